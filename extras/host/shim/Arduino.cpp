@@ -0,0 +1,206 @@
+/********************************************************************************************************
+ *  [FILE NAME]   :      <Arduino.cpp>                                                                  *
+ *  [AUTHOR]      :      <David S. Alexander>                                                           *
+ *  [DATE CREATED]:      <Dec 10, 2025>                                                                 *
+ *  [Description] :      <Minimal Arduino API for the host-native build>                                *
+ ********************************************************************************************************/
+
+#include <Arduino.h>
+#include <new>
+#include <time.h>
+#include "STM32HostClock.h"
+
+static uint64_t s_nowNs = 0;
+static uint64_t s_yieldStepNs = 100000;
+static uint64_t s_yields = 0;
+static STM32HostDevice* s_dev = nullptr;
+static bool s_profiling = false;
+static uint64_t s_deviceCpuNs = 0;
+static int s_scopeDepth = 0;
+static uint8_t s_pins[64];
+
+static uint64_t s_allocCount = 0;
+static uint64_t s_allocBytes = 0;
+
+/* ---------------------------------------------------------------- clock */
+
+uint64_t STM32HostClock::nowNs() { return s_nowNs; }
+
+void STM32HostClock::advanceTo(uint64_t ns)
+{
+	if (ns < s_nowNs) return;
+	if (s_dev)
+	{
+		STM32HostDeviceScope scope;
+		s_dev->advanceTo(ns);
+	}
+	s_nowNs = ns;
+}
+
+void STM32HostClock::advance(uint64_t ns) { advanceTo(s_nowNs + ns); }
+
+void STM32HostClock::attach(STM32HostDevice* dev) { s_dev = dev; }
+STM32HostDevice* STM32HostClock::device() { return s_dev; }
+
+void STM32HostClock::setYieldStepNs(uint64_t ns) { s_yieldStepNs = ns ? ns : 1; }
+uint64_t STM32HostClock::yields() { return s_yields; }
+
+void STM32HostClock::yieldOnce()
+{
+	s_yields++;
+	uint64_t next = s_nowNs + s_yieldStepNs;
+	if (s_dev)
+	{
+		uint64_t ev = s_dev->nextEventNs();
+		if (ev > s_nowNs && ev < next) next = ev;
+	}
+	advanceTo(next);
+}
+
+void STM32HostClock::setProfiling(bool on) { s_profiling = on; }
+uint64_t STM32HostClock::deviceCpuNs() { return s_deviceCpuNs; }
+
+uint64_t STM32HostClock::cpuNs()
+{
+	struct timespec ts;
+	clock_gettime(CLOCK_PROCESS_CPUTIME_ID, &ts);
+	return (uint64_t)ts.tv_sec * 1000000000ULL + (uint64_t)ts.tv_nsec;
+}
+
+/* Nested scopes (port -> clock -> device) are only charged once */
+STM32HostDeviceScope::STM32HostDeviceScope() : _start(0)
+{
+	if (s_profiling && s_scopeDepth++ == 0) _start = STM32HostClock::cpuNs();
+}
+
+STM32HostDeviceScope::~STM32HostDeviceScope()
+{
+	if (s_profiling && --s_scopeDepth == 0) s_deviceCpuNs += STM32HostClock::cpuNs() - _start;
+}
+
+void STM32HostClock::reset()
+{
+	s_nowNs = 0;
+	s_yields = 0;
+	s_deviceCpuNs = 0;
+	memset(s_pins, 0, sizeof(s_pins));
+}
+
+uint32_t millis() { return (uint32_t)(s_nowNs / 1000000ULL); }
+uint32_t micros() { return (uint32_t)(s_nowNs / 1000ULL); }
+void delay(uint32_t ms) { STM32HostClock::advance((uint64_t)ms * 1000000ULL); }
+void delayMicroseconds(uint32_t us) { STM32HostClock::advance((uint64_t)us * 1000ULL); }
+void yield() { STM32HostClock::yieldOnce(); }
+
+/* ---------------------------------------------------------------- pins */
+
+void pinMode(uint8_t pin, uint8_t mode) { (void)pin; (void)mode; }
+
+void digitalWrite(uint8_t pin, uint8_t level)
+{
+	if (pin < sizeof(s_pins)) s_pins[pin] = level ? HIGH : LOW;
+	if (s_dev) s_dev->onPin(pin, level ? HIGH : LOW, s_nowNs);
+}
+
+int digitalRead(uint8_t pin)
+{
+	return (pin < sizeof(s_pins)) ? s_pins[pin] : LOW;
+}
+
+/* ---------------------------------------------------------------- Print / Stream */
+
+size_t Print::write(const uint8_t* data, size_t len)
+{
+	size_t n = 0;
+	while (len--)
+	{
+		if (!write(*data++)) break;
+		n++;
+	}
+	return n;
+}
+
+size_t Print::print(long v)
+{
+	char tmp[24];
+	int n = snprintf(tmp, sizeof(tmp), "%ld", v);
+	return write((const uint8_t*)tmp, (size_t)n);
+}
+
+size_t Print::print(unsigned long v)
+{
+	char tmp[24];
+	int n = snprintf(tmp, sizeof(tmp), "%lu", v);
+	return write((const uint8_t*)tmp, (size_t)n);
+}
+
+size_t Stream::readBytes(char* buf, size_t len)
+{
+	size_t n = 0;
+	while (n < len)
+	{
+		uint32_t start = millis();
+		while (!available())
+		{
+			if (millis() - start >= _timeout) return n;
+			yield();
+		}
+		buf[n++] = (char)read();
+	}
+	return n;
+}
+
+/* ---------------------------------------------------------------- allocation counting */
+
+extern "C" void* __real_malloc(size_t n);
+extern "C" void* __real_calloc(size_t n, size_t sz);
+extern "C" void* __real_realloc(void* p, size_t n);
+extern "C" void __real_free(void* p);
+
+extern "C" void* __wrap_malloc(size_t n)
+{
+	s_allocCount++;
+	s_allocBytes += n;
+	return __real_malloc(n);
+}
+
+extern "C" void* __wrap_calloc(size_t n, size_t sz)
+{
+	s_allocCount++;
+	s_allocBytes += n * sz;
+	return __real_calloc(n, sz);
+}
+
+extern "C" void* __wrap_realloc(void* p, size_t n)
+{
+	s_allocCount++;
+	s_allocBytes += n;
+	return __real_realloc(p, n);
+}
+
+extern "C" void __wrap_free(void* p)
+{
+	__real_free(p);
+}
+
+void* operator new(size_t n)
+{
+	void* p = __wrap_malloc(n ? n : 1);
+	if (!p) throw std::bad_alloc();
+	return p;
+}
+
+void* operator new[](size_t n) { return operator new(n); }
+void operator delete(void* p) noexcept { __real_free(p); }
+void operator delete[](void* p) noexcept { __real_free(p); }
+void operator delete(void* p, size_t) noexcept { __real_free(p); }
+void operator delete[](void* p, size_t) noexcept { __real_free(p); }
+
+uint64_t STM32HostAlloc::count() { return s_allocCount; }
+uint64_t STM32HostAlloc::bytes() { return s_allocBytes; }
+
+void STM32HostAlloc::reset()
+{
+	s_allocCount = 0;
+	s_allocBytes = 0;
+}
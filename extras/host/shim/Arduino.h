@@ -0,0 +1,82 @@
+/********************************************************************************************************
+ *  [FILE NAME]   :      <Arduino.h>                                                                    *
+ *  [AUTHOR]      :      <David S. Alexander>                                                           *
+ *  [DATE CREATED]:      <Dec 10, 2025>                                                                 *
+ *  [Description] :      <Minimal Arduino API for the host-native build>                                *
+ ********************************************************************************************************/
+
+#ifndef STM32_HOST_ARDUINO_H
+#define	STM32_HOST_ARDUINO_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+
+/* Only what the protocol, flasher and metrics layers use; the web layer is ESP8266-only */
+
+#define PROGMEM
+#define PGM_P                const char*
+#define strncpy_P            strncpy
+#define memcpy_P             memcpy
+#define pgm_read_byte(p)     (*(const uint8_t*)(p))
+#define pgm_read_ptr(p)      (*(void* const*)(p))
+#define pgm_read_dword(p)    (*(const uint32_t*)(p))
+
+#define LOW    0
+#define HIGH   1
+#define INPUT  0
+#define OUTPUT 1
+
+/* Time comes from STM32HostClock, never from the wall clock */
+uint32_t millis();
+uint32_t micros();
+void delay(uint32_t ms);
+void delayMicroseconds(uint32_t us);
+void yield();
+
+/* Pin writes are forwarded to the device attached to STM32HostClock */
+void pinMode(uint8_t pin, uint8_t mode);
+void digitalWrite(uint8_t pin, uint8_t level);
+int digitalRead(uint8_t pin);
+
+class Print
+{
+	public:
+	virtual ~Print() {}
+
+	virtual size_t write(uint8_t c) = 0;
+	virtual size_t write(const uint8_t* data, size_t len);
+	size_t write(const char* s) { return s ? write((const uint8_t*)s, strlen(s)) : 0; }
+	virtual void flush() {}
+
+	size_t print(const char* s) { return write(s); }
+	size_t print(char c) { return write((uint8_t)c); }
+	size_t print(int v) { return print((long)v); }
+	size_t print(unsigned v) { return print((unsigned long)v); }
+	size_t print(long v);
+	size_t print(unsigned long v);
+
+	size_t println() { return write((uint8_t)'\n'); }
+	size_t println(const char* s) { return print(s) + println(); }
+};
+
+class Stream : public Print
+{
+	public:
+	Stream() : _timeout(1000) {}
+
+	virtual int available() = 0;
+	virtual int read() = 0;
+	virtual int peek() = 0;
+
+	void setTimeout(unsigned long ms) { _timeout = ms; }
+	virtual size_t readBytes(char* buf, size_t len);
+	size_t readBytes(uint8_t* buf, size_t len) { return readBytes((char*)buf, len); }
+
+	protected:
+	unsigned long _timeout;
+};
+
+#endif	/* STM32_HOST_ARDUINO_H */
@@ -0,0 +1,106 @@
+/********************************************************************************************************
+ *  [FILE NAME]   :      <STM32HostClock.h>                                                             *
+ *  [AUTHOR]      :      <David S. Alexander>                                                           *
+ *  [DATE CREATED]:      <Dec 10, 2025>                                                                 *
+ *  [Description] :      <Header file for the host build virtual clock>                                 *
+ ********************************************************************************************************/
+
+#ifndef STM32_HOST_CLOCK_H
+#define	STM32_HOST_CLOCK_H
+
+#include <Arduino.h>
+
+/* Something that lives on the virtual timeline, e.g. a simulated target */
+class STM32HostDevice
+{
+	public:
+	virtual ~STM32HostDevice() {}
+
+	/* Earliest pending event, or UINT64_MAX if idle */
+	virtual uint64_t nextEventNs() const = 0;
+	/* Process everything scheduled up to and including `ns` */
+	virtual void advanceTo(uint64_t ns) = 0;
+	virtual void onPin(uint8_t pin, uint8_t level, uint64_t ns) { (void)pin; (void)level; (void)ns; }
+};
+
+/* Virtual time in nanoseconds. Nothing sleeps: delay() and yield() move the clock forward and let
+   the attached device catch up, so a 30 s erase simulates in microseconds of CPU time. */
+class STM32HostClock
+{
+	public:
+	static uint64_t nowNs();
+	static void advance(uint64_t ns);
+	static void advanceTo(uint64_t ns);
+
+	static void attach(STM32HostDevice* dev);
+	static STM32HostDevice* device();
+
+	/* Largest jump a single yield() may make when nothing is pending sooner (default 100 us) */
+	static void setYieldStepNs(uint64_t ns);
+	static void yieldOnce();
+	static uint64_t yields();
+
+	/* CPU time spent inside the attached device (simulator/replayer), so tools can subtract it */
+	static void setProfiling(bool on);
+	static uint64_t deviceCpuNs();
+	static uint64_t cpuNs();
+
+	static void reset();
+};
+
+/* Charges the CPU time of its scope to STM32HostClock::deviceCpuNs() when profiling is on */
+class STM32HostDeviceScope
+{
+	public:
+	STM32HostDeviceScope();
+	~STM32HostDeviceScope();
+
+	private:
+	uint64_t _start;
+};
+
+/* Allocation counters for the host build. operator new/delete are replaced and malloc/calloc/
+   realloc/free are wrapped at link time (-Wl,--wrap), so calls from library code are counted. */
+class STM32HostAlloc
+{
+	public:
+	static uint64_t count();
+	static uint64_t bytes();
+	static void reset();
+};
+
+/* Read-only Stream over a memory buffer; stands in for a LittleFS File.
+   Each readBytes() call can be charged a fixed plus per-byte cost on the virtual clock. */
+class STM32HostBufferStream : public Stream
+{
+	public:
+	STM32HostBufferStream(const uint8_t* data, size_t len) : _data(data), _len(len), _pos(0), _callNs(0), _byteNs(0) {}
+
+	void setReadCost(uint32_t callNs, uint32_t byteNs) { _callNs = callNs; _byteNs = byteNs; }
+
+	int available() override { return (int)(_len - _pos); }
+	int read() override { return (_pos < _len) ? _data[_pos++] : -1; }
+	int peek() override { return (_pos < _len) ? _data[_pos] : -1; }
+	size_t write(uint8_t) override { return 0; }
+	using Stream::readBytes;
+
+	size_t readBytes(char* buf, size_t len) override
+	{
+		if (len > _len - _pos) len = _len - _pos;
+		memcpy(buf, _data + _pos, len);
+		_pos += len;
+		if (_callNs || _byteNs) STM32HostClock::advance(_callNs + (uint64_t)_byteNs * len);
+		return len;
+	}
+
+	void rewind() { _pos = 0; }
+
+	private:
+	const uint8_t* _data;
+	size_t _len;
+	size_t _pos;
+	uint32_t _callNs;
+	uint32_t _byteNs;
+};
+
+#endif	/* STM32_HOST_CLOCK_H */
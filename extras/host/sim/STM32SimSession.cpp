@@ -0,0 +1,198 @@
+/********************************************************************************************************
+ *  [FILE NAME]   :      <STM32SimSession.cpp>                                                          *
+ *  [AUTHOR]      :      <David S. Alexander>                                                           *
+ *  [DATE CREATED]:      <Dec 10, 2025>                                                                 *
+ *  [Description] :      <Source file for a measured detect/erase/program/verify session>               *
+ ********************************************************************************************************/
+
+#include "STM32SimSession.h"
+
+static const char* const STEP_NAMES[STM32_STEP_COUNT] = { "detect", "erase", "program", "verify", "run" };
+
+/* Roughly the size of the built extras/stub binaries */
+static const size_t STUB_IMAGE_BYTES = 768;
+
+class StepMeter
+{
+	public:
+	StepMeter(STM32SessionStepResult& r, const STM32FlasherMetrics& m)
+	: _r(&r),
+	_m(&m),
+	_sim(STM32HostClock::nowNs()),
+	_cpu(STM32HostClock::cpuNs()),
+	_dev(STM32HostClock::deviceCpuNs()),
+	_allocs(STM32HostAlloc::count()),
+	_fsRead(m.phase[STM32_PHASE_FS_READ].sumUs)
+	{}
+
+	void done(bool ok)
+	{
+		_r->ran = true;
+		_r->ok = ok;
+		_r->simNs = STM32HostClock::nowNs() - _sim;
+		_r->cpuNs = STM32HostClock::cpuNs() - _cpu;
+		_r->deviceCpuNs = STM32HostClock::deviceCpuNs() - _dev;
+		_r->allocs = STM32HostAlloc::count() - _allocs;
+		_r->fsReadUs = _m->phase[STM32_PHASE_FS_READ].sumUs - _fsRead;
+	}
+
+	private:
+	STM32SessionStepResult* _r;
+	const STM32FlasherMetrics* _m;
+	uint64_t _sim;
+	uint64_t _cpu;
+	uint64_t _dev;
+	uint64_t _allocs;
+	uint64_t _fsRead;
+};
+
+STM32SimSession::STM32SimSession() : written(0), ok(false), totalNs(0), flashStart(0), ramAddr(0)
+{
+	memset(step, 0, sizeof(step));
+	desc[0] = '\0';
+	uid[0] = '\0';
+}
+
+const char* STM32SimSession::stepName(STM32SessionStep s)
+{
+	return (s < STM32_STEP_COUNT) ? STEP_NAMES[s] : "";
+}
+
+void STM32SimSession::makeImage(std::vector<uint8_t>& image, size_t len, uint32_t seed)
+{
+	uint32_t x = 0x12345678u ^ seed;
+	image.resize(len);
+	for (size_t i = 0; i < len; i++)
+	{
+		x = x * 1664525u + 1013904223u;
+		image[i] = (uint8_t)(x >> 24);
+	}
+}
+
+void STM32SimSession::makeRamImage(std::vector<uint8_t>& image, size_t len, uint32_t addr, uint32_t seed)
+{
+	makeImage(image, (len < 8) ? 8 : len, seed);
+	STM32StubCodec::put32(&image[0], 0xFFFFFFFFUL);
+	STM32StubCodec::put32(&image[4], (addr + (uint32_t)(image.size() / 2)) | 1u);
+}
+
+void STM32SimSession::makeFlashImage(std::vector<uint8_t>& image, size_t len, const STM32FamilyInfo& fi, uint32_t seed)
+{
+	makeImage(image, (len < 8) ? 8 : len, seed);
+	STM32StubCodec::put32(&image[0], 0x20000000UL + (fi.sramKb ? fi.sramKb : 4u) * 1024UL);
+	STM32StubCodec::put32(&image[4], (fi.flashStart + (uint32_t)(image.size() / 2)) | 1u);
+}
+
+bool STM32SimSession::makeStubImage(std::vector<uint8_t>& data, STM32Family family, STM32StubImage& image)
+{
+	uint32_t loadAddr;
+	switch (family)
+	{
+		case STM32_F1: loadAddr = 0x20000800UL; break;
+		case STM32_F4: loadAddr = 0x20003000UL; break;
+		default: return false;
+	}
+
+	/* Thumb NOPs after the header; the simulator only looks at the header */
+	data.assign(STUB_IMAGE_BYTES, 0x00);
+	for (size_t i = STM32_STUB_HEADER_LEN; i + 1 < data.size(); i += 2)
+	{
+		data[i] = 0x00;
+		data[i + 1] = 0xBF;
+	}
+	/* Initial SP at the end of the 8 KB extras/stub/Makefile gives each stub (RAM_SIZE) */
+	STM32StubCodec::put32(&data[0], loadAddr + 0x2000);
+	STM32StubCodec::put32(&data[4], (loadAddr + STM32_STUB_HEADER_LEN) | 1u);
+	STM32StubCodec::put32(&data[8], STM32_STUB_MAGIC);
+	data[12] = STM32_STUB_VERSION;
+	data[13] = STM32_STUB_CAP_RLE;
+	data[14] = STM32_STUB_WINDOW;
+	STM32StubCodec::put16(&data[16], (uint16_t)STM32_STUB_BLOCK);
+
+	image.family = family;
+	image.loadAddr = loadAddr;
+	image.data = data.data();
+	image.len = (uint16_t)data.size();
+	return true;
+}
+
+bool STM32SimSession::run(Stream& port, const uint8_t* image, size_t len, const STM32SessionOptions& opt)
+{
+	uint64_t start = STM32HostClock::nowNs();
+
+	STM32RomFlasher flasher(STM32StreamTransport(port, opt.spi), opt.boot0Pin, opt.resetPin);
+	flasher.setMetrics(&metrics);
+	flasher.bootloader().setTracer(opt.tracer);
+	flasher.beginPins();
+	metrics.observer = &telemetry;
+	telemetry.beginJob(opt.runRam ? 'X' : 'S', metrics);
+
+	StepMeter detect(step[STM32_STEP_DETECT], metrics);
+	ok = flasher.detect(res);
+	detect.done(ok);
+	snprintf(desc, sizeof(desc), "%s", flasher.desc());
+	for (size_t i = 0; flasher.uid() && i < STM32_UID_LEN; i++) snprintf(uid + 2 * i, 3, "%02x", flasher.uid()[i]);
+	flashStart = flasher.flashStart();
+
+	std::vector<uint8_t> stubData;
+	STM32StubImage stub;
+	if (ok && opt.stub && makeStubImage(stubData, flasher.familyInfo().family, stub))
+	{
+		flasher.setStubImage(&stub);
+		flasher.setStubEnabled(true);
+	}
+
+	if (ok && opt.runRam)
+	{
+		STM32HostBufferStream src(image, len);
+		src.setReadCost(opt.fsCallNs, opt.fsByteNs);
+		ramAddr = opt.ramAddr;
+		StepMeter m(step[STM32_STEP_RUN], metrics);
+		ok = flasher.runFromRam(src, len, ramAddr, res);
+		m.done(ok);
+		if (ok) written = len;
+		telemetry.endJob(ok, metrics);
+		totalNs = STM32HostClock::nowNs() - start;
+		return ok;
+	}
+
+	if (ok && opt.preflight)
+	{
+		STM32ImageInfo info;
+		info.set(image, (uint32_t)len);
+		if (!STM32ImagePreflight::analyze(info, flasher.familyInfo(), flasher.flashKb(), flasher.flashStart(), opt.linkBytesPerSec, preflight))
+		{
+			ok = res.fail(STM32_ERR_BAD_ARG, STM32_RO_PREFLIGHT, STM32_ST_NONE);
+		}
+	}
+
+	if (ok && opt.erase)
+	{
+		StepMeter m(step[STM32_STEP_ERASE], metrics);
+		ok = flasher.massErase(res);
+		m.done(ok);
+	}
+
+	if (ok)
+	{
+		STM32HostBufferStream src(image, len);
+		src.setReadCost(opt.fsCallNs, opt.fsByteNs);
+		StepMeter m(step[STM32_STEP_PROGRAM], metrics);
+		ok = flasher.programStream(src, flasher.flashStart(), written, res);
+		m.done(ok);
+	}
+
+	if (ok && opt.verify)
+	{
+		STM32HostBufferStream src(image, len);
+		src.setReadCost(opt.fsCallNs, opt.fsByteNs);
+		size_t verified = 0;
+		StepMeter m(step[STM32_STEP_VERIFY], metrics);
+		ok = flasher.verifyStream(src, flasher.flashStart(), verified, res);
+		m.done(ok);
+	}
+
+	telemetry.endJob(ok, metrics);
+	totalNs = STM32HostClock::nowNs() - start;
+	return ok;
+}
@@ -0,0 +1,111 @@
+/********************************************************************************************************
+ *  [FILE NAME]   :      <STM32SimSession.h>                                                            *
+ *  [AUTHOR]      :      <David S. Alexander>                                                           *
+ *  [DATE CREATED]:      <Dec 10, 2025>                                                                 *
+ *  [Description] :      <Header file for a measured detect/erase/program/verify session>               *
+ ********************************************************************************************************/
+
+#ifndef STM32_SIM_SESSION_H
+#define	STM32_SIM_SESSION_H
+
+#include <Arduino.h>
+#include <vector>
+#include "STM32HostClock.h"
+#include "STM32RomFlasher.h"
+#include "STM32ImagePreflight.h"
+#include "STM32Telemetry.h"
+
+enum STM32SessionStep
+{
+	STM32_STEP_DETECT,
+	STM32_STEP_ERASE,
+	STM32_STEP_PROGRAM,
+	STM32_STEP_VERIFY,
+	STM32_STEP_RUN,
+	STM32_STEP_COUNT
+};
+
+struct STM32SessionStepResult
+{
+	bool ran;
+	bool ok;
+	uint64_t simNs;
+	uint64_t cpuNs;
+	uint64_t deviceCpuNs;
+	uint64_t allocs;
+	/* Time the flasher spent reading the image source (STM32_PHASE_FS_READ) */
+	uint64_t fsReadUs;
+};
+
+struct STM32SessionOptions
+{
+	uint8_t boot0Pin;
+	uint8_t resetPin;
+	bool erase;
+	bool verify;
+
+	/* Simulated LittleFS read cost per readBytes() call and per byte */
+	uint32_t fsCallNs;
+	uint32_t fsByteNs;
+
+	/* Program through a synthetic loader stub image (see makeStubImage) */
+	bool stub;
+
+	/* Load the image into SRAM at ramAddr (0 = start of the free region) and GO instead of
+	   erase/program/verify; the image needs a vector table, see makeRamImage */
+	bool runRam;
+	uint32_t ramAddr;
+
+	/* Run STM32ImagePreflight after detect and stop before erasing on a no-go; the estimate uses
+	   linkBytesPerSec (0 leaves the link out) */
+	bool preflight;
+	uint32_t linkBytesPerSec;
+
+	/* Attached to the bootloader for the whole session when set */
+	STM32FrameTracer* tracer;
+
+	/* The port is an SPI slave (STM32SimConfig::spiHz): use AN4286 framing */
+	bool spi;
+
+	STM32SessionOptions() : boot0Pin(4), resetPin(5), erase(true), verify(true), fsCallNs(0), fsByteNs(0), stub(false), runRam(false), ramAddr(0), preflight(false), linkBytesPerSec(0), tracer(nullptr), spi(false) {}
+};
+
+/* Runs the same sequence as the web UI's Full Update plus Verify, or its Run in RAM, against whatever device is
+   attached to STM32HostClock, and records virtual time, CPU time and allocations per step. */
+class STM32SimSession
+{
+	public:
+	STM32SimSession();
+
+	bool run(Stream& port, const uint8_t* image, size_t len, const STM32SessionOptions& opt);
+
+	static const char* stepName(STM32SessionStep step);
+	/* Deterministic pseudo-random image so recorded traces can be replayed */
+	static void makeImage(std::vector<uint8_t>& image, size_t len, uint32_t seed);
+	/* Stub image with a valid header and filler the size of the real one, at the load address
+	   extras/stub uses for the family; false if there is no stub for it */
+	static bool makeStubImage(std::vector<uint8_t>& data, STM32Family family, STM32StubImage& image);
+	/* makeImage() data behind a vector table for a RAM image at addr; the initial SP is left
+	   0xFFFFFFFF, as in an image linked without a stack, for the flasher to patch */
+	static void makeRamImage(std::vector<uint8_t>& image, size_t len, uint32_t addr, uint32_t seed);
+	/* makeImage() data behind a vector table that passes the preflight checks for `fi`: SP at the
+	   top of its SRAM, reset handler inside the image */
+	static void makeFlashImage(std::vector<uint8_t>& image, size_t len, const STM32FamilyInfo& fi, uint32_t seed);
+
+	STM32SessionStepResult step[STM32_STEP_COUNT];
+	STM32FlasherMetrics metrics;
+	/* The whole session as one job, as the web UI's telemetry panel would see a Full Update */
+	STM32Telemetry telemetry;
+	STM32RomResult res;
+	size_t written;
+	bool ok;
+	uint64_t totalNs;
+	char desc[64];
+	/* Unique ID read by detect() as hex, empty if it was not readable */
+	char uid[STM32_UID_LEN * 2 + 1];
+	uint32_t flashStart;
+	uint32_t ramAddr;
+	STM32Preflight preflight;
+};
+
+#endif	/* STM32_SIM_SESSION_H */
@@ -0,0 +1,920 @@
+/********************************************************************************************************
+ *  [FILE NAME]   :      <STM32SimTarget.cpp>                                                           *
+ *  [AUTHOR]      :      <David S. Alexander>                                                           *
+ *  [DATE CREATED]:      <Dec 10, 2025>                                                                 *
+ *  [Description] :      <Source file for the simulated STM32 ROM bootloader target>                    *
+ ********************************************************************************************************/
+
+#include "STM32SimTarget.h"
+#include <limits.h>
+
+static const uint32_t RAM_START = 0x20000000UL;
+static const size_t RING_SLOTS = 4096;
+/* What the SPI bootloader shifts out while it has nothing to send */
+static const uint8_t SPI_IDLE = 0xA5;
+
+static uint64_t byteNs(const STM32SimConfig& cfg)
+{
+	if (cfg.spiHz) return (8000000000ULL + cfg.spiHz / 2) / cfg.spiHz;
+	return ((uint64_t)cfg.bitsPerByte * 1000000000ULL + cfg.baud / 2) / (cfg.baud ? cfg.baud : 1) + cfg.byteGapNs;
+}
+
+static const uint8_t BASE_CMDS[] =
+{
+	STM32_CMD_GET, STM32_CMD_GET_VER, STM32_CMD_GET_ID, STM32_CMD_READ, STM32_CMD_GO, STM32_CMD_WRITE
+};
+
+/* Write/readout protect commands are listed by GET like on real parts but answered with NACK */
+static const uint8_t PROTECT_CMDS[] = { 0x63, 0x73, 0x82, 0x92 };
+
+bool STM32SimTarget::Ring::push(uint64_t ns, uint8_t b)
+{
+	if (count == slots.size()) return false;
+	Slot& s = slots[(head + count) % slots.size()];
+	s.ns = ns;
+	s.b = b;
+	count++;
+	return true;
+}
+
+static STM32FamilyInfo simFamily(const STM32SimConfig& cfg)
+{
+	STM32FamilyInfo fi = STM32FamilyDb::getFamilyInfo(cfg.devId);
+	if (cfg.flashKb) fi.FlashSize = cfg.flashKb;
+	return fi;
+}
+
+STM32SimTarget::STM32SimTarget(const STM32SimConfig& cfg)
+: _cfg(cfg),
+_fi(simFamily(cfg)),
+_geo(STM32FamilyDb::getFlashGeometry(_fi, _fi.FlashSize)),
+_port(*this),
+_spiPort(*this),
+_flash((size_t)_fi.FlashSize * 1024u, 0xFF),
+_ram(cfg.ramSize, 0x00),
+_eraseCounts(STM32FamilyDb::eraseUnitCount(_geo, (uint32_t)_fi.FlashSize * 1024u), 0),
+_in(RING_SLOTS),
+_out(RING_SLOTS),
+_inLineFree(0),
+_outLineFree(0),
+_byteNs(byteNs(cfg)),
+_mode(MODE_APP),
+_state(ST_SYNC),
+_readyAt(0),
+_boot0(LOW),
+_resetLevel(HIGH),
+_rng(cfg.seed ? cfg.seed : 1),
+_trace(nullptr),
+_frameLen(0),
+_addr(0),
+_spiSof(false),
+_stubState(STUB_HUNT),
+_stubSeq(0),
+_stubWindow(1),
+_stubBlock(0),
+_stubLastRxNs(0),
+_stubBusyUntil(0),
+_ramSp(0),
+_ramEntry(0)
+{
+	memset(&_stats, 0, sizeof(_stats));
+}
+
+Stream& STM32SimTarget::port() { return _cfg.spiHz ? (Stream&)_spiPort : (Stream&)_port; }
+const STM32SimConfig& STM32SimTarget::config() const { return _cfg; }
+const STM32FamilyInfo& STM32SimTarget::family() const { return _fi; }
+const STM32FlashGeometry& STM32SimTarget::geometry() const { return _geo; }
+const STM32SimStats& STM32SimTarget::stats() const { return _stats; }
+void STM32SimTarget::resetStats() { memset(&_stats, 0, sizeof(_stats)); }
+uint8_t* STM32SimTarget::flash() { return _flash.data(); }
+uint32_t STM32SimTarget::flashSize() const { return (uint32_t)_flash.size(); }
+bool STM32SimTarget::inBootloader() const { return _mode == MODE_BOOT; }
+bool STM32SimTarget::inStub() const { return _mode == MODE_STUB; }
+const uint8_t* STM32SimTarget::ram() const { return _ram.data(); }
+void STM32SimTarget::setTrace(STM32TraceSink* sink) { _trace = sink; }
+
+bool STM32SimTarget::inRamImage(uint32_t& sp, uint32_t& entry) const
+{
+	sp = _ramSp;
+	entry = _ramEntry;
+	return _mode == MODE_RAM;
+}
+
+uint32_t STM32SimTarget::eraseCount(uint32_t unit) const
+{
+	return (unit < _eraseCounts.size()) ? _eraseCounts[unit] : 0;
+}
+
+void STM32SimTarget::fillFlash(uint8_t value)
+{
+	memset(_flash.data(), value, _flash.size());
+}
+
+bool STM32SimTarget::chance(uint16_t permille)
+{
+	if (permille == 0) return false;
+	_rng ^= _rng << 13;
+	_rng ^= _rng >> 17;
+	_rng ^= _rng << 5;
+	return (_rng % 1000u) < permille;
+}
+
+/* ---------------------------------------------------------------- timeline */
+
+uint64_t STM32SimTarget::nextEventNs() const
+{
+	uint64_t now = STM32HostClock::nowNs();
+	uint64_t next = stubIdleAt();
+	if (_in.count && _in.front().ns < next) next = _in.front().ns;
+	for (size_t i = 0; i < _out.count; i++)
+	{
+		uint64_t t = _out.at(i).ns;
+		if (t > now)
+		{
+			if (t < next) next = t;
+			break;
+		}
+	}
+	return next;
+}
+
+void STM32SimTarget::advanceTo(uint64_t ns)
+{
+	while (true)
+	{
+		uint64_t idle = stubIdleAt();
+		bool byte = _in.count && _in.front().ns <= ns;
+		if (idle <= ns && (!byte || idle < _in.front().ns))
+		{
+			stubIdle(idle);
+			continue;
+		}
+		if (!byte) break;
+
+		Slot s = _in.front();
+		_in.pop();
+		rxByte(s.b, s.ns);
+	}
+}
+
+void STM32SimTarget::onPin(uint8_t pin, uint8_t level, uint64_t ns)
+{
+	if (pin == _cfg.boot0Pin) _boot0 = level;
+	if (pin != _cfg.resetPin) return;
+
+	if (level == LOW)
+	{
+		_mode = MODE_RESET;
+		_out.clear();
+	}
+	else if (_resetLevel == LOW)
+	{
+		_stats.resets++;
+		_mode = (_boot0 == HIGH) ? MODE_BOOT : MODE_APP;
+		_state = ST_SYNC;
+		_frameLen = 0;
+		_spiSof = false;
+		_readyAt = ns + _cfg.bootDelayNs;
+	}
+	_resetLevel = level;
+}
+
+/* ---------------------------------------------------------------- line */
+
+void STM32SimTarget::hostByte(uint8_t b, uint64_t now)
+{
+	uint64_t fifoNs = (uint64_t)_cfg.txFifoBytes * _byteNs;
+	if (_inLineFree > now + fifoNs)
+	{
+		/* TX FIFO full: the caller blocks until there is room */
+		STM32HostClock::advanceTo(_inLineFree - fifoNs);
+		now = STM32HostClock::nowNs();
+	}
+
+	uint64_t t = ((_inLineFree > now) ? _inLineFree : now) + _byteNs;
+	_inLineFree = t;
+	if (_trace) _trace->onByte(STM32_TRACE_TX, b, now);
+
+	if (chance(_cfg.dropRxPermille))
+	{
+		_stats.faultsInjected++;
+		return;
+	}
+	if (chance(_cfg.corruptRxPermille))
+	{
+		_stats.faultsInjected++;
+		b ^= (uint8_t)(1u << (_rng & 7));
+	}
+	_in.push(t, b);
+}
+
+void STM32SimTarget::reply(uint8_t b, uint64_t readyNs)
+{
+	uint64_t t = ((_outLineFree > readyNs) ? _outLineFree : readyNs) + _byteNs;
+	_outLineFree = t;
+	if (chance(_cfg.dropTxPermille))
+	{
+		_stats.faultsInjected++;
+		return;
+	}
+	if (_out.push(t, b)) _stats.bytesToHost++;
+}
+
+void STM32SimTarget::ack(uint64_t readyNs, bool ok)
+{
+	if (!ok) _stats.nacksSent++;
+	reply(ok ? STM32_ACK : STM32_NACK, readyNs);
+	/* AN4286: the host answers every ACK/NACK with an ACK of its own, clocking in filler meanwhile */
+	if (_cfg.spiHz) reply(SPI_IDLE, readyNs);
+}
+
+void STM32SimTarget::dataLead(uint64_t readyNs)
+{
+	/* AN4286: a dummy byte goes ahead of the data the target returns */
+	if (_cfg.spiHz) reply(SPI_IDLE, readyNs);
+}
+
+uint8_t STM32SimTarget::spiTransfer(uint8_t mosi)
+{
+	uint64_t now;
+	uint8_t miso = SPI_IDLE;
+	{
+		STM32HostDeviceScope scope;
+		now = STM32HostClock::nowNs();
+		/* While the target has something queued it is talking, and MOSI only carries the host's
+		   dummies and its ACK of the target's ACK */
+		bool talking = _out.count > 0;
+		if (talking && _out.front().ns <= now)
+		{
+			miso = _out.front().b;
+			_out.pop();
+			if (_trace) _trace->onByte(STM32_TRACE_RX, miso, now);
+		}
+		if (!talking)
+		{
+			_stats.bytesFromHost++;
+			if (_trace) _trace->onByte(STM32_TRACE_TX, mosi, now);
+			rxByte(mosi, now + _byteNs);
+		}
+	}
+	STM32HostClock::advance(_byteNs);
+	return miso;
+}
+
+int STM32SimTarget::Port::available()
+{
+	STM32HostDeviceScope scope;
+	uint64_t now = STM32HostClock::nowNs();
+	int n = 0;
+	while ((size_t)n < _t->_out.count && _t->_out.at((size_t)n).ns <= now) n++;
+	return n;
+}
+
+int STM32SimTarget::Port::read()
+{
+	STM32HostDeviceScope scope;
+	if (!available()) return -1;
+	Slot s = _t->_out.front();
+	_t->_out.pop();
+	if (_t->_trace) _t->_trace->onByte(STM32_TRACE_RX, s.b, s.ns);
+	return s.b;
+}
+
+int STM32SimTarget::Port::peek()
+{
+	return available() ? _t->_out.front().b : -1;
+}
+
+size_t STM32SimTarget::Port::write(uint8_t c)
+{
+	STM32HostDeviceScope scope;
+	_t->_stats.bytesFromHost++;
+	_t->hostByte(c, STM32HostClock::nowNs());
+	return 1;
+}
+
+size_t STM32SimTarget::Port::write(const uint8_t* data, size_t len)
+{
+	for (size_t i = 0; i < len; i++) write(data[i]);
+	return len;
+}
+
+void STM32SimTarget::Port::flush()
+{
+	STM32HostClock::advanceTo(_t->_inLineFree);
+}
+
+int STM32SimTarget::SpiPort::available()
+{
+	return INT_MAX;
+}
+
+int STM32SimTarget::SpiPort::read()
+{
+	return _t->spiTransfer(STM32_SPI_DUMMY);
+}
+
+int STM32SimTarget::SpiPort::peek()
+{
+	/* Seeing the next byte means clocking it */
+	return -1;
+}
+
+size_t STM32SimTarget::SpiPort::write(uint8_t c)
+{
+	_t->spiTransfer(c);
+	return 1;
+}
+
+size_t STM32SimTarget::SpiPort::write(const uint8_t* data, size_t len)
+{
+	for (size_t i = 0; i < len; i++) _t->spiTransfer(data[i]);
+	return len;
+}
+
+/* ---------------------------------------------------------------- memory model */
+
+bool STM32SimTarget::flashRange(uint32_t addr, size_t len) const
+{
+	return addr >= _fi.flashStart && (uint64_t)(addr - _fi.flashStart) + len <= _flash.size();
+}
+
+bool STM32SimTarget::ramRange(uint32_t addr, size_t len) const
+{
+	return addr >= RAM_START && (uint64_t)(addr - RAM_START) + len <= _ram.size();
+}
+
+bool STM32SimTarget::readMem(uint32_t addr, uint8_t* out, size_t len) const
+{
+	if (flashRange(addr, len))
+	{
+		memcpy(out, &_flash[addr - _fi.flashStart], len);
+		return true;
+	}
+	if (ramRange(addr, len))
+	{
+		memcpy(out, &_ram[addr - RAM_START], len);
+		return true;
+	}
+	if (addr >= _fi.flashSizeAddr && (uint64_t)(addr - _fi.flashSizeAddr) + len <= 2)
+	{
+		uint8_t kb[2] = { (uint8_t)(_fi.FlashSize & 0xFF), (uint8_t)(_fi.FlashSize >> 8) };
+		memcpy(out, kb + (addr - _fi.flashSizeAddr), len);
+		return true;
+	}
+	/* A fixed ID per device ID, so records keyed by it match from run to run. Bytes 8-11 sit at the
+	   family's third-word offset; on L0/L1 the bytes in between read as other factory data (zero here). */
+	uint32_t uidAddr = STM32FamilyDb::getUidAddr(_fi.family);
+	uint32_t word2 = STM32FamilyDb::getUidWord2Offset(_fi.family);
+	if (uidAddr && addr >= uidAddr && (uint64_t)(addr - uidAddr) + len <= word2 + 4)
+	{
+		for (size_t i = 0; i < len; i++)
+		{
+			uint32_t off = addr - uidAddr + (uint32_t)i;
+			if (off >= 8 && off < word2) out[i] = 0;
+			else out[i] = (uint8_t)(_cfg.devId * 31u + ((off < 8) ? off : off - word2 + 8) * 17u);
+		}
+		return true;
+	}
+	return false;
+}
+
+bool STM32SimTarget::writeMem(uint32_t addr, const uint8_t* data, size_t len, uint64_t& busyNs)
+{
+	busyNs = 0;
+	if (ramRange(addr, len))
+	{
+		memcpy(&_ram[addr - RAM_START], data, len);
+		return true;
+	}
+	if (!flashRange(addr, len)) return false;
+
+	uint32_t unit = _geo.programUnit ? _geo.programUnit : 1;
+	if ((addr - _fi.flashStart) % unit || len % unit)
+	{
+		_stats.unalignedWrites++;
+		return false;
+	}
+
+	uint8_t* dst = &_flash[addr - _fi.flashStart];
+	if (_cfg.strictProgram)
+	{
+		for (size_t i = 0; i < len; i++)
+		{
+			if (dst[i] != 0xFF)
+			{
+				_stats.programErrors++;
+				return false;
+			}
+		}
+	}
+	for (size_t i = 0; i < len; i++) dst[i] &= data[i];
+
+	uint32_t first = (addr - _fi.flashStart) / unit;
+	uint32_t last = (uint32_t)(addr - _fi.flashStart + len - 1) / unit;
+	busyNs = (uint64_t)(last - first + 1) * _geo.programUs * 1000ULL;
+	_stats.bytesProgrammed += (uint32_t)len;
+	return true;
+}
+
+bool STM32SimTarget::unitIndex(uint16_t number, uint16_t& index) const
+{
+	uint32_t flashBytes = (uint32_t)_flash.size();
+	for (size_t i = 0; i < _eraseCounts.size(); i++)
+	{
+		if (STM32FamilyDb::eraseUnitNumber(_geo, flashBytes, (uint32_t)i) != number) continue;
+		index = (uint16_t)i;
+		return true;
+	}
+	return false;
+}
+
+bool STM32SimTarget::eraseUnits(const uint16_t* units, size_t n, uint64_t& busyNs)
+{
+	busyNs = 0;
+	for (size_t i = 0; i < n; i++)
+	{
+		uint32_t offset, size;
+		if (!STM32FamilyDb::eraseUnit(_geo, (uint32_t)_flash.size(), units[i], offset, size)) return false;
+		memset(&_flash[offset], 0xFF, size);
+		_eraseCounts[units[i]]++;
+		_stats.unitErases++;
+		busyNs += (uint64_t)STM32FamilyDb::eraseUnitMs(_geo, size) * 1000000ULL;
+	}
+	return true;
+}
+
+void STM32SimTarget::eraseAll(uint64_t& busyNs)
+{
+	memset(_flash.data(), 0xFF, _flash.size());
+	for (size_t i = 0; i < _eraseCounts.size(); i++) _eraseCounts[i]++;
+	_stats.massErases++;
+	busyNs = (uint64_t)_geo.massEraseMs * 1000000ULL;
+}
+
+/* ---------------------------------------------------------------- protocol */
+
+size_t STM32SimTarget::frameNeed() const
+{
+	switch (_state)
+	{
+		case ST_CMD:
+		case ST_READ_LEN:
+		return 2;
+		case ST_READ_ADDR:
+		case ST_WRITE_ADDR:
+		case ST_GO_ADDR:
+		return 5;
+		case ST_WRITE_DATA:
+		return (_frameLen < 1) ? 1 : (size_t)_frame[0] + 3;
+		case ST_ERASE:
+		if (_frameLen < 1) return 1;
+		return (_frame[0] == 0xFF) ? 2 : (size_t)_frame[0] + 3;
+		case ST_XERASE:
+		{
+			if (_frameLen < 2) return 2;
+			uint16_t n = (uint16_t)((_frame[0] << 8) | _frame[1]);
+			return (n >= 0xFFF0) ? 3 : 2 + 2 * ((size_t)n + 1) + 1;
+		}
+		default:
+		return 1;
+	}
+}
+
+bool STM32SimTarget::addressFrameValid(uint32_t& addr) const
+{
+	uint8_t cs = _frame[0] ^ _frame[1] ^ _frame[2] ^ _frame[3];
+	if (cs != _frame[4]) return false;
+	addr = ((uint32_t)_frame[0] << 24) | ((uint32_t)_frame[1] << 16) | ((uint32_t)_frame[2] << 8) | _frame[3];
+	uint8_t probe;
+	return readMem(addr, &probe, 1);
+}
+
+void STM32SimTarget::rxByte(uint8_t b, uint64_t ns)
+{
+	if (_mode == MODE_STUB)
+	{
+		stubByte(b, ns);
+		return;
+	}
+	if (_mode != MODE_BOOT || ns < _readyAt) return;
+
+	if (_state == ST_SYNC)
+	{
+		if (b != (_cfg.spiHz ? STM32_SPI_SOF : 0x7F)) return;
+		_stats.syncs++;
+		if (_stats.syncs <= _cfg.syncFailFirst)
+		{
+			_stats.faultsInjected++;
+			return;
+		}
+		ack(ns + _cfg.cmdTurnaroundNs, true);
+		_state = ST_CMD;
+		return;
+	}
+
+	if (_cfg.spiHz && _state == ST_CMD && _frameLen == 0)
+	{
+		/* AN4286: a command starts with a start of frame; other bytes here are the host's dummies */
+		if (!_spiSof)
+		{
+			_spiSof = (b == STM32_SPI_SOF);
+			return;
+		}
+		_spiSof = false;
+	}
+
+	if (_frameLen >= sizeof(_frame))
+	{
+		_frameLen = 0;
+		_state = ST_CMD;
+		ack(ns + _cfg.cmdTurnaroundNs, false);
+		return;
+	}
+
+	_frame[_frameLen++] = b;
+	if (_frameLen == frameNeed()) frameDone(ns);
+}
+
+void STM32SimTarget::frameDone(uint64_t ns)
+{
+	uint64_t ready = ns + _cfg.cmdTurnaroundNs;
+	State state = _state;
+	_frameLen = 0;
+	_state = ST_CMD;
+
+	switch (state)
+	{
+		case ST_CMD:
+		{
+			uint8_t cmd = _frame[0];
+			if (_frame[1] != (uint8_t)(cmd ^ 0xFF)) { ack(ready, false); return; }
+
+			_stats.commands++;
+			if (_cfg.hangAfterCmds && _stats.commands > _cfg.hangAfterCmds)
+			{
+				_mode = MODE_HUNG;
+				return;
+			}
+			if (chance(_cfg.nackPermille))
+			{
+				_stats.faultsInjected++;
+				ack(ready, false);
+				return;
+			}
+
+			switch (cmd)
+			{
+				case STM32_CMD_GET:
+				ack(ready, true);
+				dataLead(ready);
+				reply((uint8_t)(sizeof(BASE_CMDS) + 1 + sizeof(PROTECT_CMDS)), ready);
+				reply(_cfg.blVersion, ready);
+				for (size_t i = 0; i < sizeof(BASE_CMDS); i++) reply(BASE_CMDS[i], ready);
+				reply(_fi.eraseCmd, ready);
+				for (size_t i = 0; i < sizeof(PROTECT_CMDS); i++) reply(PROTECT_CMDS[i], ready);
+				ack(ready, true);
+				return;
+
+				case STM32_CMD_GET_VER:
+				ack(ready, true);
+				dataLead(ready);
+				reply(_cfg.blVersion, ready);
+				reply(0x00, ready);
+				reply(0x00, ready);
+				ack(ready, true);
+				return;
+
+				case STM32_CMD_GET_ID:
+				ack(ready, true);
+				dataLead(ready);
+				reply(0x01, ready);
+				reply((uint8_t)((_cfg.devId >> 8) & 0x0F), ready);
+				reply((uint8_t)(_cfg.devId & 0xFF), ready);
+				ack(ready, true);
+				return;
+
+				case STM32_CMD_READ:  _state = ST_READ_ADDR;  ack(ready, true); return;
+				case STM32_CMD_WRITE: _state = ST_WRITE_ADDR; ack(ready, true); return;
+				case STM32_CMD_GO:    _state = ST_GO_ADDR;    ack(ready, true); return;
+
+				case STM32_CMD_ERASE:
+				case STM32_CMD_XERASE:
+				if (cmd != _fi.eraseCmd) { ack(ready, false); return; }
+				_state = (cmd == STM32_CMD_ERASE) ? ST_ERASE : ST_XERASE;
+				ack(ready, true);
+				return;
+
+				default:
+				ack(ready, false);
+				return;
+			}
+		}
+
+		case ST_READ_ADDR:
+		if (!addressFrameValid(_addr)) { ack(ready, false); return; }
+		_state = ST_READ_LEN;
+		ack(ready, true);
+		return;
+
+		case ST_READ_LEN:
+		{
+			uint8_t data[256];
+			size_t len = (size_t)_frame[0] + 1;
+			if (_frame[1] != (uint8_t)(_frame[0] ^ 0xFF) || !readMem(_addr, data, len)) { ack(ready, false); return; }
+			ack(ready, true);
+			dataLead(ready);
+			for (size_t i = 0; i < len; i++) reply(data[i], ready);
+			return;
+		}
+
+		case ST_WRITE_ADDR:
+		if (!addressFrameValid(_addr) || (_addr & 3)) { ack(ready, false); return; }
+		_state = ST_WRITE_DATA;
+		ack(ready, true);
+		return;
+
+		case ST_WRITE_DATA:
+		{
+			size_t len = (size_t)_frame[0] + 1;
+			uint8_t cs = _frame[0];
+			for (size_t i = 0; i < len; i++) cs ^= _frame[1 + i];
+			if (cs != _frame[len + 1]) { ack(ready, false); return; }
+
+			uint64_t busy;
+			bool ok = writeMem(_addr, _frame + 1, len, busy);
+			ack(ready + busy, ok);
+			return;
+		}
+
+		case ST_ERASE:
+		{
+			uint64_t busy = 0;
+			if (_frame[0] == 0xFF)
+			{
+				if (_frame[1] != 0x00) { ack(ready, false); return; }
+				eraseAll(busy);
+				ack(ready + busy, true);
+				return;
+			}
+
+			size_t n = (size_t)_frame[0] + 1;
+			uint8_t cs = _frame[0];
+			uint16_t units[256];
+			for (size_t i = 0; i < n; i++)
+			{
+				cs ^= _frame[1 + i];
+				units[i] = _frame[1 + i];
+			}
+			if (cs != _frame[n + 1]) { ack(ready, false); return; }
+			bool ok = eraseUnits(units, n, busy);
+			ack(ready + busy, ok);
+			return;
+		}
+
+		case ST_XERASE:
+		{
+			uint64_t busy = 0;
+			uint16_t code = (uint16_t)((_frame[0] << 8) | _frame[1]);
+			if (code >= 0xFFF0)
+			{
+				if (_frame[2] != (uint8_t)(_frame[0] ^ _frame[1])) { ack(ready, false); return; }
+				if (code == 0xFFFF)
+				{
+					eraseAll(busy);
+					ack(ready + busy, true);
+					return;
+				}
+				if (code != 0xFFFE && code != 0xFFFD) { ack(ready, false); return; }
+
+				/* Bank erase: first or second half of the erase units */
+				uint16_t units[512];
+				size_t total = _eraseCounts.size();
+				size_t half = total / 2;
+				size_t from = (code == 0xFFFE) ? 0 : half;
+				size_t to = (code == 0xFFFE) ? half : total;
+				size_t n = 0;
+				for (size_t u = from; u < to && n < 512; u++) units[n++] = (uint16_t)u;
+				bool ok = eraseUnits(units, n, busy);
+				ack(ready + busy, ok);
+				return;
+			}
+
+			size_t n = (size_t)code + 1;
+			uint8_t cs = _frame[0] ^ _frame[1];
+			uint16_t units[550];
+			for (size_t i = 0; i < n; i++)
+			{
+				uint8_t hi = _frame[2 + 2 * i];
+				uint8_t lo = _frame[3 + 2 * i];
+				cs ^= hi ^ lo;
+				units[i] = (uint16_t)((hi << 8) | lo);
+			}
+			if (cs != _frame[2 + 2 * n]) { ack(ready, false); return; }
+			for (size_t i = 0; i < n; i++)
+			{
+				if (!unitIndex(units[i], units[i])) { ack(ready, false); return; }
+			}
+			bool ok = eraseUnits(units, n, busy);
+			ack(ready + busy, ok);
+			return;
+		}
+
+		case ST_GO_ADDR:
+		if (!addressFrameValid(_addr)) { ack(ready, false); return; }
+		ack(ready, true);
+		if (!stubHeaderAt(_addr))
+		{
+			goRam(_addr);
+			return;
+		}
+		if (_cfg.stubFail)
+		{
+			_stats.faultsInjected++;
+			_mode = MODE_HUNG;
+			return;
+		}
+		startStub(_addr, ready);
+		return;
+
+		default:
+		return;
+	}
+}
+
+void STM32SimTarget::goRam(uint32_t addr)
+{
+	_mode = MODE_APP;
+	uint8_t v[8];
+	if (!ramRange(addr, sizeof(v)) || !readMem(addr, v, sizeof(v))) return;
+
+	/* What the core does next: MSP and PC from the vector table; a bad PC faults into a lockup */
+	_ramSp = STM32StubCodec::get32(v);
+	_ramEntry = STM32StubCodec::get32(v + 4);
+	bool entryOk = (_ramEntry & 1) && ramRange(_ramEntry & ~1u, 2);
+	_mode = entryOk ? MODE_RAM : MODE_HUNG;
+	if (entryOk) _stats.ramRuns++;
+}
+
+/* ---------------------------------------------------------------- loader stub */
+
+bool STM32SimTarget::stubHeaderAt(uint32_t addr) const
+{
+	uint8_t h[STM32_STUB_HEADER_LEN];
+	return ramRange(addr, sizeof(h)) && readMem(addr, h, sizeof(h)) && STM32StubCodec::get32(h + 8) == STM32_STUB_MAGIC;
+}
+
+void STM32SimTarget::startStub(uint32_t addr, uint64_t ns)
+{
+	uint8_t h[STM32_STUB_HEADER_LEN];
+	readMem(addr, h, sizeof(h));
+
+	STM32StubHello hello;
+	hello.version = h[12];
+	hello.caps = h[13];
+	hello.window = h[14];
+	hello.block = STM32StubCodec::get16(h + 16);
+
+	/* The emulation is limited to what the host side supports */
+	_stubWindow = hello.window ? hello.window : 1;
+	_stubBlock = (hello.block <= STM32_STUB_BLOCK) ? hello.block : (uint16_t)STM32_STUB_BLOCK;
+	_stubSeq = 0;
+	_stubState = STUB_HUNT;
+	_stubBusyUntil = 0;
+	_mode = MODE_STUB;
+	_stats.stubStarts++;
+
+	uint8_t b[STM32_STUB_HELLO_LEN];
+	STM32StubCodec::writeHello(b, hello);
+	for (size_t i = 0; i < sizeof(b); i++) reply(b[i], ns + _cfg.cmdTurnaroundNs);
+}
+
+uint64_t STM32SimTarget::stubIdleAt() const
+{
+	if (_mode != MODE_STUB || _stubState == STUB_HUNT) return UINT64_MAX;
+	return _stubLastRxNs + (uint64_t)STM32_STUB_IDLE_MS * 1000000ULL;
+}
+
+void STM32SimTarget::stubIdle(uint64_t ns)
+{
+	/* A frame cut short by lost bytes is NAKed; after a NAK the line is idle again */
+	if (_stubState == STUB_FRAME)
+	{
+		stubNak(ns);
+		_stubState = STUB_HUNT;
+		return;
+	}
+	_stubState = STUB_HUNT;
+}
+
+void STM32SimTarget::stubReply(uint8_t seq, uint8_t status, uint64_t readyNs)
+{
+	reply(seq, readyNs);
+	reply(status, readyNs);
+	reply((uint8_t)(seq ^ status ^ 0xFF), readyNs);
+}
+
+void STM32SimTarget::stubNak(uint64_t readyNs)
+{
+	_stats.stubNaks++;
+	stubReply(_stubSeq, STM32_STUB_ERR_CRC, readyNs);
+	_stubState = STUB_DISCARD;
+}
+
+void STM32SimTarget::stubByte(uint8_t b, uint64_t ns)
+{
+	_stubLastRxNs = ns;
+	switch (_stubState)
+	{
+		case STUB_HUNT:
+		if (b == STM32_STUB_SOF)
+		{
+			_frameLen = 0;
+			_stubState = STUB_FRAME;
+		}
+		return;
+
+		case STUB_DISCARD:
+		return;
+
+		case STUB_FRAME:
+		break;
+	}
+
+	/* _frame holds the frame without its start byte: seq, flags, addr[4], len[2], payload, crc[4] */
+	_frame[_frameLen++] = b;
+	const size_t hdr = STM32_STUB_FRAME_HDR - 1;
+	if (_frameLen < hdr) return;
+
+	size_t plen = STM32StubCodec::get16(_frame + 6);
+	if (plen > (size_t)_stubBlock + STM32_STUB_RLE_SLACK)
+	{
+		stubNak(ns + _cfg.cmdTurnaroundNs);
+		return;
+	}
+	if (_frameLen == hdr + plen + STM32_STUB_FRAME_CRC) stubFrameDone(ns);
+}
+
+void STM32SimTarget::stubFrameDone(uint64_t ns)
+{
+	uint64_t ready = ns + _cfg.cmdTurnaroundNs;
+	_stubState = STUB_HUNT;
+
+	const size_t hdr = STM32_STUB_FRAME_HDR - 1;
+	size_t plen = STM32StubCodec::get16(_frame + 6);
+	if (STM32StubCodec::crc32(0, _frame, hdr + plen) != STM32StubCodec::get32(_frame + hdr + plen))
+	{
+		stubNak(ready);
+		return;
+	}
+
+	uint8_t seq = _frame[0];
+	if (seq != _stubSeq)
+	{
+		/* A resend of something already programmed is acknowledged again; anything else is out of order */
+		uint8_t behind = (uint8_t)(_stubSeq - seq);
+		if (behind >= 1 && behind <= _stubWindow) stubReply(seq, STM32_STUB_OK, ready);
+		else stubNak(ready);
+		return;
+	}
+
+	uint8_t data[STM32_STUB_BLOCK];
+	size_t len = plen;
+	if (_frame[1] & STM32_STUB_FLAG_RLE)
+	{
+		if (!STM32StubCodec::rleDecode(_frame + hdr, plen, data, _stubBlock, len))
+		{
+			stubReply(seq, STM32_STUB_ERR_DECODE, ready);
+			return;
+		}
+	}
+	else
+	{
+		if (plen > _stubBlock)
+		{
+			stubReply(seq, STM32_STUB_ERR_DECODE, ready);
+			return;
+		}
+		memcpy(data, _frame + hdr, plen);
+	}
+
+	uint32_t addr = STM32StubCodec::get32(_frame + 2);
+	if (!flashRange(addr, len) || (addr & 3) || (len & 3))
+	{
+		stubReply(seq, STM32_STUB_ERR_RANGE, ready);
+		return;
+	}
+
+	/* Programming overlaps reception of the next frame, but one frame at a time */
+	uint64_t busy;
+	if (!writeMem(addr, data, len, busy))
+	{
+		stubReply(seq, STM32_STUB_ERR_PROGRAM, ready);
+		return;
+	}
+	uint64_t start = (_stubBusyUntil > ready) ? _stubBusyUntil : ready;
+	_stubBusyUntil = start + busy;
+	_stubSeq++;
+	_stats.stubFrames++;
+	stubReply(seq, STM32_STUB_OK, _stubBusyUntil);
+}
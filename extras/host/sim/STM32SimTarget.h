@@ -0,0 +1,298 @@
+/********************************************************************************************************
+ *  [FILE NAME]   :      <STM32SimTarget.h>                                                             *
+ *  [AUTHOR]      :      <David S. Alexander>                                                           *
+ *  [DATE CREATED]:      <Dec 10, 2025>                                                                 *
+ *  [Description] :      <Header file for the simulated STM32 ROM bootloader target>                    *
+ ********************************************************************************************************/
+
+#ifndef STM32_SIM_TARGET_H
+#define	STM32_SIM_TARGET_H
+
+#include <Arduino.h>
+#include <vector>
+#include "STM32HostClock.h"
+#include "STM32DeviceConstants.h"
+#include "STM32FamilyDb.h"
+#include "STM32SimTrace.h"
+#include "STM32StubProtocol.h"
+
+struct STM32SimConfig
+{
+	uint16_t devId;
+	/* Flash of this part, reported in the flash size register; 0 for the family table's size */
+	uint16_t flashKb;
+
+	/* Line model: every byte takes bitsPerByte / baud on the wire (8E1 = 11 bits) plus byteGapNs */
+	uint32_t baud;
+	uint8_t bitsPerByte;
+	uint32_t byteGapNs;
+	uint16_t txFifoBytes;
+	/* Non-zero: the AN4286 SPI link clocked at spiHz replaces the UART, and the line model and the
+	   host->target faults above do not apply */
+	uint32_t spiHz;
+
+	/* Target timing: command turnaround, reset release to bootloader ready.
+	   Program and erase times come from STM32FamilyDb::getFlashGeometry(). */
+	uint32_t cmdTurnaroundNs;
+	uint32_t bootDelayNs;
+
+	uint8_t boot0Pin;
+	uint8_t resetPin;
+
+	uint8_t blVersion;
+	uint32_t ramSize;
+
+	/* NACK writes that would have to clear bits in a program unit that is not erased */
+	bool strictProgram;
+
+	/* Fault injection; rates are per mille, drawn from a PRNG seeded with `seed` */
+	uint32_t seed;
+	uint16_t dropRxPermille;
+	uint16_t dropTxPermille;
+	uint16_t corruptRxPermille;
+	uint16_t nackPermille;
+	uint16_t syncFailFirst;
+	uint32_t hangAfterCmds;
+	/* GO into a loader stub image leaves the target hung instead of starting the emulated stub */
+	bool stubFail;
+
+	STM32SimConfig()
+	: devId(0x410),
+	flashKb(0),
+	baud(115200),
+	bitsPerByte(11),
+	byteGapNs(0),
+	txFifoBytes(128),
+	spiHz(0),
+	cmdTurnaroundNs(30000),
+	bootDelayNs(1000000),
+	boot0Pin(4),
+	resetPin(5),
+	blVersion(0x31),
+	ramSize(192 * 1024),
+	strictProgram(true),
+	seed(1),
+	dropRxPermille(0),
+	dropTxPermille(0),
+	corruptRxPermille(0),
+	nackPermille(0),
+	syncFailFirst(0),
+	hangAfterCmds(0),
+	stubFail(false)
+	{}
+};
+
+struct STM32SimStats
+{
+	uint32_t resets;
+	uint32_t syncs;
+	uint32_t commands;
+	uint32_t nacksSent;
+	uint32_t bytesFromHost;
+	uint32_t bytesToHost;
+	uint32_t bytesProgrammed;
+	uint32_t programErrors;
+	/* Flash writes not starting and ending on the family's programming unit, NACKed as on H7/L4/G4 */
+	uint32_t unalignedWrites;
+	uint32_t unitErases;
+	uint32_t massErases;
+	uint32_t faultsInjected;
+	uint32_t stubStarts;
+	uint32_t stubFrames;
+	uint32_t stubNaks;
+	uint32_t ramRuns;
+};
+
+/* In-process STM32 running the AN3155 USART bootloader, or its AN4286 SPI variant when spiHz is set.
+   Attach it to STM32HostClock and hand port() to STM32RomBootloader/STM32RomFlasher in place of the
+   ESP8266 UART (wrapped in an SPI-framing STM32StreamTransport for the SPI link). GO to SRAM holding a
+   loader stub header starts an emulated stub speaking the protocol in STM32StubProtocol.h; GO to any
+   other SRAM image loads MSP and PC from its vector table and leaves the target running it. */
+class STM32SimTarget : public STM32HostDevice
+{
+	public:
+	explicit STM32SimTarget(const STM32SimConfig& cfg);
+
+	Stream& port();
+
+	const STM32SimConfig& config() const;
+	const STM32FamilyInfo& family() const;
+	const STM32FlashGeometry& geometry() const;
+	const STM32SimStats& stats() const;
+	void resetStats();
+
+	/* Flash model: erased state is 0xFF, programming can only clear bits */
+	uint8_t* flash();
+	uint32_t flashSize() const;
+	uint32_t eraseCount(uint32_t unit) const;
+	void fillFlash(uint8_t value);
+
+	bool inBootloader() const;
+	bool inStub() const;
+	/* After GO to a plain RAM image: the MSP and reset vector the core started with */
+	bool inRamImage(uint32_t& sp, uint32_t& entry) const;
+	/* SRAM model, mapped at 0x20000000 */
+	const uint8_t* ram() const;
+
+	/* Records every byte the host writes and every byte it reads back; null disables */
+	void setTrace(STM32TraceSink* sink);
+
+	uint64_t nextEventNs() const override;
+	void advanceTo(uint64_t ns) override;
+	void onPin(uint8_t pin, uint8_t level, uint64_t ns) override;
+
+	private:
+	struct Slot
+	{
+		uint64_t ns;
+		uint8_t b;
+	};
+
+	/* Fixed-capacity FIFO so the simulator does not allocate while the flasher runs */
+	struct Ring
+	{
+		std::vector<Slot> slots;
+		size_t head;
+		size_t count;
+
+		explicit Ring(size_t cap) : slots(cap), head(0), count(0) {}
+		bool push(uint64_t ns, uint8_t b);
+		const Slot& front() const { return slots[head]; }
+		const Slot& at(size_t i) const { return slots[(head + i) % slots.size()]; }
+		void pop() { head = (head + 1) % slots.size(); count--; }
+		void clear() { head = 0; count = 0; }
+	};
+
+	class Port : public Stream
+	{
+		public:
+		explicit Port(STM32SimTarget& t) : _t(&t) {}
+		int available() override;
+		int read() override;
+		int peek() override;
+		size_t write(uint8_t c) override;
+		size_t write(const uint8_t* data, size_t len) override;
+		void flush() override;
+
+		private:
+		STM32SimTarget* _t;
+	};
+
+	/* SPI slave side: every byte the host clocks out on MOSI brings one in from MISO, so reads never
+	   wait and flush() has nothing to drain */
+	class SpiPort : public Stream
+	{
+		public:
+		explicit SpiPort(STM32SimTarget& t) : _t(&t) {}
+		int available() override;
+		int read() override;
+		int peek() override;
+		size_t write(uint8_t c) override;
+		size_t write(const uint8_t* data, size_t len) override;
+		void flush() override {}
+
+		private:
+		STM32SimTarget* _t;
+	};
+
+	enum Mode
+	{
+		MODE_RESET,
+		MODE_APP,
+		MODE_BOOT,
+		MODE_STUB,
+		MODE_RAM,
+		MODE_HUNG
+	};
+
+	enum StubState
+	{
+		STUB_HUNT,		/* waiting for a start of frame */
+		STUB_FRAME,
+		STUB_DISCARD	/* after a NAK, until the line is idle */
+	};
+
+	enum State
+	{
+		ST_SYNC,
+		ST_CMD,
+		ST_READ_ADDR,
+		ST_READ_LEN,
+		ST_WRITE_ADDR,
+		ST_WRITE_DATA,
+		ST_ERASE,
+		ST_XERASE,
+		ST_GO_ADDR
+	};
+
+	STM32SimConfig _cfg;
+	STM32FamilyInfo _fi;
+	STM32FlashGeometry _geo;
+	STM32SimStats _stats;
+	Port _port;
+	SpiPort _spiPort;
+
+	std::vector<uint8_t> _flash;
+	std::vector<uint8_t> _ram;
+	std::vector<uint32_t> _eraseCounts;
+
+	Ring _in;
+	Ring _out;
+	uint64_t _inLineFree;
+	uint64_t _outLineFree;
+	uint64_t _byteNs;
+
+	Mode _mode;
+	State _state;
+	uint64_t _readyAt;
+	uint8_t _boot0;
+	uint8_t _resetLevel;
+	uint32_t _rng;
+	STM32TraceSink* _trace;
+
+	uint8_t _frame[1100];	/* also holds a stub frame, STM32_STUB_FRAME_MAX */
+	size_t _frameLen;
+	uint32_t _addr;
+	bool _spiSof;		/* SPI: start of frame seen, the command byte is next */
+
+	StubState _stubState;
+	uint8_t _stubSeq;
+	uint8_t _stubWindow;
+	uint16_t _stubBlock;
+	uint64_t _stubLastRxNs;
+	uint64_t _stubBusyUntil;
+
+	uint32_t _ramSp;
+	uint32_t _ramEntry;
+
+	bool chance(uint16_t permille);
+	void hostByte(uint8_t b, uint64_t ns);
+	void rxByte(uint8_t b, uint64_t ns);
+	void reply(uint8_t b, uint64_t readyNs);
+	void ack(uint64_t readyNs, bool ok);
+	void dataLead(uint64_t readyNs);
+	uint8_t spiTransfer(uint8_t mosi);
+	void frameDone(uint64_t ns);
+
+	void goRam(uint32_t addr);
+	bool stubHeaderAt(uint32_t addr) const;
+	void startStub(uint32_t addr, uint64_t ns);
+	uint64_t stubIdleAt() const;
+	void stubIdle(uint64_t ns);
+	void stubByte(uint8_t b, uint64_t ns);
+	void stubFrameDone(uint64_t ns);
+	void stubReply(uint8_t seq, uint8_t status, uint64_t readyNs);
+	void stubNak(uint64_t readyNs);
+
+	size_t frameNeed() const;
+	bool addressFrameValid(uint32_t& addr) const;
+	bool readMem(uint32_t addr, uint8_t* out, size_t len) const;
+	bool writeMem(uint32_t addr, const uint8_t* data, size_t len, uint64_t& busyNs);
+	bool unitIndex(uint16_t number, uint16_t& index) const;
+	bool eraseUnits(const uint16_t* units, size_t n, uint64_t& busyNs);
+	void eraseAll(uint64_t& busyNs);
+	bool flashRange(uint32_t addr, size_t len) const;
+	bool ramRange(uint32_t addr, size_t len) const;
+};
+
+#endif	/* STM32_SIM_TARGET_H */
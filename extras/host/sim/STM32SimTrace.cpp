@@ -0,0 +1,248 @@
+/********************************************************************************************************
+ *  [FILE NAME]   :      <STM32SimTrace.cpp>                                                            *
+ *  [AUTHOR]      :      <David S. Alexander>                                                           *
+ *  [DATE CREATED]:      <Dec 10, 2025>                                                                 *
+ *  [Description] :      <Source file for UART session traces and their replay>                         *
+ ********************************************************************************************************/
+
+#include "STM32SimTrace.h"
+#include <ctype.h>
+
+/* ---------------------------------------------------------------- writer */
+
+STM32TraceWriter::STM32TraceWriter(FILE* f) : _f(f), _dir(STM32_TRACE_TX), _ns(0), _len(0) {}
+
+STM32TraceWriter::~STM32TraceWriter()
+{
+	flush();
+}
+
+void STM32TraceWriter::header(const char* key, const char* value)
+{
+	flush();
+	fprintf(_f, "# %s %s\n", key, value);
+}
+
+void STM32TraceWriter::onByte(STM32TraceDir dir, uint8_t b, uint64_t ns)
+{
+	if (_len && (dir != _dir || ns != _ns || _len == sizeof(_buf))) flush();
+	_dir = dir;
+	_ns = ns;
+	_buf[_len++] = b;
+}
+
+void STM32TraceWriter::flush()
+{
+	if (!_len) return;
+	fprintf(_f, "%llu %s", (unsigned long long)_ns, (_dir == STM32_TRACE_TX) ? "TX" : "RX");
+	for (size_t i = 0; i < _len; i++) fprintf(_f, " %02x", _buf[i]);
+	fputc('\n', _f);
+	_len = 0;
+}
+
+/* ---------------------------------------------------------------- reader */
+
+bool STM32Trace::load(const char* path, char* err, size_t errCap)
+{
+	entries.clear();
+	headers.clear();
+
+	FILE* f = fopen(path, "r");
+	if (!f)
+	{
+		snprintf(err, errCap, "cannot open %s", path);
+		return false;
+	}
+
+	char line[512];
+	unsigned lineNo = 0;
+	while (fgets(line, sizeof(line), f))
+	{
+		lineNo++;
+		char* p = line;
+		while (isspace((unsigned char)*p)) p++;
+		if (!*p) continue;
+
+		if (*p == '#')
+		{
+			p++;
+			while (*p == ' ') p++;
+			char* key = p;
+			while (*p && !isspace((unsigned char)*p)) p++;
+			std::string k(key, p);
+			while (*p == ' ') p++;
+			char* end = p + strlen(p);
+			while (end > p && isspace((unsigned char)end[-1])) end--;
+			headers.push_back(std::make_pair(k, std::string(p, end)));
+			continue;
+		}
+
+		char* next;
+		unsigned long long ns = strtoull(p, &next, 10);
+		if (next == p) break;
+		p = next;
+		while (*p == ' ') p++;
+
+		STM32TraceDir dir;
+		if (!strncmp(p, "TX", 2)) dir = STM32_TRACE_TX;
+		else if (!strncmp(p, "RX", 2)) dir = STM32_TRACE_RX;
+		else break;
+		p += 2;
+
+		while (true)
+		{
+			unsigned long v = strtoul(p, &next, 16);
+			if (next == p) break;
+			STM32TraceEntry e = { (uint64_t)ns, dir, (uint8_t)v };
+			entries.push_back(e);
+			p = next;
+		}
+		while (isspace((unsigned char)*p)) p++;
+		if (*p)
+		{
+			fclose(f);
+			snprintf(err, errCap, "%s:%u: cannot parse trace line", path, lineNo);
+			return false;
+		}
+	}
+
+	bool ok = !ferror(f);
+	fclose(f);
+	if (!ok) snprintf(err, errCap, "read error on %s", path);
+	return ok;
+}
+
+const char* STM32Trace::header(const char* key) const
+{
+	for (size_t i = 0; i < headers.size(); i++)
+	{
+		if (headers[i].first == key) return headers[i].second.c_str();
+	}
+	return nullptr;
+}
+
+/* ---------------------------------------------------------------- replay */
+
+/* The recording's line: 8E1 and the ESP8266 UART TX FIFO, as STM32SimConfig defaults */
+static const uint32_t REPLAY_BITS_PER_BYTE = 11;
+static const uint32_t REPLAY_TX_FIFO_BYTES = 128;
+
+static uint64_t replayByteNs(const STM32Trace& trace)
+{
+	const char* v = trace.header("baud");
+	unsigned long baud = v ? strtoul(v, nullptr, 0) : 0;
+	if (!baud) return 0;
+	return ((uint64_t)REPLAY_BITS_PER_BYTE * 1000000000ULL + baud / 2) / baud;
+}
+
+STM32ReplayTarget::STM32ReplayTarget(const STM32Trace& trace)
+: _trace(&trace),
+_port(*this),
+_rxHead(0),
+_cursor(0),
+_byteNs(replayByteNs(trace)),
+_lineFree(0),
+_diverged(false),
+_divergedAt(0),
+_expected(0),
+_got(0)
+{
+	/* Reserve up front so delivering bytes never allocates */
+	_rx.reserve(trace.entries.size());
+}
+
+Stream& STM32ReplayTarget::port() { return _port; }
+bool STM32ReplayTarget::diverged() const { return _diverged; }
+size_t STM32ReplayTarget::divergedAt() const { return _divergedAt; }
+uint8_t STM32ReplayTarget::expected() const { return _expected; }
+uint8_t STM32ReplayTarget::got() const { return _got; }
+size_t STM32ReplayTarget::consumed() const { return _cursor; }
+
+uint64_t STM32ReplayTarget::nextEventNs() const
+{
+	uint64_t now = STM32HostClock::nowNs();
+	for (size_t i = _rxHead; i < _rx.size(); i++)
+	{
+		if (_rx[i].ns > now) return _rx[i].ns;
+	}
+	return UINT64_MAX;
+}
+
+void STM32ReplayTarget::advanceTo(uint64_t ns)
+{
+	(void)ns;
+}
+
+void STM32ReplayTarget::hostByte(uint8_t b)
+{
+	if (_diverged) return;
+
+	const std::vector<STM32TraceEntry>& e = _trace->entries;
+	while (_cursor < e.size() && e[_cursor].dir == STM32_TRACE_RX) _cursor++;
+
+	if (_cursor >= e.size() || e[_cursor].b != b)
+	{
+		_diverged = true;
+		_divergedAt = _cursor;
+		_expected = (_cursor < e.size()) ? e[_cursor].b : 0;
+		_got = b;
+		return;
+	}
+
+	uint64_t now = STM32HostClock::nowNs();
+	uint64_t fifoNs = REPLAY_TX_FIFO_BYTES * _byteNs;
+	if (_lineFree > now + fifoNs)
+	{
+		/* TX FIFO full: the caller blocks until there is room */
+		STM32HostClock::advanceTo(_lineFree - fifoNs);
+		now = STM32HostClock::nowNs();
+	}
+	_lineFree = ((_lineFree > now) ? _lineFree : now) + _byteNs;
+
+	uint64_t txNs = e[_cursor].ns;
+	_cursor++;
+
+	while (_cursor < e.size() && e[_cursor].dir == STM32_TRACE_RX)
+	{
+		uint64_t delta = (e[_cursor].ns > txNs) ? e[_cursor].ns - txNs : 0;
+		Slot s = { now + delta, e[_cursor].b };
+		_rx.push_back(s);
+		_cursor++;
+	}
+}
+
+int STM32ReplayTarget::Port::available()
+{
+	uint64_t now = STM32HostClock::nowNs();
+	size_t n = 0;
+	while (_t->_rxHead + n < _t->_rx.size() && _t->_rx[_t->_rxHead + n].ns <= now) n++;
+	return (int)n;
+}
+
+int STM32ReplayTarget::Port::read()
+{
+	if (!available()) return -1;
+	return _t->_rx[_t->_rxHead++].b;
+}
+
+int STM32ReplayTarget::Port::peek()
+{
+	return available() ? _t->_rx[_t->_rxHead].b : -1;
+}
+
+size_t STM32ReplayTarget::Port::write(uint8_t c)
+{
+	_t->hostByte(c);
+	return 1;
+}
+
+size_t STM32ReplayTarget::Port::write(const uint8_t* data, size_t len)
+{
+	for (size_t i = 0; i < len; i++) _t->hostByte(data[i]);
+	return len;
+}
+
+void STM32ReplayTarget::Port::flush()
+{
+	STM32HostClock::advanceTo(_t->_lineFree);
+}
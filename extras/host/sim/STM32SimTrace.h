@@ -0,0 +1,131 @@
+/********************************************************************************************************
+ *  [FILE NAME]   :      <STM32SimTrace.h>                                                              *
+ *  [AUTHOR]      :      <David S. Alexander>                                                           *
+ *  [DATE CREATED]:      <Dec 10, 2025>                                                                 *
+ *  [Description] :      <Header file for UART session traces and their replay>                         *
+ ********************************************************************************************************/
+
+#ifndef STM32_SIM_TRACE_H
+#define	STM32_SIM_TRACE_H
+
+#include <Arduino.h>
+#include <string>
+#include <utility>
+#include <vector>
+#include "STM32HostClock.h"
+
+/* TX is ESP -> STM32 (what the host wrote), RX is STM32 -> ESP (what the host read) */
+enum STM32TraceDir : uint8_t
+{
+	STM32_TRACE_TX,
+	STM32_TRACE_RX
+};
+
+class STM32TraceSink
+{
+	public:
+	virtual ~STM32TraceSink() {}
+	virtual void onByte(STM32TraceDir dir, uint8_t b, uint64_t ns) = 0;
+};
+
+/* Text trace, one line per burst:
+     # key value              header, e.g. "# dev 0x410"
+     <ns> TX|RX <hex> ...     bytes with the same direction and timestamp
+   A logic-analyzer capture converted to this format replays the same way as a recorded one. */
+class STM32TraceWriter : public STM32TraceSink
+{
+	public:
+	explicit STM32TraceWriter(FILE* f);
+	~STM32TraceWriter();
+
+	void header(const char* key, const char* value);
+	void onByte(STM32TraceDir dir, uint8_t b, uint64_t ns) override;
+	void flush();
+
+	private:
+	FILE* _f;
+	STM32TraceDir _dir;
+	uint64_t _ns;
+	uint8_t _buf[64];
+	size_t _len;
+};
+
+struct STM32TraceEntry
+{
+	uint64_t ns;
+	STM32TraceDir dir;
+	uint8_t b;
+};
+
+struct STM32Trace
+{
+	std::vector<STM32TraceEntry> entries;
+	std::vector<std::pair<std::string, std::string> > headers;
+
+	bool load(const char* path, char* err, size_t errCap);
+	const char* header(const char* key) const;
+};
+
+/* Plays the RX side of a trace back to the host. Each RX byte is delivered at the same offset from
+   the host's matching TX byte as in the recording, so a faster or slower host keeps its own timing.
+   TX bytes leave at the trace's "# baud" rate through a TX FIFO, as on STM32SimTarget, so the host
+   cannot write faster than the line. TX bytes are checked against the trace; on the first mismatch
+   the replayer goes silent. */
+class STM32ReplayTarget : public STM32HostDevice
+{
+	public:
+	explicit STM32ReplayTarget(const STM32Trace& trace);
+
+	Stream& port();
+
+	bool diverged() const;
+	size_t divergedAt() const;
+	uint8_t expected() const;
+	uint8_t got() const;
+	size_t consumed() const;
+
+	uint64_t nextEventNs() const override;
+	void advanceTo(uint64_t ns) override;
+
+	private:
+	struct Slot
+	{
+		uint64_t ns;
+		uint8_t b;
+	};
+
+	class Port : public Stream
+	{
+		public:
+		explicit Port(STM32ReplayTarget& t) : _t(&t) {}
+		int available() override;
+		int read() override;
+		int peek() override;
+		size_t write(uint8_t c) override;
+		size_t write(const uint8_t* data, size_t len) override;
+		void flush() override;
+
+		private:
+		STM32ReplayTarget* _t;
+	};
+
+	const STM32Trace* _trace;
+	Port _port;
+
+	std::vector<Slot> _rx;
+	size_t _rxHead;
+	size_t _cursor;
+
+	/* Line model for TX: 0 when the trace has no baud header */
+	uint64_t _byteNs;
+	uint64_t _lineFree;
+
+	bool _diverged;
+	size_t _divergedAt;
+	uint8_t _expected;
+	uint8_t _got;
+
+	void hostByte(uint8_t b);
+};
+
+#endif	/* STM32_SIM_TRACE_H */
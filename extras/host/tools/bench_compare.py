@@ -0,0 +1,78 @@
+#!/usr/bin/env python3
+"""Compare two stm32bench JSON reports and fail on throughput or CPU regressions.
+
+    bench_compare.py baseline.json current.json [--tolerance 5] [--cpu-tolerance 25]
+
+Results are matched on (source, dev, baud, imageBytes). Throughput is simulated time, so it is
+deterministic and the default tolerance is tight; CPU time is measured on the host and noisy.
+"""
+
+import argparse
+import json
+import sys
+
+
+def load(path):
+    with open(path) as f:
+        report = json.load(f)
+    results = {}
+    for r in report.get("results", []):
+        results[(r["source"], r["dev"], r["baud"], r["imageBytes"])] = r
+    return report, results
+
+
+def pct(old, new):
+    return (new - old) * 100.0 / old if old else 0.0
+
+
+def main():
+    ap = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    ap.add_argument("baseline")
+    ap.add_argument("current")
+    ap.add_argument("--tolerance", type=float, default=5.0,
+                    help="allowed throughput drop in percent (default 5)")
+    ap.add_argument("--cpu-tolerance", type=float, default=25.0,
+                    help="allowed protocol CPU time increase in percent (default 25)")
+    args = ap.parse_args()
+
+    base_report, base = load(args.baseline)
+    cur_report, cur = load(args.current)
+    print("baseline %s  current %s" % (base_report.get("version"), cur_report.get("version")))
+
+    failures = 0
+    for key in sorted(base):
+        b = base[key]
+        c = cur.get(key)
+        name = "%s %s @%d %dB" % (key[0], b["family"], key[2], key[3])
+        if c is None:
+            print("MISSING  %s" % name)
+            failures += 1
+            continue
+        if b["ok"] and not c["ok"]:
+            print("FAILED   %s: %s" % (name, c.get("error", "")))
+            failures += 1
+            continue
+
+        notes = []
+        bad = False
+        for field in ("bytesPerSec", "endToEndBytesPerSec"):
+            d = pct(b[field], c[field])
+            notes.append("%s %+.1f%%" % (field, d))
+            if d < -args.tolerance:
+                bad = True
+        d = pct(b["cpuUs"]["protocol"], c["cpuUs"]["protocol"])
+        notes.append("cpu %+.1f%%" % d)
+        if d > args.cpu_tolerance:
+            bad = True
+        if c["allocs"] > b["allocs"]:
+            notes.append("allocs %d -> %d" % (b["allocs"], c["allocs"]))
+            bad = True
+
+        print("%-8s %s: %s" % ("REGRESS" if bad else "ok", name, ", ".join(notes)))
+        failures += bad
+
+    return 1 if failures else 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
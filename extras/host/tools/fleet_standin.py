@@ -0,0 +1,305 @@
+#!/usr/bin/env python3
+"""Stand-in for a rack of web flashers, to exercise stm32fleet without hardware.
+
+    fleet_standin.py --units 8 --base-port 8080 [--mdns] [--fail-first 1] [--nogo 3]
+
+Each unit is an HTTP server on its own port with the routes stm32fleet uses (/login, /status,
+/image, /upload, /patch, /connect, /disconnect, /cmd?c=P|S|D|U|V) and the same status codes and
+reply texts as the ESP8266. Patches are applied with an independent decoder, so a wrong patch from
+the tool fails here the way it would on a unit. Like the real server, a unit handles one request
+at a time and remembers one logged-in client address.
+"""
+
+import argparse
+import hashlib
+import json
+import random
+import socket
+import struct
+import threading
+import time
+from http.server import BaseHTTPRequestHandler, ThreadingHTTPServer
+from urllib.parse import parse_qs, urlparse
+
+MDNS_GROUP = "224.0.0.251"
+MDNS_PORT = 5353
+
+
+class Unit:
+    def __init__(self, index, port, args):
+        self.index = index
+        self.name = "standin-%d" % index
+        self.port = port
+        self.args = args
+        self.lock = threading.Lock()
+        self.logged_ip = None
+        self.image = None
+        self.connected = False
+        self.flash = b""
+        self.jobs = 0
+        self.rng = random.Random(args.seed * 1000 + index)
+
+
+def part(body, boundary, field):
+    """The file in multipart field `field`, or None"""
+    for chunk in body.split(b"--" + boundary):
+        head, sep, data = chunk.partition(b"\r\n\r\n")
+        if sep and (b'name="%s"' % field.encode()) in head:
+            return data[:-2] if data.endswith(b"\r\n") else data
+    return None
+
+
+def apply_patch(patch, base):
+    """The new image, or raises ValueError with the unit's error text"""
+    if len(patch) < 80 or patch[:4] != b"STMD":
+        raise ValueError("not a patch")
+    if patch[4] != 1:
+        raise ValueError("unsupported patch version")
+    base_size, new_size = struct.unpack_from("<II", patch, 8)
+    if base is None or base_size != len(base) or patch[16:48] != hashlib.sha256(base).digest():
+        raise ValueError("patch is for another base image")
+    out = bytearray()
+    pos = 80
+    while len(out) < new_size:
+        if pos >= len(patch):
+            raise ValueError("patch ends before the new image is complete")
+        op = patch[pos]
+        if op == 1:
+            offset, length = struct.unpack_from("<II", patch, pos + 1)
+            if offset + length > len(base):
+                raise ValueError("copy outside the base image")
+            out += base[offset:offset + length]
+            pos += 9
+        elif op == 2:
+            (length,) = struct.unpack_from("<I", patch, pos + 1)
+            out += patch[pos + 5:pos + 5 + length]
+            pos += 5 + length
+        else:
+            raise ValueError("unknown patch op")
+        if len(out) > new_size:
+            raise ValueError("patch runs past the new image size")
+    if pos != len(patch):
+        raise ValueError("data after the end of the patch")
+    if hashlib.sha256(out).digest() != patch[48:80]:
+        raise ValueError("SHA-256 of the new image does not match")
+    return bytes(out)
+
+
+def make_handler(unit):
+    args = unit.args
+
+    class Handler(BaseHTTPRequestHandler):
+        def log_message(self, fmt, *a):
+            if args.verbose:
+                print("[%s] %s" % (unit.name, fmt % a))
+
+        def reply(self, code, body, ctype="text/plain"):
+            data = body.encode() if isinstance(body, str) else body
+            self.send_response(code)
+            self.send_header("Content-Type", ctype)
+            self.send_header("Content-Length", str(len(data)))
+            self.send_header("Connection", "close")
+            self.end_headers()
+            self.wfile.write(data)
+
+        def json(self, code, obj):
+            self.reply(code, json.dumps(obj, separators=(",", ":")), "application/json")
+
+        def logged_in(self):
+            return unit.logged_ip == self.client_address[0]
+
+        def body(self):
+            return self.rfile.read(int(self.headers.get("Content-Length", 0)))
+
+        def do_GET(self):
+            with unit.lock:
+                self.route("GET")
+
+        def do_POST(self):
+            with unit.lock:
+                self.route("POST")
+
+        def route(self, method):
+            url = urlparse(self.path)
+            key = (method, url.path)
+            if key == ("POST", "/login"):
+                return self.login(parse_qs(self.body().decode()))
+            if key == ("GET", "/status"):
+                if not self.logged_in():
+                    return self.json(403, {"ok": False, "error": "not logged in", "host": unit.name})
+                return self.json(200, {"ok": True, "host": unit.name, "connected": unit.connected,
+                                       "hasFile": unit.image is not None, "link": "uart"})
+            routes = {
+                ("GET", "/image"): self.image,
+                ("POST", "/upload"): self.upload,
+                ("POST", "/patch"): self.patch,
+                ("POST", "/connect"): self.connect,
+                ("POST", "/disconnect"): self.disconnect,
+                ("GET", "/cmd"): lambda: self.cmd(parse_qs(url.query)),
+            }
+            handler = routes.get(key)
+            if handler is None:
+                return self.reply(404, "Not found")
+            if not self.logged_in():
+                if method == "POST":
+                    self.body()
+                return self.json(403, {"ok": False, "error": "not logged in"})
+            return handler()
+
+        def login(self, form):
+            if form.get("user") == [args.user] and form.get("pass") == [args.password]:
+                unit.logged_ip = self.client_address[0]
+                return self.json(200, {"ok": True})
+            unit.logged_ip = None
+            return self.json(200, {"ok": False, "error": "Invalid username or password"})
+
+        def image(self):
+            if unit.image is None:
+                return self.json(404, {"ok": False, "error": "no image"})
+            return self.json(200, {"ok": True, "size": len(unit.image),
+                                   "crc": "%08X" % 0, "sha256": hashlib.sha256(unit.image).hexdigest()})
+
+        def upload_body(self, field):
+            boundary = self.headers.get("Content-Type", "").partition("boundary=")[2].encode()
+            data = self.body()
+            time.sleep(len(data) / (args.upload_kbps * 1024.0))
+            return part(data, boundary, field) if boundary else None
+
+        def upload(self):
+            data = self.upload_body("firmware")
+            if data is None:
+                return self.reply(507, "Upload failed: no file in the request")
+            unit.image = data
+            self.reply(200, "Upload OK, Bytes = %d, FS write 100 kB/s, overall 50 kB/s" % len(data))
+
+        def patch(self):
+            data = self.upload_body("patch")
+            try:
+                if data is None:
+                    raise ValueError("no patch in the request")
+                if unit.image is None:
+                    raise ValueError("no stored image to patch")
+                unit.image = apply_patch(data, unit.image)
+            except ValueError as e:
+                return self.reply(409, "Patch failed: %s" % e)
+            self.reply(200, "Patch OK, Bytes = %d from a %d byte patch, 0 copied from the stored image, overall 50 kB/s"
+                       % (len(unit.image), len(data)))
+
+        def connect(self):
+            unit.connected = True
+            self.json(200, {"ok": True, "connected": True, "desc": "STM32F40xxx/41xxx (ID: 0x413, Flash: 1024KB)"})
+
+        def disconnect(self):
+            unit.connected = False
+            self.json(200, {"ok": True, "connected": False})
+
+        def cmd(self, query):
+            c = query.get("c", [""])[0][:1]
+            force = query.get("f") == ["1"]
+            if c in "SDUV" and not unit.connected:
+                return self.reply(400, "Target not connected. Use Connect first.")
+            if c in "SDUVP" and unit.image is None:
+                return self.reply(200, "No /update.bin")
+            size = len(unit.image or b"")
+            nogo = unit.index in args.nogo
+            pf = "Preflight %s: %d of 1048576 bytes" % ("NO-GO" if nogo else "GO", size)
+            if nogo:
+                pf += "; SP 0x9B691284 not in SRAM"
+            if c == "P" or (c in "SDU" and nogo and not force):
+                return self.reply(200, pf)
+            if c in "SDU":
+                unit.jobs += 1
+                time.sleep(size / (args.program_kbps * 1024.0))
+                if unit.jobs <= args.fail_first or unit.rng.random() < args.fail_rate:
+                    unit.flash = b""
+                    return self.reply(200, "WRITE: NACK (data) at 0x08000100")
+                unit.flash = unit.image
+                if c == "D":
+                    return self.reply(200, "Delta OK, Bytes = %d, skipped 0, 1 of 1 blocks rewritten" % size)
+                return self.reply(200, "Upload OK, Bytes = %d" % size)
+            if c == "V":
+                time.sleep(size / (args.program_kbps * 2048.0))
+                if unit.flash != unit.image:
+                    return self.reply(200, "READ: verify mismatch at 0x08000000")
+                return self.reply(200, "Verify OK, Bytes = %d" % size)
+            self.reply(200, "Unknown CMD: %s" % c)
+
+    return Handler
+
+
+def encode_name(name):
+    out = b""
+    for label in name.split("."):
+        out += bytes([len(label)]) + label.encode()
+    return out + b"\0"
+
+
+def mdns_responder(units, stop):
+    """Answers _http._tcp PTR queries with PTR, SRV and A records for every unit"""
+    sock = socket.socket(socket.AF_INET, socket.SOCK_DGRAM, socket.IPPROTO_UDP)
+    sock.setsockopt(socket.SOL_SOCKET, socket.SO_REUSEADDR, 1)
+    sock.bind(("", MDNS_PORT))
+    mreq = struct.pack("4s4s", socket.inet_aton(MDNS_GROUP), socket.inet_aton("0.0.0.0"))
+    sock.setsockopt(socket.IPPROTO_IP, socket.IP_ADD_MEMBERSHIP, mreq)
+    sock.settimeout(0.5)
+    service = encode_name("_http._tcp.local")
+    host = encode_name("standin.local")
+    addr = socket.inet_aton("127.0.0.1")
+    while not stop.is_set():
+        try:
+            query, peer = sock.recvfrom(1500)
+        except socket.timeout:
+            continue
+        if service.lower() not in query.lower() or query[2] & 0x80:
+            continue
+        answers = b""
+        extra = b""
+        for u in units:
+            inst = encode_name("%s._http._tcp.local" % u.name)
+            answers += service + struct.pack(">HHIH", 12, 1, 120, len(inst)) + inst
+            srv = struct.pack(">HHH", 0, 0, u.port) + host
+            extra += inst + struct.pack(">HHIH", 33, 1, 120, len(srv)) + srv
+        extra += host + struct.pack(">HHIH", 1, 1, 120, 4) + addr
+        head = struct.pack(">HHHHHH", struct.unpack_from(">H", query)[0], 0x8400, 0, len(units), 0, len(units) + 1)
+        sock.sendto(head + answers + extra, peer)
+
+
+def main():
+    ap = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    ap.add_argument("--units", type=int, default=4)
+    ap.add_argument("--base-port", type=int, default=8080)
+    ap.add_argument("--bind", default="127.0.0.1")
+    ap.add_argument("--user", default="admin")
+    ap.add_argument("--password", default="admin")
+    ap.add_argument("--upload-kbps", type=float, default=400.0, help="simulated upload rate (400 KB/s)")
+    ap.add_argument("--program-kbps", type=float, default=30.0, help="simulated program rate (30 KB/s)")
+    ap.add_argument("--fail-first", type=int, default=0, help="fail each unit's first N program jobs")
+    ap.add_argument("--fail-rate", type=float, default=0.0, help="fail program jobs at random")
+    ap.add_argument("--nogo", type=int, action="append", default=[], help="unit index whose preflight says NO-GO")
+    ap.add_argument("--seed", type=int, default=1)
+    ap.add_argument("--mdns", action="store_true", help="answer mDNS queries on port 5353")
+    ap.add_argument("-v", "--verbose", action="store_true")
+    args = ap.parse_args()
+
+    units = [Unit(i, args.base_port + i, args) for i in range(args.units)]
+    servers = []
+    for u in units:
+        srv = ThreadingHTTPServer((args.bind, u.port), make_handler(u))
+        threading.Thread(target=srv.serve_forever, daemon=True).start()
+        servers.append(srv)
+        print("%s on %s:%d" % (u.name, args.bind, u.port), flush=True)
+
+    stop = threading.Event()
+    if args.mdns:
+        threading.Thread(target=mdns_responder, args=(units, stop), daemon=True).start()
+    try:
+        while True:
+            time.sleep(3600)
+    except KeyboardInterrupt:
+        stop.set()
+        for srv in servers:
+            srv.shutdown()
+
+
+if __name__ == "__main__":
+    main()
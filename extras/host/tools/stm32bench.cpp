@@ -0,0 +1,319 @@
+/********************************************************************************************************
+ *  [FILE NAME]   :      <stm32bench.cpp>                                                               *
+ *  [AUTHOR]      :      <David S. Alexander>                                                           *
+ *  [DATE CREATED]:      <Dec 10, 2025>                                                                 *
+ *  [Description] :      <Flash throughput benchmark over the simulator and recorded UART traces>       *
+ ********************************************************************************************************/
+
+#include <Arduino.h>
+#include <vector>
+#include "STM32HostClock.h"
+#include "STM32JsonWriter.h"
+#include "STM32SimSession.h"
+#include "STM32SimTarget.h"
+#include "STM32SimTrace.h"
+
+#ifndef STM32_BENCH_VERSION
+#define STM32_BENCH_VERSION "unknown"
+#endif
+
+/* JSON goes to stdout through the same writer the web server uses */
+class FilePrint : public Print
+{
+	public:
+	explicit FilePrint(FILE* f) : _f(f) {}
+	size_t write(uint8_t c) override { return fwrite(&c, 1, 1, _f); }
+	size_t write(const uint8_t* data, size_t len) override { return fwrite(data, 1, len, _f); }
+
+	private:
+	FILE* _f;
+};
+
+struct BenchCase
+{
+	const char* source;
+	uint16_t devId;
+	uint32_t baud;
+	uint32_t imageBytes;
+	uint32_t seed;
+};
+
+static void usage()
+{
+	puts("usage: stm32bench [options]\n"
+	"  --devs <list>        device IDs, comma separated (0x410,0x413)\n"
+	"  --bauds <list>       baud rates (115200,921600)\n"
+	"  --sizes <list>       image sizes in KB (16,64)\n"
+	"  --fs-read-us <n>     simulated cost of one LittleFS readBytes() call (0)\n"
+	"  --fs-byte-ns <n>     simulated LittleFS cost per byte read (0)\n"
+	"  --seed <n>           image PRNG seed (1)\n"
+	"  --stub               program through the emulated RAM loader stub\n"
+	"  --label <text>       free-form label copied into the report\n"
+	"  --record <file>      run the first case once and save its UART trace\n"
+	"  --replay <file>      benchmark against a recorded trace instead of the simulator\n"
+	"  --out <file>         write JSON here instead of stdout");
+}
+
+static bool parseList(const char* arg, std::vector<uint32_t>& out)
+{
+	out.clear();
+	const char* p = arg;
+	while (*p)
+	{
+		char* end;
+		unsigned long v = strtoul(p, &end, 0);
+		if (end == p) return false;
+		out.push_back((uint32_t)v);
+		p = end;
+		if (*p == ',') p++;
+		else if (*p) return false;
+	}
+	return !out.empty();
+}
+
+static void writeResult(STM32JsonWriter& json, const BenchCase& c, const STM32SimSession& s, const char* error)
+{
+	const STM32SessionStepResult* st = s.step;
+	const STM32SessionStepResult& prog = st[STM32_STEP_PROGRAM];
+
+	uint64_t cpuNs = 0;
+	uint64_t deviceNs = 0;
+	uint64_t allocs = 0;
+	for (int i = 0; i < STM32_STEP_COUNT; i++)
+	{
+		cpuNs += st[i].cpuNs;
+		deviceNs += st[i].deviceCpuNs;
+		allocs += st[i].allocs;
+	}
+
+	uint64_t programUs = prog.simNs / 1000u;
+	uint64_t totalUs = s.totalNs / 1000u;
+
+	json.beginObject();
+	json.add("source", c.source);
+	json.addHex("dev", c.devId, 3);
+	json.add("family", STM32FamilyDb::getFamilyInfo(c.devId).name);
+	json.add("baud", (unsigned long)c.baud);
+	json.add("imageBytes", (unsigned long)c.imageBytes);
+	json.add("ok", s.ok);
+	if (error && error[0]) json.add("error", error);
+
+	json.add("bytesPerSec", (unsigned long)(programUs ? (uint64_t)s.written * 1000000u / programUs : 0));
+	json.add("endToEndBytesPerSec", (unsigned long)(totalUs ? (uint64_t)s.written * 1000000u / totalUs : 0));
+
+	json.beginObject("phasesUs");
+	json.add("sync", (unsigned long)s.metrics.phase[STM32_PHASE_SYNC].sumUs);
+	json.add("detect", (unsigned long)(st[STM32_STEP_DETECT].simNs / 1000u));
+	json.add("erase", (unsigned long)(st[STM32_STEP_ERASE].simNs / 1000u));
+	json.add("write", (unsigned long)(programUs - prog.fsReadUs));
+	json.add("ackWait", (unsigned long)s.metrics.ack[STM32_OP_WRITE].sumUs);
+	json.add("fsRead", (unsigned long)prog.fsReadUs);
+	json.add("verify", (unsigned long)(st[STM32_STEP_VERIFY].simNs / 1000u));
+	json.add("total", (unsigned long)totalUs);
+	json.endObject();
+
+	/* "protocol" is host CPU time minus the time charged to the simulator or replayer */
+	json.beginObject("cpuUs");
+	json.add("total", (unsigned long)(cpuNs / 1000u));
+	json.add("protocol", (unsigned long)((cpuNs > deviceNs ? cpuNs - deviceNs : 0) / 1000u));
+	json.add("device", (unsigned long)(deviceNs / 1000u));
+	json.endObject();
+
+	json.add("allocs", (unsigned long)allocs);
+	json.endObject();
+}
+
+static void sessionError(const STM32SimSession& s, char* out, size_t cap)
+{
+	out[0] = '\0';
+	if (!s.ok) s.res.format(out, cap);
+}
+
+static bool runSim(const BenchCase& c, const STM32SessionOptions& opt, STM32JsonWriter& json, STM32TraceWriter* rec)
+{
+	std::vector<uint8_t> image;
+	STM32SimSession::makeImage(image, c.imageBytes, c.seed);
+
+	STM32SimConfig cfg;
+	cfg.devId = c.devId;
+	cfg.baud = c.baud;
+
+	STM32HostClock::reset();
+	STM32SimTarget sim(cfg);
+	STM32HostClock::attach(&sim);
+	if (rec) sim.setTrace(rec);
+
+	STM32SimSession s;
+	char err[96];
+	if (image.size() > sim.flashSize())
+	{
+		snprintf(err, sizeof(err), "image larger than %u bytes of flash", sim.flashSize());
+		writeResult(json, c, s, err);
+		STM32HostClock::attach(nullptr);
+		return false;
+	}
+
+	s.run(sim.port(), image.data(), image.size(), opt);
+	sessionError(s, err, sizeof(err));
+	if (s.ok && memcmp(sim.flash(), image.data(), image.size()) != 0)
+	{
+		s.ok = false;
+		snprintf(err, sizeof(err), "flash model does not match the image");
+	}
+	writeResult(json, c, s, err);
+	STM32HostClock::attach(nullptr);
+	return s.ok;
+}
+
+static bool runReplay(const char* path, const STM32SessionOptions& opt, STM32JsonWriter& json)
+{
+	char err[128];
+	STM32Trace trace;
+	if (!trace.load(path, err, sizeof(err)))
+	{
+		fprintf(stderr, "%s\n", err);
+		return false;
+	}
+
+	const char* dev = trace.header("dev");
+	const char* baud = trace.header("baud");
+	const char* size = trace.header("image-size");
+	const char* seed = trace.header("image-seed");
+	if (!dev || !baud || !size || !seed)
+	{
+		fprintf(stderr, "%s: missing dev/baud/image-size/image-seed header\n", path);
+		return false;
+	}
+
+	BenchCase c = { "replay", (uint16_t)strtoul(dev, nullptr, 0), (uint32_t)strtoul(baud, nullptr, 0),
+	(uint32_t)strtoul(size, nullptr, 0), (uint32_t)strtoul(seed, nullptr, 0) };
+
+	std::vector<uint8_t> image;
+	STM32SimSession::makeImage(image, c.imageBytes, c.seed);
+
+	STM32HostClock::reset();
+	STM32ReplayTarget replay(trace);
+	STM32HostClock::attach(&replay);
+
+	STM32SimSession s;
+	s.run(replay.port(), image.data(), image.size(), opt);
+	sessionError(s, err, sizeof(err));
+	if (replay.diverged())
+	{
+		s.ok = false;
+		snprintf(err, sizeof(err), "host diverged from trace at entry %zu: expected %02x, wrote %02x",
+		replay.divergedAt(), replay.expected(), replay.got());
+	}
+	writeResult(json, c, s, err);
+	STM32HostClock::attach(nullptr);
+	return s.ok;
+}
+
+int main(int argc, char** argv)
+{
+	std::vector<uint32_t> devs;
+	std::vector<uint32_t> bauds;
+	std::vector<uint32_t> sizes;
+	parseList("0x410,0x413", devs);
+	parseList("115200,921600", bauds);
+	parseList("16,64", sizes);
+
+	STM32SessionOptions opt;
+	uint32_t seed = 1;
+	const char* label = "";
+	const char* recordPath = nullptr;
+	const char* replayPath = nullptr;
+	const char* outPath = nullptr;
+
+	for (int i = 1; i < argc; i++)
+	{
+		const char* a = argv[i];
+		const char* v = (i + 1 < argc) ? argv[i + 1] : nullptr;
+		bool ok = (v != nullptr);
+
+		if (!strcmp(a, "--devs") && v) ok = parseList(v, devs);
+		else if (!strcmp(a, "--bauds") && v) ok = parseList(v, bauds);
+		else if (!strcmp(a, "--sizes") && v) ok = parseList(v, sizes);
+		else if (!strcmp(a, "--fs-read-us") && v) opt.fsCallNs = (uint32_t)strtoul(v, nullptr, 0) * 1000u;
+		else if (!strcmp(a, "--fs-byte-ns") && v) opt.fsByteNs = (uint32_t)strtoul(v, nullptr, 0);
+		else if (!strcmp(a, "--stub")) { opt.stub = true; continue; }
+		else if (!strcmp(a, "--seed") && v) seed = (uint32_t)strtoul(v, nullptr, 0);
+		else if (!strcmp(a, "--label") && v) label = v;
+		else if (!strcmp(a, "--record") && v) recordPath = v;
+		else if (!strcmp(a, "--replay") && v) replayPath = v;
+		else if (!strcmp(a, "--out") && v) outPath = v;
+		else ok = false;
+
+		if (!ok) { usage(); return 2; }
+		i++;
+	}
+
+	FILE* out = stdout;
+	if (outPath && !(out = fopen(outPath, "w")))
+	{
+		fprintf(stderr, "cannot open %s\n", outPath);
+		return 2;
+	}
+
+	STM32HostClock::setProfiling(true);
+	FilePrint print(out);
+	STM32JsonWriter json(print);
+	json.beginObject();
+	json.add("tool", "stm32bench");
+	json.add("version", STM32_BENCH_VERSION);
+	json.add("label", label);
+	json.add("fsReadCallUs", (unsigned long)(opt.fsCallNs / 1000u));
+	json.add("fsReadByteNs", (unsigned long)opt.fsByteNs);
+	json.add("stub", opt.stub);
+	json.beginArray("results");
+
+	bool allOk = true;
+	if (replayPath)
+	{
+		allOk = runReplay(replayPath, opt, json);
+	}
+	else if (recordPath)
+	{
+		FILE* f = fopen(recordPath, "w");
+		if (!f)
+		{
+			fprintf(stderr, "cannot open %s\n", recordPath);
+			return 2;
+		}
+		BenchCase c = { "sim", (uint16_t)devs[0], bauds[0], sizes[0] * 1024u, seed };
+		char v[16];
+		STM32TraceWriter rec(f);
+		snprintf(v, sizeof(v), "0x%03X", c.devId);
+		rec.header("dev", v);
+		snprintf(v, sizeof(v), "%u", (unsigned)c.baud);
+		rec.header("baud", v);
+		snprintf(v, sizeof(v), "%u", (unsigned)c.imageBytes);
+		rec.header("image-size", v);
+		snprintf(v, sizeof(v), "%u", (unsigned)c.seed);
+		rec.header("image-seed", v);
+		allOk = runSim(c, opt, json, &rec);
+		rec.flush();
+		fclose(f);
+	}
+	else
+	{
+		for (size_t d = 0; d < devs.size(); d++)
+		{
+			for (size_t b = 0; b < bauds.size(); b++)
+			{
+				for (size_t z = 0; z < sizes.size(); z++)
+				{
+					BenchCase c = { "sim", (uint16_t)devs[d], bauds[b], sizes[z] * 1024u, seed };
+					if (!runSim(c, opt, json, nullptr)) allOk = false;
+				}
+			}
+		}
+	}
+
+	json.endArray();
+	json.endObject();
+	print.write('\n');
+	if (out != stdout) fclose(out);
+
+	return allOk ? 0 : 1;
+}
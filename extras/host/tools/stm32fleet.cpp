@@ -0,0 +1,1118 @@
+/********************************************************************************************************
+ *  [FILE NAME]   :      <stm32fleet.cpp>                                                               *
+ *  [AUTHOR]      :      <David S. Alexander>                                                           *
+ *  [DATE CREATED]:      <Dec 10, 2025>                                                                 *
+ *  [Description] :      <Flashes one image onto many web flashers in parallel over their HTTP API>     *
+ ********************************************************************************************************/
+
+#include <Arduino.h>
+#include <arpa/inet.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <netdb.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <poll.h>
+#include <stdarg.h>
+#include <strings.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <atomic>
+#include <chrono>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+#include "STM32ImagePatch.h"
+#include "STM32JsonWriter.h"
+#include "STM32Sha256.h"
+
+#ifndef STM32_FLEET_VERSION
+#define STM32_FLEET_VERSION "unknown"
+#endif
+
+/* Same block size and size threshold as the web UI's patches */
+static const size_t PATCH_BLOCK = 32;
+static const double PATCH_MAX_RATIO = 0.8;
+static const int CONNECT_TIMEOUT_MS = 5000;
+
+class FilePrint : public Print
+{
+	public:
+	explicit FilePrint(FILE* f) : _f(f) {}
+	size_t write(uint8_t c) override { return fwrite(&c, 1, 1, _f); }
+	size_t write(const uint8_t* data, size_t len) override { return fwrite(data, 1, len, _f); }
+
+	private:
+	FILE* _f;
+};
+
+struct Options
+{
+	std::string user;
+	std::string pass;
+	char job;
+	bool verify;
+	bool force;
+	unsigned jobs;
+	unsigned retries;
+	int timeoutMs;
+	std::string cacheDir;
+};
+
+/* How the stored image was brought up to date */
+enum UploadPath
+{
+	PATH_NONE,
+	PATH_SKIP,
+	PATH_PATCH,
+	PATH_FULL
+};
+
+static const char* const PATH_NAMES[] = { "-", "skip", "patch", "upload" };
+
+enum Step
+{
+	STEP_LOGIN,
+	STEP_UPLOAD,
+	STEP_CONNECT,
+	STEP_PROGRAM,
+	STEP_VERIFY,
+	STEP_COUNT
+};
+
+static const char* const STEP_NAMES[STEP_COUNT] = { "login", "upload", "connect", "program", "verify" };
+
+struct Unit
+{
+	std::string name;
+	std::string host;
+	uint16_t port;
+
+	bool ok;
+	unsigned attempts;
+	UploadPath path;
+	uint32_t sent;
+	/* Times of the last attempt; totalMs covers all attempts and the waits between them */
+	uint32_t ms[STEP_COUNT];
+	uint32_t totalMs;
+	std::string desc;
+	std::string reply;
+	std::string error;
+};
+
+/* One result of an attempt: retrying cannot fix bad credentials or an image the preflight refuses */
+enum Outcome
+{
+	OUT_OK,
+	OUT_RETRY,
+	OUT_FATAL
+};
+
+struct Image
+{
+	std::vector<uint8_t> data;
+	uint8_t sha[STM32_SHA256_LEN];
+	char shaHex[2 * STM32_SHA256_LEN + 1];
+};
+
+static std::mutex s_logLock;
+
+static uint32_t nowMs()
+{
+	using namespace std::chrono;
+	return (uint32_t)duration_cast<milliseconds>(steady_clock::now().time_since_epoch()).count();
+}
+
+static void note(const Unit& u, const char* fmt, ...)
+{
+	char msg[256];
+	va_list ap;
+	va_start(ap, fmt);
+	vsnprintf(msg, sizeof(msg), fmt, ap);
+	va_end(ap);
+	std::lock_guard<std::mutex> lock(s_logLock);
+	fprintf(stderr, "[%s] %s\n", u.name.c_str(), msg);
+}
+
+static bool readFile(const std::string& path, std::vector<uint8_t>& out)
+{
+	FILE* f = fopen(path.c_str(), "rb");
+	if (!f) return false;
+	uint8_t buf[4096];
+	size_t n;
+	out.clear();
+	while ((n = fread(buf, 1, sizeof(buf), f)) > 0) out.insert(out.end(), buf, buf + n);
+	fclose(f);
+	return true;
+}
+
+static bool writeFile(const std::string& path, const std::vector<uint8_t>& data)
+{
+	std::string tmp = path + ".tmp";
+	FILE* f = fopen(tmp.c_str(), "wb");
+	if (!f) return false;
+	bool ok = fwrite(data.data(), 1, data.size(), f) == data.size();
+	ok = (fclose(f) == 0) && ok;
+	if (ok) ok = rename(tmp.c_str(), path.c_str()) == 0;
+	if (!ok) remove(tmp.c_str());
+	return ok;
+}
+
+/* mkdir -p */
+static bool makeDirs(const std::string& dir)
+{
+	for (size_t i = 1; i <= dir.size(); i++)
+	{
+		if (i < dir.size() && dir[i] != '/') continue;
+		std::string part = dir.substr(0, i);
+		if (mkdir(part.c_str(), 0755) != 0 && errno != EEXIST) return false;
+	}
+	struct stat st;
+	return stat(dir.c_str(), &st) == 0 && S_ISDIR(st.st_mode);
+}
+
+/* ---------------------------------------------------------------- HTTP */
+
+struct HttpReply
+{
+	int status;
+	std::string body;
+};
+
+static int openTcp(const std::string& host, uint16_t port, int timeoutMs, std::string& err)
+{
+	addrinfo hints;
+	memset(&hints, 0, sizeof(hints));
+	hints.ai_family = AF_UNSPEC;
+	hints.ai_socktype = SOCK_STREAM;
+	char service[8];
+	snprintf(service, sizeof(service), "%u", (unsigned)port);
+	addrinfo* list = nullptr;
+	int rc = getaddrinfo(host.c_str(), service, &hints, &list);
+	if (rc != 0)
+	{
+		err = std::string("cannot resolve ") + host + ": " + gai_strerror(rc);
+		return -1;
+	}
+
+	int fd = -1;
+	for (addrinfo* a = list; a && fd < 0; a = a->ai_next)
+	{
+		fd = socket(a->ai_family, a->ai_socktype, a->ai_protocol);
+		if (fd < 0) continue;
+		/* Non-blocking only for the connect, so an unplugged unit costs CONNECT_TIMEOUT_MS */
+		int flags = fcntl(fd, F_GETFL, 0);
+		fcntl(fd, F_SETFL, flags | O_NONBLOCK);
+		bool up = connect(fd, a->ai_addr, a->ai_addrlen) == 0;
+		if (!up && errno == EINPROGRESS)
+		{
+			pollfd p = { fd, POLLOUT, 0 };
+			int soErr = 0;
+			socklen_t len = sizeof(soErr);
+			up = poll(&p, 1, CONNECT_TIMEOUT_MS) == 1 && getsockopt(fd, SOL_SOCKET, SO_ERROR, &soErr, &len) == 0 && soErr == 0;
+			if (!up) errno = soErr ? soErr : ETIMEDOUT;
+		}
+		if (!up)
+		{
+			err = std::string("cannot connect: ") + strerror(errno);
+			close(fd);
+			fd = -1;
+			continue;
+		}
+		fcntl(fd, F_SETFL, flags);
+	}
+	freeaddrinfo(list);
+	if (fd < 0) return -1;
+
+	timeval tv;
+	tv.tv_sec = timeoutMs / 1000;
+	tv.tv_usec = (timeoutMs % 1000) * 1000;
+	setsockopt(fd, SOL_SOCKET, SO_RCVTIMEO, &tv, sizeof(tv));
+	setsockopt(fd, SOL_SOCKET, SO_SNDTIMEO, &tv, sizeof(tv));
+	int one = 1;
+	setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &one, sizeof(one));
+	return fd;
+}
+
+static bool sendAll(int fd, const char* data, size_t len)
+{
+	while (len)
+	{
+		ssize_t n = send(fd, data, len, MSG_NOSIGNAL);
+		if (n <= 0) return false;
+		data += n;
+		len -= (size_t)n;
+	}
+	return true;
+}
+
+static bool dechunk(std::string& body)
+{
+	std::string out;
+	size_t pos = 0;
+	for (;;)
+	{
+		size_t eol = body.find("\r\n", pos);
+		if (eol == std::string::npos) return false;
+		unsigned long n = strtoul(body.c_str() + pos, nullptr, 16);
+		pos = eol + 2;
+		if (n == 0) break;
+		if (pos + n > body.size()) return false;
+		out.append(body, pos, n);
+		pos += n + 2;
+	}
+	body.swap(out);
+	return true;
+}
+
+/* One request per connection ("Connection: close"), as the ESP8266 server serves one client at a time */
+static bool httpRequest(const Unit& u, const char* method, const std::string& path, const char* contentType,
+const std::string& body, int timeoutMs, HttpReply& reply, std::string& err)
+{
+	int fd = openTcp(u.host, u.port, timeoutMs, err);
+	if (fd < 0) return false;
+
+	char head[512];
+	int n = snprintf(head, sizeof(head), "%s %s HTTP/1.1\r\nHost: %s\r\nConnection: close\r\nUser-Agent: stm32fleet\r\n",
+	method, path.c_str(), u.host.c_str());
+	if (contentType) n += snprintf(head + n, sizeof(head) - n, "Content-Type: %s\r\n", contentType);
+	if (contentType || !body.empty() || !strcmp(method, "POST")) n += snprintf(head + n, sizeof(head) - n, "Content-Length: %zu\r\n", body.size());
+	n += snprintf(head + n, sizeof(head) - n, "\r\n");
+
+	if (!sendAll(fd, head, (size_t)n) || !sendAll(fd, body.data(), body.size()))
+	{
+		err = std::string("send failed: ") + strerror(errno);
+		close(fd);
+		return false;
+	}
+
+	std::string raw;
+	char buf[4096];
+	ssize_t got;
+	while ((got = recv(fd, buf, sizeof(buf), 0)) > 0) raw.append(buf, (size_t)got);
+	bool timedOut = got < 0;
+	close(fd);
+
+	size_t split = raw.find("\r\n\r\n");
+	if (split == std::string::npos || raw.compare(0, 5, "HTTP/") != 0)
+	{
+		err = timedOut ? "no reply (timeout)" : "malformed reply";
+		return false;
+	}
+	reply.status = atoi(raw.c_str() + raw.find(' ') + 1);
+	std::string headers = raw.substr(0, split);
+	reply.body = raw.substr(split + 4);
+
+	for (size_t i = 0; i < headers.size(); i++) headers[i] = (char)tolower((unsigned char)headers[i]);
+	if (headers.find("transfer-encoding: chunked") != std::string::npos && !dechunk(reply.body))
+	{
+		err = "truncated chunked reply";
+		return false;
+	}
+	return true;
+}
+
+static std::string urlEncode(const std::string& s)
+{
+	std::string out;
+	char hex[4];
+	for (size_t i = 0; i < s.size(); i++)
+	{
+		unsigned char c = (unsigned char)s[i];
+		if (isalnum(c) || c == '-' || c == '_' || c == '.' || c == '~') out += (char)c;
+		else { snprintf(hex, sizeof(hex), "%%%02X", c); out += hex; }
+	}
+	return out;
+}
+
+/* The value of a top-level "key": a string without its quotes, or the raw token */
+static bool jsonField(const std::string& body, const char* key, std::string& value)
+{
+	std::string pat = std::string("\"") + key + "\":";
+	size_t p = body.find(pat);
+	if (p == std::string::npos) return false;
+	p += pat.size();
+	value.clear();
+	if (p < body.size() && body[p] == '"')
+	{
+		for (p++; p < body.size() && body[p] != '"'; p++)
+		{
+			if (body[p] == '\\' && p + 1 < body.size()) p++;
+			value += body[p];
+		}
+		return true;
+	}
+	while (p < body.size() && body[p] != ',' && body[p] != '}') value += body[p++];
+	return true;
+}
+
+static bool jsonOk(const std::string& body)
+{
+	std::string v;
+	return jsonField(body, "ok", v) && v == "true";
+}
+
+static std::string multipart(const char* field, const char* filename, const std::vector<uint8_t>& data, std::string& contentType)
+{
+	static const char BOUNDARY[] = "----stm32fleet7d3a9c51e4b2";
+	contentType = std::string("multipart/form-data; boundary=") + BOUNDARY;
+	std::string body;
+	body.reserve(data.size() + 256);
+	body += std::string("--") + BOUNDARY + "\r\n";
+	body += std::string("Content-Disposition: form-data; name=\"") + field + "\"; filename=\"" + filename + "\"\r\n";
+	body += "Content-Type: application/octet-stream\r\n\r\n";
+	body.append((const char*)data.data(), data.size());
+	body += std::string("\r\n--") + BOUNDARY + "--\r\n";
+	return body;
+}
+
+/* ---------------------------------------------------------------- patches */
+
+static void put32(std::vector<uint8_t>& out, uint32_t v)
+{
+	for (int i = 0; i < 4; i++) out.push_back((uint8_t)(v >> (8 * i)));
+}
+
+static uint32_t weakSum(const uint8_t* p, uint32_t& a, uint32_t& b)
+{
+	a = 0;
+	b = 0;
+	for (size_t i = 0; i < PATCH_BLOCK; i++)
+	{
+		a += p[i];
+		b += (uint32_t)(PATCH_BLOCK - i) * p[i];
+	}
+	a &= 0xFFFF;
+	b &= 0xFFFF;
+	return (b << 16) | a;
+}
+
+/* rsync-style diff, the same as the web UI's: base blocks are indexed by a rolling checksum, matches
+   found at any offset of the new image are grown in both directions, and the rest becomes inserts */
+static void makePatch(const std::vector<uint8_t>& base, const Image& next, const uint8_t* baseSha, std::vector<uint8_t>& out)
+{
+	const std::vector<uint8_t>& img = next.data;
+	std::unordered_map<uint32_t, uint32_t> blocks;
+	uint32_t a, b;
+	for (size_t off = 0; off + PATCH_BLOCK <= base.size(); off += PATCH_BLOCK)
+	{
+		blocks.insert(std::make_pair(weakSum(&base[off], a, b), (uint32_t)off));
+	}
+
+	out.clear();
+	out.insert(out.end(), { 'S', 'T', 'M', 'D', STM32_PATCH_VERSION, 0, 0, 0 });
+	put32(out, (uint32_t)base.size());
+	put32(out, (uint32_t)img.size());
+	out.insert(out.end(), baseSha, baseSha + STM32_SHA256_LEN);
+	out.insert(out.end(), next.sha, next.sha + STM32_SHA256_LEN);
+
+	size_t lit = 0;
+	auto insert = [&](size_t from, size_t to)
+	{
+		if (to <= from) return;
+		out.push_back(STM32_PATCH_INSERT);
+		put32(out, (uint32_t)(to - from));
+		out.insert(out.end(), img.begin() + from, img.begin() + to);
+	};
+
+	size_t i = 0;
+	a = b = 0;
+	if (img.size() >= PATCH_BLOCK) weakSum(&img[0], a, b);
+	while (i + PATCH_BLOCK <= img.size())
+	{
+		auto hit = blocks.find((b << 16) | a);
+		size_t len = 0;
+		if (hit != blocks.end())
+		{
+			while (len < PATCH_BLOCK && img[i + len] == base[hit->second + len]) len++;
+		}
+		if (len == PATCH_BLOCK)
+		{
+			size_t s = i;
+			size_t o = hit->second;
+			while (s > lit && o > 0 && img[s - 1] == base[o - 1]) { s--; o--; }
+			len += i - s;
+			while (s + len < img.size() && o + len < base.size() && img[s + len] == base[o + len]) len++;
+			insert(lit, s);
+			out.push_back(STM32_PATCH_COPY);
+			put32(out, (uint32_t)o);
+			put32(out, (uint32_t)len);
+			i = lit = s + len;
+			if (i + PATCH_BLOCK <= img.size()) weakSum(&img[i], a, b);
+			continue;
+		}
+		if (i + PATCH_BLOCK < img.size())
+		{
+			uint32_t drop = img[i];
+			uint32_t add = img[i + PATCH_BLOCK];
+			a = (a - drop + add) & 0xFFFF;
+			b = (b - (uint32_t)PATCH_BLOCK * drop + a) & 0xFFFF;
+		}
+		i++;
+	}
+	insert(lit, img.size());
+}
+
+static bool fromHex(const std::string& hex, uint8_t* out, size_t len)
+{
+	if (hex.size() != 2 * len) return false;
+	for (size_t i = 0; i < len; i++)
+	{
+		char byte[3] = { hex[2 * i], hex[2 * i + 1], 0 };
+		char* end;
+		out[i] = (uint8_t)strtoul(byte, &end, 16);
+		if (*end) return false;
+	}
+	return true;
+}
+
+/* Units usually share a handful of old images, so each patch is made once per base and reused */
+class PatchCache
+{
+	public:
+	PatchCache(const Image& next, const std::string& dir) : _next(next), _dir(dir) {}
+
+	/* nullptr when there is no copy of the base, or the patch would not save enough */
+	std::shared_ptr<const std::vector<uint8_t>> get(const std::string& baseHex)
+	{
+		if (_dir.empty()) return nullptr;
+		std::lock_guard<std::mutex> lock(_lock);
+		auto it = _patches.find(baseHex);
+		if (it != _patches.end()) return it->second;
+
+		std::shared_ptr<std::vector<uint8_t>> patch;
+		std::vector<uint8_t> base;
+		uint8_t baseSha[STM32_SHA256_LEN];
+		if (fromHex(baseHex, baseSha, sizeof(baseSha)) && readFile(_dir + "/" + baseHex + ".bin", base))
+		{
+			/* A damaged cache file would only earn a 409, but checking it is cheaper */
+			uint8_t check[STM32_SHA256_LEN];
+			STM32Sha256 sha;
+			sha.update(base.data(), base.size());
+			sha.finish(check);
+			if (memcmp(check, baseSha, sizeof(check)) == 0)
+			{
+				patch = std::make_shared<std::vector<uint8_t>>();
+				makePatch(base, _next, baseSha, *patch);
+				if (patch->size() >= _next.data.size() * PATCH_MAX_RATIO) patch.reset();
+			}
+		}
+		_patches[baseHex] = patch;
+		return patch;
+	}
+
+	private:
+	const Image& _next;
+	std::string _dir;
+	std::mutex _lock;
+	std::map<std::string, std::shared_ptr<const std::vector<uint8_t>>> _patches;
+};
+
+/* ---------------------------------------------------------------- one unit */
+
+class UnitRunner
+{
+	public:
+	UnitRunner(Unit& unit, const Image& image, const Options& opt, PatchCache& patches)
+	: _u(unit),
+	_image(image),
+	_opt(opt),
+	_patches(patches)
+	{
+	}
+
+	void run()
+	{
+		uint32_t start = nowMs();
+		Outcome out = OUT_RETRY;
+		for (_u.attempts = 0; _u.attempts <= _opt.retries && out == OUT_RETRY; )
+		{
+			if (_u.attempts) sleep(_u.attempts < 5 ? _u.attempts : 5);
+			_u.attempts++;
+			memset(_u.ms, 0, sizeof(_u.ms));
+			_u.error.clear();
+			out = attempt();
+			if (out != OUT_OK) note(_u, "attempt %u failed: %s", _u.attempts, _u.error.c_str());
+		}
+		_u.ok = (out == OUT_OK);
+		_u.totalMs = nowMs() - start;
+		note(_u, "%s in %.1f s", _u.ok ? "done" : "FAILED", _u.totalMs / 1000.0);
+	}
+
+	private:
+	Unit& _u;
+	const Image& _image;
+	const Options& _opt;
+	PatchCache& _patches;
+
+	Outcome fail(Outcome out, const std::string& error)
+	{
+		_u.error = error;
+		return out;
+	}
+
+	bool request(const char* method, const std::string& path, const char* contentType, const std::string& body, HttpReply& reply)
+	{
+		std::string err;
+		if (httpRequest(_u, method, path, contentType, body, _opt.timeoutMs, reply, err)) return true;
+		_u.error = path + ": " + err;
+		return false;
+	}
+
+	/* GET /image; an empty string when the unit holds no image */
+	bool storedSha(std::string& sha)
+	{
+		HttpReply r;
+		sha.clear();
+		if (!request("GET", "/image", nullptr, "", r)) return false;
+		if (r.status == 404) return true;
+		if (r.status != 200 || !jsonField(r.body, "sha256", sha))
+		{
+			_u.error = "/image: HTTP " + std::to_string(r.status);
+			return false;
+		}
+		return true;
+	}
+
+	Outcome login()
+	{
+		HttpReply r;
+		std::string form = "user=" + urlEncode(_opt.user) + "&pass=" + urlEncode(_opt.pass);
+		if (!request("POST", "/login", "application/x-www-form-urlencoded", form, r)) return OUT_RETRY;
+		if (r.status == 200 && jsonOk(r.body)) return OUT_OK;
+		std::string why;
+		jsonField(r.body, "error", why);
+		return fail(r.status == 200 ? OUT_FATAL : OUT_RETRY, "login: " + (why.empty() ? "HTTP " + std::to_string(r.status) : why));
+	}
+
+	/* Skips the transfer when the unit already holds the image, else tries a patch against what it
+	   holds, else sends the whole image. A retry after a transfer that got through starts here and
+	   skips it, so only the failed step is repeated. */
+	Outcome upload()
+	{
+		std::string have;
+		if (!storedSha(have)) return OUT_RETRY;
+		if (have == _image.shaHex)
+		{
+			/* An earlier attempt's transfer is the one worth reporting */
+			if (_u.path == PATH_NONE) _u.path = PATH_SKIP;
+			return OUT_OK;
+		}
+
+		UploadPath path = PATH_NONE;
+
+		HttpReply r;
+		std::string type;
+		std::shared_ptr<const std::vector<uint8_t>> patch = have.empty() ? nullptr : _patches.get(have);
+		if (patch)
+		{
+			std::string body = multipart("patch", "image.bin.patch", *patch, type);
+			if (!request("POST", "/patch", type.c_str(), body, r)) return OUT_RETRY;
+			_u.sent += (uint32_t)patch->size();
+			if (r.status == 200) path = PATH_PATCH;
+			/* 409: the image changed since /image or the result did not check out; 507 would refuse a full upload too */
+			else if (r.status != 409) return fail(OUT_RETRY, "/patch: " + r.body);
+			else note(_u, "%s, sending the whole image", r.body.c_str());
+		}
+
+		if (path != PATH_PATCH)
+		{
+			std::string body = multipart("firmware", "image.bin", _image.data, type);
+			if (!request("POST", "/upload", type.c_str(), body, r)) return OUT_RETRY;
+			_u.sent += (uint32_t)_image.data.size();
+			if (r.status != 200) return fail(OUT_RETRY, "/upload: " + r.body);
+			path = PATH_FULL;
+		}
+		_u.path = path;
+
+		/* The unit hashed what it stored; a short or damaged transfer shows up here */
+		if (!storedSha(have)) return OUT_RETRY;
+		if (have != _image.shaHex) return fail(OUT_RETRY, "stored image does not match after the upload");
+		return OUT_OK;
+	}
+
+	Outcome connectTarget()
+	{
+		HttpReply r;
+		if (!request("POST", "/connect", nullptr, "", r)) return OUT_RETRY;
+		if (r.status == 200 && jsonOk(r.body))
+		{
+			jsonField(r.body, "desc", _u.desc);
+			return OUT_OK;
+		}
+		std::string why;
+		if (!jsonField(r.body, "error", why)) why = "HTTP " + std::to_string(r.status);
+		return fail(OUT_RETRY, "connect: " + why);
+	}
+
+	Outcome command(char c, const char* okPrefix, const char* extra)
+	{
+		HttpReply r;
+		std::string path = std::string("/cmd?c=") + c + extra;
+		if (!request("GET", path, nullptr, "", r)) return OUT_RETRY;
+		_u.reply = r.body;
+		if (r.status == 200 && r.body.compare(0, strlen(okPrefix), okPrefix) == 0) return OUT_OK;
+		Outcome out = (r.body.compare(0, 15, "Preflight NO-GO") == 0) ? OUT_FATAL : OUT_RETRY;
+		return fail(out, std::string(1, c) + ": " + (r.body.empty() ? "HTTP " + std::to_string(r.status) : r.body));
+	}
+
+	Outcome attempt()
+	{
+		Outcome out;
+		uint32_t t = nowMs();
+		auto lap = [&](Step s) { uint32_t n = nowMs(); _u.ms[s] = n - t; t = n; };
+
+		if ((out = login()) != OUT_OK) return out;
+		lap(STEP_LOGIN);
+		if ((out = upload()) != OUT_OK) return out;
+		lap(STEP_UPLOAD);
+		if ((out = connectTarget()) != OUT_OK) return out;
+		lap(STEP_CONNECT);
+
+		const char* okPrefix = (_opt.job == 'D') ? "Delta OK" : "Upload OK";
+		if ((out = command(_opt.job, okPrefix, _opt.force ? "&f=1" : "")) != OUT_OK) return out;
+		lap(STEP_PROGRAM);
+		if (_opt.verify)
+		{
+			std::string programReply = _u.reply;
+			if ((out = command('V', "Verify OK", "")) != OUT_OK) return out;
+			_u.reply = programReply;
+			lap(STEP_VERIFY);
+		}
+
+		/* Leaves the bootloader, so the target runs the new image */
+		HttpReply r;
+		request("POST", "/disconnect", nullptr, "", r);
+		return OUT_OK;
+	}
+};
+
+/* ---------------------------------------------------------------- mDNS */
+
+static const char HTTP_SERVICE[] = "_http._tcp.local";
+
+static bool readName(const uint8_t* msg, size_t len, size_t& pos, std::string& out)
+{
+	out.clear();
+	size_t p = pos;
+	bool jumped = false;
+	for (int hops = 0; p < len; )
+	{
+		uint8_t l = msg[p];
+		if ((l & 0xC0) == 0xC0)
+		{
+			if (p + 1 >= len || ++hops > 16) return false;
+			if (!jumped) pos = p + 2;
+			jumped = true;
+			p = ((size_t)(l & 0x3F) << 8) | msg[p + 1];
+			continue;
+		}
+		p++;
+		if (l == 0)
+		{
+			if (!jumped) pos = p;
+			return true;
+		}
+		if (p + l > len) return false;
+		if (!out.empty()) out += '.';
+		out.append((const char*)msg + p, l);
+		p += l;
+	}
+	return false;
+}
+
+struct MdnsInstance
+{
+	uint16_t port;
+	std::string target;
+	in_addr from;
+};
+
+/* Collects the answers of one packet: PTRs to instances of _http._tcp, their SRVs and A records */
+static void parseMdns(const uint8_t* msg, size_t len, in_addr from, std::map<std::string, MdnsInstance>& found,
+std::map<std::string, in_addr>& addrs)
+{
+	if (len < 12) return;
+	size_t qd = (size_t)(msg[4] << 8 | msg[5]);
+	size_t rr = (size_t)(msg[6] << 8 | msg[7]) + (size_t)(msg[8] << 8 | msg[9]) + (size_t)(msg[10] << 8 | msg[11]);
+	size_t pos = 12;
+	std::string name;
+	for (size_t i = 0; i < qd; i++)
+	{
+		if (!readName(msg, len, pos, name) || pos + 4 > len) return;
+		pos += 4;
+	}
+	for (size_t i = 0; i < rr; i++)
+	{
+		if (!readName(msg, len, pos, name) || pos + 10 > len) return;
+		uint16_t type = (uint16_t)(msg[pos] << 8 | msg[pos + 1]);
+		size_t rdlen = (size_t)(msg[pos + 8] << 8 | msg[pos + 9]);
+		pos += 10;
+		if (pos + rdlen > len) return;
+		size_t rd = pos;
+		std::string value;
+
+		if (type == 12 && !strcasecmp(name.c_str(), HTTP_SERVICE) && readName(msg, len, rd, value))
+		{
+			MdnsInstance& inst = found[value];
+			inst.from = from;
+			if (!inst.port) inst.port = 80;
+		}
+		else if (type == 33 && rdlen >= 7)
+		{
+			rd += 6;
+			if (readName(msg, len, rd, value))
+			{
+				MdnsInstance& inst = found[name];
+				inst.port = (uint16_t)(msg[pos + 4] << 8 | msg[pos + 5]);
+				inst.target = value;
+				inst.from = from;
+			}
+		}
+		else if (type == 1 && rdlen == 4)
+		{
+			memcpy(&addrs[name], msg + pos, 4);
+		}
+		pos += rdlen;
+	}
+}
+
+/* One-shot legacy query from an ephemeral port: responders answer straight back to it (RFC 6762 6.7) */
+static bool discover(int waitMs, const char* match, std::vector<Unit>& units)
+{
+	int fd = socket(AF_INET, SOCK_DGRAM, 0);
+	if (fd < 0) { perror("mdns socket"); return false; }
+	unsigned char ttl = 255;
+	setsockopt(fd, IPPROTO_IP, IP_MULTICAST_TTL, &ttl, sizeof(ttl));
+
+	uint8_t query[64] = { 0 };
+	query[5] = 1;
+	size_t n = 12;
+	for (const char* label : { "_http", "_tcp", "local" })
+	{
+		query[n++] = (uint8_t)strlen(label);
+		memcpy(query + n, label, strlen(label));
+		n += strlen(label);
+	}
+	query[n++] = 0;
+	query[n++] = 0;
+	query[n++] = 12;
+	query[n++] = 0;
+	query[n++] = 1;
+
+	sockaddr_in group;
+	memset(&group, 0, sizeof(group));
+	group.sin_family = AF_INET;
+	group.sin_port = htons(5353);
+	inet_pton(AF_INET, "224.0.0.251", &group.sin_addr);
+
+	std::map<std::string, MdnsInstance> found;
+	std::map<std::string, in_addr> addrs;
+	uint32_t start = nowMs();
+	bool resent = false;
+	if (sendto(fd, query, n, 0, (sockaddr*)&group, sizeof(group)) < 0) { perror("mdns query"); close(fd); return false; }
+
+	for (;;)
+	{
+		int left = waitMs - (int)(nowMs() - start);
+		if (left <= 0) break;
+		/* A second query halfway catches units that missed the first */
+		if (!resent && left < waitMs / 2)
+		{
+			sendto(fd, query, n, 0, (sockaddr*)&group, sizeof(group));
+			resent = true;
+		}
+		pollfd p = { fd, POLLIN, 0 };
+		if (poll(&p, 1, resent ? left : left - waitMs / 2) <= 0) continue;
+		uint8_t msg[1500];
+		sockaddr_in from;
+		socklen_t fromLen = sizeof(from);
+		ssize_t got = recvfrom(fd, msg, sizeof(msg), 0, (sockaddr*)&from, &fromLen);
+		if (got > 0) parseMdns(msg, (size_t)got, from.sin_addr, found, addrs);
+	}
+	close(fd);
+
+	for (auto& it : found)
+	{
+		std::string name = it.first.substr(0, it.first.find('.'));
+		if (match && name.find(match) == std::string::npos) continue;
+		auto a = addrs.find(it.second.target);
+		in_addr ip = (a != addrs.end()) ? a->second : it.second.from;
+		char text[INET_ADDRSTRLEN];
+		inet_ntop(AF_INET, &ip, text, sizeof(text));
+		Unit u = Unit();
+		u.name = name;
+		u.host = text;
+		u.port = it.second.port ? it.second.port : 80;
+		units.push_back(u);
+	}
+	return true;
+}
+
+/* Anything else on the network announcing _http._tcp is dropped: a flasher's /status names its
+   mDNS host even before login */
+static bool isFlasher(Unit& u, int timeoutMs)
+{
+	HttpReply r;
+	std::string err, host;
+	if (!httpRequest(u, "GET", "/status", nullptr, "", timeoutMs, r, err)) return false;
+	return (r.status == 200 || r.status == 403) && jsonField(r.body, "host", host);
+}
+
+/* ---------------------------------------------------------------- report */
+
+static bool parseUnit(const std::string& spec, Unit& u)
+{
+	u = Unit();
+	size_t colon = spec.rfind(':');
+	u.host = spec.substr(0, colon);
+	u.port = 80;
+	if (colon != std::string::npos)
+	{
+		char* end;
+		unsigned long port = strtoul(spec.c_str() + colon + 1, &end, 10);
+		if (*end || port == 0 || port > 65535) return false;
+		u.port = (uint16_t)port;
+	}
+	u.name = spec;
+	return !u.host.empty();
+}
+
+static bool readHosts(const char* path, std::vector<Unit>& units)
+{
+	FILE* f = fopen(path, "r");
+	if (!f) return false;
+	char line[256];
+	bool ok = true;
+	while (fgets(line, sizeof(line), f))
+	{
+		char* p = line + strspn(line, " \t");
+		p[strcspn(p, " \t\r\n#")] = 0;
+		if (!*p) continue;
+		Unit u;
+		if (!parseUnit(p, u)) { fprintf(stderr, "%s: bad unit \"%s\"\n", path, p); ok = false; continue; }
+		units.push_back(u);
+	}
+	fclose(f);
+	return ok;
+}
+
+static void printTable(const std::vector<Unit>& units)
+{
+	printf("%-20s %-21s %-6s %-6s %10s %7s %7s %8s %8s %8s %8s %5s\n", "unit", "address", "result", "path", "sent",
+	"login", "upload", "connect", "program", "verify", "total", "tries");
+	for (const Unit& u : units)
+	{
+		char addr[64];
+		snprintf(addr, sizeof(addr), "%s:%u", u.host.c_str(), (unsigned)u.port);
+		printf("%-20s %-21s %-6s %-6s %10u", u.name.c_str(), addr, u.ok ? "ok" : "FAIL", PATH_NAMES[u.path], (unsigned)u.sent);
+		for (int s = 0; s < STEP_COUNT; s++) printf(" %*u", s == STEP_LOGIN || s == STEP_UPLOAD ? 7 : 8, (unsigned)u.ms[s]);
+		printf(" %8u %5u\n", (unsigned)u.totalMs, u.attempts);
+		if (!u.ok) printf("  %s\n", u.error.c_str());
+	}
+}
+
+static void writeReport(FILE* f, const std::vector<Unit>& units, const Image& image, const char* imagePath, const Options& opt,
+uint32_t wallMs)
+{
+	FilePrint print(f);
+	STM32JsonWriter json(print);
+	size_t ok = 0;
+	for (const Unit& u : units) ok += u.ok;
+
+	json.beginObject();
+	json.add("tool", "stm32fleet");
+	json.add("version", STM32_FLEET_VERSION);
+	json.beginObject("image");
+	json.add("path", imagePath);
+	json.add("size", (unsigned long)image.data.size());
+	json.add("sha256", image.shaHex);
+	json.endObject();
+	char job[2] = { opt.job, 0 };
+	json.add("job", job);
+	json.add("verify", opt.verify);
+	json.add("jobs", opt.jobs);
+	json.add("retries", opt.retries);
+	json.add("units", (unsigned long)units.size());
+	json.add("ok", (unsigned long)ok);
+	json.add("failed", (unsigned long)(units.size() - ok));
+	json.add("wallMs", (unsigned long)wallMs);
+	json.beginArray("results");
+	for (const Unit& u : units)
+	{
+		json.beginObject();
+		json.add("name", u.name.c_str());
+		json.add("host", u.host.c_str());
+		json.add("port", (unsigned)u.port);
+		json.add("ok", u.ok);
+		json.add("attempts", u.attempts);
+		json.add("path", PATH_NAMES[u.path]);
+		json.add("sentBytes", (unsigned long)u.sent);
+		json.add("desc", u.desc.c_str());
+		json.add("reply", u.reply.c_str());
+		if (!u.ok) json.add("error", u.error.c_str());
+		json.beginObject("ms");
+		for (int s = 0; s < STEP_COUNT; s++) json.add(STEP_NAMES[s], (unsigned long)u.ms[s]);
+		json.add("total", (unsigned long)u.totalMs);
+		json.endObject();
+		json.endObject();
+	}
+	json.endArray();
+	json.endObject();
+	print.write('\n');
+}
+
+static void usage()
+{
+	puts("usage: stm32fleet [options] <image.bin>\n"
+	"  --discover <ms>      find flashers over mDNS (_http._tcp) for this long (2000 if no units given)\n"
+	"  --match <text>       only discovered units whose name contains text\n"
+	"  --unit <host[:port]> flash this unit; repeatable\n"
+	"  --hosts <file>       units from a file, one host[:port] per line, # comments\n"
+	"  --user <name>        web login (admin)\n"
+	"  --pass <password>    web password (admin)\n"
+	"  --job S|D|U          program job: full update, delta update or program only (S)\n"
+	"  --no-verify          skip the V job after programming\n"
+	"  --force              program even if the preflight check says NO-GO (f=1)\n"
+	"  --jobs <n>           units flashed at the same time (4)\n"
+	"  --retries <n>        extra attempts per unit after a failure (2)\n"
+	"  --timeout <s>        per-request timeout; erase and program replies count (600)\n"
+	"  --cache <dir>        keep sent images here and send patches against them\n"
+	"  --out <file>         write the JSON report here\n"
+	"  --list               discover and list units, flash nothing");
+}
+
+int main(int argc, char** argv)
+{
+	Options opt;
+	opt.user = "admin";
+	opt.pass = "admin";
+	opt.job = 'S';
+	opt.verify = true;
+	opt.force = false;
+	opt.jobs = 4;
+	opt.retries = 2;
+	opt.timeoutMs = 600000;
+
+	std::vector<Unit> units;
+	int discoverMs = -1;
+	const char* match = nullptr;
+	const char* imagePath = nullptr;
+	const char* outPath = nullptr;
+	bool listOnly = false;
+
+	for (int i = 1; i < argc; i++)
+	{
+		const char* a = argv[i];
+		const char* v = (i + 1 < argc) ? argv[i + 1] : nullptr;
+		bool ok = (v != nullptr);
+		Unit u;
+
+		if (!strcmp(a, "--no-verify")) { opt.verify = false; continue; }
+		else if (!strcmp(a, "--force")) { opt.force = true; continue; }
+		else if (!strcmp(a, "--list")) { listOnly = true; continue; }
+		else if (a[0] != '-' && !imagePath) { imagePath = a; continue; }
+		else if (!strcmp(a, "--discover") && v) discoverMs = atoi(v);
+		else if (!strcmp(a, "--match") && v) match = v;
+		else if (!strcmp(a, "--unit") && v) { ok = parseUnit(v, u); units.push_back(u); }
+		else if (!strcmp(a, "--hosts") && v) ok = readHosts(v, units);
+		else if (!strcmp(a, "--user") && v) opt.user = v;
+		else if (!strcmp(a, "--pass") && v) opt.pass = v;
+		else if (!strcmp(a, "--job") && v) { opt.job = v[0]; ok = !v[1] && strchr("SDU", v[0]); }
+		else if (!strcmp(a, "--jobs") && v) ok = (opt.jobs = (unsigned)atoi(v)) > 0;
+		else if (!strcmp(a, "--retries") && v) opt.retries = (unsigned)atoi(v);
+		else if (!strcmp(a, "--timeout") && v) ok = (opt.timeoutMs = atoi(v) * 1000) > 0;
+		else if (!strcmp(a, "--cache") && v) opt.cacheDir = v;
+		else if (!strcmp(a, "--out") && v) outPath = v;
+		else ok = false;
+
+		if (!ok) { usage(); return 2; }
+		i++;
+	}
+	if (!imagePath && !listOnly) { usage(); return 2; }
+
+	if (discoverMs < 0 && units.empty()) discoverMs = 2000;
+	if (discoverMs > 0)
+	{
+		std::vector<Unit> found;
+		if (!discover(discoverMs, match, found)) return 2;
+		for (Unit& u : found)
+		{
+			if (isFlasher(u, CONNECT_TIMEOUT_MS)) units.push_back(u);
+			else fprintf(stderr, "skipping %s (%s:%u): not a flasher\n", u.name.c_str(), u.host.c_str(), (unsigned)u.port);
+		}
+	}
+	if (listOnly)
+	{
+		for (const Unit& u : units) printf("%-20s %s:%u\n", u.name.c_str(), u.host.c_str(), (unsigned)u.port);
+		return 0;
+	}
+	if (units.empty()) { fprintf(stderr, "no units\n"); return 2; }
+
+	Image image;
+	if (!readFile(imagePath, image.data) || image.data.empty())
+	{
+		fprintf(stderr, "cannot read %s\n", imagePath);
+		return 2;
+	}
+	STM32Sha256 sha;
+	sha.update(image.data.data(), image.data.size());
+	sha.finish(image.sha);
+	STM32Sha256::toHex(image.sha, image.shaHex);
+
+	/* Cached first, so the next run can patch against this image even if every unit fails now.
+	   Without it the next run only loses its patches, so a failed write is not fatal. */
+	if (!opt.cacheDir.empty())
+	{
+		std::string path = opt.cacheDir + "/" + image.shaHex + ".bin";
+		if (access(path.c_str(), R_OK) != 0 && !(makeDirs(opt.cacheDir) && writeFile(path, image.data)))
+		{
+			fprintf(stderr, "warning: cannot write %s (%s); the next run will send full images\n", path.c_str(), strerror(errno));
+		}
+	}
+
+	FILE* out = nullptr;
+	if (outPath && !(out = fopen(outPath, "w")))
+	{
+		fprintf(stderr, "cannot open %s\n", outPath);
+		return 2;
+	}
+
+	unsigned jobs = (opt.jobs < units.size()) ? opt.jobs : (unsigned)units.size();
+	fprintf(stderr, "flashing %zu bytes (sha256 %.16s...) to %zu unit(s), %u at a time\n", image.data.size(), image.shaHex,
+	units.size(), jobs);
+	PatchCache patches(image, opt.cacheDir);
+	std::atomic<size_t> next(0);
+	uint32_t start = nowMs();
+	std::vector<std::thread> workers;
+	for (unsigned w = 0; w < jobs; w++)
+	{
+		workers.emplace_back([&]()
+		{
+			for (size_t i; (i = next++) < units.size(); )
+			{
+				UnitRunner runner(units[i], image, opt, patches);
+				runner.run();
+			}
+		});
+	}
+	for (std::thread& t : workers) t.join();
+	uint32_t wallMs = nowMs() - start;
+
+	printTable(units);
+	size_t ok = 0;
+	for (const Unit& u : units) ok += u.ok;
+	printf("%zu unit(s), %zu ok, %zu failed, %.1f s\n", units.size(), ok, units.size() - ok, wallMs / 1000.0);
+
+	if (out)
+	{
+		writeReport(out, units, image, imagePath, opt, wallMs);
+		fclose(out);
+	}
+	return (ok == units.size()) ? 0 : 1;
+}
@@ -0,0 +1,392 @@
+/********************************************************************************************************
+ *  [FILE NAME]   :      <stm32frames.cpp>                                                              *
+ *  [AUTHOR]      :      <David S. Alexander>                                                           *
+ *  [DATE CREATED]:      <Dec 10, 2025>                                                                 *
+ *  [Description] :      <Decodes STM32FrameTracer captures into annotated AN3155 transactions>         *
+ ********************************************************************************************************/
+
+#include <Arduino.h>
+#include <algorithm>
+#include <string>
+#include <vector>
+#include "STM32DeviceConstants.h"
+#include "STM32FrameTracer.h"
+
+struct Frame
+{
+	bool rx;
+	bool truncated;
+	uint32_t startUs;
+	uint32_t durUs;
+	std::vector<uint8_t> data;
+};
+
+struct Capture
+{
+	uint8_t version;
+	uint8_t link;
+	uint32_t rate;
+	uint32_t frames;
+	uint32_t dropped;
+	std::vector<Frame> list;
+};
+
+/* What the next TX frame is expected to be, from the command that was acknowledged */
+enum Expect
+{
+	EXPECT_CMD,
+	EXPECT_ADDR,
+	EXPECT_READ_LEN,
+	EXPECT_WRITE_DATA,
+	EXPECT_ERASE_ARGS
+};
+
+/* ACK latencies grouped by command and by what the ACK answered */
+struct LatencyGroup
+{
+	std::string name;
+	std::vector<uint32_t> us;
+};
+
+static uint16_t get16(const uint8_t* p) { return (uint16_t)(p[0] | (p[1] << 8)); }
+static uint32_t get32(const uint8_t* p) { return (uint32_t)p[0] | ((uint32_t)p[1] << 8) | ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24); }
+
+static bool load(const char* path, Capture& cap)
+{
+	FILE* f = fopen(path, "rb");
+	if (!f) { fprintf(stderr, "cannot open %s\n", path); return false; }
+	std::vector<uint8_t> buf;
+	uint8_t tmp[4096];
+	size_t n;
+	while ((n = fread(tmp, 1, sizeof(tmp), f)) > 0) buf.insert(buf.end(), tmp, tmp + n);
+	fclose(f);
+
+	if (buf.size() < STM32_FRAME_HEADER_LEN || memcmp(buf.data(), "STMF", 4) != 0)
+	{
+		fprintf(stderr, "%s: not a frame capture\n", path);
+		return false;
+	}
+	cap.version = buf[4];
+	if (cap.version != STM32_FRAME_VERSION)
+	{
+		fprintf(stderr, "%s: capture version %u, expected %u\n", path, cap.version, STM32_FRAME_VERSION);
+		return false;
+	}
+	cap.link = buf[5];
+	cap.rate = get32(&buf[8]);
+	cap.frames = get32(&buf[12]);
+	cap.dropped = get32(&buf[16]);
+
+	size_t pos = STM32_FRAME_HEADER_LEN;
+	while (pos + STM32_FRAME_RECORD_LEN <= buf.size())
+	{
+		const uint8_t* h = &buf[pos];
+		Frame fr;
+		fr.rx = (h[0] & STM32_FRAME_RX) != 0;
+		fr.truncated = (h[0] & STM32_FRAME_TRUNCATED) != 0;
+		uint16_t len = get16(h + 1);
+		fr.startUs = get32(h + 3);
+		fr.durUs = get16(h + 7);
+		pos += STM32_FRAME_RECORD_LEN;
+		if (pos + len > buf.size())
+		{
+			fprintf(stderr, "%s: frame %zu is cut short\n", path, cap.list.size());
+			break;
+		}
+		fr.data.assign(buf.begin() + pos, buf.begin() + pos + len);
+		pos += len;
+		cap.list.push_back(fr);
+	}
+	return true;
+}
+
+static const char* cmdName(uint8_t cmd)
+{
+	switch (cmd)
+	{
+		case STM32_CMD_GET: return "GET";
+		case STM32_CMD_GET_VER: return "GET_VERSION";
+		case STM32_CMD_GET_ID: return "GET_ID";
+		case STM32_CMD_READ: return "READ_MEMORY";
+		case STM32_CMD_GO: return "GO";
+		case STM32_CMD_WRITE: return "WRITE_MEMORY";
+		case STM32_CMD_ERASE: return "ERASE";
+		case STM32_CMD_XERASE: return "EXTENDED_ERASE";
+		default: return nullptr;
+	}
+}
+
+static uint8_t xorOf(const uint8_t* p, size_t n)
+{
+	uint8_t c = 0;
+	for (size_t i = 0; i < n; i++) c ^= p[i];
+	return c;
+}
+
+static std::string hexBytes(const std::vector<uint8_t>& d, size_t max)
+{
+	std::string s;
+	char b[4];
+	for (size_t i = 0; i < d.size() && i < max; i++)
+	{
+		snprintf(b, sizeof(b), "%02x ", d[i]);
+		s += b;
+	}
+	if (d.size() > max) s += "...";
+	return s;
+}
+
+class Decoder
+{
+	public:
+	explicit Decoder(const Capture& cap) : _spi(cap.link == STM32_FRAME_LINK_SPI), _expect(EXPECT_CMD), _cmd(-1), _stage("cmd") {}
+
+	/* Meaning of one frame; `group` names the latency group of an RX frame */
+	std::string annotate(const Frame& f, std::string& group)
+	{
+		char s[128];
+		const std::vector<uint8_t>& d = f.data;
+		size_t n = d.size();
+		if (f.rx) return annotateRx(f, group);
+
+		/* AN4286 frames every command with a start-of-frame byte */
+		const uint8_t* p = d.data();
+		if (_spi && n == 3 && p[0] == STM32_SPI_SOF && p[2] == (uint8_t)~p[1])
+		{
+			p++;
+			n--;
+		}
+
+		if (n == 1 && p[0] == (_spi ? STM32_SPI_SOF : 0x7F))
+		{
+			_cmd = -1;
+			_stage = "sync";
+			_expect = EXPECT_CMD;
+			return "sync";
+		}
+		if (_spi && n == 1 && p[0] == STM32_ACK) return "host ACK";
+
+		switch (_expect)
+		{
+			case EXPECT_ADDR:
+			if (n == 5 && xorOf(p, 4) == p[4])
+			{
+				uint32_t a = ((uint32_t)p[0] << 24) | ((uint32_t)p[1] << 16) | ((uint32_t)p[2] << 8) | p[3];
+				snprintf(s, sizeof(s), "address 0x%08X", a);
+				_stage = "addr";
+				_expect = (_cmd == STM32_CMD_READ) ? EXPECT_READ_LEN : (_cmd == STM32_CMD_WRITE) ? EXPECT_WRITE_DATA : EXPECT_CMD;
+				return s;
+			}
+			break;
+
+			case EXPECT_READ_LEN:
+			if (n == 2 && p[1] == (uint8_t)~p[0])
+			{
+				snprintf(s, sizeof(s), "length %u", p[0] + 1u);
+				_stage = "len";
+				_expect = EXPECT_CMD;
+				return s;
+			}
+			break;
+
+			case EXPECT_WRITE_DATA:
+			if (n >= 3 && p[0] + 3u == n)
+			{
+				snprintf(s, sizeof(s), "data %u bytes, checksum %s%s", p[0] + 1u, xorOf(p, n - 1) == p[n - 1] ? "ok" : "BAD",
+				f.truncated ? " (truncated)" : "");
+				_stage = "data";
+				_expect = EXPECT_CMD;
+				return s;
+			}
+			break;
+
+			case EXPECT_ERASE_ARGS:
+			_stage = "erase";
+			_expect = EXPECT_CMD;
+			if (_cmd == STM32_CMD_ERASE && n == 2 && p[0] == 0xFF) return "global erase";
+			if (_cmd == STM32_CMD_XERASE && n == 3 && p[0] == 0xFF && p[1] >= 0xFD)
+			{
+				return (p[1] == 0xFF) ? "mass erase" : (p[1] == 0xFE) ? "bank 1 erase" : "bank 2 erase";
+			}
+			if (n >= 3)
+			{
+				bool ext = (_cmd == STM32_CMD_XERASE);
+				unsigned count = (ext ? ((p[0] << 8) | p[1]) : p[0]) + 1u;
+				unsigned first = ext ? ((p[2] << 8) | p[3]) : p[1];
+				snprintf(s, sizeof(s), "%u %s from %u, checksum %s", count, count == 1 ? "unit" : "units", first,
+				xorOf(p, n - 1) == p[n - 1] ? "ok" : "BAD");
+				return s;
+			}
+			break;
+
+			case EXPECT_CMD:
+			break;
+		}
+
+		if (n == 2 && p[1] == (uint8_t)~p[0] && cmdName(p[0]))
+		{
+			_cmd = p[0];
+			_stage = "cmd";
+			_expect = (_cmd == STM32_CMD_READ || _cmd == STM32_CMD_WRITE || _cmd == STM32_CMD_GO) ? EXPECT_ADDR
+			: (_cmd == STM32_CMD_ERASE || _cmd == STM32_CMD_XERASE) ? EXPECT_ERASE_ARGS : EXPECT_CMD;
+			snprintf(s, sizeof(s), "%s (0x%02X)", cmdName(p[0]), p[0]);
+			return s;
+		}
+		_expect = EXPECT_CMD;
+		_stage = "?";
+		return "?";
+	}
+
+	bool startsTransaction(const Frame& f) const
+	{
+		if (f.rx) return false;
+		const std::vector<uint8_t>& d = f.data;
+		if (d.size() == 1 && d[0] == (_spi ? STM32_SPI_SOF : 0x7F)) return true;
+		size_t o = (_spi && d.size() == 3 && d[0] == STM32_SPI_SOF) ? 1 : 0;
+		return _expect == EXPECT_CMD && d.size() == 2 + o && d[o + 1] == (uint8_t)~d[o] && cmdName(d[o]);
+	}
+
+	private:
+	bool _spi;
+	Expect _expect;
+	int _cmd;
+	const char* _stage;
+
+	std::string annotateRx(const Frame& f, std::string& group)
+	{
+		const std::vector<uint8_t>& d = f.data;
+		size_t n = d.size();
+		std::string s;
+		size_t i = 0;
+
+		/* The ACK/NACK answering the last TX frame, then any data, then a closing ACK */
+		if (n && (d[0] == STM32_ACK || d[0] == STM32_NACK))
+		{
+			s = (d[0] == STM32_ACK) ? "ACK" : "NACK";
+			group = std::string(_cmd >= 0 ? cmdName((uint8_t)_cmd) : "SYNC") + " " + _stage;
+			i = 1;
+			if (d[0] == STM32_NACK) _expect = EXPECT_CMD;
+		}
+		if (n <= i) return s;
+		/* Only the GET commands end their data with another ACK */
+		bool get = (_cmd == STM32_CMD_GET || _cmd == STM32_CMD_GET_VER || _cmd == STM32_CMD_GET_ID);
+		bool closing = get && n > i + 1 && (d[n - 1] == STM32_ACK || d[n - 1] == STM32_NACK);
+		size_t body = n - i - (closing ? 1 : 0);
+
+		/* SPI sends a dummy byte before the data */
+		size_t skip = (_spi && body > 0 && i == 1) ? 1 : 0;
+		const uint8_t* p = d.data() + i + skip;
+		size_t len = body - skip;
+		char tmp[96];
+		if (_cmd == STM32_CMD_GET_ID && len == 3) snprintf(tmp, sizeof(tmp), "id 0x%03X", ((p[1] << 8) | p[2]) & 0xFFF);
+		else if (_cmd == STM32_CMD_GET_VER && len == 3) snprintf(tmp, sizeof(tmp), "version %u.%u", p[0] >> 4, p[0] & 0x0F);
+		else if (_cmd == STM32_CMD_GET && len >= 2) snprintf(tmp, sizeof(tmp), "version %u.%u, %u commands", p[1] >> 4, p[1] & 0x0F, p[0] + 1u);
+		else snprintf(tmp, sizeof(tmp), "%zu data bytes%s", len, f.truncated ? " (truncated)" : "");
+		if (len)
+		{
+			if (!s.empty()) s += ", ";
+			s += tmp;
+		}
+		if (closing) s += (d[n - 1] == STM32_ACK) ? ", ACK" : ", NACK";
+		return s;
+	}
+};
+
+static uint32_t percentile(std::vector<uint32_t>& v, unsigned pct)
+{
+	size_t i = (v.size() * pct + 99) / 100;
+	if (i > 0) i--;
+	return v[std::min(i, v.size() - 1)];
+}
+
+static void usage()
+{
+	puts("usage: stm32frames [options] <capture>\n"
+	"  -v                  print every byte of every frame\n"
+	"  --summary           print only the ACK latency summary\n"
+	"Captures come from GET /trace on the web flasher or from stm32sim --capture.");
+}
+
+int main(int argc, char** argv)
+{
+	bool verbose = false;
+	bool summaryOnly = false;
+	const char* path = nullptr;
+	for (int i = 1; i < argc; i++)
+	{
+		if (!strcmp(argv[i], "-v")) verbose = true;
+		else if (!strcmp(argv[i], "--summary")) summaryOnly = true;
+		else if (argv[i][0] != '-' && !path) path = argv[i];
+		else { usage(); return 2; }
+	}
+	if (!path) { usage(); return 2; }
+
+	Capture cap;
+	if (!load(path, cap)) return 2;
+
+	printf("capture  %s %lu %s, %zu frames", cap.link == STM32_FRAME_LINK_SPI ? "spi" : "uart", (unsigned long)cap.rate,
+	cap.link == STM32_FRAME_LINK_SPI ? "Hz" : "baud", cap.list.size());
+	if (cap.dropped) printf(", %lu older frames dropped (decoding starts mid-session)", (unsigned long)cap.dropped);
+	printf("\n");
+	if (cap.list.empty()) return 0;
+
+	if (!summaryOnly) printf("\n%10s  %-3s %5s %8s  %-26s %s\n", "time ms", "dir", "len", "gap us", "bytes", "meaning");
+
+	Decoder dec(cap);
+	std::vector<LatencyGroup> groups;
+	const uint32_t t0 = cap.list[0].startUs;
+	uint32_t txEnd = t0;
+	bool haveTx = false;
+
+	for (size_t k = 0; k < cap.list.size(); k++)
+	{
+		const Frame& f = cap.list[k];
+		bool newTx = dec.startsTransaction(f);
+		std::string group;
+		std::string meaning = dec.annotate(f, group);
+
+		/* Gap: for RX, from the end of the TX frame it answers; for TX, the host's own turnaround */
+		uint32_t gap = haveTx ? f.startUs - txEnd : 0;
+		if (f.rx && haveTx && !group.empty())
+		{
+			size_t g = 0;
+			while (g < groups.size() && groups[g].name != group) g++;
+			if (g == groups.size())
+			{
+				groups.push_back(LatencyGroup());
+				groups[g].name = group;
+			}
+			groups[g].us.push_back(gap);
+		}
+		if (!f.rx)
+		{
+			txEnd = f.startUs + f.durUs;
+			haveTx = true;
+		}
+
+		if (summaryOnly) continue;
+		if (newTx && k) printf("\n");
+		printf("%10.3f  %-3s %5zu ", (f.startUs - t0) / 1000.0, f.rx ? "RX" : "TX", f.data.size());
+		if (f.rx && haveTx) printf("%8lu", (unsigned long)gap);
+		else printf("%8s", "");
+		printf("  %-26s %s\n", hexBytes(f.data, 8).c_str(), meaning.c_str());
+		if (verbose && f.data.size() > 8)
+		{
+			for (size_t i = 0; i < f.data.size(); i += 16)
+			{
+				std::vector<uint8_t> row(f.data.begin() + i, f.data.begin() + std::min(i + 16, f.data.size()));
+				printf("%36s%s\n", "", hexBytes(row, 16).c_str());
+			}
+		}
+	}
+
+	printf("\n%-28s %6s %9s %9s %9s %9s\n", "ACK latency (us)", "count", "min", "p50", "p90", "max");
+	for (size_t g = 0; g < groups.size(); g++)
+	{
+		std::vector<uint32_t>& v = groups[g].us;
+		std::sort(v.begin(), v.end());
+		printf("%-28s %6zu %9lu %9lu %9lu %9lu\n", groups[g].name.c_str(), v.size(), (unsigned long)v.front(),
+		(unsigned long)percentile(v, 50), (unsigned long)percentile(v, 90), (unsigned long)v.back());
+	}
+	return 0;
+}
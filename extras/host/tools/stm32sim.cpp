@@ -0,0 +1,469 @@
+/********************************************************************************************************
+ *  [FILE NAME]   :      <stm32sim.cpp>                                                                 *
+ *  [AUTHOR]      :      <David S. Alexander>                                                           *
+ *  [DATE CREATED]:      <Dec 10, 2025>                                                                 *
+ *  [Description] :      <Runs a full flasher session against the simulated target>                     *
+ ********************************************************************************************************/
+
+#include <Arduino.h>
+#include <vector>
+#include "STM32HostClock.h"
+#include "STM32SimTarget.h"
+#include "STM32SimSession.h"
+#include "STM32BatchRunner.h"
+#include "STM32FlashShadow.h"
+
+class FilePrint : public Print
+{
+	public:
+	explicit FilePrint(FILE* f) : _f(f) {}
+	size_t write(uint8_t c) override { return fwrite(&c, 1, 1, _f); }
+	size_t write(const uint8_t* data, size_t len) override { return fwrite(data, 1, len, _f); }
+
+	private:
+	FILE* _f;
+};
+
+class StdoutPrint : public FilePrint
+{
+	public:
+	StdoutPrint() : FilePrint(stdout) {}
+};
+
+/* Write-only Stream appending to a vector; stands in for a LittleFS scratch file */
+class VectorStream : public Stream
+{
+	public:
+	VectorStream() : _data(nullptr) {}
+	void attach(std::vector<uint8_t>* data) { _data = data; }
+
+	int available() override { return 0; }
+	int read() override { return -1; }
+	int peek() override { return -1; }
+	size_t write(uint8_t c) override { _data->push_back(c); return 1; }
+	size_t write(const uint8_t* data, size_t len) override { _data->insert(_data->end(), data, data + len); return len; }
+
+	private:
+	std::vector<uint8_t>* _data;
+};
+
+/* "image" is the --image/--size image, anything else a file on disk read whole; scratch files are
+   kept in memory */
+class HostBatchFiles : public STM32BatchFiles
+{
+	public:
+	explicit HostBatchFiles(const std::vector<uint8_t>& image) : _image(&image), _stream(nullptr, 0) {}
+
+	Stream* open(const char* name, size_t& len) override
+	{
+		const std::vector<uint8_t>* data = _image;
+		if (strcmp(name, "image") != 0)
+		{
+			FILE* f = fopen(name, "rb");
+			if (!f) return nullptr;
+			_file.clear();
+			uint8_t buf[4096];
+			size_t n;
+			while ((n = fread(buf, 1, sizeof(buf), f)) > 0) _file.insert(_file.end(), buf, buf + n);
+			fclose(f);
+			data = &_file;
+		}
+		_stream = STM32HostBufferStream(data->data(), data->size());
+		len = data->size();
+		return &_stream;
+	}
+
+	void close() override {}
+
+	Stream* openScratch(uint8_t slot, bool write) override
+	{
+		if (slot >= _scratch.size()) _scratch.resize(slot + 1);
+		if (write)
+		{
+			_scratch[slot].clear();
+			_writer.attach(&_scratch[slot]);
+			return &_writer;
+		}
+		_stream = STM32HostBufferStream(_scratch[slot].data(), _scratch[slot].size());
+		return &_stream;
+	}
+
+	private:
+	const std::vector<uint8_t>* _image;
+	std::vector<uint8_t> _file;
+	std::vector<std::vector<uint8_t>> _scratch;
+	STM32HostBufferStream _stream;
+	VectorStream _writer;
+};
+
+static bool readScript(const char* path, std::vector<char>& out)
+{
+	FILE* f = fopen(path, "rb");
+	if (!f) return false;
+	char buf[1024];
+	size_t n;
+	while ((n = fread(buf, 1, sizeof(buf), f)) > 0) out.insert(out.end(), buf, buf + n);
+	fclose(f);
+	return true;
+}
+
+static bool writeCapture(const STM32FrameTracer& tracer, const char* path, const STM32SimConfig& cfg)
+{
+	FILE* f = fopen(path, "wb");
+	if (!f) { fprintf(stderr, "cannot write %s\n", path); return false; }
+	FilePrint out(f);
+	if (cfg.spiHz) tracer.writeCapture(out, STM32_FRAME_LINK_SPI, cfg.spiHz);
+	else tracer.writeCapture(out, STM32_FRAME_LINK_UART, cfg.baud);
+	fclose(f);
+	printf("capture  %u frames, %u dropped, %zu bytes -> %s\n", (unsigned)tracer.frames(), (unsigned)tracer.dropped(),
+	tracer.captureBytes(), path);
+	return true;
+}
+
+static void report(const STM32SimSession& session, STM32SessionStep step)
+{
+	const STM32SessionStepResult& r = session.step[step];
+	if (!r.ran) return;
+	char msg[96] = "";
+	if (!r.ok) session.res.format(msg, sizeof(msg));
+	printf("%-8s %-4s sim %10.3f ms  cpu %8.3f ms  allocs %llu%s%s\n",
+	STM32SimSession::stepName(step), r.ok ? "ok" : "FAIL",
+	r.simNs / 1e6, r.cpuNs / 1e6,
+	(unsigned long long)r.allocs, msg[0] ? "  " : "", msg);
+	if (step == STM32_STEP_DETECT && r.ok) printf("         %s%s%s\n", session.desc, session.uid[0] ? ", UID " : "", session.uid);
+}
+
+static void usage()
+{
+	puts("usage: stm32sim [options]\n"
+	"  --dev <id>          device ID, e.g. 0x410 (F1 medium density), 0x413 (F4)\n"
+	"  --flash-kb <n>      flash of the emulated part (the family table's largest size)\n"
+	"  --baud <n>          UART baud rate (115200)\n"
+	"  --spi <hz>          use the AN4286 SPI link at this clock instead of the UART\n"
+	"  --image <file>      firmware image; default is --size KB of pseudo-random data\n"
+	"  --size <kb>         generated image size (64, or 4 with --run-ram)\n"
+	"  --turnaround-us <n> target command turnaround (30)\n"
+	"  --gap-us <n>        extra idle time per byte on the wire (0)\n"
+	"  --seed <n>          fault PRNG seed (1)\n"
+	"  --drop-rx <pm>      per mille of host->target bytes lost\n"
+	"  --drop-tx <pm>      per mille of target->host bytes lost\n"
+	"  --corrupt-rx <pm>   per mille of host->target bytes with a flipped bit\n"
+	"  --nack <pm>         per mille of commands answered with NACK\n"
+	"  --sync-fail <n>     ignore the first n sync bytes\n"
+	"  --hang-after <n>    stop answering after n commands\n"
+	"  --stub              program through the emulated RAM loader stub\n"
+	"  --stub-fail         target hangs on GO to the stub (tests the ROM fallback)\n"
+	"  --run-ram           load the image into SRAM and GO instead of programming flash\n"
+	"  --ram-addr <addr>   SRAM load address for --run-ram (start of the free region)\n"
+	"  --preflight         check the image against the detected part before erasing; the\n"
+	"                      generated image gets a vector table that passes\n"
+	"  --batch <file>      run a /batch script (see STM32BatchRunner.h) instead; the name\n"
+	"                      'image' refers to the --image/--size image\n"
+	"  --manifest <file>   program a /manifest (see STM32BatchRunner.h) instead, file names\n"
+	"                      as for --batch\n"
+	"  --delta             three delta updates (see STM32FlashShadow.h) instead: from an\n"
+	"                      empty shadow, after one image byte changed, and after the target\n"
+	"                      flash was erased behind the shadow's back\n"
+	"  --no-verify         skip the read-back pass\n"
+	"  --metrics           print Prometheus metrics at the end\n"
+	"  --telemetry <file>  write the web UI's /telemetry JSON for the session to file\n"
+	"  --capture <file>    write a frame capture of the bootloader link (see stm32frames)\n"
+	"  --capture-kb <n>    capture ring size (1024; the ESP default is 16)");
+}
+
+int main(int argc, char** argv)
+{
+	STM32SimConfig cfg;
+	const char* imagePath = nullptr;
+	uint32_t sizeKb = 0;
+	bool verify = true;
+	bool printMetrics = false;
+	bool stub = false;
+	bool runRam = false;
+	bool preflight = false;
+	uint32_t ramAddr = 0;
+	const char* batchPath = nullptr;
+	const char* manifestPath = nullptr;
+	bool delta = false;
+	const char* telemetryPath = nullptr;
+	const char* capturePath = nullptr;
+	uint32_t captureKb = 1024;
+
+	for (int i = 1; i < argc; i++)
+	{
+		const char* a = argv[i];
+		const char* v = (i + 1 < argc) ? argv[i + 1] : nullptr;
+		bool takesValue = true;
+
+		if (!strcmp(a, "--dev") && v) cfg.devId = (uint16_t)strtoul(v, nullptr, 0);
+		else if (!strcmp(a, "--flash-kb") && v) cfg.flashKb = (uint16_t)strtoul(v, nullptr, 0);
+		else if (!strcmp(a, "--baud") && v) cfg.baud = (uint32_t)strtoul(v, nullptr, 0);
+		else if (!strcmp(a, "--spi") && v) cfg.spiHz = (uint32_t)strtoul(v, nullptr, 0);
+		else if (!strcmp(a, "--image") && v) imagePath = v;
+		else if (!strcmp(a, "--size") && v) sizeKb = (uint32_t)strtoul(v, nullptr, 0);
+		else if (!strcmp(a, "--turnaround-us") && v) cfg.cmdTurnaroundNs = (uint32_t)strtoul(v, nullptr, 0) * 1000u;
+		else if (!strcmp(a, "--gap-us") && v) cfg.byteGapNs = (uint32_t)strtoul(v, nullptr, 0) * 1000u;
+		else if (!strcmp(a, "--seed") && v) cfg.seed = (uint32_t)strtoul(v, nullptr, 0);
+		else if (!strcmp(a, "--drop-rx") && v) cfg.dropRxPermille = (uint16_t)strtoul(v, nullptr, 0);
+		else if (!strcmp(a, "--drop-tx") && v) cfg.dropTxPermille = (uint16_t)strtoul(v, nullptr, 0);
+		else if (!strcmp(a, "--corrupt-rx") && v) cfg.corruptRxPermille = (uint16_t)strtoul(v, nullptr, 0);
+		else if (!strcmp(a, "--nack") && v) cfg.nackPermille = (uint16_t)strtoul(v, nullptr, 0);
+		else if (!strcmp(a, "--sync-fail") && v) cfg.syncFailFirst = (uint16_t)strtoul(v, nullptr, 0);
+		else if (!strcmp(a, "--batch") && v) batchPath = v;
+		else if (!strcmp(a, "--manifest") && v) manifestPath = v;
+		else if (!strcmp(a, "--telemetry") && v) telemetryPath = v;
+		else if (!strcmp(a, "--capture") && v) capturePath = v;
+		else if (!strcmp(a, "--capture-kb") && v) captureKb = (uint32_t)strtoul(v, nullptr, 0);
+		else if (!strcmp(a, "--ram-addr") && v) ramAddr = (uint32_t)strtoul(v, nullptr, 0);
+		else if (!strcmp(a, "--hang-after") && v) cfg.hangAfterCmds = (uint32_t)strtoul(v, nullptr, 0);
+		else
+		{
+			takesValue = false;
+			if (!strcmp(a, "--no-verify")) verify = false;
+			else if (!strcmp(a, "--stub")) stub = true;
+			else if (!strcmp(a, "--stub-fail")) cfg.stubFail = true;
+			else if (!strcmp(a, "--run-ram")) runRam = true;
+			else if (!strcmp(a, "--delta")) delta = true;
+			else if (!strcmp(a, "--preflight")) preflight = true;
+			else if (!strcmp(a, "--metrics")) printMetrics = true;
+			else { usage(); return 2; }
+		}
+		if (takesValue) i++;
+	}
+
+	std::vector<uint8_t> image;
+	if (imagePath)
+	{
+		FILE* f = fopen(imagePath, "rb");
+		if (!f) { fprintf(stderr, "cannot open %s\n", imagePath); return 2; }
+		uint8_t buf[4096];
+		size_t n;
+		while ((n = fread(buf, 1, sizeof(buf), f)) > 0) image.insert(image.end(), buf, buf + n);
+		fclose(f);
+	}
+
+	STM32HostClock::reset();
+	STM32SimTarget sim(cfg);
+	STM32HostClock::attach(&sim);
+
+	uint32_t ramStart = 0, ramEnd = 0;
+	if (runRam && !STM32FamilyDb::getRamRegion(sim.family(), ramStart, ramEnd))
+	{
+		fprintf(stderr, "no SRAM region known for device 0x%03X\n", cfg.devId);
+		return 2;
+	}
+	if (!imagePath && runRam)
+	{
+		STM32SimSession::makeRamImage(image, (size_t)(sizeKb ? sizeKb : 4) * 1024u, ramAddr ? ramAddr : ramStart, 0);
+	}
+	else if (!imagePath && preflight)
+	{
+		STM32SimSession::makeFlashImage(image, (size_t)(sizeKb ? sizeKb : 64) * 1024u, sim.family(), 0);
+	}
+	else if (!imagePath)
+	{
+		STM32SimSession::makeImage(image, (size_t)(sizeKb ? sizeKb : 64) * 1024u, 0);
+	}
+
+	if (image.size() > sim.flashSize())
+	{
+		fprintf(stderr, "image (%zu bytes) larger than target flash (%u bytes)\n", image.size(), sim.flashSize());
+		return 2;
+	}
+
+	STM32FrameTracer tracer;
+	if (capturePath)
+	{
+		if (!tracer.begin((size_t)captureKb * 1024u)) { fprintf(stderr, "bad --capture-kb %u\n", (unsigned)captureKb); return 2; }
+		tracer.setEnabled(true);
+	}
+
+	printf("target   %s, %u KB flash, %u erase units, %lu %s\n",
+	sim.family().name, (unsigned)sim.family().FlashSize,
+	(unsigned)STM32FamilyDb::eraseUnitCount(sim.geometry(), sim.flashSize()),
+	(unsigned long)(cfg.spiHz ? cfg.spiHz : cfg.baud), cfg.spiHz ? "Hz SPI" : "baud");
+
+	if (batchPath || manifestPath)
+	{
+		const char* path = manifestPath ? manifestPath : batchPath;
+		std::vector<char> script;
+		if (!readScript(path, script)) { fprintf(stderr, "cannot open %s\n", path); return 2; }
+
+		STM32FlasherMetrics metrics;
+		STM32RomFlasher flasher(STM32StreamTransport(sim.port(), cfg.spiHz != 0), cfg.boot0Pin, cfg.resetPin);
+		flasher.setMetrics(&metrics);
+		if (capturePath) flasher.bootloader().setTracer(&tracer);
+		flasher.beginPins();
+		/* Batches hold one session, which the stub fallback has to leave and re-enter */
+		std::vector<uint8_t> stubData;
+		STM32StubImage stubImage;
+		if (stub && STM32SimSession::makeStubImage(stubData, sim.family().family, stubImage))
+		{
+			flasher.setStubImage(&stubImage);
+			flasher.setStubEnabled(true);
+		}
+		HostBatchFiles files(image);
+		STM32BatchRunner runner(flasher, files);
+
+		bool ok = manifestPath ? runner.runManifest(script.data(), script.size()) : runner.run(script.data(), script.size());
+		if (runner.stepCount())
+		{
+			StdoutPrint out;
+			runner.writeReport(out);
+			printf("\n");
+		}
+		else
+		{
+			printf("line %u: %s\n", (unsigned)runner.errorLine(), runner.error());
+		}
+		const STM32SimStats& st = sim.stats();
+		printf("target   resets %u, syncs %u, commands %u, unit erases %u, mass erases %u, sim %.3f s\n",
+		st.resets, st.syncs, st.commands, st.unitErases, st.massErases, STM32HostClock::nowNs() / 1e9);
+		if (stub)
+		{
+			printf("stub     starts %u, frames %u, NAKs %u, retransmits %u, fallbacks %u\n",
+			st.stubStarts, st.stubFrames, st.stubNaks, metrics.stubRetransmits, metrics.stubFallbacks);
+		}
+		if (capturePath && !writeCapture(tracer, capturePath, cfg)) return 2;
+		return ok ? 0 : 1;
+	}
+
+	if (delta)
+	{
+		STM32FlasherMetrics metrics;
+		STM32RomFlasher flasher(STM32StreamTransport(sim.port(), cfg.spiHz != 0), cfg.boot0Pin, cfg.resetPin);
+		flasher.setMetrics(&metrics);
+		if (capturePath) flasher.bootloader().setTracer(&tracer);
+		flasher.beginPins();
+		HostBatchFiles files(image);
+		STM32DeltaUpdater updater(flasher, files);
+
+		STM32RomResult res;
+		STM32FlashShadow shadow;
+		bool ok = flasher.detect(res);
+		if (ok && !shadow.begin(flasher.devId(), flasher.flashKb(), sim.geometry(), flasher.uid() ? flasher.uid() : (const uint8_t*)"\0\0\0\0\0\0\0\0\0\0\0"))
+		{
+			fprintf(stderr, "no shadow layout for device 0x%03X\n", cfg.devId);
+			return 2;
+		}
+
+		std::vector<uint8_t> saved;
+		for (int run = 1; ok && run <= 3; run++)
+		{
+			if (run == 2) image[image.size() / 2] ^= 0xFF;
+			if (run == 3) sim.fillFlash(0xFF);
+
+			uint64_t t0 = STM32HostClock::nowNs();
+			STM32DeltaReport rep;
+			ok = updater.run("image", shadow, rep, res);
+			printf("delta %d  %s  blocks %u, rewritten %u (%u erased), spot checks %u%s, written %lu, skipped %lu, sim %.3f s\n",
+			run, ok ? "ok  " : "FAIL", (unsigned)rep.blocks, (unsigned)rep.rewritten, (unsigned)rep.erased, (unsigned)rep.checked,
+			rep.stale ? " (stale)" : "", (unsigned long)rep.written, (unsigned long)rep.skipped, (STM32HostClock::nowNs() - t0) / 1e9);
+
+			/* Round trip through the stored form, as the web flasher does between jobs */
+			VectorStream out;
+			saved.clear();
+			out.attach(&saved);
+			shadow.save(out);
+			STM32HostBufferStream in(saved.data(), saved.size());
+			if (!shadow.load(in)) { fprintf(stderr, "shadow did not load back\n"); return 2; }
+		}
+		if (!ok)
+		{
+			char msg[96];
+			res.format(msg, sizeof(msg));
+			printf("error    %s\n", msg);
+		}
+		const STM32SimStats& st = sim.stats();
+		printf("target   resets %u, syncs %u, commands %u, unit erases %u, mass erases %u, sim %.3f s\n",
+		st.resets, st.syncs, st.commands, st.unitErases, st.massErases, STM32HostClock::nowNs() / 1e9);
+		if (capturePath && !writeCapture(tracer, capturePath, cfg)) return 2;
+		return ok ? 0 : 1;
+	}
+
+	STM32SessionOptions opt;
+	opt.boot0Pin = cfg.boot0Pin;
+	opt.resetPin = cfg.resetPin;
+	opt.verify = verify;
+	opt.stub = stub;
+	opt.runRam = runRam;
+	opt.ramAddr = ramAddr;
+	opt.preflight = preflight;
+	opt.linkBytesPerSec = cfg.spiHz ? cfg.spiHz / 8 : cfg.baud / 11;
+	opt.spi = cfg.spiHz != 0;
+	if (capturePath) opt.tracer = &tracer;
+
+	STM32HostClock::setProfiling(true);
+	STM32SimSession session;
+	bool ok = session.run(sim.port(), image.data(), image.size(), opt);
+	for (int s = 0; s < STM32_STEP_COUNT; s++) report(session, (STM32SessionStep)s);
+	if (preflight && session.step[STM32_STEP_DETECT].ok && !runRam)
+	{
+		char text[256];
+		session.preflight.format(text, sizeof(text));
+		printf("preflight %s\n", text);
+		if (session.preflight.go)
+		{
+			printf("estimate erase %.3f s (sim %.3f s), program %.3f s (sim %.3f s)\n",
+			session.preflight.eraseMs / 1e3, session.step[STM32_STEP_ERASE].simNs / 1e9,
+			session.preflight.programMs / 1e3, session.step[STM32_STEP_PROGRAM].simNs / 1e9);
+		}
+	}
+
+	size_t written = session.written;
+	uint64_t programNs = session.step[STM32_STEP_PROGRAM].simNs;
+
+	if (runRam)
+	{
+		programNs = session.step[STM32_STEP_RUN].simNs;
+		uint32_t sp = 0, entry = 0;
+		bool running = sim.inRamImage(sp, entry);
+		const uint8_t* loaded = sim.ram() + (session.ramAddr - 0x20000000UL);
+		if (ok && (!running || memcmp(loaded + 4, image.data() + 4, image.size() - 4) != 0))
+		{
+			printf("SRAM model does not match the image\n");
+			ok = false;
+		}
+		if (running) printf("ram      running at 0x%08X, SP 0x%08X, entry 0x%08X, free SRAM 0x%08X-0x%08X\n",
+		session.ramAddr, sp, entry, ramStart, ramEnd);
+	}
+	else if (ok && memcmp(sim.flash(), image.data(), image.size()) != 0)
+	{
+		printf("flash model does not match the image\n");
+		ok = false;
+	}
+
+	const STM32SimStats& st = sim.stats();
+	printf("total    %s, %zu bytes %s, %.0f B/s while programming, sim %.3f s\n",
+	ok ? "ok" : "FAIL", written, runRam ? "loaded" : "programmed", programNs ? written * 1e9 / (double)programNs : 0.0,
+	STM32HostClock::nowNs() / 1e9);
+	printf("target   resets %u, syncs %u, commands %u, NACKs %u, faults %u, program errors %u, unaligned writes %u\n",
+	st.resets, st.syncs, st.commands, st.nacksSent, st.faultsInjected, st.programErrors, st.unalignedWrites);
+	if (stub)
+	{
+		const STM32FlasherMetrics& m = session.metrics;
+		printf("stub     starts %u, frames %u, NAKs %u, retransmits %u, fallbacks %u\n",
+		st.stubStarts, st.stubFrames, st.stubNaks, m.stubRetransmits, m.stubFallbacks);
+	}
+
+	if (printMetrics)
+	{
+		StdoutPrint out;
+		session.metrics.writePrometheus(out);
+	}
+
+	if (telemetryPath)
+	{
+		FILE* f = fopen(telemetryPath, "wb");
+		if (!f) { fprintf(stderr, "cannot write %s\n", telemetryPath); return 2; }
+		FilePrint out(f);
+		session.telemetry.writeJson(out, session.metrics);
+		fclose(f);
+		printf("telemetry %u samples, interval %u ms -> %s\n", (unsigned)session.telemetry.sampleCount(),
+		(unsigned)session.telemetry.sampleIntervalMs(), telemetryPath);
+	}
+
+	if (capturePath && !writeCapture(tracer, capturePath, cfg)) return 2;
+
+	return ok ? 0 : 1;
+}
@@ -0,0 +1,112 @@
+#!/usr/bin/env python3
+"""Build src/STM32StubImages.cpp from loader stub binaries.
+
+Each argument is FAMILY=LOAD_ADDR:PATH, e.g. F1=0x20000800:build/stub_f1.bin. The
+header at the start of every binary is checked against src/STM32StubProtocol.h
+before it is emitted as a PROGMEM byte array, and STM32_STUB_IMAGE_COUNT in
+src/STM32StubImages.h is set to the number of binaries. With no arguments the
+table is written empty, the count is 0, and the ESP8266 build leaves the stub
+path out and always uses the ROM protocol.
+
+    make -C extras/stub embed
+"""
+
+import os
+import re
+import struct
+import sys
+
+HERE = os.path.dirname(os.path.abspath(__file__))
+OUT = os.path.join(HERE, "..", "..", "src", "STM32StubImages.cpp")
+HEADER = os.path.join(HERE, "..", "..", "src", "STM32StubImages.h")
+
+MAGIC = 0x31425453
+VERSION = 1
+HEADER_LEN = 20
+MAX_BLOCK = 1024
+MAX_WINDOW = 2
+
+BANNER = """/********************************************************************************************************
+ *  [FILE NAME]   :      <STM32StubImages.cpp>                                                          *
+ *  [AUTHOR]      :      <David S. Alexander>                                                           *
+ *  [DATE CREATED]:      <Dec 10, 2025>                                                                 *
+ *  [Description] :      <Source file for the built-in RAM loader stub binaries>                        *
+ ********************************************************************************************************/
+
+/* Generated by extras/stub/embed_stubs.py from the binaries in extras/stub/build - do not edit by hand. */
+
+#include "STM32StubImages.h"
+"""
+
+FOOTER = """
+const STM32StubImage* STM32StubImages::find(STM32Family family)
+{
+	for (size_t i = 0; STUB_IMAGES[i].data; i++)
+	{
+		if (STUB_IMAGES[i].family == family) return &STUB_IMAGES[i];
+	}
+	return nullptr;
+}"""
+
+
+def check_header(name, blob, load):
+	if len(blob) < HEADER_LEN or len(blob) > 0xFFFF:
+		raise SystemExit("%s: %u bytes is not a stub image" % (name, len(blob)))
+	sp, entry, magic, version, caps, window, _, block, _ = struct.unpack_from("<IIIBBBBHH", blob)
+	if magic != MAGIC or version != VERSION:
+		raise SystemExit("%s: bad magic/version" % name)
+	if not entry & 1 or not load <= entry - 1 < load + len(blob):
+		raise SystemExit("%s: entry 0x%08X outside the image at 0x%08X" % (name, entry, load))
+	if sp <= load + len(blob):
+		raise SystemExit("%s: stack top 0x%08X overlaps the image" % (name, sp))
+	if not 1 <= window <= MAX_WINDOW or not 4 <= block <= MAX_BLOCK:
+		raise SystemExit("%s: window %u / block %u outside what the host supports" % (name, window, block))
+	return caps, window, block
+
+
+def c_array(name, blob):
+	rows = []
+	for i in range(0, len(blob), 16):
+		rows.append("\t" + ", ".join("0x%02X" % b for b in blob[i:i + 16]) + ",")
+	return "static const uint8_t %s[] PROGMEM =\n{\n%s\n};\n" % (name, "\n".join(rows))
+
+
+def main():
+	out = [BANNER]
+	entries = []
+	for arg in sys.argv[1:]:
+		try:
+			family, rest = arg.split("=", 1)
+			load, path = rest.split(":", 1)
+			load = int(load, 0)
+		except ValueError:
+			raise SystemExit("expected FAMILY=LOAD_ADDR:PATH, got %r" % arg)
+		with open(path, "rb") as f:
+			blob = f.read()
+		caps, window, block = check_header(path, blob, load)
+		name = "STUB_%s" % family.upper()
+		out.append("/* %s: %u bytes at 0x%08X, window %u, block %u, caps 0x%02X */" % (path, len(blob), load, window, block, caps))
+		out.append(c_array(name, blob))
+		entries.append("\t{ STM32_%s, 0x%08XUL, %s, sizeof(%s) }," % (family.upper(), load, name, name))
+		print("%-4s %5u bytes at 0x%08X" % (family.upper(), len(blob), load))
+
+	if not entries:
+		out.append("/* No stub binaries have been built; run `make -C extras/stub embed`. */\n")
+	out.append("static const STM32StubImage STUB_IMAGES[] =\n{")
+	out.extend(entries)
+	out.append("\t{ STM32_UNKNOWN, 0, nullptr, 0 }\n};")
+	out.append(FOOTER)
+	with open(OUT, "w", encoding="utf-8", newline="\r\n") as f:
+		f.write("\n".join(out) + "\n")
+
+	with open(HEADER, "rb") as f:
+		header = f.read()
+	header, n = re.subn(rb"#define STM32_STUB_IMAGE_COUNT \d+", b"#define STM32_STUB_IMAGE_COUNT %d" % len(entries), header)
+	if n != 1:
+		raise SystemExit("%s: no STM32_STUB_IMAGE_COUNT line to update" % HEADER)
+	with open(HEADER, "wb") as f:
+		f.write(header)
+
+
+if __name__ == "__main__":
+	main()
@@ -0,0 +1,528 @@
+/********************************************************************************************************
+ *  [FILE NAME]   :      <stm32_stub.c>                                                                 *
+ *  [AUTHOR]      :      <David S. Alexander>                                                           *
+ *  [DATE CREATED]:      <Dec 10, 2025>                                                                 *
+ *  [Description] :      <RAM-resident flash loader started by the ROM bootloader's GO command>         *
+ ********************************************************************************************************/
+
+/* Loaded into SRAM with the ROM bootloader's WRITE command and started with GO. It keeps the USART
+   exactly as the ROM's auto-baud left it (same baud, 8E1) and speaks the protocol described in
+   src/STM32StubProtocol.h: windowed, CRC-checked frames of up to STUB_BLOCK bytes, optionally RLE
+   compressed, programmed straight into flash while the next frame is being received.
+
+   Build with the Makefile in this folder; -DSTUB_F1 or -DSTUB_F4 selects the flash controller.
+   The target must already be erased: the host runs mass erase through the ROM first. */
+
+#include <stdint.h>
+#include <stddef.h>
+
+#define STUB_VERSION    1
+#define STUB_CAP_RLE    0x01
+#define STUB_FLAG_RLE   0x01
+#define STUB_MAGIC      0x31425453UL
+#define STUB_SOF        0xA5
+#define STUB_BLOCK      1024
+#define STUB_WINDOW     2
+#define STUB_IDLE_MS    5
+
+#define FRAME_HDR       8	/* seq, flags, addr[4], len[2]; the 0xA5 start byte is not stored */
+#define FRAME_MAX       (FRAME_HDR + STUB_BLOCK + STUB_BLOCK / 128 + 1 + 4)
+
+enum
+{
+	ST_OK,
+	ST_ERR_CRC,
+	ST_ERR_PROGRAM,
+	ST_ERR_RANGE,
+	ST_ERR_DECODE
+};
+
+#define REG(addr)       (*(volatile uint32_t*)(addr))
+#define REG16(addr)     (*(volatile uint16_t*)(addr))
+
+/* ---------------------------------------------------------------- per family */
+
+#ifndef STUB_USART
+#define STUB_USART      USART1_BASE
+#endif
+
+#if defined(STUB_F1)
+
+#define USART1_BASE     0x40013800UL
+#define RCC_BASE        0x40021000UL
+#define FLASH_BASE_R    0x40022000UL
+#define FLASH_SIZE_REG  0x1FFFF7E0UL
+#define FLASH_BANK2     0x08080000UL	/* XL-density parts have a second controller bank */
+
+#define FLASH_KEYR      0x04
+#define FLASH_SR        0x0C
+#define FLASH_CR        0x10
+#define FLASH_SR_BSY    (1UL << 0)
+#define FLASH_SR_ERR    ((1UL << 2) | (1UL << 4))	/* PGERR, WRPRTERR */
+#define FLASH_SR_EOP    (1UL << 5)
+#define FLASH_CR_PG     (1UL << 0)
+#define FLASH_CR_LOCK   (1UL << 7)
+#define PROGRAM_UNIT    2
+
+#elif defined(STUB_F4)
+
+#define USART1_BASE     0x40011000UL
+#define RCC_BASE        0x40023800UL
+#define FLASH_BASE_R    0x40023C00UL
+#define FLASH_SIZE_REG  0x1FFF7A22UL
+
+#define FLASH_KEYR      0x04
+#define FLASH_SR        0x0C
+#define FLASH_CR        0x10
+#define FLASH_SR_BSY    (1UL << 16)
+#define FLASH_SR_ERR    (0xF2UL)	/* OPERR, WRPERR, PGAERR, PGPERR, PGSERR */
+#define FLASH_SR_EOP    (1UL << 0)
+#define FLASH_CR_PG     (1UL << 0)
+#define FLASH_CR_PSIZE  (2UL << 8)	/* x32: needs 2.7-3.6 V, the normal supply for a flasher */
+#define FLASH_CR_LOCK   (1UL << 31)
+#define PROGRAM_UNIT    4
+
+#else
+#error "define STUB_F1 or STUB_F4"
+#endif
+
+#define FLASH_START     0x08000000UL
+#define KEY1            0x45670123UL
+#define KEY2            0xCDEF89ABUL
+
+#define USART_SR        (STUB_USART + 0x00)
+#define USART_DR        (STUB_USART + 0x04)
+#define USART_SR_PE     (1UL << 0)
+#define USART_SR_FE     (1UL << 1)
+#define USART_SR_ORE    (1UL << 3)
+#define USART_SR_RXNE   (1UL << 5)
+#define USART_SR_TXE    (1UL << 7)
+
+#define SYST_CSR        0xE000E010UL
+#define SYST_RVR        0xE000E014UL
+#define SYST_CVR        0xE000E018UL
+
+/* ---------------------------------------------------------------- image header */
+
+extern uint32_t _stack_top;
+extern uint32_t _sbss;
+extern uint32_t _ebss;
+
+void stub_main(void);
+
+struct stub_header
+{
+	uint32_t initial_sp;
+	void (*entry)(void);
+	uint32_t magic;
+	uint8_t version;
+	uint8_t caps;
+	uint8_t window;
+	uint8_t reserved0;
+	uint16_t block;
+	uint16_t reserved1;
+};
+
+/* The ROM's GO loads SP and PC from the first two words, so this must stay at the load address */
+__attribute__((section(".header"), used))
+const struct stub_header stub_header =
+{
+	(uint32_t)&_stack_top,
+	stub_main,
+	STUB_MAGIC,
+	STUB_VERSION,
+	STUB_CAP_RLE,
+	STUB_WINDOW,
+	0,
+	STUB_BLOCK,
+	0
+};
+
+/* ---------------------------------------------------------------- state */
+
+enum rx_state
+{
+	RX_HUNT,
+	RX_FRAME,
+	RX_DISCARD
+};
+
+struct frame_buf
+{
+	uint8_t pending;
+	uint16_t len;
+	uint8_t data[FRAME_MAX];
+};
+
+static struct frame_buf frames[STUB_WINDOW];
+static uint8_t decoded[STUB_BLOCK];
+
+static enum rx_state rx_state;
+static uint8_t rx_buf;	/* frame buffer being received */
+static uint16_t rx_need;
+static uint32_t rx_crc;
+static uint32_t rx_idle_ticks;
+static uint32_t tick_last;
+static uint32_t ticks_per_ms;
+
+static uint8_t expect_seq;	/* next seq to accept */
+static uint8_t prog_buf;	/* frame buffer to program next */
+static uint32_t flash_end;
+
+static const uint32_t crc_nibble[16] =
+{
+	0x00000000UL, 0x1DB71064UL, 0x3B6E20C8UL, 0x26D930ACUL, 0x76DC4190UL, 0x6B6B51F4UL, 0x4DB26158UL, 0x5005713CUL,
+	0xEDB88320UL, 0xF00F9344UL, 0xD6D6A3E8UL, 0xCB61B38CUL, 0x9B64C2B0UL, 0x86D3D2D4UL, 0xA00AE278UL, 0xBDBDF21CUL
+};
+
+/* Running register form: start at 0xFFFFFFFF, invert at the end */
+static uint32_t crc_byte(uint32_t crc, uint8_t b)
+{
+	crc ^= b;
+	crc = (crc >> 4) ^ crc_nibble[crc & 0x0F];
+	crc = (crc >> 4) ^ crc_nibble[crc & 0x0F];
+	return crc;
+}
+
+static uint16_t get16(const uint8_t* p) { return (uint16_t)(p[0] | (p[1] << 8)); }
+static uint32_t get32(const uint8_t* p) { return (uint32_t)p[0] | ((uint32_t)p[1] << 8) | ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24); }
+
+/* ---------------------------------------------------------------- clock */
+
+/* HCLK as the ROM bootloader configured it, read back from RCC; only used for the idle timeout */
+static uint32_t hclk_hz(void)
+{
+	static const uint8_t ahb_shift[8] = { 1, 2, 3, 4, 6, 7, 8, 9 };
+	uint32_t cfgr;
+	uint32_t hz;
+
+#if defined(STUB_F1)
+	cfgr = REG(RCC_BASE + 0x04);
+	switch ((cfgr >> 2) & 3)
+	{
+		case 2:
+		{
+			uint32_t mul = ((cfgr >> 18) & 0x0F) + 2;
+			if (mul > 16) mul = 16;
+			uint32_t src = (cfgr & (1UL << 16)) ? 8000000UL : 4000000UL;	/* HSE assumed 8 MHz, else HSI / 2 */
+			if ((cfgr & (1UL << 16)) && (cfgr & (1UL << 17))) src /= 2;
+			hz = src * mul;
+			break;
+		}
+		case 1: hz = 8000000UL; break;
+		default: hz = 8000000UL; break;
+	}
+#else
+	cfgr = REG(RCC_BASE + 0x08);
+	switch ((cfgr >> 2) & 3)
+	{
+		case 2:
+		{
+			uint32_t pll = REG(RCC_BASE + 0x04);
+			uint32_t m = pll & 0x3F;
+			uint32_t n = (pll >> 6) & 0x1FF;
+			uint32_t p = (((pll >> 16) & 3) + 1) * 2;
+			uint32_t src = (pll & (1UL << 22)) ? 8000000UL : 16000000UL;	/* HSE assumed 8 MHz */
+			hz = m ? (src / m) * n / p : 16000000UL;
+			break;
+		}
+		case 1: hz = 8000000UL; break;
+		default: hz = 16000000UL; break;
+	}
+#endif
+
+	uint32_t hpre = (cfgr >> 4) & 0x0F;
+	if (hpre & 8) hz >>= ahb_shift[hpre & 7];
+	return hz;
+}
+
+/* SysTick free-running without interrupts; elapsed time is accumulated on every poll */
+static void tick_init(void)
+{
+	ticks_per_ms = hclk_hz() / 1000;
+	REG(SYST_RVR) = 0x00FFFFFF;
+	REG(SYST_CVR) = 0;
+	REG(SYST_CSR) = 5;	/* processor clock, enabled, no interrupt */
+	tick_last = REG(SYST_CVR);
+}
+
+static uint32_t tick_elapsed(void)
+{
+	uint32_t now = REG(SYST_CVR);
+	uint32_t delta = (tick_last - now) & 0x00FFFFFF;
+	tick_last = now;
+	return delta;
+}
+
+/* ---------------------------------------------------------------- UART */
+
+static void rx_poll(void);
+
+static void tx_byte(uint8_t b)
+{
+	while (!(REG(USART_SR) & USART_SR_TXE)) rx_poll();
+	REG(USART_DR) = b;
+}
+
+static void reply(uint8_t seq, uint8_t status)
+{
+	tx_byte(seq);
+	tx_byte(status);
+	tx_byte((uint8_t)(seq ^ status ^ 0xFF));
+}
+
+/* Bad frame: tell the host which seq to resend from, then ignore the line until it goes idle */
+static void nak(void)
+{
+	reply(expect_seq, ST_ERR_CRC);
+	rx_state = RX_DISCARD;
+}
+
+static void rx_frame_done(void)
+{
+	struct frame_buf* f = &frames[rx_buf];
+	uint16_t plen = get16(f->data + 6);
+	rx_state = RX_HUNT;
+
+	if (~rx_crc != get32(f->data + FRAME_HDR + plen))
+	{
+		nak();
+		return;
+	}
+
+	uint8_t seq = f->data[0];
+	if (seq != expect_seq)
+	{
+		/* A resend of a frame already taken is acknowledged again and otherwise ignored */
+		uint8_t behind = (uint8_t)(expect_seq - seq);
+		if (behind >= 1 && behind <= STUB_WINDOW) reply(seq, ST_OK);
+		else nak();
+		return;
+	}
+
+	f->len = (uint16_t)(FRAME_HDR + plen);
+	f->pending = 1;
+	expect_seq++;
+	rx_buf = (uint8_t)((rx_buf + 1) % STUB_WINDOW);
+}
+
+static void rx_byte(uint8_t b)
+{
+	struct frame_buf* f = &frames[rx_buf];
+
+	switch (rx_state)
+	{
+		case RX_HUNT:
+		if (b != STUB_SOF) return;
+		/* Host is outside its window: both buffers are still queued */
+		if (f->pending)
+		{
+			nak();
+			return;
+		}
+		f->len = 0;
+		rx_need = FRAME_HDR;
+		rx_crc = 0xFFFFFFFFUL;
+		rx_state = RX_FRAME;
+		return;
+
+		case RX_DISCARD:
+		return;
+
+		case RX_FRAME:
+		break;
+	}
+
+	/* CRC is folded in per byte so nothing long runs when the frame completes */
+	if (f->len < rx_need - (rx_need > FRAME_HDR ? 4 : 0)) rx_crc = crc_byte(rx_crc, b);
+	f->data[f->len++] = b;
+
+	if (f->len == FRAME_HDR)
+	{
+		uint16_t plen = get16(f->data + 6);
+		if (plen > STUB_BLOCK + STUB_BLOCK / 128 + 1)
+		{
+			nak();
+			return;
+		}
+		rx_need = (uint16_t)(FRAME_HDR + plen + 4);
+	}
+	if (f->len == rx_need && rx_need > FRAME_HDR) rx_frame_done();
+}
+
+/* Called from every wait loop so the 1-byte USART data register never overruns */
+static void rx_poll(void)
+{
+	uint32_t dt = tick_elapsed();
+	uint32_t sr = REG(USART_SR);
+
+	if (sr & (USART_SR_RXNE | USART_SR_ORE | USART_SR_FE | USART_SR_PE))
+	{
+		/* Reading DR after SR also clears the error flags */
+		uint8_t b = (uint8_t)REG(USART_DR);
+		rx_idle_ticks = 0;
+		if (sr & (USART_SR_ORE | USART_SR_FE | USART_SR_PE))
+		{
+			if (rx_state == RX_FRAME) nak();
+			return;
+		}
+		rx_byte(b);
+		return;
+	}
+
+	if (rx_state == RX_HUNT) return;
+	rx_idle_ticks += dt;
+	if (rx_idle_ticks < STUB_IDLE_MS * ticks_per_ms) return;
+
+	rx_idle_ticks = 0;
+	if (rx_state == RX_FRAME) reply(expect_seq, ST_ERR_CRC);
+	rx_state = RX_HUNT;
+}
+
+/* ---------------------------------------------------------------- flash */
+
+static uint32_t flash_reg(uint32_t addr, uint32_t off)
+{
+#if defined(STUB_F1)
+	if (addr >= FLASH_BANK2) return FLASH_BASE_R + 0x40 + off;
+#endif
+	(void)addr;
+	return FLASH_BASE_R + off;
+}
+
+static void flash_unlock(uint32_t addr)
+{
+	if (REG(flash_reg(addr, FLASH_CR)) & FLASH_CR_LOCK)
+	{
+		REG(flash_reg(addr, FLASH_KEYR)) = KEY1;
+		REG(flash_reg(addr, FLASH_KEYR)) = KEY2;
+	}
+}
+
+static int flash_program(uint32_t addr, const uint8_t* data, uint32_t len)
+{
+	flash_unlock(addr);
+
+	for (uint32_t i = 0; i < len; i += PROGRAM_UNIT)
+	{
+		uint32_t a = addr + i;
+		uint32_t sr = flash_reg(a, FLASH_SR);
+		uint32_t cr = flash_reg(a, FLASH_CR);
+
+		REG(sr) = FLASH_SR_EOP | FLASH_SR_ERR;
+#if defined(STUB_F1)
+		REG(cr) = FLASH_CR_PG;
+		REG16(a) = (uint16_t)(data[i] | (data[i + 1] << 8));
+#else
+		REG(cr) = FLASH_CR_PG | FLASH_CR_PSIZE;
+		REG(a) = get32(data + i);
+#endif
+		while (REG(sr) & FLASH_SR_BSY) rx_poll();
+		REG(cr) = 0;
+
+		if (REG(sr) & FLASH_SR_ERR) return 0;
+	}
+
+	for (uint32_t i = 0; i < len; i++)
+	{
+		if (*(volatile const uint8_t*)(addr + i) != data[i]) return 0;
+	}
+	return 1;
+}
+
+/* c < 0x80: c + 1 literal bytes follow; c >= 0x80: next byte repeated c - 0x80 + 3 times */
+static int rle_decode(const uint8_t* in, uint32_t len, uint8_t* out, uint32_t cap, uint32_t* out_len)
+{
+	uint32_t i = 0;
+	uint32_t o = 0;
+	while (i < len)
+	{
+		uint8_t c = in[i++];
+		uint32_t n;
+		if (c < 0x80)
+		{
+			n = (uint32_t)c + 1;
+			if (i + n > len || o + n > cap) return 0;
+			for (uint32_t k = 0; k < n; k++) out[o + k] = in[i + k];
+			i += n;
+		}
+		else
+		{
+			n = (uint32_t)c - 0x80 + 3;
+			if (i >= len || o + n > cap) return 0;
+			for (uint32_t k = 0; k < n; k++) out[o + k] = in[i];
+			i++;
+		}
+		o += n;
+		rx_poll();
+	}
+	*out_len = o;
+	return 1;
+}
+
+static void program_frame(struct frame_buf* f)
+{
+	uint8_t seq = f->data[0];
+	uint8_t flags = f->data[1];
+	uint32_t addr = get32(f->data + 2);
+	uint32_t plen = get16(f->data + 6);
+	const uint8_t* data = f->data + FRAME_HDR;
+	uint32_t len = plen;
+
+	if (flags & STUB_FLAG_RLE)
+	{
+		if (!rle_decode(data, plen, decoded, STUB_BLOCK, &len))
+		{
+			reply(seq, ST_ERR_DECODE);
+			return;
+		}
+		data = decoded;
+	}
+	else if (plen > STUB_BLOCK)
+	{
+		reply(seq, ST_ERR_DECODE);
+		return;
+	}
+
+	if (addr < FLASH_START || addr + len > flash_end || (addr & 3) || (len & 3))
+	{
+		reply(seq, ST_ERR_RANGE);
+		return;
+	}
+
+	reply(seq, flash_program(addr, data, len) ? ST_OK : ST_ERR_PROGRAM);
+}
+
+/* ---------------------------------------------------------------- entry */
+
+__attribute__((noreturn, used))
+void stub_main(void)
+{
+	__asm volatile ("cpsid i");
+
+	for (uint32_t* p = &_sbss; p < &_ebss; p++) *p = 0;
+
+	flash_end = FLASH_START + (uint32_t)REG16(FLASH_SIZE_REG) * 1024UL;
+	tick_init();
+
+	/* Hello: magic, version, caps, window, block */
+	const uint8_t* m = (const uint8_t*)&stub_header.magic;
+	for (int i = 0; i < 4; i++) tx_byte(m[i]);
+	tx_byte(STUB_VERSION);
+	tx_byte(STUB_CAP_RLE);
+	tx_byte(STUB_WINDOW);
+	tx_byte((uint8_t)(STUB_BLOCK & 0xFF));
+	tx_byte((uint8_t)(STUB_BLOCK >> 8));
+
+	for (;;)
+	{
+		rx_poll();
+
+		struct frame_buf* f = &frames[prog_buf];
+		if (!f->pending) continue;
+
+		program_frame(f);
+		f->pending = 0;
+		prog_buf = (uint8_t)((prog_buf + 1) % STUB_WINDOW);
+	}
+}
@@ -0,0 +1,91 @@
+#!/usr/bin/env python3
+"""Build src/STM32WebPages.cpp from the HTML sources in this folder.
+
+Each page gets the SVG symbols it references inlined at <!--ICONS-->, has its
+indentation stripped, is gzip-compressed and emitted as a PROGMEM byte array
+together with a strong ETag derived from the compressed bytes.
+
+Run from anywhere after editing login.html, index.html or icons.svg:
+
+    python3 extras/web/embed_pages.py
+"""
+
+import gzip
+import hashlib
+import os
+import re
+
+HERE = os.path.dirname(os.path.abspath(__file__))
+OUT = os.path.join(HERE, "..", "..", "src", "STM32WebPages.cpp")
+
+PAGES = [
+	("LOGIN_PAGE", "login.html", "text/html"),
+	("INDEX_PAGE", "index.html", "text/html"),
+]
+
+BANNER = """﻿/********************************************************************************************************
+ *  [FILE NAME]   :      <STM32WebPages.cpp>                                                            *
+ *  [AUTHOR]      :      <David S. Alexander>                                                           *
+ *  [DATE CREATED]:      <Dec 10, 2025>                                                                 *
+ *  [Description] :      <Source file for STM32 Web Pages>                                              *
+ ********************************************************************************************************/
+
+/* Generated by extras/web/embed_pages.py from the HTML sources in extras/web - do not edit by hand. */
+
+#include "STM32WebPages.h"
+"""
+
+
+def load_symbols():
+	with open(os.path.join(HERE, "icons.svg"), encoding="utf-8") as f:
+		svg = f.read()
+	return {name: symbol for symbol, name in re.findall(r'(<symbol id="i-([a-z-]+)".*?</symbol>)', svg, re.S)}
+
+
+def inline_icons(html, symbols):
+	used = sorted(set(re.findall(r'#i-([a-z-]+)', html)) | set(re.findall(r"ic\('([a-z-]+)'", html)))
+	missing = [name for name in used if name not in symbols]
+	if missing:
+		raise SystemExit("unknown icon(s): " + ", ".join(missing))
+	sprite = '<svg style="display:none">' + "".join(symbols[name] for name in used) + "</svg>"
+	return html.replace("<!--ICONS-->", sprite)
+
+
+def minify(html):
+	lines = (line.strip() for line in html.splitlines())
+	html = "\n".join(line for line in lines if line)
+	# CSS has no significant newlines, so each <style> block collapses to one line
+	return re.sub(r"<style>.*?</style>", lambda m: m.group(0).replace("\n", ""), html, flags=re.S)
+
+
+def c_array(name, blob):
+	rows = []
+	for i in range(0, len(blob), 16):
+		rows.append("\t" + ", ".join("0x%02X" % b for b in blob[i:i + 16]) + ",")
+	return "static const uint8_t %s_GZ[] PROGMEM =\n{\n%s\n};\n" % (name, "\n".join(rows))
+
+
+def main():
+	symbols = load_symbols()
+	out = [BANNER]
+	for name, src, mime in PAGES:
+		with open(os.path.join(HERE, src), encoding="utf-8") as f:
+			raw = f.read()
+		html = minify(inline_icons(raw, symbols)).encode("utf-8")
+		blob = gzip.compress(html, compresslevel=9, mtime=0)
+		etag = '"%s"' % hashlib.sha256(blob).hexdigest()[:16]
+		out.append("")
+		out.append("/* %s: %u bytes of HTML, %u bytes gzip */" % (src, len(html), len(blob)))
+		out.append(c_array(name, blob))
+		out.append('static const char %s_ETAG[] PROGMEM = "%s";' % (name, etag.replace('"', '\\"')))
+		out.append('static const char %s_MIME[] PROGMEM = "%s";' % (name, mime))
+		out.append("")
+		out.append("const STM32WebAsset %s = { %s_GZ, sizeof(%s_GZ), %s_ETAG, %s_MIME };"
+		           % (name, name, name, name, name))
+		print("%-12s %6u -> %5u bytes  etag %s" % (src, len(raw.encode("utf-8")), len(blob), etag))
+	with open(OUT, "w", encoding="utf-8", newline="\r\n") as f:
+		f.write("\n".join(out) + "\n")
+
+
+if __name__ == "__main__":
+	main()
@@ -0,0 +1,641 @@
+/********************************************************************************************************
+ *  [FILE NAME]   :      <STM32BatchRunner.cpp>                                                         *
+ *  [AUTHOR]      :      <David S. Alexander>                                                           *
+ *  [DATE CREATED]:      <Dec 10, 2025>                                                                 *
+ *  [Description] :      <Source file for batch scripts run in one bootloader session>                  *
+ ********************************************************************************************************/
+
+#include "STM32BatchRunner.h"
+
+static const char* const OP_NAMES[STM32_BATCH_OP_COUNT] =
+{
+	"detect", "erase", "program", "verify", "write", "run", "go", "save", "restore"
+};
+
+/* Splits off the next whitespace-separated token; false at the end of the line */
+static bool nextToken(const char*& p, const char* end, const char*& tok, size_t& tokLen)
+{
+	while (p < end && (*p == ' ' || *p == '\t')) p++;
+	if (p >= end || *p == '#') return false;
+	tok = p;
+	while (p < end && *p != ' ' && *p != '\t' && *p != '#') p++;
+	tokLen = (size_t)(p - tok);
+	return true;
+}
+
+static bool tokenIs(const char* tok, size_t len, const char* word)
+{
+	return strlen(word) == len && strncmp(tok, word, len) == 0;
+}
+
+static bool parseNumber(const char* tok, size_t len, uint32_t& out)
+{
+	char buf[16];
+	if (len == 0 || len >= sizeof(buf)) return false;
+	memcpy(buf, tok, len);
+	buf[len] = '\0';
+	char* end = nullptr;
+	out = (uint32_t)strtoul(buf, &end, 0);
+	return end && *end == '\0';
+}
+
+static int hexNibble(char c)
+{
+	if (c >= '0' && c <= '9') return c - '0';
+	if (c >= 'a' && c <= 'f') return c - 'a' + 10;
+	if (c >= 'A' && c <= 'F') return c - 'A' + 10;
+	return -1;
+}
+
+static bool overlaps(uint32_t a, uint32_t aLen, uint32_t b, uint32_t bLen)
+{
+	return a < b + bLen && b < a + aLen;
+}
+
+STM32Manifest::STM32Manifest()
+: _n(0),
+_spans(0),
+_errorLine(0),
+_error(nullptr)
+{
+}
+
+bool STM32Manifest::fail(uint16_t line, const char* error)
+{
+	_errorLine = line;
+	_error = error;
+	return false;
+}
+
+bool STM32Manifest::parseLine(const char* text, size_t len, STM32ManifestRegion& out, bool& empty)
+{
+	const char* p = text;
+	const char* end = text + len;
+	const char* tok;
+	size_t tokLen;
+
+	empty = !nextToken(p, end, tok, tokLen);
+	if (empty) return true;
+
+	memset(&out, 0, sizeof(out));
+	if (tokenIs(tok, tokLen, "image")) out.kind = STM32_REGION_IMAGE;
+	else if (tokenIs(tok, tokLen, "check")) out.kind = STM32_REGION_CHECK;
+	else if (tokenIs(tok, tokLen, "preserve")) out.kind = STM32_REGION_PRESERVE;
+	else { _error = "unknown region kind"; return false; }
+
+	if (out.kind == STM32_REGION_PRESERVE)
+	{
+		if (!nextToken(p, end, tok, tokLen) || !parseNumber(tok, tokLen, out.addr) || !nextToken(p, end, tok, tokLen) || !parseNumber(tok, tokLen, out.len) || out.len == 0)
+		{
+			_error = "preserve needs <addr> <len>";
+			return false;
+		}
+	}
+	else
+	{
+		if (!nextToken(p, end, tok, tokLen)) { _error = "missing file name"; return false; }
+		if (tokLen >= sizeof(out.file)) { _error = "file name too long"; return false; }
+		memcpy(out.file, tok, tokLen);
+		out.file[tokLen] = '\0';
+		if (!nextToken(p, end, tok, tokLen) || !parseNumber(tok, tokLen, out.addr)) { _error = "bad address"; return false; }
+	}
+
+	if (nextToken(p, end, tok, tokLen)) { _error = "unexpected argument"; return false; }
+	return true;
+}
+
+bool STM32Manifest::parse(const char* text, size_t len)
+{
+	_n = 0;
+	_spans = 0;
+	_errorLine = 0;
+	_error = nullptr;
+
+	uint16_t lineNo = 0;
+	const char* end = text + len;
+	for (const char* p = text; p < end; )
+	{
+		const char* eol = (const char*)memchr(p, '\n', (size_t)(end - p));
+		if (!eol) eol = end;
+		lineNo++;
+
+		STM32ManifestRegion r;
+		bool empty;
+		if ((size_t)(eol - p) > STM32_BATCH_LINE_MAX) _error = "line too long";
+		else if (parseLine(p, (size_t)(eol - p), r, empty) && !empty)
+		{
+			if (_n == STM32_MANIFEST_MAX_REGIONS) _error = "too many regions";
+			else
+			{
+				r.line = lineNo;
+				_regions[_n++] = r;
+			}
+		}
+		if (_error) return fail(lineNo, _error);
+		p = eol + 1;
+	}
+
+	for (uint8_t i = 0; i < _n; i++)
+	{
+		if (_regions[i].kind == STM32_REGION_IMAGE) return true;
+	}
+	return fail(0, "no image in manifest");
+}
+
+bool STM32Manifest::erased(uint32_t addr, uint32_t len) const
+{
+	for (uint8_t i = 0; i < _spans; i++)
+	{
+		if (overlaps(addr, len, _span[i].addr, _span[i].len)) return true;
+	}
+	return false;
+}
+
+bool STM32Manifest::plan(const STM32FlashGeometry& g, uint32_t flashStart, uint32_t flashBytes, uint8_t programUnit)
+{
+	_spans = 0;
+	_errorLine = 0;
+	_error = nullptr;
+	if (programUnit == 0) programUnit = 1;
+
+	for (uint8_t i = 0; i < _n; i++)
+	{
+		const STM32ManifestRegion& r = _regions[i];
+		if (r.len == 0) return fail(r.line, "empty file");
+		if (r.addr < flashStart || r.addr - flashStart > flashBytes || r.len > flashBytes - (r.addr - flashStart)) return fail(r.line, "region outside flash");
+	}
+
+	/* Writes are padded to the programming unit, so a unit shared by two images, or by an image and
+	   a range that may be written back, would be written twice */
+	for (uint8_t i = 0; i < _n; i++)
+	{
+		const STM32ManifestRegion& a = _regions[i];
+		if (a.kind == STM32_REGION_CHECK) continue;
+		uint32_t aLo = a.addr / programUnit;
+		uint32_t aHi = (a.addr + a.len - 1) / programUnit;
+		for (uint8_t j = 0; j < i; j++)
+		{
+			const STM32ManifestRegion& b = _regions[j];
+			if (b.kind == STM32_REGION_CHECK || (a.kind == STM32_REGION_PRESERVE && b.kind == STM32_REGION_PRESERVE)) continue;
+			bool unitShared = aLo <= (b.addr + b.len - 1) / programUnit && b.addr / programUnit <= aHi;
+			if (a.kind == STM32_REGION_IMAGE && b.kind == STM32_REGION_IMAGE)
+			{
+				if (overlaps(a.addr, a.len, b.addr, b.len)) return fail(a.line, "overlaps another image");
+				if (unitShared) return fail(a.line, "shares a programming unit with another image");
+			}
+			else if (unitShared)
+			{
+				return fail(a.line, "image and preserved range share a programming unit");
+			}
+		}
+	}
+
+	/* Every unit an image touches, merged into runs of consecutive units */
+	uint32_t off, size;
+	for (uint32_t u = 0; STM32FamilyDb::eraseUnit(g, flashBytes, u, off, size); u++)
+	{
+		uint16_t line = 0;
+		for (uint8_t i = 0; i < _n && !line; i++)
+		{
+			const STM32ManifestRegion& r = _regions[i];
+			if (r.kind == STM32_REGION_IMAGE && overlaps(r.addr - flashStart, r.len, off, size)) line = r.line;
+		}
+		if (!line) continue;
+
+		if (_spans && _span[_spans - 1].addr + _span[_spans - 1].len == flashStart + off)
+		{
+			_span[_spans - 1].len += size;
+			continue;
+		}
+		/* Each image yields one run and runs only merge, so there are never more than the images */
+		_span[_spans].line = line;
+		_span[_spans].addr = flashStart + off;
+		_span[_spans].len = size;
+		_spans++;
+	}
+
+	uint8_t slots = 0;
+	for (uint8_t i = 0; i < _n; i++)
+	{
+		STM32ManifestRegion& r = _regions[i];
+		if (r.kind == STM32_REGION_CHECK && erased(r.addr, r.len)) return fail(r.line, "check region is in a page/sector an image erases");
+		r.save = (r.kind == STM32_REGION_PRESERVE) && erased(r.addr, r.len);
+		r.slot = r.save ? slots++ : 0;
+	}
+
+	if (stepCount() > STM32_BATCH_MAX_STEPS) return fail(0, "too many steps");
+	return true;
+}
+
+uint8_t STM32Manifest::stepCount() const
+{
+	uint8_t steps = 1 + _spans;
+	for (uint8_t i = 0; i < _n; i++)
+	{
+		if (_regions[i].kind == STM32_REGION_IMAGE) steps += 2;
+		else if (_regions[i].kind == STM32_REGION_CHECK) steps++;
+		else if (_regions[i].save) steps += 3;
+	}
+	return steps;
+}
+
+template <class Transport>
+STM32BatchRunnerT<Transport>::STM32BatchRunnerT(Flasher& flasher, STM32BatchFiles& files)
+: _flasher(&flasher),
+_files(&files),
+_count(0),
+_ok(false),
+_totalMs(0),
+_errorLine(0),
+_error(nullptr)
+{
+}
+
+template <class Transport>
+const char* STM32BatchRunnerT<Transport>::opName(STM32BatchOp op)
+{
+	return (op < STM32_BATCH_OP_COUNT) ? OP_NAMES[op] : "";
+}
+
+template <class Transport>
+bool STM32BatchRunnerT<Transport>::parseLine(const char* text, size_t len, Line& out, bool& empty)
+{
+	const char* p = text;
+	const char* end = text + len;
+	const char* tok;
+	size_t tokLen;
+
+	empty = !nextToken(p, end, tok, tokLen);
+	if (empty) return true;
+
+	memset(&out, 0, sizeof(out));
+	uint8_t op = 0;
+	while (op < STM32_BATCH_SAVE && !tokenIs(tok, tokLen, OP_NAMES[op])) op++;
+	if (op == STM32_BATCH_SAVE) { _error = "unknown operation"; return false; }
+	out.op = (STM32BatchOp)op;
+
+	switch (out.op)
+	{
+		case STM32_BATCH_DETECT:
+		break;
+
+		case STM32_BATCH_ERASE:
+		if (!nextToken(p, end, tok, tokLen)) { _error = "erase needs 'all' or <addr> <len>"; return false; }
+		if (tokenIs(tok, tokLen, "all"))
+		{
+			out.all = true;
+			break;
+		}
+		if (!parseNumber(tok, tokLen, out.addr) || !nextToken(p, end, tok, tokLen) || !parseNumber(tok, tokLen, out.len) || out.len == 0)
+		{
+			_error = "erase needs 'all' or <addr> <len>";
+			return false;
+		}
+		out.hasAddr = true;
+		break;
+
+		case STM32_BATCH_PROGRAM:
+		case STM32_BATCH_VERIFY:
+		case STM32_BATCH_RUN:
+		if (!nextToken(p, end, tok, tokLen)) { _error = "missing file name"; return false; }
+		if (tokLen >= sizeof(out.file)) { _error = "file name too long"; return false; }
+		memcpy(out.file, tok, tokLen);
+		out.file[tokLen] = '\0';
+		if (nextToken(p, end, tok, tokLen))
+		{
+			if (!parseNumber(tok, tokLen, out.addr)) { _error = "bad address"; return false; }
+			out.hasAddr = true;
+		}
+		break;
+
+		case STM32_BATCH_WRITE:
+		case STM32_BATCH_GO:
+		if (!nextToken(p, end, tok, tokLen) || !parseNumber(tok, tokLen, out.addr)) { _error = "bad address"; return false; }
+		out.hasAddr = true;
+		if (out.op == STM32_BATCH_GO) break;
+
+		if (!nextToken(p, end, tok, tokLen) || (tokLen & 1)) { _error = "write needs an even number of hex digits"; return false; }
+		if (tokLen / 2 > sizeof(out.data)) { _error = "write data too long"; return false; }
+		for (size_t i = 0; i < tokLen; i += 2)
+		{
+			int hi = hexNibble(tok[i]);
+			int lo = hexNibble(tok[i + 1]);
+			if (hi < 0 || lo < 0) { _error = "bad hex data"; return false; }
+			out.data[i / 2] = (uint8_t)((hi << 4) | lo);
+		}
+		out.len = (uint32_t)(tokLen / 2);
+		break;
+
+		default:
+		break;
+	}
+
+	if (nextToken(p, end, tok, tokLen)) { _error = "unexpected argument"; return false; }
+	return true;
+}
+
+template <class Transport>
+bool STM32BatchRunnerT<Transport>::parse(const char* script, size_t len)
+{
+	_errorLine = 0;
+	_error = nullptr;
+
+	uint16_t lineNo = 0;
+	uint8_t steps = 0;
+	const char* end = script + len;
+	for (const char* p = script; p < end; )
+	{
+		const char* eol = (const char*)memchr(p, '\n', (size_t)(end - p));
+		if (!eol) eol = end;
+		lineNo++;
+
+		Line line;
+		bool empty;
+		if ((size_t)(eol - p) > STM32_BATCH_LINE_MAX) _error = "line too long";
+		else if (parseLine(p, (size_t)(eol - p), line, empty) && !empty && ++steps > STM32_BATCH_MAX_STEPS) _error = "too many steps";
+		if (_error)
+		{
+			_errorLine = lineNo;
+			return false;
+		}
+		p = eol + 1;
+	}
+
+	if (steps == 0) _error = "empty script";
+	return steps != 0;
+}
+
+template <class Transport>
+bool STM32BatchRunnerT<Transport>::run(const char* script, size_t len)
+{
+	_count = 0;
+	_ok = false;
+	_totalMs = 0;
+	if (!parse(script, len)) return false;
+
+	uint32_t start = millis();
+	_flasher->beginSession();
+
+	bool ok = true;
+	uint16_t lineNo = 0;
+	const char* end = script + len;
+	for (const char* p = script; ok && p < end; )
+	{
+		const char* eol = (const char*)memchr(p, '\n', (size_t)(end - p));
+		if (!eol) eol = end;
+		lineNo++;
+
+		Line line;
+		bool empty;
+		parseLine(p, (size_t)(eol - p), line, empty);
+		p = eol + 1;
+		if (empty) continue;
+
+		ok = runStep(line, lineNo);
+	}
+
+	_flasher->endSession();
+	_totalMs = millis() - start;
+	_ok = ok;
+	return ok;
+}
+
+template <class Transport>
+bool STM32BatchRunnerT<Transport>::runStep(const Line& line, uint16_t lineNo)
+{
+	STM32BatchStep& step = _steps[_count++];
+	step = STM32BatchStep();
+	step.line = lineNo;
+	step.op = line.op;
+	step.addr = line.addr;
+
+	uint32_t t0 = millis();
+	step.ok = exec(line, step);
+	step.ms = millis() - t0;
+	yield();
+	return step.ok;
+}
+
+template <class Transport>
+bool STM32BatchRunnerT<Transport>::planManifest()
+{
+	STM32FamilyInfo fi = _flasher->familyInfo();
+	STM32FlashGeometry g = STM32FamilyDb::getFlashGeometry(fi, _flasher->flashKb());
+	bool ok = _manifest.plan(g, _flasher->flashStart(), (uint32_t)_flasher->flashKb() * 1024UL, _flasher->flashWriteAlign());
+	_errorLine = _manifest.errorLine();
+	_error = _manifest.error();
+	return ok;
+}
+
+template <class Transport>
+bool STM32BatchRunnerT<Transport>::parseManifest(const char* text, size_t len)
+{
+	_errorLine = 0;
+	_error = nullptr;
+	if (!_manifest.parse(text, len))
+	{
+		_errorLine = _manifest.errorLine();
+		_error = _manifest.error();
+		return false;
+	}
+
+	for (uint8_t i = 0; i < _manifest.regionCount(); i++)
+	{
+		STM32ManifestRegion& r = _manifest.region(i);
+		if (r.kind == STM32_REGION_PRESERVE) continue;
+		size_t size = 0;
+		if (!_files->open(r.file, size))
+		{
+			_errorLine = r.line;
+			_error = "cannot open file";
+			return false;
+		}
+		_files->close();
+		r.len = (uint32_t)size;
+	}
+
+	return !_flasher->isConnected() || planManifest();
+}
+
+template <class Transport>
+bool STM32BatchRunnerT<Transport>::runManifest(const char* text, size_t len, bool verifyImages)
+{
+	_count = 0;
+	_ok = false;
+	_totalMs = 0;
+	if (!parseManifest(text, len)) return false;
+
+	uint32_t start = millis();
+	_flasher->beginSession();
+
+	/* The plan needs the layout, so a manifest on an undetected part starts with detect */
+	Line line;
+	memset(&line, 0, sizeof(line));
+	bool ok = true;
+	if (!_flasher->isConnected())
+	{
+		line.op = STM32_BATCH_DETECT;
+		ok = runStep(line, 0) && planManifest();
+	}
+
+	for (uint8_t i = 0; ok && i < _manifest.regionCount(); i++)
+	{
+		const STM32ManifestRegion& r = _manifest.region(i);
+		if (!r.save) continue;
+		line.op = STM32_BATCH_SAVE;
+		line.addr = r.addr;
+		line.len = r.len;
+		line.slot = r.slot;
+		ok = runStep(line, r.line);
+	}
+
+	for (uint8_t i = 0; ok && i < _manifest.spanCount(); i++)
+	{
+		const STM32EraseSpan& s = _manifest.span(i);
+		line.op = STM32_BATCH_ERASE;
+		line.addr = s.addr;
+		line.len = s.len;
+		ok = runStep(line, s.line);
+	}
+
+	/* Write everything before verifying anything, so a later write cannot disturb a verified one */
+	for (uint8_t pass = 0; pass < 3; pass++)
+	{
+		for (uint8_t i = 0; ok && i < _manifest.regionCount(); i++)
+		{
+			const STM32ManifestRegion& r = _manifest.region(i);
+			if (r.kind == STM32_REGION_PRESERVE)
+			{
+				/* Saved ranges go back after every image, and are always read back */
+				if (!r.save || pass == 0) continue;
+				line.op = (pass == 1) ? STM32_BATCH_RESTORE : STM32_BATCH_VERIFY;
+			}
+			else
+			{
+				if (pass == 1 || (pass == 0 && r.kind == STM32_REGION_CHECK)) continue;
+				if (pass == 2 && r.kind == STM32_REGION_IMAGE && !verifyImages) continue;
+				line.op = pass ? STM32_BATCH_VERIFY : STM32_BATCH_PROGRAM;
+			}
+			line.addr = r.addr;
+			line.hasAddr = true;
+			line.scratch = (r.kind == STM32_REGION_PRESERVE);
+			line.slot = r.slot;
+			memcpy(line.file, r.file, sizeof(line.file));
+			ok = runStep(line, r.line);
+		}
+	}
+
+	_flasher->endSession();
+	_totalMs = millis() - start;
+	_ok = ok;
+	return ok;
+}
+
+template <class Transport>
+bool STM32BatchRunnerT<Transport>::exec(const Line& line, STM32BatchStep& step)
+{
+	STM32RomResult& res = step.res;
+	switch (line.op)
+	{
+		case STM32_BATCH_DETECT:
+		return _flasher->detect(res);
+
+		case STM32_BATCH_ERASE:
+		if (line.all) return _flasher->massErase(res);
+		return _flasher->eraseRange(line.addr, line.len, step.bytes, res);
+
+		case STM32_BATCH_WRITE:
+		if (!_flasher->flashBuffer(line.addr, line.data, line.len, res)) return false;
+		step.bytes = line.len;
+		return true;
+
+		case STM32_BATCH_GO:
+		return _flasher->go(line.addr, res);
+
+		case STM32_BATCH_SAVE:
+		{
+			Stream* dst = _files->openScratch(line.slot, true);
+			if (!dst) return res.fail(STM32_ERR_SOURCE, STM32_RO_READ, STM32_ST_NONE, 0, line.addr);
+			bool ok = _flasher->readToStream(line.addr, line.len, *dst, res);
+			_files->close();
+			if (ok) step.bytes = line.len;
+			return ok;
+		}
+
+		default:
+		return withFile(line, step);
+	}
+}
+
+template <class Transport>
+bool STM32BatchRunnerT<Transport>::withFile(const Line& line, STM32BatchStep& step)
+{
+	STM32RomResult& res = step.res;
+	STM32RomOp op = (line.op == STM32_BATCH_VERIFY) ? STM32_RO_VERIFY : (line.op == STM32_BATCH_RUN) ? STM32_RO_RAM_RUN : STM32_RO_WRITE;
+
+	size_t len = 0;
+	Stream* src = line.scratch ? _files->openScratch(line.slot, false) : _files->open(line.file, len);
+	if (!src) return res.fail(STM32_ERR_SOURCE, op, STM32_ST_NONE);
+
+	bool ok;
+	size_t done = 0;
+	if (line.op == STM32_BATCH_RUN)
+	{
+		step.addr = line.hasAddr ? line.addr : 0;
+		ok = _flasher->runFromRam(*src, len, step.addr, res);
+		if (ok) done = len;
+	}
+	else
+	{
+		step.addr = line.hasAddr ? line.addr : _flasher->flashStart();
+		ok = (line.op == STM32_BATCH_VERIFY)
+			? _flasher->verifyStream(*src, step.addr, done, res)
+			: _flasher->programStream(*src, step.addr, done, res);
+	}
+	_files->close();
+
+	step.bytes = (uint32_t)done;
+	return ok;
+}
+
+template <class Transport>
+void STM32BatchRunnerT<Transport>::writeReport(Print& out) const
+{
+	STM32JsonWriter json(out);
+	json.beginObject();
+	json.add("ok", _ok);
+	json.add("ms", (unsigned long)_totalMs);
+	if (_flasher->isConnected()) json.add("desc", _flasher->desc());
+	/* A manifest that does not fit the part it detected */
+	if (_error)
+	{
+		json.add("line", (unsigned)_errorLine);
+		json.add("error", _error);
+	}
+	json.beginArray("steps");
+	for (uint8_t i = 0; i < _count; i++)
+	{
+		const STM32BatchStep& s = _steps[i];
+		json.beginObject();
+		json.add("line", (unsigned)s.line);
+		json.add("op", opName(s.op));
+		json.add("ok", s.ok);
+		json.add("ms", (unsigned long)s.ms);
+		if (s.op != STM32_BATCH_DETECT && (s.op != STM32_BATCH_ERASE || s.addr)) json.addHex("addr", s.addr, 8);
+		if (s.bytes) json.add((s.op == STM32_BATCH_ERASE) ? "units" : "bytes", (unsigned long)s.bytes);
+		if (!s.ok)
+		{
+			char msg[96];
+			s.res.format(msg, sizeof(msg));
+			json.add("error", msg);
+		}
+		json.endObject();
+	}
+	json.endArray();
+	json.endObject();
+}
+
+template class STM32BatchRunnerT<STM32StreamTransport>;
+#ifdef ESP8266
+template class STM32BatchRunnerT<STM32EspTransport>;
+#endif
@@ -0,0 +1,223 @@
+/********************************************************************************************************
+ *  [FILE NAME]   :      <STM32BatchRunner.h>                                                           *
+ *  [AUTHOR]      :      <David S. Alexander>                                                           *
+ *  [DATE CREATED]:      <Dec 10, 2025>                                                                 *
+ *  [Description] :      <Header file for batch scripts run in one bootloader session>                  *
+ ********************************************************************************************************/
+
+#ifndef STM32_BATCH_RUNNER_H
+#define	STM32_BATCH_RUNNER_H
+
+#include <Arduino.h>
+#include "STM32RomFlasher.h"
+#include "STM32JsonWriter.h"
+
+/* One operation per line, '#' starts a comment, numbers are decimal or 0x-prefixed:
+
+     detect
+     erase all
+     erase <addr> <len>          pages/sectors overlapping the range
+     program <file> [<addr>]     default: flash start
+     verify <file> [<addr>]
+     write <addr> <hex bytes>    e.g. write 0x20001000 DEADBEEF
+     run <file> [<addr>]         runFromRam(); default: start of free SRAM
+     go <addr> */
+enum STM32BatchOp : uint8_t
+{
+	STM32_BATCH_DETECT,
+	STM32_BATCH_ERASE,
+	STM32_BATCH_PROGRAM,
+	STM32_BATCH_VERIFY,
+	STM32_BATCH_WRITE,
+	STM32_BATCH_RUN,
+	STM32_BATCH_GO,
+	/* Manifest steps only; scripts cannot name them */
+	STM32_BATCH_SAVE,
+	STM32_BATCH_RESTORE,
+	STM32_BATCH_OP_COUNT
+};
+
+static const uint8_t STM32_BATCH_MAX_STEPS = 32;
+static const size_t  STM32_BATCH_LINE_MAX = 160;
+static const size_t  STM32_BATCH_NAME_MAX = 32;
+static const size_t  STM32_BATCH_WRITE_MAX = 64;
+
+struct STM32BatchStep
+{
+	uint16_t line;
+	STM32BatchOp op;
+	bool ok;
+	uint32_t addr;
+	uint32_t bytes;	/* programmed, verified, written, loaded or saved; erase units for a range erase */
+	uint32_t ms;
+	STM32RomResult res;
+};
+
+/* A manifest places several images in one flash, one region per line ('#' comments, numbers as in
+   scripts):
+
+     image <file> <addr>       programmed and verified; only the pages/sectors it covers are erased
+     check <file> <addr>       verified only; must lie outside every page/sector that is erased
+     preserve <addr> <len>     kept: left out of the erase, or saved and written back when an image
+                               needs its page/sector erased
+
+   Images must not overlap or share a programming unit, and neither may an image and a preserved
+   range. Two images in one page/sector are fine: the page is erased once, before either is
+   programmed. A preserved range in an erased page/sector is read into a scratch file of
+   STM32BatchFiles before the erase, programmed back after the images and verified. */
+enum STM32RegionKind : uint8_t
+{
+	STM32_REGION_IMAGE,
+	STM32_REGION_CHECK,
+	STM32_REGION_PRESERVE
+};
+
+static const uint8_t STM32_MANIFEST_MAX_REGIONS = 12;
+
+struct STM32ManifestRegion
+{
+	uint16_t line;
+	STM32RegionKind kind;
+	uint32_t addr;
+	uint32_t len;	/* file size for images and checks, set by the runner */
+	bool save;		/* preserved range in an erased page/sector, set by plan() */
+	uint8_t slot;	/* its scratch file */
+	char file[STM32_BATCH_NAME_MAX];
+};
+
+/* Consecutive erase units covered by images, as the range eraseRange() takes */
+struct STM32EraseSpan
+{
+	uint16_t line;	/* the first image in it */
+	uint32_t addr;
+	uint32_t len;
+};
+
+class STM32Manifest
+{
+	public:
+	STM32Manifest();
+
+	/* Syntax only; false with errorLine()/error() set */
+	bool parse(const char* text, size_t len);
+	/* Checks the regions against a part's flash and works out the erase spans */
+	bool plan(const STM32FlashGeometry& g, uint32_t flashStart, uint32_t flashBytes, uint8_t programUnit);
+
+	uint8_t regionCount() const { return _n; }
+	STM32ManifestRegion& region(uint8_t i) { return _regions[i]; }
+	const STM32ManifestRegion& region(uint8_t i) const { return _regions[i]; }
+	uint8_t spanCount() const { return _spans; }
+	const STM32EraseSpan& span(uint8_t i) const { return _span[i]; }
+	/* detect (if needed), saves, erases, programs, restores and verifies */
+	uint8_t stepCount() const;
+
+	uint16_t errorLine() const { return _errorLine; }
+	const char* error() const { return _error; }
+
+	private:
+	STM32ManifestRegion _regions[STM32_MANIFEST_MAX_REGIONS];
+	uint8_t _n;
+	STM32EraseSpan _span[STM32_MANIFEST_MAX_REGIONS];
+	uint8_t _spans;
+
+	uint16_t _errorLine;
+	const char* _error;
+
+	bool fail(uint16_t line, const char* error);
+	bool parseLine(const char* text, size_t len, STM32ManifestRegion& out, bool& empty);
+	bool erased(uint32_t addr, uint32_t len) const;
+};
+
+/* Opens the images a script names; the web flasher maps names to LittleFS paths */
+class STM32BatchFiles
+{
+	public:
+	virtual ~STM32BatchFiles() {}
+	/* nullptr if there is no such file; only one file is open at a time */
+	virtual Stream* open(const char* name, size_t& len) = 0;
+	virtual void close() = 0;
+	/* Scratch file `slot` for a preserved range, truncated when opened for writing; closed with
+	   close(). nullptr when there is none, which makes a manifest that must save a range fail. */
+	virtual Stream* openScratch(uint8_t slot, bool write) { (void)slot; (void)write; return nullptr; }
+};
+
+/* Parses and runs a batch script with STM32RomFlasherT::beginSession() held, so the target is
+   reset and synced once rather than per operation. Instantiated in STM32BatchRunner.cpp for the
+   same transports as the flasher. */
+template <class Transport>
+class STM32BatchRunnerT
+{
+	public:
+	typedef STM32RomFlasherT<Transport> Flasher;
+
+	STM32BatchRunnerT(Flasher& flasher, STM32BatchFiles& files);
+
+	/* Checks every line without touching the target; on failure errorLine()/error() say why */
+	bool parse(const char* script, size_t len);
+	/* Parses, then runs the steps in order and stops at the first failure */
+	bool run(const char* script, size_t len);
+
+	/* Parses a manifest and sizes its files; when the flasher has detected the part, also plans it,
+	   so a manifest that does not fit is refused before the target is touched */
+	bool parseManifest(const char* text, size_t len);
+	/* Runs a manifest in one session: detect (unless done), save the preserved ranges that are in
+	   the way, erase the spans, program the images, restore the saved ranges, then verify images,
+	   check regions and restored ranges. Reported like a script, each step with the line of its
+	   region. Without verifyImages the images are not read back (the rest still is). */
+	bool runManifest(const char* text, size_t len, bool verifyImages = true);
+
+	uint16_t errorLine() const { return _errorLine; }
+	const char* error() const { return _error; }
+
+	uint8_t stepCount() const { return _count; }
+	const STM32BatchStep& step(uint8_t i) const { return _steps[i]; }
+	bool ok() const { return _ok; }
+	uint32_t totalMs() const { return _totalMs; }
+
+	/* {"ok":..,"ms":..,"steps":[{"line":..,"op":..,"ok":..,"ms":..,...}]} */
+	void writeReport(Print& out) const;
+
+	static const char* opName(STM32BatchOp op);
+
+	private:
+	struct Line
+	{
+		STM32BatchOp op;
+		bool all;
+		bool hasAddr;
+		bool scratch;	/* the file is scratch file `slot` */
+		uint8_t slot;
+		uint32_t addr;
+		uint32_t len;
+		char file[STM32_BATCH_NAME_MAX];
+		uint8_t data[STM32_BATCH_WRITE_MAX];
+	};
+
+	Flasher* _flasher;
+	STM32BatchFiles* _files;
+
+	STM32BatchStep _steps[STM32_BATCH_MAX_STEPS];
+	uint8_t _count;
+	bool _ok;
+	uint32_t _totalMs;
+
+	uint16_t _errorLine;
+	const char* _error;
+
+	STM32Manifest _manifest;
+
+	/* Returns false with _error set; sets `empty` for blank and comment lines */
+	bool parseLine(const char* text, size_t len, Line& out, bool& empty);
+	bool exec(const Line& line, STM32BatchStep& step);
+	/* Appends a step for `line`, runs it and times it */
+	bool runStep(const Line& line, uint16_t lineNo);
+	bool planManifest();
+	bool withFile(const Line& line, STM32BatchStep& step);
+};
+
+typedef STM32BatchRunnerT<STM32StreamTransport> STM32BatchRunner;
+#ifdef ESP8266
+typedef STM32BatchRunnerT<STM32EspTransport> STM32EspBatchRunner;
+#endif
+
+#endif	/* STM32_BATCH_RUNNER_H */
@@ -13,6 +13,10 @@
 static const uint8_t STM32_ACK  = 0x79;
 static const uint8_t STM32_NACK = 0x1F;
 
+/* AN4286 SPI framing: start of frame before each command, dummy byte clocked to poll or read */
+static const uint8_t STM32_SPI_SOF   = 0x5A;
+static const uint8_t STM32_SPI_DUMMY = 0x00;
+
 static const uint8_t STM32_CMD_GET     = 0x00;
 static const uint8_t STM32_CMD_GET_VER = 0x01;
 static const uint8_t STM32_CMD_GET_ID  = 0x02;
@@ -24,6 +28,12 @@ static const uint8_t STM32_CMD_XERASE  = 0x44;
 
 static const uint32_t STM32_FLASH_START_DEFAULT = 0x08000000UL;
 static const size_t   STM32_CHUNK = 256;
+/* WRITE frames are padded with 0xFF to a word; flash writes to the family's programming unit
+   (STM32FlashGeometry::programUnit) up to a 32-byte H7 flash word, which divides STM32_CHUNK */
+static const uint8_t  STM32_WRITE_ALIGN_MIN = 4;
+static const uint8_t  STM32_WRITE_ALIGN_MAX = 32;
+/* Pages/sectors per ERASE/XERASE command when erasing a range */
+static const size_t   STM32_ERASE_UNITS_MAX = 32;
 
 #define F0_FLASH_SIZE_ADDR   0x1FFFF7CCUL
 #define G0_FLASH_SIZE_ADDR   0x1FFF75E0UL
@@ -51,4 +61,25 @@ static const size_t   STM32_CHUNK = 256;
 
 #define WL_FLASH_SIZE_ADDR   0x1FFF75E0UL
 
+/* 96-bit unique device ID (reference manuals); L1 Cat.3 and later parts keep it at 0x1FF800D0 */
+#define F0_UID_ADDR          0x1FFFF7ACUL
+#define F1_UID_ADDR          0x1FFFF7E8UL
+#define F2_UID_ADDR          0x1FFF7A10UL
+#define F3_UID_ADDR          0x1FFFF7ACUL
+#define F4_UID_ADDR          0x1FFF7A10UL
+#define F7_UID_ADDR          0x1FF0F420UL
+#define H5_UID_ADDR          0x08FFF800UL
+#define H7_UID_ADDR          0x1FF1E800UL
+#define L0_UID_ADDR          0x1FF80050UL
+#define L1_UID_ADDR          0x1FF80050UL
+#define L4_UID_ADDR          0x1FFF7590UL
+#define L5_UID_ADDR          0x0BFA0590UL
+#define C0_UID_ADDR          0x1FFF7550UL
+#define G0_UID_ADDR          0x1FFF7590UL
+#define G4_UID_ADDR          0x1FFF7590UL
+#define WB_UID_ADDR          0x1FFF7590UL
+/* L0/L1 keep the last word of the ID apart from the first two */
+#define L0_UID_WORD2_OFFSET  0x14UL
+static const size_t   STM32_UID_LEN = 12;
+
 #endif	/* FOTA_CONSTANTS_H */
\ No newline at end of file
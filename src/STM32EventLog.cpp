@@ -0,0 +1,203 @@
+/********************************************************************************************************
+ *  [FILE NAME]   :      <STM32EventLog.cpp>                                                            *
+ *  [AUTHOR]      :      <David S. Alexander>                                                           *
+ *  [DATE CREATED]:      <Dec 10, 2025>                                                                 *
+ *  [Description] :      <Source file for the fixed-size flasher event log>                             *
+ ********************************************************************************************************/
+
+#include "STM32EventLog.h"
+#include "STM32JsonWriter.h"
+#include "STM32ImagePreflight.h"
+
+static const char* const EVENT_NAMES[STM32_EV_COUNT] =
+{
+	"boot", "login", "login_failed", "logout", "connect", "connect_failed", "disconnect",
+	"upload", "upload_failed", "command", "job_ok", "job_failed", "preflight_refused",
+	"bridge_open", "bridge_closed"
+};
+
+STM32EventLog::STM32EventLog()
+: _head(0),
+_n(0),
+_next(1),
+_store(nullptr)
+{
+	memset(_ring, 0, sizeof(_ring));
+}
+
+const char* STM32EventLog::codeName(uint8_t code)
+{
+	return (code < STM32_EV_COUNT) ? EVENT_NAMES[code] : "unknown";
+}
+
+void STM32EventLog::pack(const STM32RomResult& res, uint32_t& addr, uint32_t& value)
+{
+	addr = res.addr;
+	value = ((uint32_t)res.code << 24) | ((uint32_t)res.op << 16) | ((uint32_t)res.stage << 8) | res.resp;
+}
+
+STM32RomResult STM32EventLog::unpack(uint32_t addr, uint32_t value)
+{
+	STM32RomResult res;
+	res.code = (STM32RomCode)(value >> 24);
+	res.op = (STM32RomOp)((value >> 16) & 0xFF);
+	res.stage = (STM32RomStage)((value >> 8) & 0xFF);
+	res.resp = (uint8_t)value;
+	res.addr = addr;
+	return res;
+}
+
+void STM32EventLog::begin(STM32EventStore* store, uint32_t resetReason)
+{
+	_store = store;
+	_head = 0;
+	_n = 0;
+	_next = 1;
+
+	if (_store)
+	{
+		size_t n = _store->load(_ring, CAPACITY);
+		/* A torn or foreign file ends the history rather than corrupting the numbering */
+		size_t valid = 0;
+		while (valid < n && _ring[valid].code < STM32_EV_COUNT
+			&& (valid == 0 || _ring[valid].seq == _ring[valid - 1].seq + 1)) valid++;
+		if (valid > 0 && _ring[0].seq != 0)
+		{
+			_n = (uint8_t)valid;
+			_head = (uint8_t)(valid % CAPACITY);
+			_next = _ring[valid - 1].seq + 1;
+		}
+	}
+
+	log(STM32_EV_BOOT, 0, resetReason);
+}
+
+void STM32EventLog::push(const STM32Event& e)
+{
+	_ring[_head] = e;
+	_head = (uint8_t)((_head + 1) % CAPACITY);
+	if (_n < CAPACITY) _n++;
+}
+
+void STM32EventLog::log(STM32EventCode code, uint32_t addr, uint32_t value, char job)
+{
+	STM32Event e;
+	e.seq = _next++;
+	e.ms = millis();
+	e.addr = addr;
+	e.value = value;
+	e.code = code;
+	e.job = job;
+	push(e);
+	if (_store) _store->append(e);
+}
+
+void STM32EventLog::logFailure(STM32EventCode code, const STM32RomResult& res, char job)
+{
+	uint32_t addr, value;
+	pack(res, addr, value);
+	log(code, addr, value, job);
+}
+
+const STM32Event& STM32EventLog::at(uint32_t seq) const
+{
+	/* Slot of the oldest event, then forward by its distance from firstSeq() */
+	uint8_t oldest = (uint8_t)((_head + CAPACITY - _n) % CAPACITY);
+	return _ring[(oldest + (seq - firstSeq())) % CAPACITY];
+}
+
+void STM32EventLog::writeJson(Print& out, uint32_t after, uint8_t max) const
+{
+	STM32JsonWriter json(out);
+
+	/* A client that is ahead (the log was cleared by a reflash) starts over */
+	if (after > lastSeq()) after = 0;
+	uint32_t from = after + 1;
+	uint32_t lost = 0;
+	if (from < firstSeq())
+	{
+		lost = firstSeq() - from;
+		from = firstSeq();
+	}
+
+	json.beginObject();
+	json.add("ok", true);
+	json.add("now", (unsigned long)millis());
+	json.add("first", (unsigned long)firstSeq());
+	json.add("last", (unsigned long)lastSeq());
+	json.add("lost", (unsigned long)lost);
+
+	json.beginArray("events");
+	for (uint32_t seq = from; seq <= lastSeq() && max > 0; seq++, max--)
+	{
+		const STM32Event& e = at(seq);
+		json.beginObject();
+		json.add("seq", (unsigned long)e.seq);
+		json.add("ms", (unsigned long)e.ms);
+		json.add("ev", codeName(e.code));
+		if (e.job)
+		{
+			char job[2] = { e.job, '\0' };
+			json.add("job", job);
+		}
+
+		switch (e.code)
+		{
+			case STM32_EV_BOOT:
+			json.add("reason", (unsigned long)e.value);
+			break;
+
+			case STM32_EV_LOGIN:
+			case STM32_EV_LOGIN_FAILED:
+			case STM32_EV_BRIDGE_OPEN:
+			{
+				char ip[16];
+				snprintf(ip, sizeof(ip), "%u.%u.%u.%u", (unsigned)(e.addr & 0xFF), (unsigned)((e.addr >> 8) & 0xFF),
+				(unsigned)((e.addr >> 16) & 0xFF), (unsigned)(e.addr >> 24));
+				json.add("ip", ip);
+				break;
+			}
+
+			case STM32_EV_CONNECT:
+			json.addHex("devId", e.addr, 3);
+			json.add("flashKB", (unsigned long)e.value);
+			break;
+
+			case STM32_EV_UPLOAD:
+			case STM32_EV_JOB_OK:
+			json.add("bytes", (unsigned long)e.value);
+			break;
+
+			case STM32_EV_CONNECT_FAILED:
+			case STM32_EV_JOB_FAILED:
+			{
+				STM32RomResult res = unpack(e.addr, e.value);
+				if (res.ok()) break;
+				char msg[96];
+				res.format(msg, sizeof(msg));
+				json.add("error", msg);
+				break;
+			}
+
+			case STM32_EV_BRIDGE_CLOSED:
+			json.add("fromTarget", (unsigned long)e.addr);
+			json.add("toTarget", (unsigned long)e.value);
+			break;
+
+			case STM32_EV_PREFLIGHT_REFUSED:
+			json.beginArray("failed");
+			for (uint8_t i = 0; i < STM32_PF_COUNT; i++)
+			{
+				if (e.value & (1UL << i)) json.value(STM32ImagePreflight::checkName((STM32PreflightCheck)i));
+			}
+			json.endArray();
+			break;
+
+			default:
+			break;
+		}
+		json.endObject();
+	}
+	json.endArray();
+	json.endObject();
+}
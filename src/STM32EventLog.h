@@ -0,0 +1,96 @@
+/********************************************************************************************************
+ *  [FILE NAME]   :      <STM32EventLog.h>                                                              *
+ *  [AUTHOR]      :      <David S. Alexander>                                                           *
+ *  [DATE CREATED]:      <Dec 10, 2025>                                                                 *
+ *  [Description] :      <Header file for the fixed-size flasher event log>                             *
+ ********************************************************************************************************/
+
+#ifndef STM32_EVENT_LOG_H
+#define	STM32_EVENT_LOG_H
+
+#include <Arduino.h>
+#include "STM32RomResult.h"
+
+/* What addr and value hold is listed per code */
+enum STM32EventCode : uint8_t
+{
+	STM32_EV_BOOT,				/* value: ESP reset reason */
+	STM32_EV_LOGIN,				/* addr: client IPv4 */
+	STM32_EV_LOGIN_FAILED,		/* addr: client IPv4 */
+	STM32_EV_LOGOUT,
+	STM32_EV_CONNECT,			/* addr: device ID, value: flash KB */
+	STM32_EV_CONNECT_FAILED,	/* failure */
+	STM32_EV_DISCONNECT,
+	STM32_EV_UPLOAD,			/* value: bytes */
+	STM32_EV_UPLOAD_FAILED,
+	STM32_EV_COMMAND,			/* job: the /cmd letter, 'B' for a batch */
+	STM32_EV_JOB_OK,			/* job, value: bytes programmed or read */
+	STM32_EV_JOB_FAILED,		/* job, failure */
+	STM32_EV_PREFLIGHT_REFUSED,	/* job, value: bit per failed STM32PreflightCheck */
+	STM32_EV_BRIDGE_OPEN,		/* addr: client IPv4 */
+	STM32_EV_BRIDGE_CLOSED,		/* addr: bytes from the target, value: bytes to it */
+	STM32_EV_COUNT
+};
+
+/* One log entry; a failure keeps its STM32RomResult as addr plus value (see pack()) */
+struct STM32Event
+{
+	uint32_t seq;	/* 1, 2, ...; never reused, also across reboots when a store is attached */
+	uint32_t ms;	/* millis() of the boot that logged it */
+	uint32_t addr;
+	uint32_t value;
+	uint8_t code;
+	char job;
+};
+
+/* Keeps the log across reboots; the web flasher stores it in LittleFS */
+class STM32EventStore
+{
+	public:
+	virtual ~STM32EventStore() {}
+	virtual void append(const STM32Event& e) = 0;
+	/* The newest stored events, up to max, oldest first; returns how many */
+	virtual size_t load(STM32Event* out, size_t max) = 0;
+};
+
+/* Fixed ring of the last CAPACITY events. Readers ask for everything after the last sequence
+   number they saw, so any number of clients can follow the log without state on the ESP. */
+class STM32EventLog
+{
+	public:
+	static const uint8_t CAPACITY = 64;
+
+	STM32EventLog();
+
+	/* Reloads the newest stored events, continues their numbering and logs STM32_EV_BOOT;
+	   store may be nullptr */
+	void begin(STM32EventStore* store, uint32_t resetReason);
+
+	void log(STM32EventCode code, uint32_t addr = 0, uint32_t value = 0, char job = 0);
+	void logFailure(STM32EventCode code, const STM32RomResult& res, char job = 0);
+
+	uint32_t lastSeq() const { return _next - 1; }
+	/* Sequence number of the oldest event still held, or lastSeq() + 1 when empty */
+	uint32_t firstSeq() const { return _next - _n; }
+
+	/* {"ok":true,"now":..,"first":..,"last":..,"lost":..,"events":[{"seq","ms","ev",..},..]}
+	   with at most max events after `after`; "lost" counts those that already left the ring */
+	void writeJson(Print& out, uint32_t after, uint8_t max) const;
+
+	static const char* codeName(uint8_t code);
+	/* A failure packed into an event and back; addr is the failing address */
+	static void pack(const STM32RomResult& res, uint32_t& addr, uint32_t& value);
+	static STM32RomResult unpack(uint32_t addr, uint32_t value);
+
+	private:
+	STM32Event _ring[CAPACITY];
+	uint8_t _head;	/* next slot to write */
+	uint8_t _n;
+	uint32_t _next;
+	STM32EventStore* _store;
+
+	const STM32Event& at(uint32_t seq) const;
+	void push(const STM32Event& e);
+};
+
+#endif	/* STM32_EVENT_LOG_H */
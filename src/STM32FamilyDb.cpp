@@ -13,160 +13,355 @@ STM32FamilyInfo STM32FamilyDb::getFamilyInfo(uint16_t devId)
 	switch (devId & 0xFFF)
 	{
 		case 0x443:
-		return (STM32FamilyInfo){STM32_C0, devId, 32,  C0_FLASH_SIZE_ADDR, 2000, 0x43, true, 0x08000000, 0x20001000, "STM32C011xx"};
+		return (STM32FamilyInfo){STM32_C0, devId, 32,  C0_FLASH_SIZE_ADDR, 2000, 0x43, true, 0x08000000, 0x20001000, 6,   "STM32C011xx"};
 		case 0x453:
-		return (STM32FamilyInfo){STM32_C0, devId, 32,  C0_FLASH_SIZE_ADDR, 2000, 0x43, true, 0x08000000, 0x20001000, "STM32C031xx"};
+		return (STM32FamilyInfo){STM32_C0, devId, 32,  C0_FLASH_SIZE_ADDR, 2000, 0x43, true, 0x08000000, 0x20001000, 12,  "STM32C031xx"};
 		case 0x44C:
-		return (STM32FamilyInfo){STM32_C0, devId, 64,  C0_FLASH_SIZE_ADDR, 2000, 0x43, true, 0x08000000, 0x20001000, "STM32C051xx"};
+		return (STM32FamilyInfo){STM32_C0, devId, 64,  C0_FLASH_SIZE_ADDR, 2000, 0x43, true, 0x08000000, 0x20001000, 12,  "STM32C051xx"};
 		case 0x493:
-		return (STM32FamilyInfo){STM32_C0, devId, 128, C0_FLASH_SIZE_ADDR, 2000, 0x43, true, 0x08000000, 0x20001000, "STM32C071xx"};
+		return (STM32FamilyInfo){STM32_C0, devId, 128, C0_FLASH_SIZE_ADDR, 2000, 0x43, true, 0x08000000, 0x20001000, 24,  "STM32C071xx"};
 		case 0x44D:
-		return (STM32FamilyInfo){STM32_C0, devId, 256, C0_FLASH_SIZE_ADDR, 2000, 0x43, true, 0x08000000, 0x20001000, "STM32C091xx/92xx"};
+		return (STM32FamilyInfo){STM32_C0, devId, 256, C0_FLASH_SIZE_ADDR, 2000, 0x43, true, 0x08000000, 0x20001000, 36,  "STM32C091xx/92xx"};
 
 		case 0x440:
-		return (STM32FamilyInfo){STM32_F0, devId, 64,  F0_FLASH_SIZE_ADDR, 2000, 0x43, true, 0x08000000, 0x20000800, "STM32F030x8/F05xxx"};
+		return (STM32FamilyInfo){STM32_F0, devId, 64,  F0_FLASH_SIZE_ADDR, 2000, 0x43, true, 0x08000000, 0x20000800, 8,   "STM32F030x8/F05xxx"};
 		case 0x444:
-		return (STM32FamilyInfo){STM32_F0, devId, 32,  F0_FLASH_SIZE_ADDR, 2000, 0x43, true, 0x08000000, 0x20000800, "STM32F03xx4/6"};
+		return (STM32FamilyInfo){STM32_F0, devId, 32,  F0_FLASH_SIZE_ADDR, 2000, 0x43, true, 0x08000000, 0x20000800, 4,   "STM32F03xx4/6"};
 		case 0x442:
-		return (STM32FamilyInfo){STM32_F0, devId, 256, F0_FLASH_SIZE_ADDR, 2000, 0x43, true, 0x08000000, 0x20000800, "STM32F030xC/F09xxx"};
+		return (STM32FamilyInfo){STM32_F0, devId, 256, F0_FLASH_SIZE_ADDR, 2000, 0x43, true, 0x08000000, 0x20000800, 32,  "STM32F030xC/F09xxx"};
 		case 0x445:
-		return (STM32FamilyInfo){STM32_F0, devId, 32,  F0_FLASH_SIZE_ADDR, 2000, 0x43, true, 0x08000000, 0x20000800, "STM32F04xxx/F070x6"};
+		return (STM32FamilyInfo){STM32_F0, devId, 32,  F0_FLASH_SIZE_ADDR, 2000, 0x43, true, 0x08000000, 0x20000800, 6,   "STM32F04xxx/F070x6"};
 		case 0x448:
-		return (STM32FamilyInfo){STM32_F0, devId, 128, F0_FLASH_SIZE_ADDR, 2000, 0x43, true, 0x08000000, 0x20000800, "STM32F070xB/F071xx/F72xx"};
+		return (STM32FamilyInfo){STM32_F0, devId, 128, F0_FLASH_SIZE_ADDR, 2000, 0x43, true, 0x08000000, 0x20000800, 16,  "STM32F070xB/F071xx/F72xx"};
 
 		case 0x412:
-		return (STM32FamilyInfo){STM32_F1, devId, 32,   F1_FLASH_SIZE_ADDR, 5000, 0x43, true, 0x08000000, 0x20001000, "STM32F10xxx Low-density"};
+		return (STM32FamilyInfo){STM32_F1, devId, 32,   F1_FLASH_SIZE_ADDR, 5000, 0x43, true, 0x08000000, 0x20001000, 4,   "STM32F10xxx Low-density"};
 		case 0x410:
-		return (STM32FamilyInfo){STM32_F1, devId, 128,  F1_FLASH_SIZE_ADDR, 5000, 0x43, true, 0x08000000, 0x20001000, "STM32F10xxx Medium-density"};
+		return (STM32FamilyInfo){STM32_F1, devId, 128,  F1_FLASH_SIZE_ADDR, 5000, 0x43, true, 0x08000000, 0x20001000, 10,  "STM32F10xxx Medium-density"};
 		case 0x414:
-		return (STM32FamilyInfo){STM32_F1, devId, 512,  F1_FLASH_SIZE_ADDR, 5000, 0x43, true, 0x08000000, 0x20001000, "STM32F10xxx High-density"};
+		return (STM32FamilyInfo){STM32_F1, devId, 512,  F1_FLASH_SIZE_ADDR, 5000, 0x43, true, 0x08000000, 0x20001000, 32,  "STM32F10xxx High-density"};
 		case 0x420:
-		return (STM32FamilyInfo){STM32_F1, devId, 128,  F1_FLASH_SIZE_ADDR, 5000, 0x43, true, 0x08000000, 0x20001000, "STM32F10xxx Medium-density VL"};
+		return (STM32FamilyInfo){STM32_F1, devId, 128,  F1_FLASH_SIZE_ADDR, 5000, 0x43, true, 0x08000000, 0x20001000, 8,   "STM32F10xxx Medium-density VL"};
 		case 0x428:
-		return (STM32FamilyInfo){STM32_F1, devId, 512,  F1_FLASH_SIZE_ADDR, 5000, 0x43, true, 0x08000000, 0x20001000, "STM32F10xxx High-density VL"};
+		return (STM32FamilyInfo){STM32_F1, devId, 512,  F1_FLASH_SIZE_ADDR, 5000, 0x43, true, 0x08000000, 0x20001000, 24,  "STM32F10xxx High-density VL"};
 		case 0x418:
-		return (STM32FamilyInfo){STM32_F1, devId, 256,  F1_FLASH_SIZE_ADDR, 5000, 0x43, true, 0x08000000, 0x20001000, "STM32F105xx/F107xx"};
+		return (STM32FamilyInfo){STM32_F1, devId, 256,  F1_FLASH_SIZE_ADDR, 5000, 0x43, true, 0x08000000, 0x20001000, 64,  "STM32F105xx/F107xx"};
 		case 0x430:
-		return (STM32FamilyInfo){STM32_F1, devId, 1024, F1_FLASH_SIZE_ADDR, 5000, 0x43, true, 0x08000000, 0x20001000, "STM32F10xxx XL-density"};
+		return (STM32FamilyInfo){STM32_F1, devId, 1024, F1_FLASH_SIZE_ADDR, 5000, 0x43, true, 0x08000000, 0x20001000, 80,  "STM32F10xxx XL-density"};
 
 		case 0x411:
-		return (STM32FamilyInfo){STM32_F2, devId, 1024, F2_FLASH_SIZE_ADDR, 12000, 0x43, true, 0x08000000, 0x20010000, "STM32F2xxxx"};
+		return (STM32FamilyInfo){STM32_F2, devId, 1024, F2_FLASH_SIZE_ADDR, 12000, 0x43, true, 0x08000000, 0x20010000, 64,  "STM32F2xxxx"};
 
 		case 0x432:
-		return (STM32FamilyInfo){STM32_F3, devId, 256, F3_FLASH_SIZE_ADDR, 5000, 0x43, true, 0x08000000, 0x20001000, "STM32F373xx/F378xx"};
+		return (STM32FamilyInfo){STM32_F3, devId, 256, F3_FLASH_SIZE_ADDR, 5000, 0x43, true, 0x08000000, 0x20001000, 16,  "STM32F373xx/F378xx"};
 		case 0x422:
-		return (STM32FamilyInfo){STM32_F3, devId, 256, F3_FLASH_SIZE_ADDR, 5000, 0x43, true, 0x08000000, 0x20001000, "STM32F302xB(C)/F303xB(C)/F358xx"};
+		return (STM32FamilyInfo){STM32_F3, devId, 256, F3_FLASH_SIZE_ADDR, 5000, 0x43, true, 0x08000000, 0x20001000, 32,  "STM32F302xB(C)/F303xB(C)/F358xx"};
 		case 0x439:
-		return (STM32FamilyInfo){STM32_F3, devId, 64,  F3_FLASH_SIZE_ADDR, 5000, 0x43, true, 0x08000000, 0x20001000, "STM32F301xx/F302x4(6/8)/F318xx"};
+		return (STM32FamilyInfo){STM32_F3, devId, 64,  F3_FLASH_SIZE_ADDR, 5000, 0x43, true, 0x08000000, 0x20001000, 16,  "STM32F301xx/F302x4(6/8)/F318xx"};
 		case 0x438:
-		return (STM32FamilyInfo){STM32_F3, devId, 64,  F3_FLASH_SIZE_ADDR, 5000, 0x43, true, 0x08000000, 0x20001000, "STM32F303x4(6/8)/F334xx/F328xx"};
+		return (STM32FamilyInfo){STM32_F3, devId, 64,  F3_FLASH_SIZE_ADDR, 5000, 0x43, true, 0x08000000, 0x20001000, 12,  "STM32F303x4(6/8)/F334xx/F328xx"};
 		case 0x446:
-		return (STM32FamilyInfo){STM32_F3, devId, 512, F3_FLASH_SIZE_ADDR, 5000, 0x43, true, 0x08000000, 0x20001000, "STM32F302xD(E)/F303xD(E)/F398xx"};
+		return (STM32FamilyInfo){STM32_F3, devId, 512, F3_FLASH_SIZE_ADDR, 5000, 0x43, true, 0x08000000, 0x20001000, 64,  "STM32F302xD(E)/F303xD(E)/F398xx"};
 
 		case 0x413:
-		return (STM32FamilyInfo){STM32_F4, devId, 1024, F4_FLASH_SIZE_ADDR, 35000, 0x44, false, 0x08000000, 0x20008000, "STM32F40xxx/41xxx"};
+		return (STM32FamilyInfo){STM32_F4, devId, 1024, F4_FLASH_SIZE_ADDR, 35000, 0x44, false, 0x08000000, 0x20008000, 128, "STM32F40xxx/41xxx"};
 		case 0x419:
-		return (STM32FamilyInfo){STM32_F4, devId, 2048, F4_FLASH_SIZE_ADDR, 35000, 0x44, false, 0x08000000, 0x20008000, "STM32F42xxx/43xxx"};
+		return (STM32FamilyInfo){STM32_F4, devId, 2048, F4_FLASH_SIZE_ADDR, 35000, 0x44, false, 0x08000000, 0x20008000, 192, "STM32F42xxx/43xxx"};
 		case 0x423:
-		return (STM32FamilyInfo){STM32_F4, devId, 256,  F4_FLASH_SIZE_ADDR, 35000, 0x44, false, 0x08000000, 0x20008000, "STM32F401xB(C)"};
+		return (STM32FamilyInfo){STM32_F4, devId, 256,  F4_FLASH_SIZE_ADDR, 35000, 0x44, false, 0x08000000, 0x20008000, 64,  "STM32F401xB(C)"};
 		case 0x433:
-		return (STM32FamilyInfo){STM32_F4, devId, 512,  F4_FLASH_SIZE_ADDR, 35000, 0x44, false, 0x08000000, 0x20008000, "STM32F401xD(E)"};
+		return (STM32FamilyInfo){STM32_F4, devId, 512,  F4_FLASH_SIZE_ADDR, 35000, 0x44, false, 0x08000000, 0x20008000, 96,  "STM32F401xD(E)"};
 		case 0x431:
-		return (STM32FamilyInfo){STM32_F4, devId, 512,  F4_FLASH_SIZE_ADDR, 35000, 0x44, false, 0x08000000, 0x20008000, "STM32F411xx"};
+		return (STM32FamilyInfo){STM32_F4, devId, 512,  F4_FLASH_SIZE_ADDR, 35000, 0x44, false, 0x08000000, 0x20008000, 128, "STM32F411xx"};
 		case 0x434:
-		return (STM32FamilyInfo){STM32_F4, devId, 2048, F4_FLASH_SIZE_ADDR, 35000, 0x44, false, 0x08000000, 0x20008000, "STM32F469xx/479xx"};
+		return (STM32FamilyInfo){STM32_F4, devId, 2048, F4_FLASH_SIZE_ADDR, 35000, 0x44, false, 0x08000000, 0x20008000, 320, "STM32F469xx/479xx"};
 		case 0x458:
-		return (STM32FamilyInfo){STM32_F4, devId, 128,  F4_FLASH_SIZE_ADDR, 35000, 0x44, false, 0x08000000, 0x20008000, "STM32F410xx"};
+		return (STM32FamilyInfo){STM32_F4, devId, 128,  F4_FLASH_SIZE_ADDR, 35000, 0x44, false, 0x08000000, 0x20008000, 32,  "STM32F410xx"};
 		case 0x441:
-		return (STM32FamilyInfo){STM32_F4, devId, 1024, F4_FLASH_SIZE_ADDR, 35000, 0x44, false, 0x08000000, 0x20008000, "STM32F412xx"};
+		return (STM32FamilyInfo){STM32_F4, devId, 1024, F4_FLASH_SIZE_ADDR, 35000, 0x44, false, 0x08000000, 0x20008000, 256, "STM32F412xx"};
 		case 0x463:
-		return (STM32FamilyInfo){STM32_F4, devId, 1536, F4_FLASH_SIZE_ADDR, 35000, 0x44, false, 0x08000000, 0x20008000, "STM32F413xx/423xx"};
+		return (STM32FamilyInfo){STM32_F4, devId, 1536, F4_FLASH_SIZE_ADDR, 35000, 0x44, false, 0x08000000, 0x20008000, 320, "STM32F413xx/423xx"};
 		case 0x421:
-		return (STM32FamilyInfo){STM32_F4, devId, 512,  F4_FLASH_SIZE_ADDR, 35000, 0x44, false, 0x08000000, 0x20008000, "STM32F446xx"};
+		return (STM32FamilyInfo){STM32_F4, devId, 512,  F4_FLASH_SIZE_ADDR, 35000, 0x44, false, 0x08000000, 0x20008000, 128, "STM32F446xx"};
 
 		case 0x452:
-		return (STM32FamilyInfo){STM32_F7, devId, 512,  F7_FLASH_SIZE_ADDR, 20000, 0x43, true, 0x08000000, 0x20020000, "STM32F72xxx/73xxx"};
+		return (STM32FamilyInfo){STM32_F7, devId, 512,  F7_FLASH_SIZE_ADDR, 20000, 0x43, true, 0x08000000, 0x20020000, 256, "STM32F72xxx/73xxx"};
 		case 0x449:
-		return (STM32FamilyInfo){STM32_F7, devId, 1024, F7_FLASH_SIZE_ADDR, 20000, 0x43, true, 0x08000000, 0x20020000, "STM32F74xxx/75xxx"};
+		return (STM32FamilyInfo){STM32_F7, devId, 1024, F7_FLASH_SIZE_ADDR, 20000, 0x43, true, 0x08000000, 0x20020000, 320, "STM32F74xxx/75xxx"};
 		case 0x451:
-		return (STM32FamilyInfo){STM32_F7, devId, 2048, F7_FLASH_SIZE_ADDR, 20000, 0x43, true, 0x08000000, 0x20020000, "STM32F76xxx/77xxx"};
+		return (STM32FamilyInfo){STM32_F7, devId, 2048, F7_FLASH_SIZE_ADDR, 20000, 0x43, true, 0x08000000, 0x20020000, 512, "STM32F76xxx/77xxx"};
 
 		case 0x474:
-		return (STM32FamilyInfo){STM32_H5, devId, 512,  H5_FLASH_SIZE_ADDR, 40000, 0x44, false, 0x08000000, 0x20004000, "STM32H503xx"};
+		return (STM32FamilyInfo){STM32_H5, devId, 512,  H5_FLASH_SIZE_ADDR, 40000, 0x44, false, 0x08000000, 0x20004000, 32,  "STM32H503xx"};
 		case 0x484:
-		return (STM32FamilyInfo){STM32_H5, devId, 1024, H5_FLASH_SIZE_ADDR, 40000, 0x44, false, 0x08000000, 0x20004000, "STM32H5A3xx/H56xxx/H57xxx"};
+		return (STM32FamilyInfo){STM32_H5, devId, 1024, H5_FLASH_SIZE_ADDR, 40000, 0x44, false, 0x08000000, 0x20004000, 640, "STM32H5A3xx/H56xxx/H57xxx"};
 		case 0x478:
-		return (STM32FamilyInfo){STM32_H5, devId, 256,  H5_FLASH_SIZE_ADDR, 40000, 0x44, false, 0x08000000, 0x20004000, "STM32H563xx"};
+		return (STM32FamilyInfo){STM32_H5, devId, 256,  H5_FLASH_SIZE_ADDR, 40000, 0x44, false, 0x08000000, 0x20004000, 640, "STM32H563xx"};
 
 		case 0x485:
-		return (STM32FamilyInfo){STM32_H7, devId, 2048, H7_FLASH_SIZE_ADDR, 40000, 0x44, false, 0x08000000, 0x20008000, "STM32H7Rxxx/7Sxxx"};
+		return (STM32FamilyInfo){STM32_H7, devId, 2048, H7_FLASH_SIZE_ADDR, 40000, 0x44, false, 0x08000000, 0x20008000, 128, "STM32H7Rxxx/7Sxxx"};
 		case 0x480:
-		return (STM32FamilyInfo){STM32_H7, devId, 2048, H7_FLASH_SIZE_ADDR, 40000, 0x44, false, 0x08000000, 0x20008000, "STM32H7A3xx/7B3xx/7B0xx"};
+		return (STM32FamilyInfo){STM32_H7, devId, 2048, H7_FLASH_SIZE_ADDR, 40000, 0x44, false, 0x08000000, 0x20008000, 128, "STM32H7A3xx/7B3xx/7B0xx"};
 		case 0x483:
-		return (STM32FamilyInfo){STM32_H7, devId, 2048, H7_FLASH_SIZE_ADDR, 40000, 0x44, false, 0x08000000, 0x20008000, "STM32H72xxx/73xxx"};
+		return (STM32FamilyInfo){STM32_H7, devId, 2048, H7_FLASH_SIZE_ADDR, 40000, 0x44, false, 0x08000000, 0x20008000, 128, "STM32H72xxx/73xxx"};
 		case 0x450:
-		return (STM32FamilyInfo){STM32_H7, devId, 2048, H7_FLASH_SIZE_ADDR, 40000, 0x44, false, 0x08000000, 0x20008000, "STM32H74xxx/75xxx"};
+		return (STM32FamilyInfo){STM32_H7, devId, 2048, H7_FLASH_SIZE_ADDR, 40000, 0x44, false, 0x08000000, 0x20008000, 128, "STM32H74xxx/75xxx"};
 
 		case 0x457:
-		return (STM32FamilyInfo){STM32_L0, devId, 16,  L0_FLASH_SIZE_ADDR, 3000, 0x43, true, 0x08000000, 0x20000400, "STM32L01xxx/02xxx"};
+		return (STM32FamilyInfo){STM32_L0, devId, 16,  L0_FLASH_SIZE_ADDR, 3000, 0x43, true, 0x08000000, 0x20000400, 2,   "STM32L01xxx/02xxx"};
 		case 0x425:
-		return (STM32FamilyInfo){STM32_L0, devId, 32,  L0_FLASH_SIZE_ADDR, 3000, 0x43, true, 0x08000000, 0x20000400, "STM32L031xx/041xx"};
+		return (STM32FamilyInfo){STM32_L0, devId, 32,  L0_FLASH_SIZE_ADDR, 3000, 0x43, true, 0x08000000, 0x20000400, 8,   "STM32L031xx/041xx"};
 		case 0x417:
-		return (STM32FamilyInfo){STM32_L0, devId, 64,  L0_FLASH_SIZE_ADDR, 3000, 0x43, true, 0x08000000, 0x20000400, "STM32L05xxx/06xxx"};
+		return (STM32FamilyInfo){STM32_L0, devId, 64,  L0_FLASH_SIZE_ADDR, 3000, 0x43, true, 0x08000000, 0x20000400, 8,   "STM32L05xxx/06xxx"};
 		case 0x447:
-		return (STM32FamilyInfo){STM32_L0, devId, 192, L0_FLASH_SIZE_ADDR, 3000, 0x43, true, 0x08000000, 0x20000400, "STM32L07xxx/08xxx"};
+		return (STM32FamilyInfo){STM32_L0, devId, 192, L0_FLASH_SIZE_ADDR, 3000, 0x43, true, 0x08000000, 0x20000400, 20,  "STM32L07xxx/08xxx"};
 
 		case 0x416:
-		return (STM32FamilyInfo){STM32_L1, devId, 128, L1_FLASH_SIZE_ADDR, 8000, 0x43, true, 0x08000000, 0x20001000, "STM32L1xxx6(8/B)"};
+		return (STM32FamilyInfo){STM32_L1, devId, 128, L1_FLASH_SIZE_ADDR, 8000, 0x43, true, 0x08000000, 0x20001000, 4,   "STM32L1xxx6(8/B)"};
 		case 0x429:
-		return (STM32FamilyInfo){STM32_L1, devId, 128, L1_FLASH_SIZE_ADDR, 8000, 0x43, true, 0x08000000, 0x20001000, "STM32L1xxx6(8/B)A"};
+		return (STM32FamilyInfo){STM32_L1, devId, 128, L1_FLASH_SIZE_ADDR, 8000, 0x43, true, 0x08000000, 0x20001000, 4,   "STM32L1xxx6(8/B)A"};
 		case 0x427:
-		return (STM32FamilyInfo){STM32_L1, devId, 256, L1_FLASH_SIZE_ADDR, 8000, 0x43, true, 0x08000000, 0x20001000, "STM32L1xxxC"};
+		return (STM32FamilyInfo){STM32_L1, devId, 256, L1_FLASH_SIZE_ADDR, 8000, 0x43, true, 0x08000000, 0x20001000, 32,  "STM32L1xxxC"};
 		case 0x436:
-		return (STM32FamilyInfo){STM32_L1, devId, 384, L1_FLASH_SIZE_ADDR, 8000, 0x43, true, 0x08000000, 0x20001000, "STM32L1xxxD"};
+		return (STM32FamilyInfo){STM32_L1, devId, 384, L1_FLASH_SIZE_ADDR, 8000, 0x43, true, 0x08000000, 0x20001000, 48,  "STM32L1xxxD"};
 		case 0x437:
-		return (STM32FamilyInfo){STM32_L1, devId, 512, L1_FLASH_SIZE_ADDR, 8000, 0x43, true, 0x08000000, 0x20001000, "STM32L1xxxE"};
+		return (STM32FamilyInfo){STM32_L1, devId, 512, L1_FLASH_SIZE_ADDR, 8000, 0x43, true, 0x08000000, 0x20001000, 80,  "STM32L1xxxE"};
 
 		case 0x464:
-		return (STM32FamilyInfo){STM32_L4, devId, 2048, L4_FLASH_SIZE_ADDR, 8000, 0x43, true, 0x08000000, 0x20008000, "STM32L4Rxxx/4Sxxx"};
+		return (STM32FamilyInfo){STM32_L4, devId, 128,  L4_FLASH_SIZE_ADDR, 8000, 0x43, true, 0x08000000, 0x20008000, 40,  "STM32L41xxx/42xxx"};
 		case 0x435:
-		return (STM32FamilyInfo){STM32_L4, devId, 256,  L4_FLASH_SIZE_ADDR, 8000, 0x43, true, 0x08000000, 0x20008000, "STM32L43xxx/44xxx"};
+		return (STM32FamilyInfo){STM32_L4, devId, 256,  L4_FLASH_SIZE_ADDR, 8000, 0x43, true, 0x08000000, 0x20008000, 64,  "STM32L43xxx/44xxx"};
 		case 0x462:
-		return (STM32FamilyInfo){STM32_L4, devId, 512,  L4_FLASH_SIZE_ADDR, 8000, 0x43, true, 0x08000000, 0x20008000, "STM32L45xxx/46xxx"};
+		return (STM32FamilyInfo){STM32_L4, devId, 512,  L4_FLASH_SIZE_ADDR, 8000, 0x43, true, 0x08000000, 0x20008000, 160, "STM32L45xxx/46xxx"};
 		case 0x415:
-		return (STM32FamilyInfo){STM32_L4, devId, 1024, L4_FLASH_SIZE_ADDR, 8000, 0x43, true, 0x08000000, 0x20008000, "STM32L47xxx/48xxx"};
+		return (STM32FamilyInfo){STM32_L4, devId, 1024, L4_FLASH_SIZE_ADDR, 8000, 0x43, true, 0x08000000, 0x20008000, 96,  "STM32L47xxx/48xxx"};
 		case 0x461:
-		return (STM32FamilyInfo){STM32_L4, devId, 1024, L4_FLASH_SIZE_ADDR, 8000, 0x43, true, 0x08000000, 0x20008000, "STM32L496xx/4A6xx"};
+		return (STM32FamilyInfo){STM32_L4, devId, 1024, L4_FLASH_SIZE_ADDR, 8000, 0x43, true, 0x08000000, 0x20008000, 320, "STM32L496xx/4A6xx"};
 		case 0x470:
-		return (STM32FamilyInfo){STM32_L4, devId, 512,  L4_FLASH_SIZE_ADDR, 8000, 0x43, true, 0x08000000, 0x20008000, "STM32L41xxx/42xxx"};
+		return (STM32FamilyInfo){STM32_L4, devId, 2048, L4_FLASH_SIZE_ADDR, 8000, 0x43, true, 0x08000000, 0x20008000, 640, "STM32L4Rxxx/4Sxxx"};
 		case 0x471:
-		return (STM32FamilyInfo){STM32_L4, devId, 1024, L4_FLASH_SIZE_ADDR, 8000, 0x43, true, 0x08000000, 0x20008000, "STM32L4P5xx/4Q5xx"};
+		return (STM32FamilyInfo){STM32_L4, devId, 1024, L4_FLASH_SIZE_ADDR, 8000, 0x43, true, 0x08000000, 0x20008000, 320, "STM32L4P5xx/4Q5xx"};
 
 		case 0x472:
-		return (STM32FamilyInfo){STM32_L5, devId, 512, L5_FLASH_SIZE_ADDR, 8000, 0x43, true, 0x08000000, 0x20008000, "STM32L55xxx/56xxx"};
+		return (STM32FamilyInfo){STM32_L5, devId, 512, L5_FLASH_SIZE_ADDR, 8000, 0x43, true, 0x08000000, 0x20008000, 256, "STM32L55xxx/56xxx"};
 
 		case 0x466:
-		return (STM32FamilyInfo){STM32_G0, devId, 64,  G0_FLASH_SIZE_ADDR, 3000, 0x43, true, 0x08000000, 0x20001000, "STM32G0C1xx"};
+		return (STM32FamilyInfo){STM32_G0, devId, 64,  G0_FLASH_SIZE_ADDR, 3000, 0x43, true, 0x08000000, 0x20001000, 8,   "STM32G031xx/041xx"};
 		case 0x456:
-		return (STM32FamilyInfo){STM32_G0, devId, 32,  G0_FLASH_SIZE_ADDR, 3000, 0x43, true, 0x08000000, 0x20001000, "STM32G0B0xx/B1xx"};
+		return (STM32FamilyInfo){STM32_G0, devId, 64,  G0_FLASH_SIZE_ADDR, 3000, 0x43, true, 0x08000000, 0x20001000, 18,  "STM32G051xx/061xx"};
 		case 0x460:
-		return (STM32FamilyInfo){STM32_G0, devId, 128, G0_FLASH_SIZE_ADDR, 3000, 0x43, true, 0x08000000, 0x20001000, "STM32G07xxx/08xxx"};
+		return (STM32FamilyInfo){STM32_G0, devId, 128, G0_FLASH_SIZE_ADDR, 3000, 0x43, true, 0x08000000, 0x20001000, 36,  "STM32G07xxx/08xxx"};
 		case 0x467:
-		return (STM32FamilyInfo){STM32_G0, devId, 64,  G0_FLASH_SIZE_ADDR, 3000, 0x43, true, 0x08000000, 0x20001000, "STM32G031xx/041xx"};
+		return (STM32FamilyInfo){STM32_G0, devId, 512, G0_FLASH_SIZE_ADDR, 3000, 0x43, true, 0x08000000, 0x20001000, 144, "STM32G0B0xx/0B1xx/0C1xx"};
 
 		case 0x468:
-		return (STM32FamilyInfo){STM32_G4, devId, 512, G4_FLASH_SIZE_ADDR, 8000, 0x43, true, 0x08000000, 0x20004000, "STM32G43xxx/44xxx"};
+		return (STM32FamilyInfo){STM32_G4, devId, 128, G4_FLASH_SIZE_ADDR, 8000, 0x43, true, 0x08000000, 0x20004000, 22,  "STM32G43xxx/44xxx"};
 		case 0x469:
-		return (STM32FamilyInfo){STM32_G4, devId, 128, G4_FLASH_SIZE_ADDR, 8000, 0x43, true, 0x08000000, 0x20004000, "STM32G47xxx/48xxx"};
+		return (STM32FamilyInfo){STM32_G4, devId, 512, G4_FLASH_SIZE_ADDR, 8000, 0x43, true, 0x08000000, 0x20004000, 96,  "STM32G47xxx/48xxx"};
 		case 0x479:
-		return (STM32FamilyInfo){STM32_G4, devId, 512, G4_FLASH_SIZE_ADDR, 8000, 0x43, true, 0x08000000, 0x20004000, "STM32G49xxx/4Axxx"};
+		return (STM32FamilyInfo){STM32_G4, devId, 512, G4_FLASH_SIZE_ADDR, 8000, 0x43, true, 0x08000000, 0x20004000, 96,  "STM32G49xxx/4Axxx"};
 
 		case 0x494:
-		return (STM32FamilyInfo){STM32_WB, devId, 1024, WB_FLASH_SIZE_ADDR, 8000, 0x43, true, 0x08000000, 0x20008000, "STM32WB55xx/35xx"};
+		return (STM32FamilyInfo){STM32_WB, devId, 1024, WB_FLASH_SIZE_ADDR, 8000, 0x43, true, 0x08000000, 0x20008000, 32,  "STM32WB55xx/35xx"};
 		case 0x495:
-		return (STM32FamilyInfo){STM32_WB, devId, 512,  WB_FLASH_SIZE_ADDR, 8000, 0x43, true, 0x08000000, 0x20008000, "STM32WB10xx/15xx/50xx"};
+		return (STM32FamilyInfo){STM32_WB, devId, 512,  WB_FLASH_SIZE_ADDR, 8000, 0x43, true, 0x08000000, 0x20008000, 12,  "STM32WB10xx/15xx/50xx"};
 
 		default:
-		return (STM32FamilyInfo){STM32_UNKNOWN, devId, 64, 0x1FFFF7CC, 40000, 0x43, true, 0x08000000, 0x20000200, "STM32 Unknown"};
+		return (STM32FamilyInfo){STM32_UNKNOWN, devId, 64, 0x1FFFF7CC, 40000, 0x43, true, 0x08000000, 0x20000200, 0,   "STM32 Unknown"};
 	}
 }
+
+STM32FlashGeometry STM32FamilyDb::getFlashGeometry(const STM32FamilyInfo& fi, uint16_t flashKb)
+{
+	switch (fi.DevID)
+	{
+		case 0x480:	/* H7A3/H7B0/H7B3 */
+		case 0x485:	/* H7R/H7S */
+		return (STM32FlashGeometry){8192, 0, 0, 8192, 16, 50, 2, 2000, 0, 0};
+		case 0x483:	/* H72x/H73x: a single bank of 128 KB sectors */
+		return (STM32FlashGeometry){131072, 0, 0, 131072, 32, 60, 1000, 4000, 0, 0};
+		case 0x470:	/* L4R/L4S */
+		case 0x471:	/* L4P5/L4Q5 */
+		/* Dual-bank mode (DBANK set, as shipped): 4 KB pages, bank 2 numbered from 256 */
+		return (STM32FlashGeometry){4096, 0, 0, 4096, 8, 82, 22, 22, (uint32_t)flashKb * 512u, 256};
+		default:
+		break;
+	}
+
+	switch (fi.family)
+	{
+		case STM32_C0:
+		return (STM32FlashGeometry){2048, 0, 0, 2048, 8, 85, 22, 22, 0, 0};
+		case STM32_F0:
+		return (STM32FlashGeometry){(flashKb >= 128) ? 2048u : 1024u, 0, 0, (flashKb >= 128) ? 2048u : 1024u, 2, 53, 30, 30, 0, 0};
+		case STM32_F1:
+		return (STM32FlashGeometry){(flashKb >= 256) ? 2048u : 1024u, 0, 0, (flashKb >= 256) ? 2048u : 1024u, 2, 53, 30, 30, 0, 0};
+		case STM32_F3:
+		return (STM32FlashGeometry){2048, 0, 0, 2048, 2, 53, 30, 30, 0, 0};
+		case STM32_F2:
+		case STM32_F4:
+		/* 2 MB F42x/F43x and F469/F479 are two 1 MB banks; the second is sectors 12-23 from 0x08100000 */
+		return (STM32FlashGeometry){16384, 4, 65536, 131072, 4, 16, 250, 16000, (flashKb >= 2048) ? 1048576u : 0u, 0};
+		case STM32_F7:
+		if (flashKb >= 1024) return (STM32FlashGeometry){32768, 4, 131072, 262144, 4, 16, 250, 16000, 0, 0};
+		return (STM32FlashGeometry){16384, 4, 65536, 131072, 4, 16, 250, 8000, 0, 0};
+		case STM32_H5:
+		return (STM32FlashGeometry){8192, 0, 0, 8192, 16, 50, 2, 2000, 0, 0};
+		case STM32_H7:
+		return (STM32FlashGeometry){131072, 0, 0, 131072, 32, 60, 1000, 8000, 0, 0};
+		case STM32_L0:
+		return (STM32FlashGeometry){128, 0, 0, 128, 4, 3200, 3, 3, 0, 0};
+		case STM32_L1:
+		return (STM32FlashGeometry){256, 0, 0, 256, 4, 3200, 3, 3, 0, 0};
+		case STM32_L4:
+		case STM32_L5:
+		case STM32_G0:
+		case STM32_G4:
+		return (STM32FlashGeometry){2048, 0, 0, 2048, 8, 82, 22, 22, 0, 0};
+		case STM32_WB:
+		return (STM32FlashGeometry){4096, 0, 0, 4096, 8, 82, 22, 22, 0, 0};
+		default:
+		return (STM32FlashGeometry){1024, 0, 0, 1024, 2, 53, 30, 30, 0, 0};
+	}
+}
+
+uint32_t STM32FamilyDb::eraseUnitCount(const STM32FlashGeometry& g, uint32_t flashBytes)
+{
+	if (g.largeSize == 0) return 0;
+	uint32_t n = 0;
+	uint32_t offset, size;
+	while (eraseUnit(g, flashBytes, n, offset, size)) n++;
+	return n;
+}
+
+bool STM32FamilyDb::eraseUnit(const STM32FlashGeometry& g, uint32_t flashBytes, uint32_t index, uint32_t& offset, uint32_t& size)
+{
+	uint32_t bankBase = 0;
+	if (g.bankSize && flashBytes > g.bankSize)
+	{
+		STM32FlashGeometry bank = g;
+		bank.bankSize = 0;
+		uint32_t perBank = eraseUnitCount(bank, g.bankSize);
+		bankBase = (index / perBank) * g.bankSize;
+		index %= perBank;
+	}
+
+	if (index < g.smallCount)
+	{
+		offset = index * g.smallSize;
+		size = g.smallSize;
+	}
+	else
+	{
+		uint32_t base = (uint32_t)g.smallCount * g.smallSize;
+		uint32_t i = index - g.smallCount;
+		if (g.midSize && i == 0)
+		{
+			offset = base;
+			size = g.midSize;
+		}
+		else
+		{
+			if (g.midSize)
+			{
+				base += g.midSize;
+				i--;
+			}
+			offset = base + i * g.largeSize;
+			size = g.largeSize;
+		}
+	}
+	offset += bankBase;
+	if (offset >= flashBytes) return false;
+	if (offset + size > flashBytes) size = flashBytes - offset;
+	return true;
+}
+
+uint32_t STM32FamilyDb::eraseUnitMs(const STM32FlashGeometry& g, uint32_t size)
+{
+	if (g.smallSize == 0) return g.smallEraseMs;
+	return (uint32_t)g.smallEraseMs * ((size + g.smallSize - 1) / g.smallSize);
+}
+
+uint16_t STM32FamilyDb::eraseUnitNumber(const STM32FlashGeometry& g, uint32_t flashBytes, uint32_t index)
+{
+	if (!g.bankUnitStride || !g.bankSize || flashBytes <= g.bankSize) return (uint16_t)index;
+	STM32FlashGeometry bank = g;
+	bank.bankSize = 0;
+	uint32_t perBank = eraseUnitCount(bank, g.bankSize);
+	return (uint16_t)((index / perBank) * g.bankUnitStride + index % perBank);
+}
+
+/* First SRAM byte the ROM bootloader leaves alone (AN2606), rounded up where parts of a family differ */
+static uint32_t romRamEnd(STM32Family family)
+{
+	switch (family)
+	{
+		case STM32_F1:
+		return 0x20000200;
+		case STM32_L0:
+		return 0x20000400;
+		case STM32_F0:
+		case STM32_L1:
+		return 0x20000800;
+		case STM32_C0:
+		case STM32_G0:
+		return 0x20001000;
+		case STM32_F3:
+		return 0x20001800;
+		case STM32_F2:
+		case STM32_WB:
+		return 0x20002000;
+		case STM32_F4:
+		case STM32_L4:
+		return 0x20003000;
+		default:
+		return 0x20004000;
+	}
+}
+
+bool STM32FamilyDb::getRamRegion(const STM32FamilyInfo& fi, uint32_t& start, uint32_t& end)
+{
+	if (fi.family == STM32_UNKNOWN || fi.sramKb == 0) return false;
+	start = romRamEnd(fi.family);
+	end = 0x20000000UL + (uint32_t)fi.sramKb * 1024UL;
+	return start < end;
+}
+
+uint32_t STM32FamilyDb::getUidAddr(STM32Family family)
+{
+	switch (family)
+	{
+		case STM32_C0: return C0_UID_ADDR;
+		case STM32_F0: return F0_UID_ADDR;
+		case STM32_F1: return F1_UID_ADDR;
+		case STM32_F2: return F2_UID_ADDR;
+		case STM32_F3: return F3_UID_ADDR;
+		case STM32_F4: return F4_UID_ADDR;
+		case STM32_F7: return F7_UID_ADDR;
+		case STM32_H5: return H5_UID_ADDR;
+		case STM32_H7: return H7_UID_ADDR;
+		case STM32_L0: return L0_UID_ADDR;
+		case STM32_L1: return L1_UID_ADDR;
+		case STM32_L4: return L4_UID_ADDR;
+		case STM32_L5: return L5_UID_ADDR;
+		case STM32_G0: return G0_UID_ADDR;
+		case STM32_G4: return G4_UID_ADDR;
+		case STM32_WB: return WB_UID_ADDR;
+		default: return 0;
+	}
+}
+
+uint32_t STM32FamilyDb::getUidWord2Offset(STM32Family family)
+{
+	return (family == STM32_L0 || family == STM32_L1) ? L0_UID_WORD2_OFFSET : 8;
+}
+
+const char* STM32FamilyDb::familyName(STM32Family family)
+{
+	static const char* const NAMES[STM32_UNKNOWN] =
+	{
+		"C0", "F0", "F1", "F2", "F3", "F4", "F7", "H5", "H7", "L0", "L1", "L4", "L5", "G0", "G4", "WB"
+	};
+	return ((unsigned)family < STM32_UNKNOWN) ? NAMES[family] : "unknown";
+}
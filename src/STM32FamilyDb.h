@@ -43,13 +43,52 @@ struct STM32FamilyInfo
 	bool     supportsGlobalErase;
 	uint32_t flashStart;
 	uint32_t sramTestAddr;
+	uint16_t sramKb;	/* contiguous SRAM at 0x20000000 on the smallest part sharing the ID */
 	const char* name;
 };
 
+/* Erase layout: `smallCount` units of `smallSize`, then one `midSize` unit (if non-zero), then `largeSize` units.
+   Page-based parts have smallCount = 0 and midSize = 0. With `bankSize` non-zero the layout starts over at
+   every bank; unit numbers carry on from the previous bank, or start at k * `bankUnitStride` for bank k when
+   that is set. Timings are datasheet typicals. */
+struct STM32FlashGeometry
+{
+	uint32_t smallSize;
+	uint8_t  smallCount;
+	uint32_t midSize;
+	uint32_t largeSize;
+	uint8_t  programUnit;
+	uint16_t programUs;
+	uint16_t smallEraseMs;
+	uint16_t massEraseMs;
+	uint32_t bankSize;
+	uint16_t bankUnitStride;
+};
+
 class STM32FamilyDb
 {
 	public:
 	static STM32FamilyInfo getFamilyInfo(uint16_t devId);
+	/* Per-part layout where it differs from the family, else the family's */
+	static STM32FlashGeometry getFlashGeometry(const STM32FamilyInfo& fi, uint16_t flashKb);
+
+	static uint32_t eraseUnitCount(const STM32FlashGeometry& g, uint32_t flashBytes);
+	/* Offset (from flash start) and size of erase unit `index`; false past the end of flash */
+	static bool eraseUnit(const STM32FlashGeometry& g, uint32_t flashBytes, uint32_t index, uint32_t& offset, uint32_t& size);
+	static uint32_t eraseUnitMs(const STM32FlashGeometry& g, uint32_t size);
+	/* Number the bootloader erase command uses for unit `index` */
+	static uint16_t eraseUnitNumber(const STM32FlashGeometry& g, uint32_t flashBytes, uint32_t index);
+
+	/* SRAM a loaded image may occupy: [start, end) above what the ROM bootloader uses for itself.
+	   False when the part is unknown. */
+	static bool getRamRegion(const STM32FamilyInfo& fi, uint32_t& start, uint32_t& end);
+
+	/* Address of the 96-bit unique ID, 0 when the family is unknown */
+	static uint32_t getUidAddr(STM32Family family);
+	/* Offset of the ID's third 32-bit word from getUidAddr(); the first two are contiguous */
+	static uint32_t getUidWord2Offset(STM32Family family);
+	/* "F4", "L0", ...; "unknown" for STM32_UNKNOWN */
+	static const char* familyName(STM32Family family);
 };
 
 #endif	/* STM32_FAMILIES_H */
\ No newline at end of file
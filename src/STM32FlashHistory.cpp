@@ -0,0 +1,253 @@
+/********************************************************************************************************
+ *  [FILE NAME]   :      <STM32FlashHistory.cpp>                                                        *
+ *  [AUTHOR]      :      <David S. Alexander>                                                           *
+ *  [DATE CREATED]:      <Dec 10, 2025>                                                                 *
+ *  [Description] :      <Source file for the persistent per-job flash history>                         *
+ ********************************************************************************************************/
+
+#include "STM32FlashHistory.h"
+#include "STM32FamilyDb.h"
+#include "STM32EventLog.h"
+#include "STM32JsonWriter.h"
+
+static_assert(sizeof(STM32HistoryRecord) == 88, "history records are stored as they are in memory");
+
+const uint32_t STM32FlashHistory::BOUNDS_MS[STM32FlashHistory::BUCKETS] =
+{
+	250, 500, 1000, 2000, 4000, 6000, 8000, 12000, 16000, 24000, 32000, 48000, 64000, 128000
+};
+
+/* Records read per store call during the summary pass */
+static const size_t READ_BATCH = 4;
+
+/* Duration statistics of one family and /cmd letter */
+struct HistoryGroup
+{
+	uint8_t family;
+	char job;
+	uint16_t jobs;
+	uint16_t failed;
+	uint16_t counts[STM32FlashHistory::BUCKETS + 1];
+	uint32_t maxMs;
+	uint32_t retries;
+};
+
+static uint16_t sat16(uint32_t v)
+{
+	return (v > 0xFFFF) ? 0xFFFF : (uint16_t)v;
+}
+
+/* pct-th percentile, interpolated inside its bucket; the open bucket reports the maximum */
+static uint32_t percentileMs(const HistoryGroup& g, uint8_t pct)
+{
+	if (g.jobs == 0) return 0;
+	uint32_t rank = ((uint32_t)g.jobs * pct + 99) / 100;
+	if (rank == 0) rank = 1;
+	uint32_t seen = 0;
+	for (uint8_t i = 0; i < STM32FlashHistory::BUCKETS; i++)
+	{
+		if (seen + g.counts[i] >= rank)
+		{
+			uint32_t lo = i ? STM32FlashHistory::BOUNDS_MS[i - 1] : 0;
+			uint32_t hi = STM32FlashHistory::BOUNDS_MS[i];
+			if (hi > g.maxMs) hi = g.maxMs;
+			if (hi < lo) return hi;
+			return lo + (uint32_t)((uint64_t)(hi - lo) * (rank - seen) / g.counts[i]);
+		}
+		seen += g.counts[i];
+	}
+	return g.maxMs;
+}
+
+STM32FlashHistory::STM32FlashHistory()
+: _store(nullptr),
+_next(1),
+_job('-'),
+_startMs(0),
+_programmed0(0),
+_retries0(0),
+_nacks0(0),
+_timeouts0(0),
+_stub0(0)
+{
+	memset(_phaseUs0, 0, sizeof(_phaseUs0));
+}
+
+void STM32FlashHistory::begin(STM32HistoryStore* store)
+{
+	_store = store;
+	_next = 1;
+	if (!_store) return;
+
+	size_t n = _store->count();
+	STM32HistoryRecord last;
+	if (n && _store->read(n - 1, &last, 1) == 1 && last.version == STM32_HISTORY_VERSION) _next = last.seq + 1;
+}
+
+void STM32FlashHistory::beginJob(char job, const STM32FlasherMetrics& m)
+{
+	_job = job;
+	_startMs = millis();
+	_programmed0 = m.bytesProgrammed;
+	_retries0 = m.retries;
+	_nacks0 = m.nacks;
+	_timeouts0 = m.timeouts;
+	_stub0 = m.stubSessions;
+	for (uint8_t i = 0; i < STM32_PHASE_COUNT; i++) _phaseUs0[i] = m.phase[i].sumUs;
+}
+
+void STM32FlashHistory::endJob(STM32HistoryRecord& r, bool ok, const STM32RomResult& res, const STM32FlasherMetrics& m)
+{
+	r.seq = _next++;
+	r.uptimeMs = millis();
+	r.durationMs = r.uptimeMs - _startMs;
+	r.bytesWritten = m.bytesProgrammed - _programmed0;
+	for (uint8_t i = 0; i < STM32_PHASE_COUNT; i++) r.phaseMs[i] = (uint32_t)((m.phase[i].sumUs - _phaseUs0[i]) / 1000);
+	r.retries = sat16(m.retries - _retries0);
+	r.nacks = sat16(m.nacks - _nacks0);
+	r.timeouts = sat16(m.timeouts - _timeouts0);
+	r.version = STM32_HISTORY_VERSION;
+	r.job = (uint8_t)_job;
+	if (ok) r.flags |= STM32_HIST_OK;
+	if (m.stubSessions != _stub0) r.flags |= STM32_HIST_STUB;
+
+	r.errAddr = 0;
+	r.errValue = 0;
+	if (!ok) STM32EventLog::pack(res, r.errAddr, r.errValue);
+
+	if (_store) _store->append(r);
+}
+
+void STM32FlashHistory::writeRecord(STM32JsonWriter& json, const STM32HistoryRecord& r)
+{
+	char job[2] = { (char)r.job, '\0' };
+	json.beginObject();
+	json.add("seq", (unsigned long)r.seq);
+	if (r.time) json.add("time", (unsigned long)r.time);
+	json.add("uptimeMs", (unsigned long)r.uptimeMs);
+	json.add("job", job);
+	json.add("ok", (r.flags & STM32_HIST_OK) != 0);
+	json.addHex("devId", r.devId, 3);
+	json.add("family", STM32FamilyDb::familyName((STM32Family)r.family));
+	if (r.flags & STM32_HIST_UID)
+	{
+		char uid[STM32_UID_LEN * 2 + 1];
+		for (size_t i = 0; i < STM32_UID_LEN; i++) snprintf(uid + 2 * i, 3, "%02x", r.uid[i]);
+		json.add("uid", uid);
+	}
+	if (r.flags & STM32_HIST_HASH)
+	{
+		char hash[STM32_HISTORY_HASH_LEN * 2 + 1];
+		for (size_t i = 0; i < STM32_HISTORY_HASH_LEN; i++) snprintf(hash + 2 * i, 3, "%02x", r.imageHash[i]);
+		json.add("imageSha256", hash);
+	}
+	json.add("link", (r.flags & STM32_HIST_SPI) ? "spi" : "uart");
+	json.add("rate", (unsigned long)r.rate);
+	json.add("stub", (r.flags & STM32_HIST_STUB) != 0);
+	json.add("written", (unsigned long)r.bytesWritten);
+	json.add("skipped", (unsigned long)r.bytesSkipped);
+	json.add("ms", (unsigned long)r.durationMs);
+	json.beginObject("phaseMs");
+	for (uint8_t i = 0; i < STM32_PHASE_COUNT; i++) json.add(STM32FlasherMetrics::phaseName(i), (unsigned long)r.phaseMs[i]);
+	json.endObject();
+	json.add("retries", (unsigned)r.retries);
+	json.add("nacks", (unsigned)r.nacks);
+	json.add("timeouts", (unsigned)r.timeouts);
+	if (!(r.flags & STM32_HIST_OK))
+	{
+		STM32RomResult res = STM32EventLog::unpack(r.errAddr, r.errValue);
+		char msg[96];
+		res.format(msg, sizeof(msg));
+		json.add("error", msg);
+	}
+	json.endObject();
+}
+
+void STM32FlashHistory::writeJson(Print& out, uint8_t recent) const
+{
+	HistoryGroup groups[MAX_GROUPS];
+	uint8_t nGroups = 0;
+	uint32_t ungrouped = 0;
+	uint32_t first = 0;
+	uint32_t last = 0;
+	uint32_t valid = 0;
+
+	size_t n = _store ? _store->count() : 0;
+	STM32HistoryRecord batch[READ_BATCH];
+	for (size_t at = 0; at < n; )
+	{
+		size_t got = _store->read(at, batch, READ_BATCH);
+		if (got == 0) break;
+		at += got;
+		for (size_t k = 0; k < got; k++)
+		{
+			const STM32HistoryRecord& r = batch[k];
+			if (r.version != STM32_HISTORY_VERSION) continue;
+			if (!valid) first = r.seq;
+			last = r.seq;
+			valid++;
+
+			uint8_t g = 0;
+			while (g < nGroups && (groups[g].family != r.family || groups[g].job != (char)r.job)) g++;
+			if (g == nGroups)
+			{
+				if (nGroups == MAX_GROUPS)
+				{
+					ungrouped++;
+					continue;
+				}
+				memset(&groups[g], 0, sizeof(groups[g]));
+				groups[g].family = r.family;
+				groups[g].job = (char)r.job;
+				nGroups++;
+			}
+
+			HistoryGroup& s = groups[g];
+			uint8_t b = 0;
+			while (b < BUCKETS && r.durationMs > BOUNDS_MS[b]) b++;
+			if (s.counts[b] < 0xFFFF) s.counts[b]++;
+			if (s.jobs < 0xFFFF) s.jobs++;
+			if (!(r.flags & STM32_HIST_OK) && s.failed < 0xFFFF) s.failed++;
+			if (r.durationMs > s.maxMs) s.maxMs = r.durationMs;
+			s.retries += r.retries;
+		}
+		yield();
+	}
+
+	STM32JsonWriter json(out);
+	json.beginObject();
+	json.add("ok", true);
+	json.add("records", (unsigned long)valid);
+	json.add("first", (unsigned long)first);
+	json.add("last", (unsigned long)last);
+
+	json.beginArray("groups");
+	for (uint8_t g = 0; g < nGroups; g++)
+	{
+		const HistoryGroup& s = groups[g];
+		char job[2] = { s.job, '\0' };
+		json.beginObject();
+		json.add("family", STM32FamilyDb::familyName((STM32Family)s.family));
+		json.add("job", job);
+		json.add("jobs", (unsigned)s.jobs);
+		json.add("failed", (unsigned)s.failed);
+		json.add("failPermille", (unsigned)((uint32_t)s.failed * 1000 / s.jobs));
+		json.add("p50Ms", (unsigned long)percentileMs(s, 50));
+		json.add("p95Ms", (unsigned long)percentileMs(s, 95));
+		json.add("maxMs", (unsigned long)s.maxMs);
+		json.add("retries", (unsigned long)s.retries);
+		json.endObject();
+	}
+	json.endArray();
+	json.add("ungrouped", (unsigned long)ungrouped);
+
+	if (recent > MAX_RECENT) recent = MAX_RECENT;
+	json.beginArray("recent");
+	for (size_t at = (n > recent) ? n - recent : 0; at < n; at++)
+	{
+		if (_store->read(at, batch, 1) != 1) break;
+		if (batch[0].version == STM32_HISTORY_VERSION) writeRecord(json, batch[0]);
+	}
+	json.endArray();
+	json.endObject();
+}
@@ -0,0 +1,112 @@
+/********************************************************************************************************
+ *  [FILE NAME]   :      <STM32FlashHistory.h>                                                          *
+ *  [AUTHOR]      :      <David S. Alexander>                                                           *
+ *  [DATE CREATED]:      <Dec 10, 2025>                                                                 *
+ *  [Description] :      <Header file for the persistent per-job flash history>                         *
+ ********************************************************************************************************/
+
+#ifndef STM32_FLASH_HISTORY_H
+#define	STM32_FLASH_HISTORY_H
+
+#include <Arduino.h>
+#include "STM32DeviceConstants.h"
+#include "STM32FlasherMetrics.h"
+#include "STM32RomResult.h"
+
+class STM32JsonWriter;
+
+static const uint8_t STM32_HISTORY_VERSION = 2;
+/* Leading bytes of the image's SHA-256 kept per record */
+static const size_t STM32_HISTORY_HASH_LEN = 8;
+
+enum STM32HistoryFlag : uint8_t
+{
+	STM32_HIST_OK = 0x01,
+	STM32_HIST_SPI = 0x02,		/* rate is the SPI clock, not the UART baud */
+	STM32_HIST_UID = 0x04,		/* uid was read from the part */
+	STM32_HIST_HASH = 0x08,		/* the job used the stored image and imageHash starts its SHA-256 */
+	STM32_HIST_STUB = 0x10		/* programmed through the RAM loader stub */
+};
+
+/* One finished job, 88 bytes on flash. The caller fills the target and image fields before
+   STM32FlashHistory::endJob() adds the rest. */
+struct STM32HistoryRecord
+{
+	uint32_t seq;
+	uint32_t time;			/* Unix seconds, 0 when the ESP clock was not set */
+	uint32_t uptimeMs;		/* millis() when the job ended */
+	uint32_t rate;			/* UART baud or SPI clock */
+	uint32_t bytesWritten;
+	uint32_t bytesSkipped;	/* image bytes not written because flash already held them */
+	uint32_t durationMs;
+	uint32_t phaseMs[STM32_PHASE_COUNT];
+	uint32_t errAddr;		/* failure as STM32EventLog::pack() stores it; 0 on success */
+	uint32_t errValue;
+	uint16_t devId;
+	uint16_t retries;		/* saturated */
+	uint16_t nacks;
+	uint16_t timeouts;
+	uint8_t uid[STM32_UID_LEN];
+	uint8_t imageHash[STM32_HISTORY_HASH_LEN];
+	uint8_t version;
+	uint8_t job;			/* the /cmd letter, 'B' for a batch, 'M' for a manifest */
+	uint8_t flags;			/* STM32HistoryFlag */
+	uint8_t family;			/* STM32Family */
+};
+
+/* Where the records live; the web flasher keeps them in a rotating LittleFS file */
+class STM32HistoryStore
+{
+	public:
+	virtual ~STM32HistoryStore() {}
+	virtual void append(const STM32HistoryRecord& r) = 0;
+	virtual size_t count() = 0;
+	/* Up to max records from index `from` (0 is the oldest kept), oldest first; returns how many */
+	virtual size_t read(size_t from, STM32HistoryRecord* out, size_t max) = 0;
+};
+
+/* Writes one record per job to the store and summarises the store in one pass over it. The
+   summary groups jobs by family and /cmd letter and keeps a fixed duration histogram per group,
+   so its memory does not grow with the number of records. */
+class STM32FlashHistory
+{
+	public:
+	static const uint8_t MAX_GROUPS = 12;
+	static const uint8_t MAX_RECENT = 32;
+	/* Upper bounds of the duration buckets in ms, then one open bucket */
+	static const uint8_t BUCKETS = 14;
+	static const uint32_t BOUNDS_MS[BUCKETS];
+
+	STM32FlashHistory();
+
+	/* Continues the numbering of the newest stored record; store may be nullptr */
+	void begin(STM32HistoryStore* store);
+
+	void beginJob(char job, const STM32FlasherMetrics& m);
+	/* Adds result, timing and counters since beginJob() to `r`, numbers it and appends it */
+	void endJob(STM32HistoryRecord& r, bool ok, const STM32RomResult& res, const STM32FlasherMetrics& m);
+
+	/* {"ok":true,"records":..,"first":..,"last":..,"groups":[{"family","job","jobs","failed",
+	   "failPermille","p50Ms","p95Ms","maxMs","retries"},..],"ungrouped":..,"recent":[..]} with
+	   the newest `recent` records (at most MAX_RECENT) in full */
+	void writeJson(Print& out, uint8_t recent) const;
+
+	uint32_t lastSeq() const { return _next - 1; }
+
+	private:
+	STM32HistoryStore* _store;
+	uint32_t _next;
+
+	char _job;
+	uint32_t _startMs;
+	uint32_t _programmed0;
+	uint32_t _retries0;
+	uint32_t _nacks0;
+	uint32_t _timeouts0;
+	uint32_t _stub0;
+	uint64_t _phaseUs0[STM32_PHASE_COUNT];
+
+	static void writeRecord(STM32JsonWriter& json, const STM32HistoryRecord& r);
+};
+
+#endif	/* STM32_FLASH_HISTORY_H */
@@ -0,0 +1,450 @@
+/********************************************************************************************************
+ *  [FILE NAME]   :      <STM32FlashShadow.cpp>                                                         *
+ *  [AUTHOR]      :      <David S. Alexander>                                                           *
+ *  [DATE CREATED]:      <Dec 10, 2025>                                                                 *
+ *  [Description] :      <Source file for the target flash shadow index and delta updates>              *
+ ********************************************************************************************************/
+
+#include "STM32FlashShadow.h"
+#include "STM32StubProtocol.h"
+
+static_assert(sizeof(STM32ShadowBlock) == 20, "shadow blocks are stored as they are in memory");
+
+/* The two CRCs of a block entry, fed a slice in pieces */
+struct SliceHash
+{
+	uint32_t crc;
+	uint32_t probeCrc;
+	uint32_t seen;
+
+	SliceHash() : crc(0), probeCrc(0), seen(0) {}
+
+	void add(const uint8_t* data, size_t n)
+	{
+		if (seen < STM32_SHADOW_PROBE)
+		{
+			size_t p = STM32_SHADOW_PROBE - seen;
+			probeCrc = STM32StubCodec::crc32(probeCrc, data, (n < p) ? n : p);
+		}
+		crc = STM32StubCodec::crc32(crc, data, n);
+		seen += (uint32_t)n;
+	}
+};
+
+/* At most `len` bytes of another stream, hashed as they are read */
+class SliceStream : public Stream
+{
+	public:
+	SliceStream(Stream& src, uint32_t len) : _src(&src), _left(len) {}
+
+	int available() override
+	{
+		int n = _src->available();
+		return ((uint32_t)n > _left) ? (int)_left : n;
+	}
+	int read() override
+	{
+		uint8_t c;
+		return (readBytes((char*)&c, 1) == 1) ? c : -1;
+	}
+	int peek() override { return _left ? _src->peek() : -1; }
+	size_t write(uint8_t) override { return 0; }
+	using Stream::readBytes;
+
+	size_t readBytes(char* buf, size_t len) override
+	{
+		if (len > _left) len = _left;
+		size_t n = len ? _src->readBytes(buf, len) : 0;
+		_hash.add((const uint8_t*)buf, n);
+		_left -= (uint32_t)n;
+		return n;
+	}
+
+	uint32_t left() const { return _left; }
+	const SliceHash& hash() const { return _hash; }
+
+	private:
+	Stream* _src;
+	uint32_t _left;
+	SliceHash _hash;
+};
+
+/* CRC-32 of what the flasher reads back for a spot check */
+class CrcPrint : public Print
+{
+	public:
+	CrcPrint() : crc(0) {}
+	size_t write(uint8_t c) override { return write(&c, 1); }
+	size_t write(const uint8_t* data, size_t len) override
+	{
+		crc = STM32StubCodec::crc32(crc, data, len);
+		return len;
+	}
+
+	uint32_t crc;
+};
+
+static bool skipBytes(Stream& src, uint32_t len)
+{
+	uint8_t buf[256];
+	while (len)
+	{
+		size_t n = src.readBytes(buf, (len < sizeof(buf)) ? len : sizeof(buf));
+		if (n == 0) return false;
+		len -= (uint32_t)n;
+	}
+	return true;
+}
+
+static uint32_t erasedCrc(uint32_t len)
+{
+	uint8_t ff[32];
+	memset(ff, 0xFF, sizeof(ff));
+	uint32_t crc = 0;
+	while (len)
+	{
+		size_t n = (len < sizeof(ff)) ? len : sizeof(ff);
+		crc = STM32StubCodec::crc32(crc, ff, n);
+		len -= (uint32_t)n;
+	}
+	return crc;
+}
+
+static bool isSet(const uint8_t* bits, uint16_t i)
+{
+	return (bits[i >> 3] >> (i & 7)) & 1;
+}
+
+STM32FlashShadow::STM32FlashShadow()
+: _blocks(nullptr),
+_count(0),
+_flashBytes(0)
+{
+	memset(&_hdr, 0, sizeof(_hdr));
+}
+
+STM32FlashShadow::~STM32FlashShadow()
+{
+	end();
+}
+
+bool STM32FlashShadow::begin(uint16_t devId, uint16_t flashKb, const STM32FlashGeometry& g, const uint8_t* uid)
+{
+	end();
+	uint32_t flashBytes = (uint32_t)flashKb * 1024UL;
+	uint32_t target = (flashBytes + STM32_SHADOW_MAX_BLOCKS - 1) / STM32_SHADOW_MAX_BLOCKS;
+	if (target < STM32_SHADOW_BLOCK_MIN) target = STM32_SHADOW_BLOCK_MIN;
+
+	/* Two passes over the units: count the blocks, then fill them in */
+	for (uint8_t pass = 0; pass < 2; pass++)
+	{
+		uint16_t n = 0;
+		uint32_t size = 0;
+		uint32_t off, unit;
+		for (uint32_t i = 0; STM32FamilyDb::eraseUnit(g, flashBytes, i, off, unit); i++)
+		{
+			if (size == 0)
+			{
+				if (pass) _blocks[n].offset = off;
+				n++;
+			}
+			size += unit;
+			if (size >= target) size = 0;
+		}
+		if (pass) break;
+
+		if (n == 0 || n > STM32_SHADOW_MAX_BLOCKS) return false;
+		_blocks = (STM32ShadowBlock*)calloc(n, sizeof(STM32ShadowBlock));
+		if (!_blocks) return false;
+		_count = n;
+	}
+
+	_flashBytes = flashBytes;
+	memcpy(_hdr.magic, "STMS", 4);
+	_hdr.version = STM32_SHADOW_VERSION;
+	_hdr.devId = devId;
+	_hdr.flashKb = flashKb;
+	_hdr.count = _count;
+	memcpy(_hdr.uid, uid, STM32_UID_LEN);
+	return true;
+}
+
+void STM32FlashShadow::end()
+{
+	free(_blocks);
+	_blocks = nullptr;
+	_count = 0;
+}
+
+bool STM32FlashShadow::load(Stream& in)
+{
+	if (!_blocks) return false;
+	Header h;
+	if (in.readBytes((uint8_t*)&h, sizeof(h)) != sizeof(h) || memcmp(&h, &_hdr, sizeof(h)) != 0) return false;
+
+	STM32ShadowBlock b;
+	for (uint16_t i = 0; i < _count; i++)
+	{
+		if (in.readBytes((uint8_t*)&b, sizeof(b)) != sizeof(b) || b.offset != _blocks[i].offset)
+		{
+			forgetAll();
+			return false;
+		}
+		_blocks[i] = b;
+	}
+	return true;
+}
+
+bool STM32FlashShadow::save(Print& out) const
+{
+	if (!_blocks) return false;
+	if (out.write((const uint8_t*)&_hdr, sizeof(_hdr)) != sizeof(_hdr)) return false;
+	size_t len = (size_t)_count * sizeof(STM32ShadowBlock);
+	return out.write((const uint8_t*)_blocks, len) == len;
+}
+
+uint32_t STM32FlashShadow::blockSize(uint16_t i) const
+{
+	return ((i + 1 < _count) ? _blocks[i + 1].offset : _flashBytes) - _blocks[i].offset;
+}
+
+uint16_t STM32FlashShadow::blocksFor(uint32_t len) const
+{
+	uint16_t n = 0;
+	while (n < _count && _blocks[n].offset < len) n++;
+	return n;
+}
+
+void STM32FlashShadow::markErased()
+{
+	for (uint16_t i = 0; i < _count; i++)
+	{
+		uint32_t offset = _blocks[i].offset;
+		memset(&_blocks[i], 0, sizeof(_blocks[i]));
+		_blocks[i].offset = offset;
+		_blocks[i].state = STM32_SHADOW_ERASED;
+	}
+}
+
+void STM32FlashShadow::forgetAll()
+{
+	forget(0, _flashBytes);
+}
+
+void STM32FlashShadow::forget(uint32_t offset, uint32_t len)
+{
+	for (uint16_t i = 0; i < _count; i++)
+	{
+		STM32ShadowBlock& b = _blocks[i];
+		if (b.offset < offset + len && offset < b.offset + blockSize(i))
+		{
+			uint32_t keep = b.offset;
+			memset(&b, 0, sizeof(b));
+			b.offset = keep;
+		}
+	}
+}
+
+void STM32FlashShadow::setData(uint16_t i, uint32_t len, uint32_t crc, uint32_t probeCrc)
+{
+	STM32ShadowBlock& b = _blocks[i];
+	b.len = len;
+	b.crc = crc;
+	b.probeCrc = probeCrc;
+	b.state = STM32_SHADOW_DATA;
+}
+
+bool STM32FlashShadow::setImage(Stream& src, uint32_t len)
+{
+	uint16_t n = blocksFor(len);
+	for (uint16_t i = 0; i < n; i++)
+	{
+		uint32_t slice = len - _blocks[i].offset;
+		if (slice > blockSize(i)) slice = blockSize(i);
+		uint32_t crc, probe;
+		if (!hashSlice(src, slice, crc, probe))
+		{
+			forget(_blocks[i].offset, len - _blocks[i].offset);
+			return false;
+		}
+		setData(i, slice, crc, probe);
+		yield();
+	}
+	return true;
+}
+
+bool STM32FlashShadow::hashSlice(Stream& src, uint32_t len, uint32_t& crc, uint32_t& probeCrc)
+{
+	SliceStream s(src, len);
+	uint8_t buf[256];
+	while (s.left())
+	{
+		if (s.readBytes(buf, sizeof(buf)) == 0) return false;
+	}
+	crc = s.hash().crc;
+	probeCrc = s.hash().probeCrc;
+	return true;
+}
+
+template <class Transport>
+STM32DeltaUpdaterT<Transport>::STM32DeltaUpdaterT(Flasher& flasher, STM32BatchFiles& files)
+: _flasher(&flasher),
+_files(&files)
+{
+}
+
+template <class Transport>
+bool STM32DeltaUpdaterT<Transport>::run(const char* image, STM32FlashShadow& shadow, STM32DeltaReport& rep, STM32RomResult& res)
+{
+	memset(&rep, 0, sizeof(rep));
+	if (!_flasher->isConnected() || !shadow.active()) return res.fail(STM32_ERR_NOT_CONNECTED, STM32_RO_WRITE, STM32_ST_NONE);
+
+	size_t len = 0;
+	Stream* src = _files->open(image, len);
+	if (!src) return res.fail(STM32_ERR_SOURCE, STM32_RO_WRITE, STM32_ST_NONE);
+	uint32_t flashBytes = (uint32_t)_flasher->flashKb() * 1024UL;
+	if (len == 0 || len > flashBytes)
+	{
+		_files->close();
+		return res.fail(STM32_ERR_BAD_ARG, STM32_RO_WRITE, STM32_ST_ADDR, 0, _flasher->flashStart());
+	}
+
+	/* Which blocks differ, from the image and the shadow alone */
+	uint8_t changed[STM32_SHADOW_MAX_BLOCKS / 8];
+	memset(changed, 0, sizeof(changed));
+	rep.blocks = shadow.blocksFor((uint32_t)len);
+	for (uint16_t i = 0; i < rep.blocks; i++)
+	{
+		const STM32ShadowBlock& b = shadow.block(i);
+		uint32_t slice = (uint32_t)len - b.offset;
+		if (slice > shadow.blockSize(i)) slice = shadow.blockSize(i);
+		uint32_t crc, probe;
+		if (!STM32FlashShadow::hashSlice(*src, slice, crc, probe))
+		{
+			_files->close();
+			return res.fail(STM32_ERR_SOURCE, STM32_RO_WRITE, STM32_ST_NONE);
+		}
+		if (b.state != STM32_SHADOW_DATA || b.len != slice || b.crc != crc) changed[i >> 3] |= (uint8_t)(1 << (i & 7));
+		yield();
+	}
+	_files->close();
+
+	_flasher->beginSession();
+	bool ok = spotCheck(shadow, changed, rep.blocks, rep, res);
+	if (ok && rep.stale)
+	{
+		shadow.forgetAll();
+		memset(changed, 0xFF, sizeof(changed));
+	}
+	if (ok) ok = apply(image, (uint32_t)len, shadow, changed, rep, res);
+	_flasher->endSession();
+	return ok;
+}
+
+template <class Transport>
+bool STM32DeltaUpdaterT<Transport>::spotCheck(const STM32FlashShadow& shadow, const uint8_t* changed, uint16_t blocks, STM32DeltaReport& rep, STM32RomResult& res)
+{
+	/* Trusted blocks: skipped as unchanged, or programmed without an erase */
+	uint16_t trusted = 0;
+	for (uint16_t i = 0; i < blocks; i++)
+	{
+		uint8_t st = shadow.block(i).state;
+		if ((st == STM32_SHADOW_DATA && !isSet(changed, i)) || st == STM32_SHADOW_ERASED) trusted++;
+	}
+
+	uint16_t checks = (trusted < STM32_SHADOW_SPOT_CHECKS) ? trusted : STM32_SHADOW_SPOT_CHECKS;
+	for (uint16_t k = 0; k < checks; k++)
+	{
+		/* Spread over the trusted blocks, the first one always included */
+		uint16_t want = (uint16_t)((uint32_t)k * trusted / checks);
+		uint16_t i = 0;
+		for (uint16_t seen = 0; i < blocks; i++)
+		{
+			uint8_t st = shadow.block(i).state;
+			if (!((st == STM32_SHADOW_DATA && !isSet(changed, i)) || st == STM32_SHADOW_ERASED)) continue;
+			if (seen++ == want) break;
+		}
+
+		const STM32ShadowBlock& b = shadow.block(i);
+		bool erased = (b.state == STM32_SHADOW_ERASED);
+		uint32_t n = erased ? shadow.blockSize(i) : b.len;
+		if (n > STM32_SHADOW_PROBE) n = STM32_SHADOW_PROBE;
+
+		CrcPrint got;
+		if (!_flasher->readToStream(_flasher->flashStart() + b.offset, n, got, res)) return false;
+		rep.checked++;
+		if (got.crc != (erased ? erasedCrc(n) : b.probeCrc))
+		{
+			rep.stale = true;
+			return true;
+		}
+	}
+	return true;
+}
+
+template <class Transport>
+bool STM32DeltaUpdaterT<Transport>::apply(const char* image, uint32_t len, STM32FlashShadow& shadow, const uint8_t* changed, STM32DeltaReport& rep, STM32RomResult& res)
+{
+	/* Erase and program every changed block, then verify them all, one pass over the image each */
+	for (uint8_t pass = 0; pass < 2; pass++)
+	{
+		size_t fileLen = 0;
+		Stream* src = _files->open(image, fileLen);
+		if (!src || fileLen != len)
+		{
+			_files->close();
+			return res.fail(STM32_ERR_SOURCE, STM32_RO_WRITE, STM32_ST_NONE);
+		}
+
+		bool ok = true;
+		for (uint16_t i = 0; ok && i < rep.blocks; i++)
+		{
+			const STM32ShadowBlock& b = shadow.block(i);
+			uint32_t addr = _flasher->flashStart() + b.offset;
+			uint32_t slice = len - b.offset;
+			if (slice > shadow.blockSize(i)) slice = shadow.blockSize(i);
+
+			if (!isSet(changed, i))
+			{
+				ok = skipBytes(*src, slice);
+				if (!ok) res.fail(STM32_ERR_SOURCE, STM32_RO_WRITE, STM32_ST_NONE);
+				if (pass) rep.skipped += slice;
+				continue;
+			}
+
+			size_t done = 0;
+			SliceStream s(*src, slice);
+			if (pass == 0)
+			{
+				bool erased = (b.state == STM32_SHADOW_ERASED);
+				shadow.forget(b.offset, 1);
+				uint32_t units = 0;
+				if (!erased)
+				{
+					ok = _flasher->eraseRange(addr, shadow.blockSize(i), units, res);
+					if (ok) rep.erased++;
+				}
+				if (ok) ok = _flasher->programStream(s, addr, done, res);
+				if (ok) rep.rewritten++;
+			}
+			else
+			{
+				ok = _flasher->verifyStream(s, addr, done, res);
+				if (ok)
+				{
+					shadow.setData(i, slice, s.hash().crc, s.hash().probeCrc);
+					rep.written += slice;
+				}
+			}
+			if (ok && done != slice) ok = res.fail(STM32_ERR_SOURCE, STM32_RO_WRITE, STM32_ST_NONE, 0, addr + (uint32_t)done);
+		}
+		_files->close();
+		if (!ok) return false;
+	}
+	return true;
+}
+
+template class STM32DeltaUpdaterT<STM32StreamTransport>;
+#ifdef ESP8266
+template class STM32DeltaUpdaterT<STM32EspTransport>;
+#endif
@@ -0,0 +1,135 @@
+/********************************************************************************************************
+ *  [FILE NAME]   :      <STM32FlashShadow.h>                                                           *
+ *  [AUTHOR]      :      <David S. Alexander>                                                           *
+ *  [DATE CREATED]:      <Dec 10, 2025>                                                                 *
+ *  [Description] :      <Header file for the target flash shadow index and delta updates>              *
+ ********************************************************************************************************/
+
+#ifndef STM32_FLASH_SHADOW_H
+#define	STM32_FLASH_SHADOW_H
+
+#include <Arduino.h>
+#include "STM32RomFlasher.h"
+#include "STM32BatchRunner.h"
+
+static const uint8_t  STM32_SHADOW_VERSION = 1;
+static const uint32_t STM32_SHADOW_BLOCK_MIN = 4096;
+static const uint16_t STM32_SHADOW_MAX_BLOCKS = 512;
+/* Bytes at the start of a block that a spot check reads back */
+static const uint16_t STM32_SHADOW_PROBE = 256;
+static const uint8_t  STM32_SHADOW_SPOT_CHECKS = 4;
+
+enum STM32ShadowState : uint8_t
+{
+	STM32_SHADOW_UNKNOWN,
+	STM32_SHADOW_ERASED,
+	STM32_SHADOW_DATA		/* holds `len` image bytes from its start, as last verified */
+};
+
+/* Whole erase units, at least STM32_SHADOW_BLOCK_MIN bytes; stored as it is in memory */
+struct STM32ShadowBlock
+{
+	uint32_t offset;	/* from flash start */
+	uint32_t len;
+	uint32_t crc;		/* CRC-32 (IEEE) of the `len` bytes */
+	uint32_t probeCrc;	/* CRC-32 of the first min(len, STM32_SHADOW_PROBE) of them */
+	uint8_t state;		/* STM32ShadowState */
+	uint8_t reserved[3];
+};
+
+/* What the ESP last knew to be in each block of one part's flash. The table is allocated by
+   begin() for the length of a job and saved per UID by the caller; a part whose flash was changed
+   by anything else is caught by the spot check in STM32DeltaUpdaterT. */
+class STM32FlashShadow
+{
+	public:
+	STM32FlashShadow();
+	~STM32FlashShadow();
+
+	/* Lays out the part's flash with every block unknown; false if the table does not fit in the heap */
+	bool begin(uint16_t devId, uint16_t flashKb, const STM32FlashGeometry& g, const uint8_t* uid);
+	void end();
+	bool active() const { return _blocks != nullptr; }
+
+	/* Replaces the table with one saved for the same part, UID and layout; anything else is
+	   ignored and the table stays unknown */
+	bool load(Stream& in);
+	bool save(Print& out) const;
+
+	uint16_t blockCount() const { return _count; }
+	const STM32ShadowBlock& block(uint16_t i) const { return _blocks[i]; }
+	uint32_t blockSize(uint16_t i) const;
+
+	void markErased();
+	void forgetAll();
+	/* Every block overlapping [offset, offset + len) becomes unknown */
+	void forget(uint32_t offset, uint32_t len);
+	void setData(uint16_t i, uint32_t len, uint32_t crc, uint32_t probeCrc);
+	/* After `src` (len bytes, programmed at flash start) was verified: every block it covers */
+	bool setImage(Stream& src, uint32_t len);
+
+	/* Blocks holding [0, len) */
+	uint16_t blocksFor(uint32_t len) const;
+	/* Reads `len` bytes of src into the CRCs a block entry keeps */
+	static bool hashSlice(Stream& src, uint32_t len, uint32_t& crc, uint32_t& probeCrc);
+
+	private:
+	struct Header
+	{
+		char magic[4];
+		uint8_t version;
+		uint8_t reserved;
+		uint16_t devId;
+		uint16_t flashKb;
+		uint16_t count;
+		uint8_t uid[STM32_UID_LEN];
+	};
+
+	STM32ShadowBlock* _blocks;
+	uint16_t _count;
+	uint32_t _flashBytes;
+	Header _hdr;
+};
+
+struct STM32DeltaReport
+{
+	uint16_t blocks;		/* blocks the image covers */
+	uint16_t rewritten;
+	uint16_t erased;		/* rewritten blocks that had to be erased; the rest were known erased */
+	uint8_t checked;		/* spot checks read back */
+	bool stale;				/* a spot check failed, so the shadow was dropped */
+	uint32_t written;		/* image bytes programmed and verified */
+	uint32_t skipped;		/* image bytes the shadow said were already there */
+};
+
+/* Programs an image at flash start, erasing and writing only the blocks whose shadow entry does
+   not match the image, then verifies what it wrote. Before trusting the shadow it reads back the
+   first bytes of up to STM32_SHADOW_SPOT_CHECKS of the blocks it would skip or program without an
+   erase; a mismatch drops the shadow and every block is rewritten. Instantiated in
+   STM32FlashShadow.cpp for the same transports as the flasher. */
+template <class Transport>
+class STM32DeltaUpdaterT
+{
+	public:
+	typedef STM32RomFlasherT<Transport> Flasher;
+
+	STM32DeltaUpdaterT(Flasher& flasher, STM32BatchFiles& files);
+
+	/* `shadow` must be begun for the connected part; it is updated as blocks are written, so it
+	   is right to save whether or not the run succeeds */
+	bool run(const char* image, STM32FlashShadow& shadow, STM32DeltaReport& rep, STM32RomResult& res);
+
+	private:
+	Flasher* _flasher;
+	STM32BatchFiles* _files;
+
+	bool spotCheck(const STM32FlashShadow& shadow, const uint8_t* changed, uint16_t blocks, STM32DeltaReport& rep, STM32RomResult& res);
+	bool apply(const char* image, uint32_t len, STM32FlashShadow& shadow, const uint8_t* changed, STM32DeltaReport& rep, STM32RomResult& res);
+};
+
+typedef STM32DeltaUpdaterT<STM32StreamTransport> STM32DeltaUpdater;
+#ifdef ESP8266
+typedef STM32DeltaUpdaterT<STM32EspTransport> STM32EspDeltaUpdater;
+#endif
+
+#endif	/* STM32_FLASH_SHADOW_H */
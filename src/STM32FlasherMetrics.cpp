@@ -0,0 +1,197 @@
+/********************************************************************************************************
+ *  [FILE NAME]   :      <STM32FlasherMetrics.cpp>                                                      *
+ *  [AUTHOR]      :      <David S. Alexander>                                                           *
+ *  [DATE CREATED]:      <Dec 10, 2025>                                                                 *
+ *  [Description] :      <Source file for flasher counters and latency histograms>                      *
+ ********************************************************************************************************/
+
+#include "STM32FlasherMetrics.h"
+
+const uint32_t STM32LatencyHist::BOUNDS_US[STM32LatencyHist::BUCKETS] =
+{
+	100, 250, 500, 1000, 2500, 5000, 10000, 25000, 100000, 1000000
+};
+
+static const char* const BOUND_TEXT[STM32LatencyHist::BUCKETS] =
+{
+	"0.0001", "0.00025", "0.0005", "0.001", "0.0025", "0.005", "0.01", "0.025", "0.1", "1"
+};
+
+static const char* const OP_NAMES[STM32_OP_COUNT] = { "write", "read", "erase" };
+static const char* const PHASE_NAMES[STM32_PHASE_COUNT] = { "sync", "erase", "program", "read", "fs_read" };
+
+void STM32LatencyHist::record(uint32_t us)
+{
+	uint8_t i = 0;
+	while (i < BUCKETS && us > BOUNDS_US[i]) i++;
+	counts[i]++;
+	count++;
+	sumUs += us;
+	if (us > maxUs) maxUs = us;
+}
+
+uint32_t STM32LatencyHist::percentileUs(uint8_t pct, const STM32LatencyHist* since) const
+{
+	uint32_t total = count - (since ? since->count : 0);
+	if (total == 0) return 0;
+
+	/* Rank of the sample, 1-based, rounded up */
+	uint32_t rank = (uint32_t)(((uint64_t)total * pct + 99) / 100);
+	if (rank == 0) rank = 1;
+
+	uint32_t seen = 0;
+	for (uint8_t i = 0; i < BUCKETS; i++)
+	{
+		uint32_t n = counts[i] - (since ? since->counts[i] : 0);
+		if (seen + n >= rank)
+		{
+			uint32_t lo = i ? BOUNDS_US[i - 1] : 0;
+			return lo + (uint32_t)((uint64_t)(BOUNDS_US[i] - lo) * (rank - seen) / n);
+		}
+		seen += n;
+	}
+	return maxUs;
+}
+
+const char* STM32FlasherMetrics::phaseName(uint8_t ph)
+{
+	return (ph < STM32_PHASE_COUNT) ? PHASE_NAMES[ph] : "idle";
+}
+
+const char* STM32FlasherMetrics::opName(uint8_t op)
+{
+	return (op < STM32_OP_COUNT) ? OP_NAMES[op] : "";
+}
+
+STM32FlasherMetrics::STM32FlasherMetrics() : observer(nullptr)
+{
+	reset();
+}
+
+void STM32FlasherMetrics::reset()
+{
+	STM32MetricsObserver* keep = observer;
+	memset(this, 0, sizeof(*this));
+	activePhase = STM32_PHASE_COUNT;
+	observer = keep;
+}
+
+void STM32FlasherMetrics::recordAck(STM32MetricOp op, uint32_t us)
+{
+	if (op >= STM32_OP_COUNT) return;
+	ack[op].record(us);
+	notify();
+}
+
+void STM32FlasherMetrics::recordPhase(STM32JobPhase ph, uint32_t us)
+{
+	if (ph >= STM32_PHASE_COUNT) return;
+	phase[ph].count++;
+	phase[ph].sumUs += us;
+	phase[ph].lastUs = us;
+}
+
+void STM32FlasherMetrics::writeHeader(Print& out, const char* name, const char* type, const char* help)
+{
+	out.print("# HELP ");
+	out.print(name);
+	out.print(' ');
+	out.print(help);
+	out.print("\n# TYPE ");
+	out.print(name);
+	out.print(' ');
+	out.print(type);
+	out.print('\n');
+}
+
+void STM32FlasherMetrics::writeSeconds(Print& out, uint64_t us)
+{
+	char tmp[24];
+	snprintf(tmp, sizeof(tmp), "%lu.%06lu", (unsigned long)(us / 1000000ULL), (unsigned long)(us % 1000000ULL));
+	out.print(tmp);
+}
+
+static void writeCounter(Print& out, const char* name, const char* help, uint32_t v)
+{
+	STM32FlasherMetrics::writeHeader(out, name, "counter", help);
+	out.print(name);
+	out.print(' ');
+	out.print((unsigned long)v);
+	out.print('\n');
+}
+
+void STM32FlasherMetrics::writePrometheus(Print& out) const
+{
+	writeCounter(out, "stm32flasher_bytes_programmed_total", "Bytes written to target flash.", bytesProgrammed);
+	writeCounter(out, "stm32flasher_bytes_read_total", "Bytes read from target memory.", bytesRead);
+	writeCounter(out, "stm32flasher_sync_attempts_total", "Bootloader 0x7F sync attempts.", syncAttempts);
+	writeCounter(out, "stm32flasher_sync_failures_total", "Sync attempts without ACK.", syncFailures);
+	writeCounter(out, "stm32flasher_retries_total", "Operations retried after a failed attempt.", retries);
+	writeCounter(out, "stm32flasher_nacks_total", "NACK responses from the target.", nacks);
+	writeCounter(out, "stm32flasher_timeouts_total", "Responses that timed out.", timeouts);
+	writeCounter(out, "stm32flasher_uart_parity_errors_total", "UART parity errors seen.", uartParityErrors);
+	writeCounter(out, "stm32flasher_uart_framing_errors_total", "UART framing errors seen.", uartFramingErrors);
+	writeCounter(out, "stm32flasher_uart_overruns_total", "UART RX FIFO overflows seen.", uartOverruns);
+	writeCounter(out, "stm32flasher_uart_rx_dropped_total", "Bytes dropped because the UART RX ring was full.", uartRxDropped);
+	writeCounter(out, "stm32flasher_stub_sessions_total", "Programming jobs run through the RAM loader stub.", stubSessions);
+	writeCounter(out, "stm32flasher_stub_fallbacks_total", "Stub handshakes that failed and fell back to the ROM protocol.", stubFallbacks);
+	writeCounter(out, "stm32flasher_stub_retransmits_total", "Stub frames sent again after a NAK or timeout.", stubRetransmits);
+
+	writeHeader(out, "stm32flasher_jobs_total", "counter", "Completed flasher jobs by result.");
+	out.print("stm32flasher_jobs_total{result=\"ok\"} ");
+	out.print((unsigned long)jobsOk);
+	out.print("\nstm32flasher_jobs_total{result=\"failed\"} ");
+	out.print((unsigned long)jobsFailed);
+	out.print('\n');
+
+	writeHeader(out, "stm32flasher_ack_latency_seconds", "histogram", "Time from end of frame to ACK/NACK.");
+	for (uint8_t op = 0; op < STM32_OP_COUNT; op++)
+	{
+		const STM32LatencyHist& h = ack[op];
+		uint32_t cumulative = 0;
+		for (uint8_t i = 0; i <= STM32LatencyHist::BUCKETS; i++)
+		{
+			cumulative += h.counts[i];
+			out.print("stm32flasher_ack_latency_seconds_bucket{op=\"");
+			out.print(OP_NAMES[op]);
+			out.print("\",le=\"");
+			out.print(i < STM32LatencyHist::BUCKETS ? BOUND_TEXT[i] : "+Inf");
+			out.print("\"} ");
+			out.print((unsigned long)cumulative);
+			out.print('\n');
+		}
+		out.print("stm32flasher_ack_latency_seconds_sum{op=\"");
+		out.print(OP_NAMES[op]);
+		out.print("\"} ");
+		writeSeconds(out, h.sumUs);
+		out.print("\nstm32flasher_ack_latency_seconds_count{op=\"");
+		out.print(OP_NAMES[op]);
+		out.print("\"} ");
+		out.print((unsigned long)h.count);
+		out.print('\n');
+	}
+
+	writeHeader(out, "stm32flasher_phase_duration_seconds", "summary", "Job duration by phase.");
+	for (uint8_t ph = 0; ph < STM32_PHASE_COUNT; ph++)
+	{
+		out.print("stm32flasher_phase_duration_seconds_sum{phase=\"");
+		out.print(PHASE_NAMES[ph]);
+		out.print("\"} ");
+		writeSeconds(out, phase[ph].sumUs);
+		out.print("\nstm32flasher_phase_duration_seconds_count{phase=\"");
+		out.print(PHASE_NAMES[ph]);
+		out.print("\"} ");
+		out.print((unsigned long)phase[ph].count);
+		out.print('\n');
+	}
+
+	writeHeader(out, "stm32flasher_phase_last_duration_seconds", "gauge", "Duration of the most recent run of each phase.");
+	for (uint8_t ph = 0; ph < STM32_PHASE_COUNT; ph++)
+	{
+		out.print("stm32flasher_phase_last_duration_seconds{phase=\"");
+		out.print(PHASE_NAMES[ph]);
+		out.print("\"} ");
+		writeSeconds(out, phase[ph].lastUs);
+		out.print('\n');
+	}
+}
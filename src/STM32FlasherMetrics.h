@@ -0,0 +1,143 @@
+/********************************************************************************************************
+ *  [FILE NAME]   :      <STM32FlasherMetrics.h>                                                        *
+ *  [AUTHOR]      :      <David S. Alexander>                                                           *
+ *  [DATE CREATED]:      <Dec 10, 2025>                                                                 *
+ *  [Description] :      <Header file for flasher counters and latency histograms>                      *
+ ********************************************************************************************************/
+
+#ifndef STM32_FLASHER_METRICS_H
+#define	STM32_FLASHER_METRICS_H
+
+#include <Arduino.h>
+
+enum STM32MetricOp
+{
+	STM32_OP_WRITE,
+	STM32_OP_READ,
+	STM32_OP_ERASE,
+	STM32_OP_COUNT
+};
+
+enum STM32JobPhase
+{
+	STM32_PHASE_SYNC,
+	STM32_PHASE_ERASE,
+	STM32_PHASE_PROGRAM,
+	STM32_PHASE_READ,
+	STM32_PHASE_FS_READ,
+	STM32_PHASE_COUNT
+};
+
+/* Fixed-bucket latency histogram, bucket bounds in microseconds */
+struct STM32LatencyHist
+{
+	static const uint8_t BUCKETS = 10;
+	static const uint32_t BOUNDS_US[BUCKETS];
+
+	uint32_t counts[BUCKETS + 1];
+	uint32_t count;
+	uint64_t sumUs;
+	uint32_t maxUs;
+
+	void record(uint32_t us);
+	/* Estimated pct-th percentile, interpolated inside its bucket; with `since`, of the samples
+	   recorded after that copy was taken. The overflow bucket reports maxUs. */
+	uint32_t percentileUs(uint8_t pct, const STM32LatencyHist* since = nullptr) const;
+};
+
+struct STM32PhaseStats
+{
+	uint32_t count;
+	uint64_t sumUs;
+	uint32_t lastUs;
+};
+
+struct STM32FlasherMetrics;
+
+/* Told about progress inside a job: after every ACK and at phase boundaries */
+class STM32MetricsObserver
+{
+	public:
+	virtual ~STM32MetricsObserver() {}
+	virtual void onProgress(const STM32FlasherMetrics& m) = 0;
+};
+
+/* All counters are fixed-size and updated in place; nothing here allocates */
+struct STM32FlasherMetrics
+{
+	uint32_t bytesProgrammed;
+	uint32_t bytesRead;
+
+	uint32_t syncAttempts;
+	uint32_t syncFailures;
+	uint32_t retries;
+	uint32_t nacks;
+	uint32_t timeouts;
+
+	/* Copied from STM32Uart's counters, which count from the start of the UART */
+	uint32_t uartParityErrors;
+	uint32_t uartFramingErrors;
+	uint32_t uartOverruns;
+	uint32_t uartRxDropped;
+
+	/* RAM loader stub: jobs it ran, handshakes that fell back to ROM, frames sent again */
+	uint32_t stubSessions;
+	uint32_t stubFallbacks;
+	uint32_t stubRetransmits;
+
+	uint32_t jobsOk;
+	uint32_t jobsFailed;
+
+	STM32LatencyHist ack[STM32_OP_COUNT];
+	STM32PhaseStats phase[STM32_PHASE_COUNT];
+	/* Innermost running STM32PhaseTimer, STM32_PHASE_COUNT outside any phase */
+	uint8_t activePhase;
+
+	/* Not cleared by reset() */
+	STM32MetricsObserver* observer;
+
+	STM32FlasherMetrics();
+	void reset();
+	void notify() const { if (observer) observer->onProgress(*this); }
+
+	void recordAck(STM32MetricOp op, uint32_t us);
+	void recordPhase(STM32JobPhase ph, uint32_t us);
+
+	/* Prometheus text exposition of the protocol-level metrics */
+	void writePrometheus(Print& out) const;
+
+	static const char* phaseName(uint8_t ph);
+	static const char* opName(uint8_t op);
+
+	static void writeHeader(Print& out, const char* name, const char* type, const char* help);
+	static void writeSeconds(Print& out, uint64_t us);
+};
+
+/* Times one job phase from construction to destruction; a null sink is ignored */
+class STM32PhaseTimer
+{
+	public:
+	STM32PhaseTimer(STM32FlasherMetrics* m, STM32JobPhase ph) : _m(m), _ph(ph), _outer(STM32_PHASE_COUNT), _start(micros())
+	{
+		if (!_m) return;
+		_outer = _m->activePhase;
+		_m->activePhase = ph;
+		_m->notify();
+	}
+
+	~STM32PhaseTimer()
+	{
+		if (!_m) return;
+		_m->recordPhase(_ph, micros() - _start);
+		_m->activePhase = _outer;
+		_m->notify();
+	}
+
+	private:
+	STM32FlasherMetrics* _m;
+	STM32JobPhase _ph;
+	uint8_t _outer;
+	uint32_t _start;
+};
+
+#endif	/* STM32_FLASHER_METRICS_H */
@@ -0,0 +1,182 @@
+/********************************************************************************************************
+ *  [FILE NAME]   :      <STM32FrameTracer.cpp>                                                         *
+ *  [AUTHOR]      :      <David S. Alexander>                                                           *
+ *  [DATE CREATED]:      <Dec 10, 2025>                                                                 *
+ *  [Description] :      <Source file for the bootloader link frame tracer>                             *
+ ********************************************************************************************************/
+
+#include "STM32FrameTracer.h"
+
+static void put16(uint8_t* p, uint16_t v)
+{
+	p[0] = (uint8_t)v;
+	p[1] = (uint8_t)(v >> 8);
+}
+
+static void put32(uint8_t* p, uint32_t v)
+{
+	p[0] = (uint8_t)v;
+	p[1] = (uint8_t)(v >> 8);
+	p[2] = (uint8_t)(v >> 16);
+	p[3] = (uint8_t)(v >> 24);
+}
+
+STM32FrameTracer::STM32FrameTracer()
+: _buf(nullptr),
+_cap(0),
+_tail(0),
+_used(0),
+_frames(0),
+_dropped(0),
+_on(false),
+_rxHdr(0),
+_rxLen(0),
+_rxStart(0),
+_rxOpen(false)
+{}
+
+STM32FrameTracer::~STM32FrameTracer()
+{
+	end();
+}
+
+bool STM32FrameTracer::begin(size_t bytes)
+{
+	end();
+	if (bytes < STM32_FRAME_RECORD_LEN + MAX_FRAME) return false;
+	_buf = (uint8_t*)malloc(bytes);
+	if (!_buf) return false;
+	_cap = bytes;
+	clear();
+	return true;
+}
+
+void STM32FrameTracer::end()
+{
+	free(_buf);
+	_buf = nullptr;
+	_cap = 0;
+	_on = false;
+	clear();
+}
+
+void STM32FrameTracer::clear()
+{
+	_tail = 0;
+	_used = 0;
+	_frames = 0;
+	_dropped = 0;
+	_rxOpen = false;
+}
+
+void STM32FrameTracer::put(size_t pos, const uint8_t* data, size_t len)
+{
+	pos = wrap(pos);
+	size_t first = _cap - pos;
+	if (first > len) first = len;
+	memcpy(_buf + pos, data, first);
+	memcpy(_buf, data + first, len - first);
+}
+
+bool STM32FrameTracer::reserve(size_t need)
+{
+	if (need > _cap) return false;
+	while (_cap - _used < need)
+	{
+		size_t n = STM32_FRAME_RECORD_LEN + lenAt(_tail);
+		if (_rxOpen && _tail == _rxHdr) _rxOpen = false;
+		_tail = wrap(_tail + n);
+		_used -= n;
+		_frames--;
+		_dropped++;
+	}
+	return true;
+}
+
+size_t STM32FrameTracer::append(uint8_t flags, const uint8_t* data, uint16_t len, uint32_t startUs, uint32_t durUs)
+{
+	size_t hdr = wrap(_tail + _used);
+	uint8_t h[STM32_FRAME_RECORD_LEN];
+	h[0] = flags;
+	put16(h + 1, len);
+	put32(h + 3, startUs);
+	put16(h + 7, (durUs > 0xFFFF) ? 0xFFFF : (uint16_t)durUs);
+	put(hdr, h, sizeof(h));
+	put(hdr + sizeof(h), data, len);
+	_used += sizeof(h) + len;
+	_frames++;
+	return hdr;
+}
+
+void STM32FrameTracer::setDuration(size_t hdr, uint32_t durUs)
+{
+	uint8_t d[2];
+	put16(d, (durUs > 0xFFFF) ? 0xFFFF : (uint16_t)durUs);
+	put(hdr + 7, d, 2);
+}
+
+void STM32FrameTracer::tx(const uint8_t* data, size_t len, uint32_t startUs)
+{
+	if (!_on) return;
+	uint32_t now = micros();
+	_rxOpen = false;
+
+	uint8_t flags = 0;
+	if (len > MAX_FRAME)
+	{
+		len = MAX_FRAME;
+		flags |= STM32_FRAME_TRUNCATED;
+	}
+	if (!reserve(STM32_FRAME_RECORD_LEN + len)) return;
+	append(flags, data, (uint16_t)len, startUs, now - startUs);
+}
+
+void STM32FrameTracer::rx(const uint8_t* data, size_t len)
+{
+	if (!_on || len == 0) return;
+	uint32_t now = micros();
+
+	/* Extend the open frame in place while it fits without dropping anything */
+	if (_rxOpen && _rxLen + len <= MAX_FRAME && _cap - _used >= len)
+	{
+		put(_rxHdr + STM32_FRAME_RECORD_LEN + _rxLen, data, len);
+		_rxLen += (uint16_t)len;
+		_used += len;
+		uint8_t l[2];
+		put16(l, _rxLen);
+		put(_rxHdr + 1, l, 2);
+		setDuration(_rxHdr, now - _rxStart);
+		return;
+	}
+
+	uint8_t flags = STM32_FRAME_RX;
+	if (len > MAX_FRAME)
+	{
+		len = MAX_FRAME;
+		flags |= STM32_FRAME_TRUNCATED;
+	}
+	if (!reserve(STM32_FRAME_RECORD_LEN + len)) return;
+	_rxHdr = append(flags, data, (uint16_t)len, now, 0);
+	_rxLen = (uint16_t)len;
+	_rxStart = now;
+	_rxOpen = !(flags & STM32_FRAME_TRUNCATED);
+}
+
+void STM32FrameTracer::writeCapture(Print& out, STM32FrameLink link, uint32_t rate) const
+{
+	uint8_t h[STM32_FRAME_HEADER_LEN];
+	memcpy(h, "STMF", 4);
+	h[4] = STM32_FRAME_VERSION;
+	h[5] = (uint8_t)link;
+	put16(h + 6, 0);
+	put32(h + 8, rate);
+	put32(h + 12, _frames);
+	put32(h + 16, _dropped);
+	out.write(h, sizeof(h));
+
+	if (_used == 0) return;
+	size_t first = _cap - _tail;
+	if (first > _used) first = _used;
+	out.write(_buf + _tail, first);
+	out.write(_buf, _used - first);
+}
@@ -0,0 +1,90 @@
+/********************************************************************************************************
+ *  [FILE NAME]   :      <STM32FrameTracer.h>                                                           *
+ *  [AUTHOR]      :      <David S. Alexander>                                                           *
+ *  [DATE CREATED]:      <Dec 10, 2025>                                                                 *
+ *  [Description] :      <Header file for the bootloader link frame tracer>                             *
+ ********************************************************************************************************/
+
+#ifndef STM32_FRAME_TRACER_H
+#define	STM32_FRAME_TRACER_H
+
+#include <Arduino.h>
+
+/* Capture layout, all little endian:
+     header  "STMF", u8 version, u8 link (0 UART, 1 SPI), u16 0, u32 baud or SPI Hz,
+             u32 frames, u32 frames dropped from the ring
+     frame   u8 flags, u16 len, u32 start us, u16 duration us (saturated), len bytes
+   frames oldest first. extras/host/tools/stm32frames.cpp decodes it. */
+static const uint8_t STM32_FRAME_VERSION = 1;
+static const size_t  STM32_FRAME_HEADER_LEN = 20;
+static const size_t  STM32_FRAME_RECORD_LEN = 9;
+
+enum STM32FrameFlag : uint8_t
+{
+	STM32_FRAME_RX = 0x01,			/* target -> ESP; TX otherwise */
+	STM32_FRAME_TRUNCATED = 0x02	/* only the first STM32FrameTracer::MAX_FRAME bytes were kept */
+};
+
+enum STM32FrameLink : uint8_t
+{
+	STM32_FRAME_LINK_UART,
+	STM32_FRAME_LINK_SPI
+};
+
+/* Records what STM32RomBootloaderT puts on and takes off the link into a ring allocated once by
+   begin(). A TX frame is one write with its flush, timed from the write to the end of the flush;
+   consecutive reads with no write in between form one RX frame, timed from the first read to the
+   last. When the ring is full the oldest frames are dropped. */
+class STM32FrameTracer
+{
+	public:
+	static const uint16_t MAX_FRAME = 512;
+
+	STM32FrameTracer();
+	~STM32FrameTracer();
+
+	/* Allocates the ring; false if it does not fit in the heap. Starts disabled. */
+	bool begin(size_t bytes);
+	void end();
+	void clear();
+
+	void setEnabled(bool on) { _on = on && _buf; }
+	bool enabled() const { return _on; }
+
+	void tx(const uint8_t* data, size_t len, uint32_t startUs);
+	void rx(const uint8_t* data, size_t len);
+
+	void writeCapture(Print& out, STM32FrameLink link, uint32_t rate) const;
+	size_t captureBytes() const { return STM32_FRAME_HEADER_LEN + _used; }
+
+	uint32_t frames() const { return _frames; }
+	uint32_t dropped() const { return _dropped; }
+	size_t capacity() const { return _cap; }
+
+	private:
+	uint8_t* _buf;
+	size_t _cap;
+	size_t _tail;	/* oldest frame */
+	size_t _used;
+	uint32_t _frames;
+	uint32_t _dropped;
+	bool _on;
+
+	/* Header offset of the RX frame that further reads extend; only valid while _rxOpen */
+	size_t _rxHdr;
+	uint16_t _rxLen;
+	uint32_t _rxStart;
+	bool _rxOpen;
+
+	size_t wrap(size_t pos) const { return (pos >= _cap) ? pos - _cap : pos; }
+	void put(size_t pos, const uint8_t* data, size_t len);
+	uint8_t at(size_t pos) const { return _buf[wrap(pos)]; }
+	uint16_t lenAt(size_t hdr) const { return (uint16_t)(at(hdr + 1) | (at(hdr + 2) << 8)); }
+	/* Drops the oldest frames until `need` bytes are free; false if the ring is too small */
+	bool reserve(size_t need);
+	/* Appends a frame header and data at the end of the ring, returning the header offset */
+	size_t append(uint8_t flags, const uint8_t* data, uint16_t len, uint32_t startUs, uint32_t durUs);
+	void setDuration(size_t hdr, uint32_t durUs);
+};
+
+#endif	/* STM32_FRAME_TRACER_H */
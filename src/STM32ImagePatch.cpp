@@ -0,0 +1,168 @@
+/********************************************************************************************************
+ *  [FILE NAME]   :      <STM32ImagePatch.cpp>                                                          *
+ *  [AUTHOR]      :      <David S. Alexander>                                                           *
+ *  [DATE CREATED]:      <Dec 10, 2025>                                                                 *
+ *  [Description] :      <Source file for the streaming binary patch applier>                           *
+ ********************************************************************************************************/
+
+#include "STM32ImagePatch.h"
+#include "STM32StubProtocol.h"
+
+static const char PATCH_MAGIC[4] = { 'S', 'T', 'M', 'D' };
+static const size_t COPY_CHUNK = 256;
+
+STM32PatchApplier::STM32PatchApplier()
+: _target(nullptr),
+_error(nullptr),
+_state(HEADER),
+_op(0),
+_fill(0),
+_need(STM32_PATCH_HEADER_LEN),
+_baseSize(0),
+_newSize(0),
+_left(0),
+_out(0),
+_copied(0),
+_patchBytes(0)
+{
+	memset(_baseSha, 0, sizeof(_baseSha));
+}
+
+void STM32PatchApplier::begin(STM32PatchTarget& target, uint32_t baseSize, const uint8_t* baseSha)
+{
+	_target = &target;
+	_error = nullptr;
+	_state = HEADER;
+	_fill = 0;
+	_need = STM32_PATCH_HEADER_LEN;
+	_baseSize = baseSize;
+	memcpy(_baseSha, baseSha, sizeof(_baseSha));
+	_newSize = 0;
+	_out = 0;
+	_copied = 0;
+	_patchBytes = 0;
+	_sha.begin();
+}
+
+bool STM32PatchApplier::fail(const char* error)
+{
+	if (!_error) _error = error;
+	return false;
+}
+
+bool STM32PatchApplier::parseHeader()
+{
+	if (memcmp(_hdr, PATCH_MAGIC, sizeof(PATCH_MAGIC)) != 0) return fail("not a patch");
+	if (_hdr[4] != STM32_PATCH_VERSION) return fail("unsupported patch version");
+	if (STM32StubCodec::get32(_hdr + 8) != _baseSize || memcmp(_hdr + 16, _baseSha, STM32_SHA256_LEN) != 0)
+	{
+		return fail("patch is for another base image");
+	}
+	_newSize = STM32StubCodec::get32(_hdr + 12);
+	if (_newSize == 0) return fail("empty new image");
+	if (!_target->begin(_newSize)) return fail("cannot store the new image");
+	_state = OP;
+	return true;
+}
+
+bool STM32PatchApplier::emit(const uint8_t* data, size_t len)
+{
+	_sha.update(data, len);
+	if (!_target->write(data, len)) return fail("cannot store the new image");
+	_out += (uint32_t)len;
+	return true;
+}
+
+bool STM32PatchApplier::copy(uint32_t offset, uint32_t len)
+{
+	if (offset > _baseSize || len > _baseSize - offset) return fail("copy outside the base image");
+	if (len > _newSize - _out) return fail("patch runs past the new image size");
+
+	uint8_t buf[COPY_CHUNK];
+	while (len)
+	{
+		size_t want = (len < sizeof(buf)) ? len : sizeof(buf);
+		if (_target->readBase(offset, buf, want) != want) return fail("base image read failed");
+		if (!emit(buf, want)) return false;
+		offset += (uint32_t)want;
+		len -= (uint32_t)want;
+		_copied += (uint32_t)want;
+		yield();
+	}
+	return true;
+}
+
+bool STM32PatchApplier::runOp()
+{
+	_state = OP;
+	if (_op == STM32_PATCH_COPY) return copy(STM32StubCodec::get32(_args), STM32StubCodec::get32(_args + 4));
+
+	_left = STM32StubCodec::get32(_args);
+	if (_left > _newSize - _out) return fail("patch runs past the new image size");
+	if (_left) _state = INSERT;
+	return true;
+}
+
+size_t STM32PatchApplier::take(uint8_t* dst, const uint8_t* data, size_t len)
+{
+	size_t n = _need - _fill;
+	if (n > len) n = len;
+	memcpy(dst + _fill, data, n);
+	_fill += n;
+	return n;
+}
+
+bool STM32PatchApplier::write(const uint8_t* data, size_t len)
+{
+	if (!active()) return false;
+	_patchBytes += (uint32_t)len;
+
+	while (len)
+	{
+		size_t n;
+		switch (_state)
+		{
+			case HEADER:
+			n = take(_hdr, data, len);
+			if (_fill == _need && !parseHeader()) return false;
+			break;
+
+			case ARGS:
+			n = take(_args, data, len);
+			if (_fill == _need && !runOp()) return false;
+			break;
+
+			case OP:
+			if (_out == _newSize) return fail("data after the end of the patch");
+			_op = *data;
+			if (_op != STM32_PATCH_COPY && _op != STM32_PATCH_INSERT) return fail("unknown patch op");
+			n = 1;
+			_fill = 0;
+			_need = (_op == STM32_PATCH_COPY) ? 8 : 4;
+			_state = ARGS;
+			break;
+
+			case INSERT:
+			default:
+			n = (len < _left) ? len : _left;
+			if (!emit(data, n)) return false;
+			_left -= (uint32_t)n;
+			if (_left == 0) _state = OP;
+			break;
+		}
+		data += n;
+		len -= n;
+	}
+	return true;
+}
+
+bool STM32PatchApplier::finish()
+{
+	if (!active()) return false;
+	if (_state != OP || _out != _newSize) return fail("patch ends before the new image is complete");
+
+	uint8_t digest[STM32_SHA256_LEN];
+	_sha.finish(digest);
+	if (memcmp(digest, _hdr + 48, STM32_SHA256_LEN) != 0) return fail("SHA-256 of the new image does not match");
+	return true;
+}
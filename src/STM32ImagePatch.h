@@ -0,0 +1,106 @@
+/********************************************************************************************************
+ *  [FILE NAME]   :      <STM32ImagePatch.h>                                                            *
+ *  [AUTHOR]      :      <David S. Alexander>                                                           *
+ *  [DATE CREATED]:      <Dec 10, 2025>                                                                 *
+ *  [Description] :      <Header file for the streaming binary patch applier>                           *
+ ********************************************************************************************************/
+
+#ifndef STM32_IMAGE_PATCH_H
+#define	STM32_IMAGE_PATCH_H
+
+#include <Arduino.h>
+#include "STM32Sha256.h"
+
+/*
+   Patch format, all numbers little-endian:
+
+     header (80 bytes): "STMD", version (1), 3 reserved bytes, base size u32, new size u32,
+                        SHA-256 of the base image, SHA-256 of the new image
+     ops, until the new image is complete:
+       0x01 offset u32, len u32     copy len bytes of the base image from offset
+       0x02 len u32, data[len]      insert data
+
+   Bytes after the op that completes the new image are an error.
+*/
+static const uint8_t STM32_PATCH_VERSION = 1;
+static const size_t STM32_PATCH_HEADER_LEN = 80;
+
+enum STM32PatchOp : uint8_t
+{
+	STM32_PATCH_COPY = 0x01,
+	STM32_PATCH_INSERT = 0x02
+};
+
+/* Where the applier reads the base image and writes the new one */
+class STM32PatchTarget
+{
+	public:
+	virtual ~STM32PatchTarget() {}
+	/* `len` bytes of the base image from `offset`; returns how many were read */
+	virtual size_t readBase(uint32_t offset, uint8_t* dst, size_t len) = 0;
+	/* Called once, after the header was accepted; false refuses the new image */
+	virtual bool begin(uint32_t newSize) = 0;
+	virtual bool write(const uint8_t* data, size_t len) = 0;
+};
+
+/* Rebuilds an image from a patch fed in pieces of any size, such as HTTP upload fragments.
+   Copies go through a 256-byte stack buffer, so RAM use does not depend on the image or patch
+   size. The result is hashed on the way out and only reported good if it matches the header. */
+class STM32PatchApplier
+{
+	public:
+	STM32PatchApplier();
+
+	/* The base image the target reads from: its size and SHA-256, which the header must name */
+	void begin(STM32PatchTarget& target, uint32_t baseSize, const uint8_t* baseSha);
+	/* False once the patch failed, with error() set; later calls do nothing */
+	bool write(const uint8_t* data, size_t len);
+	/* True if the patch ended exactly at the end of the new image and its SHA-256 matches */
+	bool finish();
+
+	bool active() const { return _target != nullptr && !_error; }
+	const char* error() const { return _error; }
+
+	uint32_t patchBytes() const { return _patchBytes; }
+	uint32_t outBytes() const { return _out; }
+	/* Output bytes taken from the base image */
+	uint32_t copied() const { return _copied; }
+
+	private:
+	enum State : uint8_t
+	{
+		HEADER,
+		OP,
+		ARGS,
+		INSERT
+	};
+
+	STM32PatchTarget* _target;
+	const char* _error;
+	State _state;
+	uint8_t _op;
+
+	uint8_t _hdr[STM32_PATCH_HEADER_LEN];
+	uint8_t _baseSha[STM32_SHA256_LEN];
+	uint8_t _args[8];
+	size_t _fill;
+	size_t _need;
+
+	uint32_t _baseSize;
+	uint32_t _newSize;
+	uint32_t _left;
+	uint32_t _out;
+	uint32_t _copied;
+	uint32_t _patchBytes;
+	STM32Sha256 _sha;
+
+	bool fail(const char* error);
+	/* Moves up to the rest of a fixed-size field from the input; returns the bytes taken */
+	size_t take(uint8_t* dst, const uint8_t* data, size_t len);
+	bool parseHeader();
+	bool runOp();
+	bool copy(uint32_t offset, uint32_t len);
+	bool emit(const uint8_t* data, size_t len);
+};
+
+#endif	/* STM32_IMAGE_PATCH_H */
@@ -0,0 +1,182 @@
+/********************************************************************************************************
+ *  [FILE NAME]   :      <STM32ImagePreflight.cpp>                                                      *
+ *  [AUTHOR]      :      <David S. Alexander>                                                           *
+ *  [DATE CREATED]:      <Dec 10, 2025>                                                                 *
+ *  [Description] :      <Source file for pre-flight checks of a flash image>                           *
+ ********************************************************************************************************/
+
+#include "STM32ImagePreflight.h"
+#include "STM32StubProtocol.h"
+
+static const char* const CHECK_NAMES[STM32_PF_COUNT] = { "size", "SP", "reset", "base" };
+
+static const uint32_t SRAM_BASE = 0x20000000UL;
+/* Largest SRAM at 0x20000000 on any supported part (H5); an SP further up is not SRAM at all */
+static const uint32_t SRAM_SPAN_MAX = 0x100000UL;
+
+/* WRITE MEMORY framing around each 256-byte chunk: cmd + complement, address + checksum, length,
+   data checksum, three ACKs */
+static const uint32_t WRITE_FRAME_OVERHEAD = 12;
+static const uint32_t WRITE_CHUNK = 256;
+
+void STM32ImageInfo::set(const uint8_t* head, uint32_t imageSize)
+{
+	size = imageSize;
+	sp = (imageSize >= 4) ? STM32StubCodec::get32(head) : 0;
+	reset = (imageSize >= 8) ? STM32StubCodec::get32(head + 4) : 0;
+}
+
+bool STM32ImageInfo::read(Stream& src, uint32_t imageSize)
+{
+	uint8_t head[8] = { 0 };
+	size_t want = (imageSize < sizeof(head)) ? imageSize : sizeof(head);
+	if (src.readBytes(head, want) != want) return false;
+	set(head, imageSize);
+	return true;
+}
+
+bool STM32ImageInfo::hash(Stream& src)
+{
+	uint8_t buf[256];
+	uint32_t c = 0;
+	STM32Sha256 sha;
+	uint32_t left = size;
+	while (left)
+	{
+		size_t want = (left < sizeof(buf)) ? left : sizeof(buf);
+		size_t got = src.readBytes(buf, want);
+		if (got == 0) return false;
+		c = STM32StubCodec::crc32(c, buf, got);
+		sha.update(buf, got);
+		left -= (uint32_t)got;
+		yield();
+	}
+	crc = c;
+	sha.finish(sha256);
+	crcKnown = true;
+	return true;
+}
+
+/* SRAM outside the 0x20000000 block: CCM on F3/F4/G4, SRAM2 on L4, the AXI and D2/D3 domains on H7.
+   Sizes are the largest in each family; an SP equal to the end is a valid empty stack. */
+static bool inOtherSram(STM32Family family, uint32_t sp)
+{
+	switch (family)
+	{
+		case STM32_F3:
+		case STM32_F4:
+		case STM32_G4:
+		case STM32_L4:
+		return sp > 0x10000000UL && sp <= 0x10010000UL;
+		case STM32_H7:
+		return (sp > 0x24000000UL && sp <= 0x24100000UL)
+			|| (sp > 0x30000000UL && sp <= 0x30048000UL)
+			|| (sp > 0x38000000UL && sp <= 0x38010000UL);
+		default:
+		return false;
+	}
+}
+
+static void mark(STM32Preflight& out, STM32PreflightCheck check, STM32PreflightLevel level, const char* reason)
+{
+	/* The first finding per check is the one worth reporting */
+	if (out.level[check] != STM32_PF_PASS) return;
+	out.level[check] = level;
+	out.reason[check] = reason;
+	if (level == STM32_PF_FAIL) out.go = false;
+}
+
+const char* STM32ImagePreflight::checkName(STM32PreflightCheck check)
+{
+	return (check < STM32_PF_COUNT) ? CHECK_NAMES[check] : "";
+}
+
+bool STM32ImagePreflight::analyze(const STM32ImageInfo& image, const STM32FamilyInfo& fi, uint16_t flashKb,
+uint32_t base, uint32_t linkBytesPerSec, STM32Preflight& out)
+{
+	out = STM32Preflight();
+	out.go = true;
+	out.image = image;
+	out.base = base;
+
+	uint32_t flashEnd = fi.flashStart + (uint32_t)flashKb * 1024UL;
+	if (flashKb && base >= fi.flashStart && base < flashEnd) out.flashBytes = flashEnd - base;
+
+	if (image.size < 8)
+	{
+		mark(out, STM32_PF_SIZE, STM32_PF_FAIL, "too small for a vector table");
+		return false;
+	}
+	if (!flashKb) mark(out, STM32_PF_SIZE, STM32_PF_WARN, "flash size unknown");
+	else if (!out.flashBytes) mark(out, STM32_PF_SIZE, STM32_PF_FAIL, "base is outside flash");
+	else if (image.size > out.flashBytes) mark(out, STM32_PF_SIZE, STM32_PF_FAIL, "larger than flash");
+
+	/* Full-descending stack: the initial SP is one past the top, so the end of SRAM is valid */
+	uint32_t sramEnd = SRAM_BASE + (uint32_t)fi.sramKb * 1024UL;
+	const uint32_t sp = image.sp;
+	if (sp & 3) mark(out, STM32_PF_SP, STM32_PF_FAIL, "not word aligned");
+	else if (sp > SRAM_BASE && sp <= SRAM_BASE + SRAM_SPAN_MAX)
+	{
+		if (fi.sramKb && sp > sramEnd) mark(out, STM32_PF_SP, STM32_PF_WARN, "above the SRAM of the smallest part with this ID");
+	}
+	else if (!inOtherSram(fi.family, sp)) mark(out, STM32_PF_SP, STM32_PF_FAIL, "not in SRAM");
+
+	const uint32_t pc = image.reset & ~1UL;
+	if (!(image.reset & 1)) mark(out, STM32_PF_RESET, STM32_PF_FAIL, "not a Thumb address");
+	else if (pc >= base && (!flashKb || pc < flashEnd))
+	{
+		/* An image linked for a higher base (behind a bootloader, say) still points into flash */
+		if (pc - base >= image.size) mark(out, STM32_PF_BASE, STM32_PF_WARN, "reset handler past the end of the image, linked for a higher base?");
+	}
+	else if (pc >= fi.flashStart && pc < base) mark(out, STM32_PF_BASE, STM32_PF_WARN, "linked below the programming base");
+	else if (pc < image.size)
+	{
+		/* Runs through the boot alias at 0, but only while booting from main flash */
+		mark(out, STM32_PF_BASE, STM32_PF_WARN, "linked at the 0x00000000 alias");
+	}
+	else if ((pc >= SRAM_BASE && pc < SRAM_BASE + SRAM_SPAN_MAX) || inOtherSram(fi.family, pc)) mark(out, STM32_PF_RESET, STM32_PF_FAIL, "points to SRAM, a Run in RAM image?");
+	else mark(out, STM32_PF_RESET, STM32_PF_FAIL, "not in flash");
+
+	uint16_t kb = flashKb ? flashKb : fi.FlashSize;
+	STM32FlashGeometry g = STM32FamilyDb::getFlashGeometry(fi, kb);
+	out.eraseMs = g.massEraseMs;
+
+	uint32_t units = (image.size + g.programUnit - 1) / g.programUnit;
+	uint64_t programUs = (uint64_t)units * g.programUs;
+	if (linkBytesPerSec)
+	{
+		uint32_t chunks = (image.size + WRITE_CHUNK - 1) / WRITE_CHUNK;
+		uint64_t wireBytes = (uint64_t)image.size + (uint64_t)chunks * WRITE_FRAME_OVERHEAD;
+		programUs += wireBytes * 1000000ULL / linkBytesPerSec;
+	}
+	out.programMs = (uint32_t)((programUs + 999) / 1000);
+
+	return out.go;
+}
+
+size_t STM32Preflight::format(char* buf, size_t cap) const
+{
+	if (cap == 0) return 0;
+
+	int n;
+	if (flashBytes) n = snprintf(buf, cap, "%s: %lu of %lu bytes", go ? "GO" : "NO-GO", (unsigned long)image.size, (unsigned long)flashBytes);
+	else n = snprintf(buf, cap, "%s: %lu bytes", go ? "GO" : "NO-GO", (unsigned long)image.size);
+	if (go && n >= 0 && (size_t)n < cap)
+	{
+		n += snprintf(buf + n, cap - n, ", est. erase %lu.%lu s, program %lu.%lu s",
+		(unsigned long)(eraseMs / 1000), (unsigned long)(eraseMs % 1000 / 100),
+		(unsigned long)(programMs / 1000), (unsigned long)(programMs % 1000 / 100));
+	}
+
+	for (uint8_t i = 0; i < STM32_PF_COUNT && n >= 0 && (size_t)n < cap; i++)
+	{
+		if (level[i] == STM32_PF_PASS) continue;
+		uint32_t value = (i == STM32_PF_SP) ? image.sp : (i == STM32_PF_SIZE) ? 0 : image.reset;
+		n += snprintf(buf + n, cap - n, "; %s%s", (level[i] == STM32_PF_WARN) ? "warning, " : "", CHECK_NAMES[i]);
+		if (value && n >= 0 && (size_t)n < cap) n += snprintf(buf + n, cap - n, " 0x%08lX", (unsigned long)value);
+		if (n >= 0 && (size_t)n < cap) n += snprintf(buf + n, cap - n, " %s", reason[i]);
+	}
+
+	if (n < 0) { buf[0] = '\0'; return 0; }
+	return ((size_t)n < cap) ? (size_t)n : cap - 1;
+}
@@ -0,0 +1,86 @@
+/********************************************************************************************************
+ *  [FILE NAME]   :      <STM32ImagePreflight.h>                                                        *
+ *  [AUTHOR]      :      <David S. Alexander>                                                           *
+ *  [DATE CREATED]:      <Dec 10, 2025>                                                                 *
+ *  [Description] :      <Header file for pre-flight checks of a flash image>                           *
+ ********************************************************************************************************/
+
+#ifndef STM32_IMAGE_PREFLIGHT_H
+#define	STM32_IMAGE_PREFLIGHT_H
+
+#include <Arduino.h>
+#include "STM32FamilyDb.h"
+#include "STM32Sha256.h"
+
+/* What the checks need from an image: its size and the first two vector table words. Cheap to
+   keep next to the stored file, see STM32UploadWriter::imageInfo(). */
+struct STM32ImageInfo
+{
+	uint32_t size;
+	uint32_t sp;
+	uint32_t reset;
+	/* CRC-32 (IEEE) and SHA-256 of the whole image; only valid with crcKnown */
+	uint32_t crc;
+	uint8_t sha256[STM32_SHA256_LEN];
+	bool crcKnown;
+
+	STM32ImageInfo() : size(0), sp(0), reset(0), crc(0), crcKnown(false) { memset(sha256, 0, sizeof(sha256)); }
+
+	/* `head` holds the first min(size, 8) bytes of the image */
+	void set(const uint8_t* head, uint32_t imageSize);
+	/* Reads the first 8 bytes of `src`, which is `imageSize` bytes long */
+	bool read(Stream& src, uint32_t imageSize);
+	/* Reads `src` from the start of the image to its end into crc and sha256 */
+	bool hash(Stream& src);
+};
+
+enum STM32PreflightCheck : uint8_t
+{
+	STM32_PF_SIZE,	/* fits the detected flash above the programming base */
+	STM32_PF_SP,	/* initial SP in the family's SRAM */
+	STM32_PF_RESET,	/* reset vector is a Thumb address in flash */
+	STM32_PF_BASE,	/* vector table looks linked for the programming base */
+	STM32_PF_COUNT
+};
+
+enum STM32PreflightLevel : uint8_t
+{
+	STM32_PF_PASS,
+	STM32_PF_WARN,
+	STM32_PF_FAIL
+};
+
+struct STM32Preflight
+{
+	bool go;
+	uint8_t level[STM32_PF_COUNT];
+	const char* reason[STM32_PF_COUNT];
+
+	STM32ImageInfo image;
+	uint32_t base;
+	uint32_t flashBytes;	/* available from base; 0 if the flash size is unknown */
+
+	/* Mass erase, and programming over the ROM protocol (flash time plus WRITE MEMORY frames on
+	   the link); datasheet typicals, so a rough guide rather than a bound */
+	uint32_t eraseMs;
+	uint32_t programMs;
+
+	/* e.g. "GO: 65536 of 131072 bytes, est. erase 0.0 s, program 6.8 s", followed by
+	   "; SP 0x30000000 not in SRAM" for every warning or failure; always NUL-terminated */
+	size_t format(char* buf, size_t cap) const;
+};
+
+/* Checks an image against the detected part before anything on the target is erased */
+class STM32ImagePreflight
+{
+	public:
+	/* `flashKb` is the detected size (0 if unknown), `base` where the image will be programmed and
+	   `linkBytesPerSec` the link's byte rate for the estimate, e.g. baud / 11 for 8E1 UART (0 leaves
+	   the link time out). Returns the go/no-go. */
+	static bool analyze(const STM32ImageInfo& image, const STM32FamilyInfo& fi, uint16_t flashKb,
+	uint32_t base, uint32_t linkBytesPerSec, STM32Preflight& out);
+
+	static const char* checkName(STM32PreflightCheck check);
+};
+
+#endif	/* STM32_IMAGE_PREFLIGHT_H */
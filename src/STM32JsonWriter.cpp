@@ -0,0 +1,176 @@
+/********************************************************************************************************
+ *  [FILE NAME]   :      <STM32JsonWriter.cpp>                                                          *
+ *  [AUTHOR]      :      <David S. Alexander>                                                           *
+ *  [DATE CREATED]:      <Dec 10, 2025>                                                                 *
+ *  [Description] :      <Source file for allocation-free JSON writer>                                  *
+ ********************************************************************************************************/
+
+#include "STM32JsonWriter.h"
+
+STM32BufferPrint::STM32BufferPrint(char* buf, size_t cap)
+: _buf(buf),
+_cap(cap),
+_len(0),
+_overflow(false)
+{
+	if (_cap) _buf[0] = '\0';
+}
+
+size_t STM32BufferPrint::write(uint8_t c)
+{
+	return write(&c, 1);
+}
+
+size_t STM32BufferPrint::write(const uint8_t* data, size_t len)
+{
+	if (_cap == 0) { _overflow = true; return 0; }
+
+	size_t room = _cap - 1 - _len;
+	if (len > room) { len = room; _overflow = true; }
+	memcpy(_buf + _len, data, len);
+	_len += len;
+	_buf[_len] = '\0';
+	return len;
+}
+
+void STM32BufferPrint::clear()
+{
+	_len = 0;
+	_overflow = false;
+	if (_cap) _buf[0] = '\0';
+}
+
+const char* STM32BufferPrint::c_str() const { return _buf; }
+size_t STM32BufferPrint::length() const { return _len; }
+bool STM32BufferPrint::overflow() const { return _overflow; }
+
+STM32JsonWriter::STM32JsonWriter(Print& out) : _out(&out), _depth(0), _hasItems(0), _dropped(0), _truncated(false) {}
+
+bool STM32JsonWriter::prefix(const char* key)
+{
+	if (_dropped) return false;
+	if (_depth > 0)
+	{
+		uint16_t bit = (uint16_t)(1u << (_depth - 1));
+		if (_hasItems & bit) _out->write(',');
+		_hasItems |= bit;
+	}
+	if (key)
+	{
+		writeString(key);
+		_out->write(':');
+	}
+	return true;
+}
+
+void STM32JsonWriter::open(const char* key, char bracket)
+{
+	if (_dropped || _depth == 16)
+	{
+		_dropped++;
+		_truncated = true;
+		return;
+	}
+	prefix(key);
+	_out->write(bracket);
+	_depth++;
+	_hasItems &= (uint16_t)~(1u << (_depth - 1));
+}
+
+void STM32JsonWriter::close(char bracket)
+{
+	if (_dropped)
+	{
+		_dropped--;
+		return;
+	}
+	if (_depth > 0) _depth--;
+	_out->write(bracket);
+}
+
+void STM32JsonWriter::beginObject(const char* key) { open(key, '{'); }
+void STM32JsonWriter::endObject() { close('}'); }
+void STM32JsonWriter::beginArray(const char* key) { open(key, '['); }
+void STM32JsonWriter::endArray() { close(']'); }
+
+void STM32JsonWriter::writeString(const char* s)
+{
+	static const char hex[] = "0123456789abcdef";
+
+	_out->write('"');
+	if (s)
+	{
+		const char* run = s;
+		for (; *s; s++)
+		{
+			uint8_t c = (uint8_t)*s;
+			if (c >= 0x20 && c != '"' && c != '\\') continue;
+
+			if (s > run) _out->write((const uint8_t*)run, (size_t)(s - run));
+			run = s + 1;
+
+			char esc[6] = { '\\', 0, 0, 0, 0, 0 };
+			size_t n = 2;
+			switch (c)
+			{
+				case '"':  esc[1] = '"';  break;
+				case '\\': esc[1] = '\\'; break;
+				case '\n': esc[1] = 'n';  break;
+				case '\r': esc[1] = 'r';  break;
+				case '\t': esc[1] = 't';  break;
+				default:
+				esc[1] = 'u'; esc[2] = '0'; esc[3] = '0';
+				esc[4] = hex[c >> 4]; esc[5] = hex[c & 0x0F];
+				n = 6;
+				break;
+			}
+			_out->write((const uint8_t*)esc, n);
+		}
+		if (s > run) _out->write((const uint8_t*)run, (size_t)(s - run));
+	}
+	_out->write('"');
+}
+
+void STM32JsonWriter::add(const char* key, const char* value)
+{
+	if (!prefix(key)) return;
+	writeString(value);
+}
+
+void STM32JsonWriter::add(const char* key, bool value)
+{
+	if (!prefix(key)) return;
+	_out->print(value ? "true" : "false");
+}
+
+void STM32JsonWriter::add(const char* key, long value)
+{
+	if (!prefix(key)) return;
+	_out->print(value);
+}
+
+void STM32JsonWriter::add(const char* key, unsigned long value)
+{
+	if (!prefix(key)) return;
+	_out->print(value);
+}
+
+void STM32JsonWriter::addHex(const char* key, uint32_t value, uint8_t digits)
+{
+	char tmp[12];
+	if (digits > 8) digits = 8;
+	snprintf(tmp, sizeof(tmp), "0x%0*lX", (int)digits, (unsigned long)value);
+	add(key, tmp);
+}
+
+void STM32JsonWriter::value(const char* v)
+{
+	if (!prefix(nullptr)) return;
+	writeString(v);
+}
+
+void STM32JsonWriter::value(unsigned long v)
+{
+	if (!prefix(nullptr)) return;
+	_out->print(v);
+}
@@ -0,0 +1,74 @@
+/********************************************************************************************************
+ *  [FILE NAME]   :      <STM32JsonWriter.h>                                                            *
+ *  [AUTHOR]      :      <David S. Alexander>                                                           *
+ *  [DATE CREATED]:      <Dec 10, 2025>                                                                 *
+ *  [Description] :      <Header file for allocation-free JSON writer>                                  *
+ ********************************************************************************************************/
+
+#ifndef STM32_JSON_WRITER_H
+#define	STM32_JSON_WRITER_H
+
+#include <Arduino.h>
+
+/* Print sink over a caller-owned buffer; output past the end is dropped and flagged */
+class STM32BufferPrint : public Print
+{
+	public:
+	STM32BufferPrint(char* buf, size_t cap);
+
+	size_t write(uint8_t c) override;
+	size_t write(const uint8_t* data, size_t len) override;
+
+	void clear();
+	const char* c_str() const;
+	size_t length() const;
+	bool overflow() const;
+
+	private:
+	char* _buf;
+	size_t _cap;
+	size_t _len;
+	bool _overflow;
+};
+
+/* Streams JSON to any Print without heap use. Nesting is limited to 16 levels: an object or array
+   opened deeper is dropped with everything in it, so the output stays valid, and truncated() is set. */
+class STM32JsonWriter
+{
+	public:
+	explicit STM32JsonWriter(Print& out);
+
+	void beginObject(const char* key = nullptr);
+	void endObject();
+	void beginArray(const char* key = nullptr);
+	void endArray();
+
+	void add(const char* key, const char* value);
+	void add(const char* key, bool value);
+	void add(const char* key, long value);
+	void add(const char* key, unsigned long value);
+	void add(const char* key, int value)      { add(key, (long)value); }
+	void add(const char* key, unsigned value) { add(key, (unsigned long)value); }
+	void addHex(const char* key, uint32_t value, uint8_t digits);
+
+	void value(const char* v);
+	void value(unsigned long v);
+
+	bool truncated() const { return _truncated; }
+
+	private:
+	Print* _out;
+	uint8_t _depth;
+	uint16_t _hasItems;
+	/* Open levels past the cap, whose closes are swallowed */
+	uint16_t _dropped;
+	bool _truncated;
+
+	void open(const char* key, char bracket);
+	void close(char bracket);
+	/* False inside a dropped level: write nothing */
+	bool prefix(const char* key);
+	void writeString(const char* s);
+};
+
+#endif	/* STM32_JSON_WRITER_H */
@@ -8,350 +8,455 @@
 
 #include "STM32RomBootloader.h"
 
-STM32RomBootloader::STM32RomBootloader(Stream& io) : _io(&io) {}
+template <class Transport>
+STM32RomBootloaderT<Transport>::STM32RomBootloaderT(Transport io) : _io(io), _m(nullptr), _trace(nullptr) {}
 
-void STM32RomBootloader::clearRx()
+template <class Transport>
+void STM32RomBootloaderT<Transport>::setMetrics(STM32FlasherMetrics* metrics)
 {
-	while (_io->available()) _io->read();
+	_m = metrics;
 }
 
-bool STM32RomBootloader::readByteTimeout(uint8_t& b, uint32_t timeoutMs)
+template <class Transport>
+Transport& STM32RomBootloaderT<Transport>::transport()
+{
+	return _io;
+}
+
+template <class Transport>
+void STM32RomBootloaderT<Transport>::send(const uint8_t* data, size_t len)
+{
+	if (!_trace || !_trace->enabled())
+	{
+		_io.write(data, len);
+		_io.flush();
+		return;
+	}
+	uint32_t t0 = micros();
+	_io.write(data, len);
+	_io.flush();
+	_trace->tx(data, len, t0);
+}
+
+template <class Transport>
+void STM32RomBootloaderT<Transport>::clearRx()
+{
+	/* Nothing is buffered on SPI, and reading there would just clock dummy bytes forever */
+	if (_io.spiFraming()) return;
+	uint8_t junk[32];
+	size_t n;
+	while ((n = _io.read(junk, sizeof(junk))) > 0) traceRx(junk, n);
+}
+
+template <class Transport>
+bool STM32RomBootloaderT<Transport>::readByteTimeout(uint8_t& b, uint32_t timeoutMs)
+{
+	if (!_io.waitAvailable(1, timeoutMs)) return false;
+	b = (uint8_t)_io.read();
+	traceRx(&b, 1);
+	return true;
+}
+
+template <class Transport>
+bool STM32RomBootloaderT<Transport>::pollAckByte(uint8_t& b, uint32_t timeoutMs)
 {
 	uint32_t start = millis();
-	while (!_io->available())
+	while (true)
 	{
+		b = (uint8_t)_io.read();
+		/* The dummy bytes clocked while polling are not traced, only the answer */
+		if (b == STM32_ACK || b == STM32_NACK)
+		{
+			traceRx(&b, 1);
+			return true;
+		}
 		if (millis() - start >= timeoutMs) return false;
 		yield();
 	}
-	b = (uint8_t)_io->read();
-	return true;
 }
 
-bool STM32RomBootloader::waitAck(uint32_t timeoutMs, uint8_t& resp)
+template <class Transport>
+void STM32RomBootloaderT<Transport>::beginData()
+{
+	if (!_io.spiFraming()) return;
+	uint8_t dummy;
+	_io.read(&dummy, 1);
+	traceRx(&dummy, 1);
+}
+
+template <class Transport>
+size_t STM32RomBootloaderT<Transport>::readBlock(uint8_t* buf, size_t len, uint32_t timeoutMs)
+{
+	size_t n = 0;
+	while (n < len)
+	{
+		size_t got = _io.read(buf + n, len - n);
+		traceRx(buf + n, got);
+		n += got;
+		if (n == len) break;
+		/* A timeout that still brought bytes counts as progress and restarts the wait */
+		if (!_io.waitAvailable(len - n, timeoutMs) && !_io.available()) break;
+	}
+	return n;
+}
+
+template <class Transport>
+bool STM32RomBootloaderT<Transport>::waitAck(uint32_t timeoutMs, uint8_t& resp)
 {
-	if (!readByteTimeout(resp, timeoutMs)) return false;
+	bool got = _io.spiFraming() ? pollAckByte(resp, timeoutMs) : readByteTimeout(resp, timeoutMs);
+	if (!got)
+	{
+		resp = 0;
+		if (_m) _m->timeouts++;
+		return false;
+	}
+	if (_io.spiFraming())
+	{
+		/* AN4286: the host acknowledges every ACK/NACK it receives */
+		const uint8_t ack = STM32_ACK;
+		send(&ack, 1);
+	}
+	if (resp == STM32_NACK && _m) _m->nacks++;
 	return (resp == STM32_ACK);
 }
 
-bool STM32RomBootloader::waitAckSimple(uint32_t timeoutMs)
+template <class Transport>
+bool STM32RomBootloaderT<Transport>::waitAckSimple(uint32_t timeoutMs)
 {
 	uint8_t r;
 	return waitAck(timeoutMs, r);
 }
 
-bool STM32RomBootloader::sync(uint32_t timeoutMs)
+template <class Transport>
+bool STM32RomBootloaderT<Transport>::sync(uint32_t timeoutMs)
 {
 	clearRx();
-	_io->write((uint8_t)0x7F);
-	_io->flush();
-	return waitAckSimple(timeoutMs);
+	/* UART autobauds on 0x7F; SPI sends SOF, answered with 0xA5 and then an ACK */
+	const uint8_t b = _io.spiFraming() ? STM32_SPI_SOF : 0x7F;
+	send(&b, 1);
+	if (_m) _m->syncAttempts++;
+	bool ok = waitAckSimple(timeoutMs);
+	if (!ok && _m) _m->syncFailures++;
+	return ok;
 }
 
-bool STM32RomBootloader::sendCmdByte(uint8_t cmd, uint8_t& resp)
+template <class Transport>
+bool STM32RomBootloaderT<Transport>::sendCmdByte(uint8_t cmd, uint8_t& resp)
 {
-	uint8_t buf[2] = { cmd, (uint8_t)(cmd ^ 0xFF) };
-	_io->write(buf, 2);
-	_io->flush();
+	uint8_t buf[3] = { STM32_SPI_SOF, cmd, (uint8_t)(cmd ^ 0xFF) };
+	if (_io.spiFraming()) send(buf, 3);
+	else send(buf + 1, 2);
 	return waitAck(1000, resp);
 }
 
-bool STM32RomBootloader::sendAddress(uint32_t addr)
+template <class Transport>
+bool STM32RomBootloaderT<Transport>::sendAddress(uint32_t addr, uint8_t& resp)
 {
-	uint8_t a[4];
+	uint8_t a[5];
 	a[0] = (addr >> 24) & 0xFF;
 	a[1] = (addr >> 16) & 0xFF;
 	a[2] = (addr >>  8) & 0xFF;
 	a[3] = (addr >>  0) & 0xFF;
-	uint8_t c = a[0] ^ a[1] ^ a[2] ^ a[3];
-	_io->write(a, 4);
-	_io->write(c);
-	_io->flush();
-	return waitAckSimple(1000);
+	a[4] = a[0] ^ a[1] ^ a[2] ^ a[3];
+	send(a, 5);
+	return waitAck(1000, resp);
 }
 
-bool STM32RomBootloader::getId(uint16_t& devId, String& err)
+template <class Transport>
+bool STM32RomBootloaderT<Transport>::getId(uint16_t& devId, STM32RomResult& res)
 {
 	uint8_t resp;
 	if (!sendCmdByte(STM32_CMD_GET_ID, resp))
 	{
-		err = (resp == STM32_NACK) ? "GET_ID: NACK" : "GET_ID: timeout/no ACK";
-		return false;
+		return res.fail(STM32RomResult::ackCode(resp), STM32_RO_GET_ID, STM32_ST_CMD, resp);
 	}
+	beginData();
 
 	uint8_t n;
-	if (!readByteTimeout(n, 1000)) { err = "GET_ID: timeout reading N"; return false; }
+	if (!readByteTimeout(n, 1000)) return res.fail(STM32_ERR_TIMEOUT, STM32_RO_GET_ID, STM32_ST_LEN);
 
 	uint8_t high, low;
 	if (!readByteTimeout(high, 1000) || !readByteTimeout(low, 1000))
 	{
-		err = "GET_ID: timeout reading ID bytes";
-		return false;
+		return res.fail(STM32_ERR_TIMEOUT, STM32_RO_GET_ID, STM32_ST_DATA);
 	}
 
-	uint8_t last;
-	if (!readByteTimeout(last, 1000) || last != STM32_ACK)
+	uint8_t last = 0;
+	if (!waitAck(1000, last))
 	{
-		err = "GET_ID: missing final ACK";
-		return false;
+		return res.fail(STM32RomResult::ackCode(last), STM32_RO_GET_ID, STM32_ST_FINAL_ACK, last);
 	}
 
 	devId = (uint16_t(high) << 8) | uint16_t(low);
 	return true;
 }
 
-bool STM32RomBootloader::getVersion(uint8_t& ver, uint8_t& opt1, uint8_t& opt2, String& err)
+template <class Transport>
+bool STM32RomBootloaderT<Transport>::getVersion(uint8_t& ver, uint8_t& opt1, uint8_t& opt2, STM32RomResult& res)
 {
 	uint8_t resp;
 	if (!sendCmdByte(STM32_CMD_GET_VER, resp))
 	{
-		err = "GET_VER: NACK/timeout";
-		return false;
+		return res.fail(STM32RomResult::ackCode(resp), STM32_RO_GET_VER, STM32_ST_CMD, resp);
 	}
+	beginData();
 
-	uint8_t last;
-	if (!readByteTimeout(ver, 1000))  { err = "GET_VER: timeout ver"; return false; }
-	if (!readByteTimeout(opt1, 1000)) { err = "GET_VER: timeout opt1"; return false; }
-	if (!readByteTimeout(opt2, 1000)) { err = "GET_VER: timeout opt2"; return false; }
-	if (!readByteTimeout(last, 1000) || last != STM32_ACK)
+	uint8_t last = 0;
+	if (!readByteTimeout(ver, 1000) || !readByteTimeout(opt1, 1000) || !readByteTimeout(opt2, 1000))
 	{
-		err = "GET_VER: missing final ACK";
-		return false;
+		return res.fail(STM32_ERR_TIMEOUT, STM32_RO_GET_VER, STM32_ST_DATA);
 	}
-
-	return true;
-}
-
-bool STM32RomBootloader::getSupportedCommandsText(String& out, String& err)
-{
-	uint8_t resp;
-	if (!sendCmdByte(STM32_CMD_GET, resp))
+	if (!waitAck(1000, last))
 	{
-		err = (resp == STM32_NACK) ? "GET: NACK" : "GET: timeout/no ACK";
-		return false;
-	}
-
-	uint8_t n;
-	if (!readByteTimeout(n, 1000)) { err = "GET: timeout reading N"; return false; }
-
-	uint8_t blVer;
-	if (!readByteTimeout(blVer, 1000)) { err = "GET: timeout reading version"; return false; }
-
-	out = "Protocol version = 0x";
-	out += String(blVer, HEX);
-	out += ", CMDs: ";
-
-	for (uint16_t i = 0; i < n; i++)
-	{
-		uint8_t cmd;
-		if (!readByteTimeout(cmd, 1000)) { err = "GET: timeout reading command byte"; return false; }
-		out += "0x";
-		out += String(cmd, HEX);
-		if (i < n) out += ", ";
-	}
-
-	uint8_t last;
-	if (!readByteTimeout(last, 1000) || last != STM32_ACK)
-	{
-		err = "GET: missing final ACK";
-		return false;
+		return res.fail(STM32RomResult::ackCode(last), STM32_RO_GET_VER, STM32_ST_FINAL_ACK, last);
 	}
 
 	return true;
 }
 
-bool STM32RomBootloader::getSupportedCommands(uint8_t* out, size_t& outCount, uint8_t& proto, String& err)
+template <class Transport>
+bool STM32RomBootloaderT<Transport>::getSupportedCommands(uint8_t* out, size_t cap, size_t& outCount, uint8_t& proto, STM32RomResult& res)
 {
 	outCount = 0;
 	uint8_t resp;
 	if (!sendCmdByte(STM32_CMD_GET, resp))
 	{
-		err = "GET: NACK/timeout";
-		return false;
+		return res.fail(STM32RomResult::ackCode(resp), STM32_RO_GET, STM32_ST_CMD, resp);
 	}
+	beginData();
 
 	uint8_t n;
-	if (!readByteTimeout(n, 1000)) { err = "GET: timeout N"; return false; }
-	if (!readByteTimeout(proto, 1000)) { err = "GET: timeout proto"; return false; }
+	if (!readByteTimeout(n, 1000)) return res.fail(STM32_ERR_TIMEOUT, STM32_RO_GET, STM32_ST_LEN);
+	if (!readByteTimeout(proto, 1000)) return res.fail(STM32_ERR_TIMEOUT, STM32_RO_GET, STM32_ST_DATA);
 
-	size_t want = (size_t)n;
-	String DBG;
-	DBG += "Protocol version = 0x";
-	DBG += String(proto, HEX);
-	DBG += ", CMDs: ";
-	
-	for (size_t i = 0; i < want; i++)
+	for (size_t i = 0; i < (size_t)n; i++)
 	{
 		uint8_t c;
-		if (!readByteTimeout(c, 1000)) { err = "GET: timeout cmd list"; return false; }
-		out[outCount++] = c;
-		DBG += "0x";
-		DBG += String(c, HEX);
-		if (i < (n - 1)) DBG += ", ";
+		if (!readByteTimeout(c, 1000)) return res.fail(STM32_ERR_TIMEOUT, STM32_RO_GET, STM32_ST_DATA);
+		if (outCount < cap) out[outCount++] = c;
 	}
 
-	uint8_t last;
-	if (!readByteTimeout(last, 1000) || last != STM32_ACK)
+	uint8_t last = 0;
+	if (!waitAck(1000, last))
 	{
-		err = "GET: missing final ACK";
-		return false;
+		return res.fail(STM32RomResult::ackCode(last), STM32_RO_GET, STM32_ST_FINAL_ACK, last);
 	}
-    err = DBG;
 	return true;
 }
 
-bool STM32RomBootloader::readMemory(uint32_t addr, uint8_t* buf, size_t len, String& err)
+template <class Transport>
+bool STM32RomBootloaderT<Transport>::readMemory(uint32_t addr, uint8_t* buf, size_t len, STM32RomResult& res)
 {
-	if (len == 0 || len > 256) { err = "READ: len must be 1..256"; return false; }
+	if (len == 0 || len > 256) return res.fail(STM32_ERR_BAD_ARG, STM32_RO_READ, STM32_ST_LEN, 0, addr);
 
 	uint8_t resp;
 	if (!sendCmdByte(STM32_CMD_READ, resp))
 	{
-		err = (resp == STM32_NACK) ? "READ: NACK cmd" : "READ: timeout/no ACK cmd";
-		return false;
+		return res.fail(STM32RomResult::ackCode(resp), STM32_RO_READ, STM32_ST_CMD, resp, addr);
 	}
 
-	if (!sendAddress(addr))
+	if (!sendAddress(addr, resp))
 	{
-		err = "READ: NACK/timeout address";
-		return false;
+		return res.fail(STM32RomResult::ackCode(resp), STM32_RO_READ, STM32_ST_ADDR, resp, addr);
 	}
 
 	uint8_t N = (uint8_t)(len - 1);
-	uint8_t cs = (uint8_t)(N ^ 0xFF);
-	_io->write(N);
-	_io->write(cs);
-	_io->flush();
+	uint8_t frame[2] = { N, (uint8_t)(N ^ 0xFF) };
+	send(frame, 2);
 
-	if (!waitAckSimple(1000))
+	uint32_t t0 = micros();
+	bool acked = waitAck(1000, resp);
+	if (_m) _m->recordAck(STM32_OP_READ, micros() - t0);
+	if (!acked)
 	{
-		err = "READ: NACK/timeout length";
-		return false;
+		return res.fail(STM32RomResult::ackCode(resp), STM32_RO_READ, STM32_ST_LEN, resp, addr);
 	}
 
-	for (size_t i = 0; i < len; i++)
+	beginData();
+	size_t got = readBlock(buf, len, 1000);
+	if (got < len)
 	{
-		if (!readByteTimeout(buf[i], 1000))
-		{
-			err = "READ: timeout data";
-			return false;
-		}
+		return res.fail(STM32_ERR_TIMEOUT, STM32_RO_READ, STM32_ST_DATA, 0, addr + (uint32_t)got);
 	}
 
+	if (_m) _m->bytesRead += len;
 	return true;
 }
 
-bool STM32RomBootloader::writeChunk(uint32_t addr, const uint8_t* data, size_t len, String& err)
+template <class Transport>
+bool STM32RomBootloaderT<Transport>::writeChunk(uint32_t addr, const uint8_t* data, size_t len, size_t lead, uint8_t align, STM32RomResult& res)
 {
 	if (len == 0) return true;
-	if (len > STM32_CHUNK) { err = "WRITE: len > chunk"; return false; }
+	size_t padded = (lead + len + align - 1) & ~((size_t)align - 1);
+	if (padded > STM32_CHUNK) return res.fail(STM32_ERR_BAD_ARG, STM32_RO_WRITE, STM32_ST_LEN, 0, addr);
+
+	/* Whole data frame in one buffer: N, 0xFF lead-in, data, 0xFF padding, checksum */
+	uint8_t frame[STM32_CHUNK + 2];
+	frame[0] = (uint8_t)(padded - 1);
+	memset(frame + 1, 0xFF, lead);
+	memcpy(frame + 1 + lead, data, len);
+	memset(frame + 1 + lead + len, 0xFF, padded - lead - len);
 
-	size_t padded = (len + 3) & ~((size_t)3);
-	uint8_t tmp[STM32_CHUNK];
-	for (size_t i = 0; i < padded; i++) tmp[i] = (i < len) ? data[i] : 0xFF;
+	uint8_t c = frame[0];
+	for (size_t i = 1; i <= padded; i++) c ^= frame[i];
+	frame[padded + 1] = c;
 
 	uint8_t resp;
 	if (!sendCmdByte(STM32_CMD_WRITE, resp))
 	{
-		err = (resp == STM32_NACK) ? "WRITE: NACK cmd" : "WRITE: timeout/no ACK cmd";
-		return false;
+		return res.fail(STM32RomResult::ackCode(resp), STM32_RO_WRITE, STM32_ST_CMD, resp, addr);
 	}
 
-	if (!sendAddress(addr))
+	if (!sendAddress(addr, resp))
 	{
-		err = "WRITE: NACK/timeout address";
-		return false;
+		return res.fail(STM32RomResult::ackCode(resp), STM32_RO_WRITE, STM32_ST_ADDR, resp, addr);
 	}
 
-	uint8_t N = (uint8_t)(padded - 1);
-	uint8_t c = N;
-	_io->write(N);
-	for (size_t i = 0; i < padded; i++)
-	{
-		_io->write(tmp[i]);
-		c ^= tmp[i];
-	}
-	_io->write(c);
-	_io->flush();
+	send(frame, padded + 2);
 
-	if (!waitAck(10000, resp))
+	uint32_t t0 = micros();
+	bool acked = waitAck(10000, resp);
+	if (_m) _m->recordAck(STM32_OP_WRITE, micros() - t0);
+	if (!acked)
 	{
-		err = "WRITE: timeout/no ACK data";
-		return false;
-	}
-	if (resp == STM32_NACK)
-	{
-		err = "WRITE: NACK data";
-		return false;
+		return res.fail(STM32RomResult::ackCode(resp), STM32_RO_WRITE, STM32_ST_DATA, resp, addr);
 	}
 
+	if (_m) _m->bytesProgrammed += len;
 	return true;
 }
 
-bool STM32RomBootloader::writeMemory(uint32_t addr, const uint8_t* data, size_t len, String& err, size_t chunk)
+template <class Transport>
+bool STM32RomBootloaderT<Transport>::writeMemory(uint32_t addr, const uint8_t* data, size_t len, STM32RomResult& res, size_t chunk, uint8_t align)
 {
+	if (align < STM32_WRITE_ALIGN_MIN || align > STM32_WRITE_ALIGN_MAX || (align & (align - 1)))
+	{
+		return res.fail(STM32_ERR_BAD_ARG, STM32_RO_WRITE, STM32_ST_LEN, 0, addr);
+	}
+	if (chunk > STM32_CHUNK) chunk = STM32_CHUNK;
+	chunk &= ~((size_t)align - 1);
+	if (chunk == 0) return res.fail(STM32_ERR_BAD_ARG, STM32_RO_WRITE, STM32_ST_LEN, 0, addr);
+
+	size_t lead = addr & (align - 1);
+	addr -= (uint32_t)lead;
+
 	size_t offset = 0;
 	while (offset < len)
 	{
 		size_t n = len - offset;
-		if (n > chunk) n = chunk;
+		if (n > chunk - lead) n = chunk - lead;
 
-		if (!writeChunk(addr, data + offset, n, err)) return false;
+		if (!writeChunk(addr, data + offset, n, lead, align, res)) return false;
 
-		size_t adv = (n + 3) & ~((size_t)3);
-		addr += (uint32_t)adv;
+		/* Only the last frame can be short, so this stays aligned */
+		addr += (uint32_t)(lead + n);
 		offset += n;
+		lead = 0;
 		yield();
 	}
 	return true;
 }
 
-bool STM32RomBootloader::massErase(uint8_t eraseCmd, uint32_t eraseTimeoutMs, String& err)
+template <class Transport>
+bool STM32RomBootloaderT<Transport>::massErase(uint8_t eraseCmd, uint32_t eraseTimeoutMs, STM32RomResult& res)
 {
+	STM32RomOp op = (eraseCmd == STM32_CMD_XERASE) ? STM32_RO_XERASE : STM32_RO_ERASE;
+	if (eraseCmd != STM32_CMD_ERASE && eraseCmd != STM32_CMD_XERASE)
+	{
+		return res.fail(STM32_ERR_UNSUPPORTED, op, STM32_ST_CMD, eraseCmd);
+	}
+
 	uint8_t resp;
 	if (!sendCmdByte(eraseCmd, resp))
 	{
-		err = (resp == STM32_NACK) ? "ERASE: NACK cmd" : "ERASE: timeout/no ACK cmd";
-		return false;
+		return res.fail(STM32RomResult::ackCode(resp), op, STM32_ST_CMD, resp);
 	}
 
-	if (eraseCmd == STM32_CMD_ERASE)
+	/* Global erase: 0xFF 0x00, or 0xFFFF and its checksum 0x00 for XERASE */
+	static const uint8_t frame[3] = {0xFF, 0xFF, 0x00};
+	if (eraseCmd == STM32_CMD_ERASE) send(frame + 1, 2);
+	else send(frame, 3);
+
+	uint32_t t0 = micros();
+	bool acked = waitAck(eraseTimeoutMs, resp);
+	if (_m) _m->recordAck(STM32_OP_ERASE, micros() - t0);
+	if (!acked)
 	{
-		uint8_t frame[2] = {0xFF, 0x00};
-		_io->write(frame, 2);
-		_io->flush();
+		return res.fail(STM32RomResult::ackCode(resp), op, STM32_ST_DATA, resp);
+	}
+	return true;
+}
 
-		if (!waitAck(eraseTimeoutMs, resp))
-		{
-			err = "ERASE: timeout/no ACK frame";
-			return false;
-		}
-		if (resp == STM32_NACK)
-		{
-			err = "ERASE: NACK frame";
-			return false;
-		}
-		return true;
+template <class Transport>
+bool STM32RomBootloaderT<Transport>::eraseUnits(uint8_t eraseCmd, const uint16_t* units, size_t n, uint32_t eraseTimeoutMs, STM32RomResult& res)
+{
+	bool ext = (eraseCmd == STM32_CMD_XERASE);
+	STM32RomOp op = ext ? STM32_RO_XERASE : STM32_RO_ERASE;
+	if (!ext && eraseCmd != STM32_CMD_ERASE)
+	{
+		return res.fail(STM32_ERR_UNSUPPORTED, op, STM32_ST_CMD, eraseCmd);
+	}
+	if (n == 0 || n > STM32_ERASE_UNITS_MAX)
+	{
+		return res.fail(STM32_ERR_BAD_ARG, op, STM32_ST_LEN);
+	}
+	for (size_t i = 0; i < n; i++)
+	{
+		if (!ext && units[i] > 0xFF) return res.fail(STM32_ERR_UNSUPPORTED, op, STM32_ST_DATA, 0, units[i]);
 	}
 
-	if (eraseCmd == STM32_CMD_XERASE)
+	uint8_t resp;
+	if (!sendCmdByte(eraseCmd, resp))
 	{
-		uint8_t frame[3] = {0xFF, 0xFF, 0x00};
-		_io->write(frame, 3);
-		_io->flush();
+		return res.fail(STM32RomResult::ackCode(resp), op, STM32_ST_CMD, resp);
+	}
 
-		if (!waitAck(eraseTimeoutMs, resp))
-		{
-			err = "XERASE: timeout/no ACK frame";
-			return false;
-		}
-		if (resp == STM32_NACK)
-		{
-			err = "XERASE: NACK frame";
-			return false;
-		}
-		return true;
+	/* Count - 1, unit numbers (16-bit big endian for XERASE), XOR checksum over all of it */
+	uint8_t frame[2 + 2 * STM32_ERASE_UNITS_MAX + 1];
+	size_t len = 0;
+	uint16_t count = (uint16_t)(n - 1);
+	if (ext) frame[len++] = (uint8_t)(count >> 8);
+	frame[len++] = (uint8_t)count;
+	for (size_t i = 0; i < n; i++)
+	{
+		if (ext) frame[len++] = (uint8_t)(units[i] >> 8);
+		frame[len++] = (uint8_t)units[i];
+	}
+	uint8_t cs = 0;
+	for (size_t i = 0; i < len; i++) cs ^= frame[i];
+	frame[len++] = cs;
+	send(frame, len);
+
+	uint32_t t0 = micros();
+	bool acked = waitAck(eraseTimeoutMs, resp);
+	if (_m) _m->recordAck(STM32_OP_ERASE, micros() - t0);
+	if (!acked)
+	{
+		return res.fail(STM32RomResult::ackCode(resp), op, STM32_ST_DATA, resp, units[0]);
+	}
+	return true;
+}
+
+template <class Transport>
+bool STM32RomBootloaderT<Transport>::go(uint32_t addr, STM32RomResult& res)
+{
+	uint8_t resp;
+	if (!sendCmdByte(STM32_CMD_GO, resp))
+	{
+		return res.fail(STM32RomResult::ackCode(resp), STM32_RO_GO, STM32_ST_CMD, resp, addr);
 	}
 
-	err = "ERASE: unsupported eraseCmd";
-	return false;
+	if (!sendAddress(addr, resp))
+	{
+		return res.fail(STM32RomResult::ackCode(resp), STM32_RO_GO, STM32_ST_ADDR, resp, addr);
+	}
+	return true;
 }
+
+template class STM32RomBootloaderT<STM32StreamTransport>;
+#ifdef ESP8266
+template class STM32RomBootloaderT<STM32SerialTransport>;
+template class STM32RomBootloaderT<STM32UartTransport>;
+template class STM32RomBootloaderT<STM32SpiTransport>;
+template class STM32RomBootloaderT<STM32EspTransport>;
+#endif
@@ -11,37 +11,82 @@
 
 #include <Arduino.h>
 #include "STM32DeviceConstants.h"
+#include "STM32FlasherMetrics.h"
+#include "STM32RomResult.h"
+#include "STM32RomTransport.h"
+#include "STM32FrameTracer.h"
 
-class STM32RomBootloader
+/* AN3155 (UART) protocol over any transport (see STM32RomTransport.h); transports that report
+   spiFraming() get the AN4286 SPI variant of the same commands. Member definitions live in
+   STM32RomBootloader.cpp and are instantiated there for each transport the library ships. */
+template <class Transport>
+class STM32RomBootloaderT
 {
 	public:
-	explicit STM32RomBootloader(Stream& io);
+	explicit STM32RomBootloaderT(Transport io);
+
+	void setMetrics(STM32FlasherMetrics* metrics);
+	/* Every frame sent and byte read goes to the tracer while it is enabled; nullptr (the
+	   default) leaves one pointer test per write/read */
+	void setTracer(STM32FrameTracer* tracer) { _trace = tracer; }
+	STM32FrameTracer* tracer() const { return _trace; }
+	Transport& transport();
 
 	void clearRx();
 	bool sync(uint32_t timeoutMs);
 
-	bool getId(uint16_t& devId, String& err);
-	bool getVersion(uint8_t& ver, uint8_t& opt1, uint8_t& opt2, String& err);
-	bool getSupportedCommandsText(String& out, String& err);
-	bool getSupportedCommands(uint8_t* out, size_t& outCount, uint8_t& proto, String& err);
+	bool getId(uint16_t& devId, STM32RomResult& res);
+	bool getVersion(uint8_t& ver, uint8_t& opt1, uint8_t& opt2, STM32RomResult& res);
+	/* Commands beyond `cap` are read and dropped; outCount is the number stored */
+	bool getSupportedCommands(uint8_t* out, size_t cap, size_t& outCount, uint8_t& proto, STM32RomResult& res);
+
+	bool readMemory(uint32_t addr, uint8_t* buf, size_t len, STM32RomResult& res);
+	/* Frames start and end on `align` bytes (a power of two, 4..32): an unaligned addr is moved down
+	   and the gap sent as 0xFF, the tail is padded with 0xFF, and every frame in between is `chunk`
+	   bytes (rounded down to `align`) */
+	bool writeMemory(uint32_t addr, const uint8_t* data, size_t len, STM32RomResult& res, size_t chunk = STM32_CHUNK, uint8_t align = STM32_WRITE_ALIGN_MIN);
+
+	bool massErase(uint8_t eraseCmd, uint32_t eraseTimeoutMs, STM32RomResult& res);
+	/* Erases up to STM32_ERASE_UNITS_MAX pages/sectors by number in one command; ERASE (0x43)
+	   can only address units below 256 */
+	bool eraseUnits(uint8_t eraseCmd, const uint16_t* units, size_t n, uint32_t eraseTimeoutMs, STM32RomResult& res);
 
-	bool readMemory(uint32_t addr, uint8_t* buf, size_t len, String& err);
-	bool writeMemory(uint32_t addr, const uint8_t* data, size_t len, String& err, size_t chunk = STM32_CHUNK);
+	/* Jumps to addr; the ROM loads SP from addr and PC from addr + 4 and stops answering */
+	bool go(uint32_t addr, STM32RomResult& res);
 
-	bool massErase(uint8_t eraseCmd, uint32_t eraseTimeoutMs, String& err);
+	/* Reads up to len bytes, giving up after timeoutMs without progress; returns the count read */
+	size_t readBlock(uint8_t* buf, size_t len, uint32_t timeoutMs);
 
 	private:
-	Stream* _io;
+	Transport _io;
+	STM32FlasherMetrics* _m;
+	STM32FrameTracer* _trace;
+
+	/* Write and flush one frame */
+	void send(const uint8_t* data, size_t len);
+	void traceRx(const uint8_t* data, size_t len) { if (_trace) _trace->rx(data, len); }
 
 	bool readByteTimeout(uint8_t& b, uint32_t timeoutMs);
+	/* SPI: clock dummy bytes until the target answers ACK or NACK */
+	bool pollAckByte(uint8_t& b, uint32_t timeoutMs);
+	/* SPI: a dummy byte precedes the data the target sends back */
+	void beginData();
 	bool waitAck(uint32_t timeoutMs, uint8_t& resp);
 	bool waitAckSimple(uint32_t timeoutMs);
 
 	bool sendCmdByte(uint8_t cmd, uint8_t& resp);
-	bool sendAddress(uint32_t addr);
+	bool sendAddress(uint32_t addr, uint8_t& resp);
 
-	bool writeChunk(uint32_t addr, const uint8_t* data, size_t len, String& err);
+	/* One WRITE frame at addr: `lead` bytes of 0xFF, then data, padded to `align` */
+	bool writeChunk(uint32_t addr, const uint8_t* data, size_t len, size_t lead, uint8_t align, STM32RomResult& res);
 };
 
+typedef STM32RomBootloaderT<STM32StreamTransport> STM32RomBootloader;
+#ifdef ESP8266
+typedef STM32RomBootloaderT<STM32SerialTransport> STM32SerialBootloader;
+typedef STM32RomBootloaderT<STM32UartTransport> STM32UartBootloader;
+typedef STM32RomBootloaderT<STM32SpiTransport> STM32SpiBootloader;
+#endif
+
 
 #endif	/* STM32_ROM_BOOTLOADER_H */
\ No newline at end of file
@@ -7,13 +7,25 @@
 
 
 #include "STM32RomFlasher.h"
+#include "STM32StubImages.h"
 
-STM32RomFlasher::STM32RomFlasher(Stream& io, uint8_t boot0Pin, uint8_t resetPin)
-: _io(&io),
-_boot0(boot0Pin),
+static const uint8_t SYNC_ATTEMPTS = 3;
+/* Least stack left above a RAM image whose initial SP had to be patched */
+static const uint32_t RAM_RUN_STACK_MIN = 256;
+
+#if STM32_STUB_SUPPORT
+/* Stub frames stay in flight until acknowledged, so they live here rather than on the 4 KB stack.
+   Slots are indexed by seq % STM32_STUB_WINDOW, which needs the window to divide 256. */
+static uint8_t s_stubFrames[STM32_STUB_WINDOW][STM32_STUB_FRAME_MAX];
+#endif
+
+template <class Transport>
+STM32RomFlasherT<Transport>::STM32RomFlasherT(Transport io, uint8_t boot0Pin, uint8_t resetPin)
+: _boot0(boot0Pin),
 _reset(resetPin),
 _bl(io),
-_fi((STM32FamilyInfo){STM32_UNKNOWN, 0, 0, F1_FLASH_SIZE_ADDR, 15000, 0x43, true, 0x08000000, 0x20000200, "STM32 Unknown"}),
+_fi((STM32FamilyInfo){STM32_UNKNOWN, 0, 0, F1_FLASH_SIZE_ADDR, 15000, 0x43, true, 0x08000000, 0x20000200, 0, "STM32 Unknown"}),
+_m(nullptr),
 _connected(false),
 _devId(0),
 _flashKb(0),
@@ -21,11 +33,19 @@ _eraseCmd(0x43),
 _eraseTimeout(15000),
 _flashStart(STM32_FLASH_START_DEFAULT),
 _sramAddr(0x20000200),
-_desc("")
+_writeAlign(STM32_WRITE_ALIGN_MIN),
+_hasUid(false),
+_stubEnabled(false),
+_stubImage(nullptr),
+_holdSession(false),
+_synced(false),
+_started(false)
 {
+	_desc[0] = '\0';
 }
 
-void STM32RomFlasher::beginPins()
+template <class Transport>
+void STM32RomFlasherT<Transport>::beginPins()
 {
 	pinMode(_boot0, OUTPUT);
 	pinMode(_reset, OUTPUT);
@@ -33,7 +53,8 @@ void STM32RomFlasher::beginPins()
 	digitalWrite(_reset, HIGH);
 }
 
-void STM32RomFlasher::enterRomBootloader()
+template <class Transport>
+void STM32RomFlasherT<Transport>::enterRomBootloader()
 {
 	digitalWrite(_boot0, HIGH);
 	digitalWrite(_reset, LOW);
@@ -43,8 +64,10 @@ void STM32RomFlasher::enterRomBootloader()
 	_bl.clearRx();
 }
 
-void STM32RomFlasher::exitToUserApp()
+template <class Transport>
+void STM32RomFlasherT<Transport>::exitToUserApp()
 {
+	_synced = false;
 	digitalWrite(_boot0, LOW);
 	digitalWrite(_reset, LOW);
 	delay(50);
@@ -52,7 +75,36 @@ void STM32RomFlasher::exitToUserApp()
 	delay(120);
 }
 
-bool STM32RomFlasher::computeEraseFromSupported(const uint8_t* cmds, size_t n, uint8_t& eraseCmdOut)
+template <class Transport>
+void STM32RomFlasherT<Transport>::setMetrics(STM32FlasherMetrics* metrics)
+{
+	_m = metrics;
+	_bl.setMetrics(metrics);
+}
+
+
+template <class Transport>
+bool STM32RomFlasherT<Transport>::openSession(STM32RomResult& res)
+{
+	STM32PhaseTimer t(_m, STM32_PHASE_SYNC);
+	if (_holdSession && _synced) return true;
+	for (uint8_t attempt = 0; attempt < SYNC_ATTEMPTS; attempt++)
+	{
+		if (attempt > 0 && _m) _m->retries++;
+		enterRomBootloader();
+		if (_bl.sync(1000))
+		{
+			_synced = true;
+			_started = false;
+			return true;
+		}
+	}
+	exitToUserApp();
+	return res.fail(STM32_ERR_TIMEOUT, STM32_RO_SYNC, STM32_ST_NONE);
+}
+
+template <class Transport>
+bool STM32RomFlasherT<Transport>::computeEraseFromSupported(const uint8_t* cmds, size_t n, uint8_t& eraseCmdOut)
 {
 	bool has43 = false;
 	bool has44 = false;
@@ -66,36 +118,28 @@ bool STM32RomFlasher::computeEraseFromSupported(const uint8_t* cmds, size_t n, u
 	return false;
 }
 
-bool STM32RomFlasher::detect(String& desc, String& err)
+template <class Transport>
+bool STM32RomFlasherT<Transport>::detect(STM32RomResult& res)
 {
-	err = "";
-	desc = "";
 	_connected = false;
+	_desc[0] = '\0';
+	_hasUid = false;
 
-	enterRomBootloader();
-
-	if (!_bl.sync(1000))
-	{
-		exitToUserApp();
-		err = "SYNC failed";
-		return false;
-	}
+	if (!openSession(res)) return false;
 
 	uint16_t dev;
-	if (!_bl.getId(dev, err))
+	if (!_bl.getId(dev, res))
 	{
-		exitToUserApp();
+		finishJob();
 		return false;
 	}
 
 	uint8_t cmds[64];
 	size_t cmdCount = 0;
 	uint8_t proto = 0;
-	String getErr;
-	if (!_bl.getSupportedCommands(cmds, cmdCount, proto, getErr))
+	if (!_bl.getSupportedCommands(cmds, sizeof(cmds), cmdCount, proto, res))
 	{
-		exitToUserApp();
-		err = getErr;
+		finishJob();
 		return false;
 	}
 
@@ -109,77 +153,389 @@ bool STM32RomFlasher::detect(String& desc, String& err)
 
 	_fi = fi;
 	_devId = dev;
-	_flashKb = fi.FlashSize;
+	/* The table has the largest part sharing the ID; the flash size register has this one's. A NACK
+	   (read protection) or an unprogrammed register keeps the table's size. */
+	uint16_t kb = 0;
+	STM32RomResult sizeRes;
+	_flashKb = (readFlashSizeReg(kb, sizeRes) && kb != 0 && kb != 0xFFFF) ? kb : fi.FlashSize;
 	_eraseCmd = fi.eraseCmd;
 	_eraseTimeout = fi.eraseTimeout;
 	_flashStart = fi.flashStart;
 	_sramAddr = fi.sramTestAddr;
 
-	_desc = String(fi.name) + " (ID: 0x" + String(dev, HEX) + ", Flash: " + String(_flashKb) + "KB)";
-	desc = _desc;
+	uint8_t unit = STM32FamilyDb::getFlashGeometry(fi, _flashKb).programUnit;
+	_writeAlign = (unit < STM32_WRITE_ALIGN_MIN) ? STM32_WRITE_ALIGN_MIN : (unit > STM32_WRITE_ALIGN_MAX) ? STM32_WRITE_ALIGN_MAX : unit;
+
+	/* Only identifies the board in the flash history, so a protected part still connects */
+	uint32_t uidAddr = STM32FamilyDb::getUidAddr(fi.family);
+	uint32_t word2 = STM32FamilyDb::getUidWord2Offset(fi.family);
+	STM32RomResult uidRes;
+	if (word2 == 8) _hasUid = uidAddr && _bl.readMemory(uidAddr, _uid, sizeof(_uid), uidRes);
+	else _hasUid = uidAddr && _bl.readMemory(uidAddr, _uid, 8, uidRes) && _bl.readMemory(uidAddr + word2, _uid + 8, 4, uidRes);
+
+	snprintf(_desc, sizeof(_desc), "%s (ID: 0x%x, Flash: %uKB)", fi.name, dev, (unsigned)_flashKb);
 	_connected = true;
 	return true;
 }
 
-bool STM32RomFlasher::massErase(String& err)
+template <class Transport>
+bool STM32RomFlasherT<Transport>::massErase(STM32RomResult& res)
 {
-	err = "";
-	enterRomBootloader();
-	if (!_bl.sync(1000))
+	if (!openSession(res)) return false;
+	STM32PhaseTimer t(_m, STM32_PHASE_ERASE);
+	if (!_bl.massErase(_eraseCmd, _eraseTimeout, res))
 	{
-		exitToUserApp();
-		err = "SYNC failed";
+		finishJob();
 		return false;
 	}
-	if (!_bl.massErase(_eraseCmd, _eraseTimeout, err))
+	return true;
+}
+
+template <class Transport>
+bool STM32RomFlasherT<Transport>::flashBuffer(uint32_t addr, const uint8_t* data, size_t len, STM32RomResult& res)
+{
+	uint8_t align;
+	if (!alignFor(addr, align, STM32_RO_WRITE, res)) return false;
+	if (!openSession(res)) return false;
+	STM32PhaseTimer t(_m, STM32_PHASE_PROGRAM);
+	return _bl.writeMemory(addr, data, len, res, STM32_CHUNK, align);
+}
+
+template <class Transport>
+bool STM32RomFlasherT<Transport>::alignFor(uint32_t addr, uint8_t& align, STM32RomOp op, STM32RomResult& res) const
+{
+	uint32_t flashEnd = _flashStart + (uint32_t)_flashKb * 1024UL;
+	if (addr >= _flashStart && addr < flashEnd)
 	{
-		exitToUserApp();
-		return false;
+		align = _writeAlign;
+		return true;
 	}
+	align = STM32_WRITE_ALIGN_MIN;
+	if (addr & (align - 1)) return res.fail(STM32_ERR_BAD_ARG, op, STM32_ST_ADDR, 0, addr);
 	return true;
 }
 
-bool STM32RomFlasher::flashBuffer(uint32_t addr, const uint8_t* data, size_t len, String& err)
+template <class Transport>
+size_t STM32RomFlasherT<Transport>::readSource(Stream& src, uint8_t* buf, size_t len)
 {
-	err = "";
-	enterRomBootloader();
-	if (!_bl.sync(1000))
+	STM32PhaseTimer t(_m, STM32_PHASE_FS_READ);
+	size_t got = 0;
+	while (got < len)
 	{
-		exitToUserApp();
-		err = "SYNC failed";
-		return false;
+		size_t n = src.readBytes(buf + got, len - got);
+		if (n == 0) break;
+		got += n;
 	}
-	return _bl.writeMemory(addr, data, len, err, STM32_CHUNK);
+	return got;
 }
 
-bool STM32RomFlasher::testRam(String& out)
+template <class Transport>
+bool STM32RomFlasherT<Transport>::programStream(Stream& src, uint32_t addr, size_t& written, STM32RomResult& res)
 {
-	out = "";
-	String err;
+	written = 0;
+	uint8_t align;
+	if (!alignFor(addr, align, STM32_RO_WRITE, res)) return false;
+	if (!openSession(res)) return false;
+	STM32PhaseTimer t(_m, STM32_PHASE_PROGRAM);
+
+#if STM32_STUB_SUPPORT
+	const STM32StubImage* stub = stubImage();
+	if (stub)
+	{
+		STM32StubHello hello;
+		if (startStub(*stub, hello, res))
+		{
+			if (_m) _m->stubSessions++;
+			bool ok = programViaStub(src, addr, align, hello, written, res);
+			_synced = false;	/* the stub owns the line now; a further job resets into the ROM */
+			finishJob();
+			return ok;
+		}
 
-	enterRomBootloader();
-	if (!_bl.sync(1000))
+		/* Nothing has been read from src yet, and the ROM bootloader is one reset away. A held
+		   session must not reuse the old sync: whatever is running now is not the ROM. */
+		if (_m) _m->stubFallbacks++;
+		res.clear();
+		_synced = false;
+		if (!openSession(res)) return false;
+	}
+#endif
+
+	/* The first frame takes the 0xFF lead-in of an unaligned addr; the rest are whole frames */
+	uint8_t buf[STM32_CHUNK];
+	size_t want = STM32_CHUNK - (addr & (align - 1));
+	while (true)
 	{
-		exitToUserApp();
-		out = "SYNC failed";
-		return false;
+		size_t n = readSource(src, buf, want);
+		if (n == 0) break;
+
+		if (!_bl.writeMemory(addr, buf, n, res, STM32_CHUNK, align))
+		{
+			finishJob();
+			return false;
+		}
+
+		addr += (uint32_t)n;
+		written += n;
+		want = STM32_CHUNK;
+		yield();
 	}
 
+	finishJob();
+	return true;
+}
+
+template <class Transport>
+const STM32StubImage* STM32RomFlasherT<Transport>::stubImage()
+{
+	/* The stub talks to the USART the ROM bootloader set up; it has no SPI slave code */
+	if (!STM32_STUB_SUPPORT || !_stubEnabled || _bl.transport().spiFraming()) return nullptr;
+	const STM32StubImage* image = _stubImage ? _stubImage : STM32StubImages::find(_fi.family);
+	if (!image || image->len < STM32_STUB_HEADER_LEN) return nullptr;
+
+	/* The stub runs from loadAddr up to its initial SP (header word 0), which has to be free SRAM on
+	   this part; a family's stub is linked for its larger members, e.g. not for a 6 KB F1 */
+	uint32_t start, end;
+	uint8_t sp[4];
+	memcpy_P(sp, image->data, sizeof(sp));
+	uint32_t top = STM32StubCodec::get32(sp);
+	if (!ramRegion(start, end) || image->loadAddr < start || top > end || top < image->loadAddr + image->len) return nullptr;
+	return image;
+}
+
+#if STM32_STUB_SUPPORT
+
+template <class Transport>
+bool STM32RomFlasherT<Transport>::startStub(const STM32StubImage& image, STM32StubHello& hello, STM32RomResult& res)
+{
+	uint8_t buf[STM32_CHUNK];
+	for (size_t off = 0; off < image.len; off += STM32_CHUNK)
+	{
+		size_t n = image.len - off;
+		if (n > STM32_CHUNK) n = STM32_CHUNK;
+		memcpy_P(buf, image.data + off, n);
+		if (!_bl.writeMemory(image.loadAddr + (uint32_t)off, buf, n, res)) return false;
+	}
+
+	if (!_bl.go(image.loadAddr, res)) return false;
+	/* From here on the ROM is gone whether or not the stub answers */
+	_synced = false;
+
+	uint8_t b[STM32_STUB_HELLO_LEN];
+	if (_bl.readBlock(b, sizeof(b), STM32_STUB_HELLO_MS) < sizeof(b))
+	{
+		return res.fail(STM32_ERR_TIMEOUT, STM32_RO_STUB, STM32_ST_NONE, 0, image.loadAddr);
+	}
+	if (!STM32StubCodec::parseHello(b, hello))
+	{
+		return res.fail(STM32_ERR_BAD_RESPONSE, STM32_RO_STUB, STM32_ST_NONE, b[0], image.loadAddr);
+	}
+	return true;
+}
+
+template <class Transport>
+void STM32RomFlasherT<Transport>::drainQuiet()
+{
+	Transport& io = _bl.transport();
+	uint8_t junk[32];
+	while (io.waitAvailable(1, STM32_STUB_QUIET_MS))
+	{
+		while (io.read(junk, sizeof(junk))) {}
+	}
+}
+
+template <class Transport>
+bool STM32RomFlasherT<Transport>::programViaStub(Stream& src, uint32_t addr, uint8_t align, const STM32StubHello& hello, size_t& written, STM32RomResult& res)
+{
+	Transport& io = _bl.transport();
+	uint8_t window = (hello.window < STM32_STUB_WINDOW) ? hello.window : STM32_STUB_WINDOW;
+	size_t block = ((hello.block < STM32_STUB_BLOCK) ? hello.block : STM32_STUB_BLOCK) & ~((size_t)align - 1);
+	if (block == 0) return res.fail(STM32_ERR_BAD_RESPONSE, STM32_RO_STUB, STM32_ST_NONE);
+	size_t lead = addr & (align - 1);
+	bool rle = (hello.caps & STM32_STUB_CAP_RLE) != 0;
+
+	uint32_t frameAddr[STM32_STUB_WINDOW];
+	size_t frameData[STM32_STUB_WINDOW];
+	size_t frameLen[STM32_STUB_WINDOW];
+	uint32_t sentUs[STM32_STUB_WINDOW];
+
+	uint8_t base = 0;	/* oldest unacknowledged seq */
+	uint8_t next = 0;	/* seq of the next new frame */
+	uint8_t retries = 0;
+	bool eof = false;
+
+	while (true)
+	{
+		while (!eof && (uint8_t)(next - base) < window)
+		{
+			uint8_t slot = next % STM32_STUB_WINDOW;
+			uint8_t* frame = s_stubFrames[slot];
+			uint8_t* data = STM32StubCodec::frameData(frame);
+			size_t n = readSource(src, data + lead, block - lead);
+			if (n == 0)
+			{
+				eof = true;
+				break;
+			}
+
+			/* Same 0xFF lead-in and padding to the programming unit as the ROM WRITE path */
+			size_t padded = (lead + n + align - 1) & ~((size_t)align - 1);
+			memset(data, 0xFF, lead);
+			memset(data + lead + n, 0xFF, padded - lead - n);
+
+			frameAddr[slot] = addr - (uint32_t)lead;
+			frameData[slot] = n;
+			frameLen[slot] = STM32StubCodec::buildFrame(frame, next, frameAddr[slot], padded, rle);
+			io.write(frame, frameLen[slot]);
+			sentUs[slot] = micros();
+
+			addr += (uint32_t)n;
+			lead = 0;
+			next++;
+		}
+		uint8_t outstanding = (uint8_t)(next - base);
+		if (outstanding == 0) break;
+
+		uint8_t r[STM32_STUB_REPLY_LEN] = { 0, 0, 0 };
+		size_t got = _bl.readBlock(r, sizeof(r), STM32_STUB_REPLY_MS);
+		bool valid = (got == sizeof(r) && r[2] == (uint8_t)(r[0] ^ r[1] ^ 0xFF));
+		uint8_t ahead = (uint8_t)(r[0] - base);
+
+		/* An OK for seq, or a NAK expecting seq, both mean every frame before it is in flash */
+		uint8_t done = 0;
+		if (valid && r[1] == STM32_STUB_OK && ahead < outstanding) done = (uint8_t)(ahead + 1);
+		else if (valid && r[1] == STM32_STUB_ERR_CRC && ahead <= outstanding) done = ahead;
+		else if (valid && r[1] == STM32_STUB_OK) continue;	/* late OK for a frame already counted */
+
+		for (uint8_t i = 0; i < done; i++, base++)
+		{
+			uint8_t slot = base % STM32_STUB_WINDOW;
+			if (_m)
+			{
+				_m->recordAck(STM32_OP_WRITE, micros() - sentUs[slot]);
+				_m->bytesProgrammed += (uint32_t)frameData[slot];
+			}
+			written += frameData[slot];
+		}
+		if (done) retries = 0;
+		if (valid && r[1] == STM32_STUB_OK) continue;
+
+		uint32_t failAddr = frameAddr[base % STM32_STUB_WINDOW];
+		if (valid && r[1] != STM32_STUB_ERR_CRC)
+		{
+			STM32RomCode code = STM32_ERR_BAD_RESPONSE;
+			if (r[1] == STM32_STUB_ERR_PROGRAM) code = STM32_ERR_VERIFY;
+			else if (r[1] == STM32_STUB_ERR_RANGE) code = STM32_ERR_BAD_ARG;
+			return res.fail(code, STM32_RO_STUB, STM32_ST_DATA, r[1], failAddr);
+		}
+
+		/* NAK, garbled or missing reply: go back to the oldest unacknowledged frame */
+		if (base == next) continue;
+		if (++retries > STM32_STUB_RETRIES)
+		{
+			return res.fail(got ? STM32_ERR_BAD_RESPONSE : STM32_ERR_TIMEOUT, STM32_RO_STUB, STM32_ST_DATA, got ? r[1] : 0, failAddr);
+		}
+		drainQuiet();
+		for (uint8_t seq = base; seq != next; seq++)
+		{
+			uint8_t slot = seq % STM32_STUB_WINDOW;
+			io.write(s_stubFrames[slot], frameLen[slot]);
+			sentUs[slot] = micros();
+			if (_m) _m->stubRetransmits++;
+		}
+		yield();
+	}
+	return true;
+}
+
+#endif
+
+template <class Transport>
+bool STM32RomFlasherT<Transport>::verifyStream(Stream& src, uint32_t addr, size_t& verified, STM32RomResult& res)
+{
+	verified = 0;
+	if (!openSession(res)) return false;
+	STM32PhaseTimer t(_m, STM32_PHASE_READ);
+
+	uint8_t want[STM32_CHUNK];
+	uint8_t got[STM32_CHUNK];
+	while (true)
+	{
+		size_t n = readSource(src, want, STM32_CHUNK);
+		if (n == 0) break;
+
+		if (!_bl.readMemory(addr, got, n, res))
+		{
+			finishJob();
+			return false;
+		}
+
+		for (size_t i = 0; i < n; i++)
+		{
+			if (got[i] != want[i])
+			{
+				finishJob();
+				return res.fail(STM32_ERR_VERIFY, STM32_RO_VERIFY, STM32_ST_DATA, got[i], addr + (uint32_t)i);
+			}
+		}
+
+		addr += (uint32_t)n;
+		verified += n;
+		yield();
+	}
+
+	finishJob();
+	return true;
+}
+
+template <class Transport>
+bool STM32RomFlasherT<Transport>::readToStream(uint32_t addr, size_t len, Print& dst, STM32RomResult& res)
+{
+	if (!openSession(res)) return false;
+	STM32PhaseTimer t(_m, STM32_PHASE_READ);
+
+	uint8_t buf[STM32_CHUNK];
+	while (len)
+	{
+		size_t n = (len < STM32_CHUNK) ? len : STM32_CHUNK;
+		if (!_bl.readMemory(addr, buf, n, res))
+		{
+			finishJob();
+			return false;
+		}
+		if (dst.write(buf, n) != n)
+		{
+			finishJob();
+			return res.fail(STM32_ERR_SOURCE, STM32_RO_READ, STM32_ST_NONE, 0, addr);
+		}
+
+		addr += (uint32_t)n;
+		len -= n;
+		yield();
+	}
+
+	finishJob();
+	return true;
+}
+
+template <class Transport>
+bool STM32RomFlasherT<Transport>::testRam(STM32RomResult& res)
+{
+	if (!openSession(res)) return false;
+
 	uint8_t tx[16];
 	for (int i = 0; i < 16; i++) tx[i] = (uint8_t)(0x10 + i);
 
-	if (!_bl.writeMemory(_sramAddr, tx, sizeof(tx), err))
+	if (!_bl.writeMemory(_sramAddr, tx, sizeof(tx), res))
 	{
-		exitToUserApp();
-		out = "RAM write failed: " + err;
+		finishJob();
 		return false;
 	}
 
 	uint8_t rx[16];
-	if (!_bl.readMemory(_sramAddr, rx, sizeof(rx), err))
+	if (!_bl.readMemory(_sramAddr, rx, sizeof(rx), res))
 	{
-		exitToUserApp();
-		out = "RAM read failed: " + err;
+		finishJob();
 		return false;
 	}
 
@@ -187,54 +543,204 @@ bool STM32RomFlasher::testRam(String& out)
 	{
 		if (rx[i] != tx[i])
 		{
-			out = "RAM mismatch at index " + String(i);
-			return false;
+			return res.fail(STM32_ERR_VERIFY, STM32_RO_RAM_TEST, STM32_ST_DATA, rx[i], _sramAddr + (uint32_t)i);
 		}
 	}
 
-	out = "RAM Write/Read at 0x" + String(_fi.sramTestAddr ,HEX) + " OK";
 	return true;
 }
 
-bool STM32RomFlasher::readFlashSizeKB(uint16_t& outKb, String& err)
+template <class Transport>
+bool STM32RomFlasherT<Transport>::runFromRam(Stream& src, size_t len, uint32_t& addr, STM32RomResult& res)
 {
-	err = "";
-	outKb = 0;
+	uint32_t start, end;
+	if (!ramRegion(start, end)) return res.fail(STM32_ERR_UNSUPPORTED, STM32_RO_RAM_RUN, STM32_ST_NONE);
+	if (addr == 0) addr = start;
+	if ((addr & 3) || addr < start || addr >= end || len < 8 || ((len + 3) & ~((size_t)3)) > end - addr)
+	{
+		return res.fail(STM32_ERR_BAD_ARG, STM32_RO_RAM_RUN, STM32_ST_ADDR, 0, addr);
+	}
+
+	uint8_t buf[STM32_CHUNK];
+	size_t n = (len < STM32_CHUNK) ? len : STM32_CHUNK;
+	if (readSource(src, buf, n) < n) return res.fail(STM32_ERR_SOURCE, STM32_RO_RAM_RUN, STM32_ST_DATA, 0, addr);
+
+	/* GO loads MSP from the first word and jumps to the second; VTOR is left for the image to set */
+	uint32_t sp = (uint32_t)buf[0] | ((uint32_t)buf[1] << 8) | ((uint32_t)buf[2] << 16) | ((uint32_t)buf[3] << 24);
+	uint32_t entry = (uint32_t)buf[4] | ((uint32_t)buf[5] << 8) | ((uint32_t)buf[6] << 16) | ((uint32_t)buf[7] << 24);
+	if (!(entry & 1) || entry - 1 < addr || entry - 1 >= addr + len)
+	{
+		return res.fail(STM32_ERR_BAD_ARG, STM32_RO_RAM_RUN, STM32_ST_DATA, 0, entry);
+	}
+	bool spInImage = (sp > addr && sp <= addr + len);
+	if ((sp & 3) || sp <= start || sp > end || spInImage)
+	{
+		if (end - (addr + len) < RAM_RUN_STACK_MIN)
+		{
+			return res.fail(STM32_ERR_BAD_ARG, STM32_RO_RAM_RUN, STM32_ST_DATA, 0, sp);
+		}
+		sp = end & ~((uint32_t)7);
+		for (uint8_t i = 0; i < 4; i++) buf[i] = (uint8_t)(sp >> (8 * i));
+	}
+
+	if (!openSession(res)) return false;
+	STM32PhaseTimer t(_m, STM32_PHASE_PROGRAM);
+
+	uint32_t at = addr;
+	size_t loaded = 0;
+	while (true)
+	{
+		if (!_bl.writeMemory(at, buf, n, res))
+		{
+			finishJob();
+			return false;
+		}
+		at += (uint32_t)n;
+		loaded += n;
+		if (loaded == len) break;
 
-	enterRomBootloader();
-	if (!_bl.sync(1000))
+		size_t want = len - loaded;
+		if (want > STM32_CHUNK) want = STM32_CHUNK;
+		if ((n = readSource(src, buf, want)) < want)
+		{
+			finishJob();
+			return res.fail(STM32_ERR_SOURCE, STM32_RO_RAM_RUN, STM32_ST_DATA, 0, at);
+		}
+		yield();
+	}
+
+	return startImage(addr, res);
+}
+
+template <class Transport>
+bool STM32RomFlasherT<Transport>::go(uint32_t addr, STM32RomResult& res)
+{
+	if (!openSession(res)) return false;
+	return startImage(addr, res);
+}
+
+template <class Transport>
+bool STM32RomFlasherT<Transport>::startImage(uint32_t addr, STM32RomResult& res)
+{
+	if (!_bl.go(addr, res))
 	{
-		exitToUserApp();
-		err = "SYNC failed";
+		finishJob();
 		return false;
 	}
 
-	uint8_t b[2];
-	if (!_bl.readMemory(_fi.flashSizeAddr, b, 2, err))
+	/* Leave NRST alone so the image keeps running; the next reset boots from flash again */
+	digitalWrite(_boot0, LOW);
+	_synced = false;
+	_started = true;
+	return true;
+}
+
+template <class Transport>
+bool STM32RomFlasherT<Transport>::eraseRange(uint32_t addr, uint32_t len, uint32_t& units, STM32RomResult& res)
+{
+	units = 0;
+	STM32FlashGeometry g = STM32FamilyDb::getFlashGeometry(_fi, _flashKb);
+	uint32_t flashBytes = (uint32_t)_flashKb * 1024UL;
+	uint32_t off = addr - _flashStart;
+	if (!_connected) return res.fail(STM32_ERR_NOT_CONNECTED, STM32_RO_ERASE, STM32_ST_NONE);
+	if (addr < _flashStart || off >= flashBytes || len == 0 || len > flashBytes - off)
 	{
-		exitToUserApp();
+		return res.fail(STM32_ERR_BAD_ARG, STM32_RO_ERASE, STM32_ST_ADDR, 0, addr);
+	}
+
+	if (!openSession(res)) return false;
+	STM32PhaseTimer t(_m, STM32_PHASE_ERASE);
+
+	/* Every unit overlapping [off, off + len), sent in groups of STM32_ERASE_UNITS_MAX */
+	uint16_t group[STM32_ERASE_UNITS_MAX];
+	size_t n = 0;
+	uint32_t groupMs = 0;
+	uint32_t unitOff, unitSize;
+	for (uint32_t i = 0; STM32FamilyDb::eraseUnit(g, flashBytes, i, unitOff, unitSize); i++)
+	{
+		bool last = (unitOff + unitSize >= off + len);
+		if (unitOff + unitSize > off)
+		{
+			group[n++] = STM32FamilyDb::eraseUnitNumber(g, flashBytes, i);
+			groupMs += STM32FamilyDb::eraseUnitMs(g, unitSize);
+		}
+		if (n == STM32_ERASE_UNITS_MAX || (last && n))
+		{
+			/* Datasheet typicals; allow for slow parts and the command overhead */
+			if (!_bl.eraseUnits(_eraseCmd, group, n, 2 * groupMs + 1000, res))
+			{
+				finishJob();
+				return false;
+			}
+			units += (uint32_t)n;
+			n = 0;
+			groupMs = 0;
+		}
+		if (last) break;
+	}
+	return true;
+}
+
+template <class Transport>
+void STM32RomFlasherT<Transport>::beginSession()
+{
+	_holdSession = true;
+	_started = false;
+}
+
+template <class Transport>
+void STM32RomFlasherT<Transport>::endSession()
+{
+	_holdSession = false;
+	if (!_started) exitToUserApp();
+	_synced = false;
+}
+
+template <class Transport>
+void STM32RomFlasherT<Transport>::finishJob()
+{
+	if (!_holdSession) exitToUserApp();
+}
+
+template <class Transport>
+bool STM32RomFlasherT<Transport>::readFlashSizeKB(uint16_t& outKb, STM32RomResult& res)
+{
+	outKb = 0;
+
+	if (!openSession(res)) return false;
+	if (!readFlashSizeReg(outKb, res))
+	{
+		finishJob();
 		return false;
 	}
+	return true;
+}
 
+template <class Transport>
+bool STM32RomFlasherT<Transport>::readFlashSizeReg(uint16_t& outKb, STM32RomResult& res)
+{
+	uint8_t b[2];
+	if (!_bl.readMemory(_fi.flashSizeAddr, b, 2, res)) return false;
 	outKb = (uint16_t)b[0] | ((uint16_t)b[1] << 8);
 	return true;
 }
 
-void STM32RomFlasher::disconnect()
+template <class Transport>
+void STM32RomFlasherT<Transport>::disconnect()
 {
 	exitToUserApp();
 	_connected = false;
-	_desc = "";
+	_desc[0] = '\0';
+	_hasUid = false;
 	_devId = 0;
 	_flashKb = 0;
+	_writeAlign = STM32_WRITE_ALIGN_MIN;
 }
 
-bool STM32RomFlasher::isConnected() const { return _connected; }
-uint16_t STM32RomFlasher::devId() const { return _devId; }
-uint16_t STM32RomFlasher::flashKb() const { return _flashKb; }
-uint8_t STM32RomFlasher::eraseCmd() const { return _eraseCmd; }
-uint32_t STM32RomFlasher::eraseTimeoutMs() const { return _eraseTimeout; }
-uint32_t STM32RomFlasher::flashStart() const { return _flashStart; }
-uint32_t STM32RomFlasher::sramTestAddr() const { return _sramAddr; }
-String STM32RomFlasher::desc() const { return _desc; }
-STM32FamilyInfo STM32RomFlasher::familyInfo() const { return _fi; }
+template class STM32RomFlasherT<STM32StreamTransport>;
+#ifdef ESP8266
+template class STM32RomFlasherT<STM32SerialTransport>;
+template class STM32RomFlasherT<STM32UartTransport>;
+template class STM32RomFlasherT<STM32SpiTransport>;
+template class STM32RomFlasherT<STM32EspTransport>;
+#endif
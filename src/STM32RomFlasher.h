@@ -12,42 +12,97 @@
 #include <Arduino.h>
 #include "STM32RomBootloader.h"
 #include "STM32FamilyDb.h"
+#include "STM32StubProtocol.h"
 
-class STM32RomFlasher
+/* Reset/BOOT0 sequencing and job logic on top of STM32RomBootloaderT; instantiated in
+   STM32RomFlasher.cpp for the same transports as the bootloader */
+template <class Transport>
+class STM32RomFlasherT
 {
 	public:
-	STM32RomFlasher(Stream& io, uint8_t boot0Pin, uint8_t resetPin);
+	typedef STM32RomBootloaderT<Transport> Bootloader;
+
+	STM32RomFlasherT(Transport io, uint8_t boot0Pin, uint8_t resetPin);
 	void beginPins();
 	void disconnect();
 	void enterRomBootloader();
 	void exitToUserApp();
 
-	bool detect(String& desc, String& err);
+	void setMetrics(STM32FlasherMetrics* metrics);
+	STM32FlasherMetrics* metrics() const { return _m; }
+
+	/* programStream() loads a RAM loader stub and streams through it when one exists for the
+	   family (UART only); if the stub does not answer, it falls back to the ROM protocol */
+	void setStubEnabled(bool enabled) { _stubEnabled = enabled; }
+	bool stubEnabled() const { return _stubEnabled; }
+	/* Enabled, on UART, and a stub exists for the detected family that fits its SRAM; false until connected */
+	bool stubAvailable() { return stubImage() != nullptr; }
+	/* Use this image instead of the built-in STM32StubImages table; nullptr restores the table */
+	void setStubImage(const STM32StubImage* image) { _stubImage = image; }
+
+	/* Reset into the ROM bootloader and sync, retrying with a fresh reset; exits to app on failure */
+	bool openSession(STM32RomResult& res);
+	/* Between these, jobs share one bootloader session: openSession() only resets and syncs when
+	   the target is not already in the ROM bootloader, and finished or failed jobs leave it there.
+	   endSession() resets into the user app unless go()/runFromRam() started an image. */
+	void beginSession();
+	void endSession();
+	Bootloader& bootloader() { return _bl; }
+
+	/* On success the part description is available from desc(), and uid() if the part let it be
+	   read (read protection NACKs it) */
+	bool detect(STM32RomResult& res);
+
+	bool massErase(STM32RomResult& res);
+	/* Erases every page/sector overlapping [addr, addr + len); needs detect() for the layout */
+	bool eraseRange(uint32_t addr, uint32_t len, uint32_t& units, STM32RomResult& res);
+	/* Flash writes are padded with 0xFF to flashWriteAlign() at both ends, so a programming unit must
+	   not be shared with an earlier write; SRAM writes need a word-aligned addr */
+	bool flashBuffer(uint32_t addr, const uint8_t* data, size_t len, STM32RomResult& res);
+	bool testRam(STM32RomResult& res);
+	/* GO to addr: the ROM loads SP from addr and PC from addr + 4; BOOT0 is released, NRST is not */
+	bool go(uint32_t addr, STM32RomResult& res);
 
-	bool massErase(String& err);
-	bool flashBuffer(uint32_t addr, const uint8_t* data, size_t len, String& err);
-	bool testRam(String& out);
+	/* Writes `len` bytes of `src` to SRAM at addr and starts them with GO, skipping erase and flash
+	   programming. The image must begin with its vector table and be linked to run from addr; an
+	   addr of 0 picks the start of the free SRAM region and is updated to it. An initial SP outside
+	   that region is patched to its top. The target keeps running the image until the next reset. */
+	bool runFromRam(Stream& src, size_t len, uint32_t& addr, STM32RomResult& res);
+	/* Free SRAM of the detected part, see STM32FamilyDb::getRamRegion() */
+	bool ramRegion(uint32_t& start, uint32_t& end) const { return STM32FamilyDb::getRamRegion(_fi, start, end); }
 
-	bool readFlashSizeKB(uint16_t& outKb, String& err);
+	/* Program / compare `src` against flash starting at addr, one chunk at a time. Programming
+	   sends full STM32_CHUNK frames on flashWriteAlign() boundaries however the source splits its
+	   reads; only the end of the image is padded. */
+	bool programStream(Stream& src, uint32_t addr, size_t& written, STM32RomResult& res);
+	bool verifyStream(Stream& src, uint32_t addr, size_t& verified, STM32RomResult& res);
+	/* Reads `len` bytes of memory at addr into dst; a short write to dst fails with STM32_ERR_SOURCE */
+	bool readToStream(uint32_t addr, size_t len, Print& dst, STM32RomResult& res);
 
-	bool isConnected() const;
-	uint16_t devId() const;
-	uint16_t flashKb() const;
-	uint8_t eraseCmd() const;
-	uint32_t eraseTimeoutMs() const;
-	uint32_t flashStart() const;
-	uint32_t sramTestAddr() const;
-	String desc() const;
+	bool readFlashSizeKB(uint16_t& outKb, STM32RomResult& res);
 
-	STM32FamilyInfo familyInfo() const;
+	bool isConnected() const { return _connected; }
+	uint16_t devId() const { return _devId; }
+	uint16_t flashKb() const { return _flashKb; }
+	uint8_t eraseCmd() const { return _eraseCmd; }
+	uint32_t eraseTimeoutMs() const { return _eraseTimeout; }
+	uint32_t flashStart() const { return _flashStart; }
+	uint32_t sramTestAddr() const { return _sramAddr; }
+	/* Programming unit of the detected family (STM32FlashGeometry::programUnit), at least a word */
+	uint8_t flashWriteAlign() const { return _writeAlign; }
+	const char* desc() const { return _desc; }
+	/* STM32_UID_LEN bytes as stored on the part, or nullptr when it could not be read */
+	const uint8_t* uid() const { return _hasUid ? _uid : nullptr; }
+
+	STM32FamilyInfo familyInfo() const { return _fi; }
 
 	private:
-	Stream* _io;
 	uint8_t _boot0;
 	uint8_t _reset;
 
-	STM32RomBootloader _bl;
+	Bootloader _bl;
 	STM32FamilyInfo _fi;
+	STM32FlasherMetrics* _m;
 
 	bool _connected;
 	uint16_t _devId;
@@ -56,9 +111,45 @@ class STM32RomFlasher
 	uint32_t _eraseTimeout;
 	uint32_t _flashStart;
 	uint32_t _sramAddr;
-	String _desc;
+	uint8_t _writeAlign;
+	char _desc[64];
+	uint8_t _uid[STM32_UID_LEN];
+	bool _hasUid;
+
+	bool _stubEnabled;
+	const STM32StubImage* _stubImage;
+
+	bool _holdSession;
+	bool _synced;	/* the ROM bootloader is answering on the link */
+	bool _started;	/* go() handed the target to an image */
 
+	/* Reads until len bytes or the end of src, so frames stay full when a source returns short reads */
+	size_t readSource(Stream& src, uint8_t* buf, size_t len);
+	/* WRITE padding for addr: the programming unit in flash, a word elsewhere. SRAM has no erased
+	   state to pad into, so an unaligned SRAM addr fails. */
+	bool alignFor(uint32_t addr, uint8_t& align, STM32RomOp op, STM32RomResult& res) const;
+	/* GO in an open session, then release BOOT0 */
+	bool startImage(uint32_t addr, STM32RomResult& res);
+	/* End of a job: back to the user app unless beginSession() is holding the session */
+	void finishJob();
+
+	const STM32StubImage* stubImage();
+	/* Writes the stub to SRAM with WRITE, starts it with GO and reads its hello */
+	bool startStub(const STM32StubImage& image, STM32StubHello& hello, STM32RomResult& res);
+	bool programViaStub(Stream& src, uint32_t addr, uint8_t align, const STM32StubHello& hello, size_t& written, STM32RomResult& res);
+	/* Reads and drops RX until nothing has arrived for STM32_STUB_QUIET_MS */
+	void drainQuiet();
 	bool computeEraseFromSupported(const uint8_t* cmds, size_t n, uint8_t& eraseCmdOut);
+	/* Flash size register of the detected family, in an open session */
+	bool readFlashSizeReg(uint16_t& outKb, STM32RomResult& res);
 };
 
+typedef STM32RomFlasherT<STM32StreamTransport> STM32RomFlasher;
+#ifdef ESP8266
+typedef STM32RomFlasherT<STM32SerialTransport> STM32SerialFlasher;
+typedef STM32RomFlasherT<STM32UartTransport> STM32UartFlasher;
+typedef STM32RomFlasherT<STM32SpiTransport> STM32SpiFlasher;
+typedef STM32RomFlasherT<STM32EspTransport> STM32EspFlasher;
+#endif
+
 #endif	/* STM32_ROM_FLASHER_H */
\ No newline at end of file
@@ -0,0 +1,104 @@
+/********************************************************************************************************
+ *  [FILE NAME]   :      <STM32RomResult.cpp>                                                           *
+ *  [AUTHOR]      :      <David S. Alexander>                                                           *
+ *  [DATE CREATED]:      <Dec 10, 2025>                                                                 *
+ *  [Description] :      <Source file for bootloader operation status>                                  *
+ ********************************************************************************************************/
+
+#include "STM32RomResult.h"
+#include "STM32DeviceConstants.h"
+
+static const char CODE_OK[]            PROGMEM = "OK";
+static const char CODE_NACK[]          PROGMEM = "NACK";
+static const char CODE_TIMEOUT[]       PROGMEM = "timeout";
+static const char CODE_BAD_RESPONSE[]  PROGMEM = "unexpected response";
+static const char CODE_BAD_ARG[]       PROGMEM = "invalid argument";
+static const char CODE_UNSUPPORTED[]   PROGMEM = "not supported";
+static const char CODE_VERIFY[]        PROGMEM = "mismatch";
+static const char CODE_SOURCE[]        PROGMEM = "source read failed";
+static const char CODE_NOT_CONNECTED[] PROGMEM = "target not connected";
+
+static const char* const CODE_TEXT[STM32_ERR_CODE_COUNT] PROGMEM =
+{
+	CODE_OK, CODE_NACK, CODE_TIMEOUT, CODE_BAD_RESPONSE, CODE_BAD_ARG,
+	CODE_UNSUPPORTED, CODE_VERIFY, CODE_SOURCE, CODE_NOT_CONNECTED
+};
+
+static const char OP_NONE[]     PROGMEM = "";
+static const char OP_SYNC[]     PROGMEM = "SYNC";
+static const char OP_GET[]      PROGMEM = "GET";
+static const char OP_GET_VER[]  PROGMEM = "GET_VER";
+static const char OP_GET_ID[]   PROGMEM = "GET_ID";
+static const char OP_READ[]     PROGMEM = "READ";
+static const char OP_WRITE[]    PROGMEM = "WRITE";
+static const char OP_ERASE[]    PROGMEM = "ERASE";
+static const char OP_XERASE[]   PROGMEM = "XERASE";
+static const char OP_VERIFY[]   PROGMEM = "VERIFY";
+static const char OP_RAM_TEST[] PROGMEM = "RAM test";
+static const char OP_GO[]       PROGMEM = "GO";
+static const char OP_STUB[]     PROGMEM = "stub";
+static const char OP_RAM_RUN[]  PROGMEM = "RAM run";
+static const char OP_PREFLIGHT[] PROGMEM = "preflight";
+
+static const char* const OP_TEXT[STM32_RO_COUNT] PROGMEM =
+{
+	OP_NONE, OP_SYNC, OP_GET, OP_GET_VER, OP_GET_ID, OP_READ,
+	OP_WRITE, OP_ERASE, OP_XERASE, OP_VERIFY, OP_RAM_TEST, OP_GO, OP_STUB,
+	OP_RAM_RUN, OP_PREFLIGHT
+};
+
+static const char ST_NONE[]  PROGMEM = "";
+static const char ST_CMD[]   PROGMEM = "cmd";
+static const char ST_ADDR[]  PROGMEM = "address";
+static const char ST_LEN[]   PROGMEM = "length";
+static const char ST_DATA[]  PROGMEM = "data";
+static const char ST_FINAL[] PROGMEM = "final ACK";
+
+static const char* const STAGE_TEXT[STM32_ST_COUNT] PROGMEM =
+{
+	ST_NONE, ST_CMD, ST_ADDR, ST_LEN, ST_DATA, ST_FINAL
+};
+
+static void copyText(char* dst, size_t cap, const char* const* table, uint8_t idx, uint8_t count)
+{
+	if (idx >= count) idx = 0;
+	strncpy_P(dst, (PGM_P)pgm_read_ptr(&table[idx]), cap - 1);
+	dst[cap - 1] = '\0';
+}
+
+bool STM32RomResult::fail(STM32RomCode c, STM32RomOp o, STM32RomStage s, uint8_t r, uint32_t a)
+{
+	code = c;
+	op = o;
+	stage = s;
+	resp = r;
+	addr = a;
+	return false;
+}
+
+STM32RomCode STM32RomResult::ackCode(uint8_t resp)
+{
+	if (resp == STM32_NACK) return STM32_ERR_NACK;
+	if (resp == 0) return STM32_ERR_TIMEOUT;
+	return STM32_ERR_BAD_RESPONSE;
+}
+
+size_t STM32RomResult::format(char* buf, size_t cap) const
+{
+	if (cap == 0) return 0;
+
+	char opText[12], codeText[24], stageText[12];
+	copyText(opText, sizeof(opText), OP_TEXT, op, STM32_RO_COUNT);
+	copyText(codeText, sizeof(codeText), CODE_TEXT, code, STM32_ERR_CODE_COUNT);
+	copyText(stageText, sizeof(stageText), STAGE_TEXT, stage, STM32_ST_COUNT);
+
+	if (code == STM32_OK) return (size_t)snprintf(buf, cap, "%s", codeText);
+	if (op == STM32_RO_SYNC) return (size_t)snprintf(buf, cap, "SYNC failed");
+
+	int n = snprintf(buf, cap, "%s%s%s", opText, opText[0] ? ": " : "", codeText);
+	if (stageText[0] && n >= 0 && (size_t)n < cap) n += snprintf(buf + n, cap - n, " (%s)", stageText);
+	if (addr && n >= 0 && (size_t)n < cap) n += snprintf(buf + n, cap - n, " at 0x%08lX", (unsigned long)addr);
+	if (code == STM32_ERR_BAD_RESPONSE && n >= 0 && (size_t)n < cap) n += snprintf(buf + n, cap - n, ", got 0x%02X", resp);
+	if (n < 0) { buf[0] = '\0'; return 0; }
+	return ((size_t)n < cap) ? (size_t)n : cap - 1;
+}
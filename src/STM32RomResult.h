@@ -0,0 +1,84 @@
+/********************************************************************************************************
+ *  [FILE NAME]   :      <STM32RomResult.h>                                                             *
+ *  [AUTHOR]      :      <David S. Alexander>                                                           *
+ *  [DATE CREATED]:      <Dec 10, 2025>                                                                 *
+ *  [Description] :      <Header file for bootloader operation status>                                  *
+ ********************************************************************************************************/
+
+#ifndef STM32_ROM_RESULT_H
+#define	STM32_ROM_RESULT_H
+
+#include <Arduino.h>
+
+enum STM32RomCode : uint8_t
+{
+	STM32_OK,
+	STM32_ERR_NACK,
+	STM32_ERR_TIMEOUT,
+	STM32_ERR_BAD_RESPONSE,
+	STM32_ERR_BAD_ARG,
+	STM32_ERR_UNSUPPORTED,
+	STM32_ERR_VERIFY,
+	STM32_ERR_SOURCE,
+	STM32_ERR_NOT_CONNECTED,
+	STM32_ERR_CODE_COUNT
+};
+
+/* Which operation failed */
+enum STM32RomOp : uint8_t
+{
+	STM32_RO_NONE,
+	STM32_RO_SYNC,
+	STM32_RO_GET,
+	STM32_RO_GET_VER,
+	STM32_RO_GET_ID,
+	STM32_RO_READ,
+	STM32_RO_WRITE,
+	STM32_RO_ERASE,
+	STM32_RO_XERASE,
+	STM32_RO_VERIFY,
+	STM32_RO_RAM_TEST,
+	STM32_RO_GO,
+	STM32_RO_STUB,
+	STM32_RO_RAM_RUN,
+	STM32_RO_PREFLIGHT,
+	STM32_RO_COUNT
+};
+
+/* Which part of the frame exchange failed */
+enum STM32RomStage : uint8_t
+{
+	STM32_ST_NONE,
+	STM32_ST_CMD,
+	STM32_ST_ADDR,
+	STM32_ST_LEN,
+	STM32_ST_DATA,
+	STM32_ST_FINAL_ACK,
+	STM32_ST_COUNT
+};
+
+/* Compact status of a bootloader/flasher call; text is only produced by format() */
+struct STM32RomResult
+{
+	STM32RomCode code;
+	STM32RomOp op;
+	STM32RomStage stage;
+	uint8_t resp;
+	uint32_t addr;
+
+	STM32RomResult() : code(STM32_OK), op(STM32_RO_NONE), stage(STM32_ST_NONE), resp(0), addr(0) {}
+
+	bool ok() const { return code == STM32_OK; }
+	void clear() { *this = STM32RomResult(); }
+
+	/* Records the failure and returns false so callers can `return res.fail(...)` */
+	bool fail(STM32RomCode c, STM32RomOp o, STM32RomStage s, uint8_t r = 0, uint32_t a = 0);
+
+	/* Failure code for a missing/negative ACK: NACK if the target said so, timeout otherwise */
+	static STM32RomCode ackCode(uint8_t resp);
+
+	/* e.g. "WRITE: NACK (data) at 0x08000100"; always NUL-terminated */
+	size_t format(char* buf, size_t cap) const;
+};
+
+#endif	/* STM32_ROM_RESULT_H */
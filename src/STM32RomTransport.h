@@ -0,0 +1,234 @@
+/********************************************************************************************************
+ *  [FILE NAME]   :      <STM32RomTransport.h>                                                          *
+ *  [AUTHOR]      :      <David S. Alexander>                                                           *
+ *  [DATE CREATED]:      <Dec 10, 2025>                                                                 *
+ *  [Description] :      <Header file for STM32 ROM bootloader transports>                              *
+ ********************************************************************************************************/
+
+#ifndef STM32_ROM_TRANSPORT_H
+#define	STM32_ROM_TRANSPORT_H
+
+#include <Arduino.h>
+#ifdef ESP8266
+#include <SPI.h>
+#endif
+#include "STM32DeviceConstants.h"
+#ifdef ESP8266
+#include "STM32Uart.h"
+#endif
+
+/* A transport is any class with these members; STM32RomBootloaderT calls them directly, so a concrete
+   transport's bulk paths inline into the protocol code:
+     int available();
+     int read();                                    one byte, -1 if none
+     size_t read(uint8_t* buf, size_t len);         whatever is buffered, without waiting
+     bool waitAvailable(size_t n, uint32_t ms);     true once n bytes are buffered (a polling transport
+                                                    may return on the first), false on timeout
+     size_t write(const uint8_t* data, size_t len);
+     void flush();                                  wait until everything written is on the wire
+     bool spiFraming() const;                       true selects the AN4286 SPI protocol framing */
+
+/* Any Arduino Stream; every call is virtual. Used by the host build and for compatibility. With
+   `spi` set the stream must clock a byte in on every read(), as the simulator's SPI port does. */
+class STM32StreamTransport
+{
+	public:
+	STM32StreamTransport(Stream& s, bool spi = false) : _s(&s), _spi(spi) {}
+
+	int available() { return _s->available(); }
+	int read() { return _s->read(); }
+
+	size_t read(uint8_t* buf, size_t len)
+	{
+		int avail = _s->available();
+		size_t n = (avail > 0) ? (size_t)avail : 0;
+		if (n > len) n = len;
+		for (size_t i = 0; i < n; i++) buf[i] = (uint8_t)_s->read();
+		return n;
+	}
+
+	bool waitAvailable(size_t n, uint32_t timeoutMs)
+	{
+		uint32_t start = millis();
+		while (_s->available() <= 0)
+		{
+			if (millis() - start >= timeoutMs) return false;
+			yield();
+		}
+		return true;
+	}
+
+	size_t write(const uint8_t* data, size_t len) { return _s->write(data, len); }
+	void flush() { _s->flush(); }
+	bool spiFraming() const { return _spi; }
+
+	Stream& stream() { return *_s; }
+
+	private:
+	Stream* _s;
+	bool _spi;
+};
+
+#ifdef ESP8266
+/* ESP8266 UART. Qualified calls skip the vtable, and the bulk read/write go straight to the
+   UART driver's FIFO copy instead of one virtual call per byte. */
+class STM32SerialTransport
+{
+	public:
+	STM32SerialTransport(HardwareSerial& s) : _s(&s) {}
+
+	int available() { return _s->HardwareSerial::available(); }
+	int read() { return _s->HardwareSerial::read(); }
+	size_t read(uint8_t* buf, size_t len) { return _s->HardwareSerial::read((char*)buf, len); }
+
+	/* The core driver has no RX wakeup, so this polls; it returns on the first byte because
+	   its ring may be smaller than n */
+	bool waitAvailable(size_t n, uint32_t timeoutMs)
+	{
+		uint32_t start = millis();
+		while (available() <= 0)
+		{
+			if (millis() - start >= timeoutMs) return false;
+			yield();
+		}
+		return true;
+	}
+
+	size_t write(const uint8_t* data, size_t len) { return _s->HardwareSerial::write(data, len); }
+	void flush() { _s->HardwareSerial::flush(); }
+	bool spiFraming() const { return false; }
+
+	HardwareSerial& serial() { return *_s; }
+
+	private:
+	HardwareSerial* _s;
+};
+
+/* ESP8266 UART0 through STM32Uart: sized rings, per-cause error counters, and waits that sleep
+   until the RX interrupt has the bytes instead of polling */
+class STM32UartTransport
+{
+	public:
+	STM32UartTransport(STM32Uart& u) : _u(&u) {}
+
+	int available() { return _u->available(); }
+	int read() { return _u->read(); }
+	size_t read(uint8_t* buf, size_t len) { return _u->read(buf, len); }
+	bool waitAvailable(size_t n, uint32_t timeoutMs) { return _u->waitAvailable(n, timeoutMs); }
+	size_t write(const uint8_t* data, size_t len) { return _u->write(data, len); }
+	void flush() { _u->flush(); }
+	bool spiFraming() const { return false; }
+
+	STM32Uart& uart() { return *_u; }
+
+	private:
+	STM32Uart* _u;
+};
+
+/* SPI master on the ESP8266 HSPI pins (SCK 14, MISO 12, MOSI 13) with a GPIO chip select.
+   The master clocks every byte, so reads always succeed: read() shifts out a dummy byte and
+   returns whatever the STM32 put on MISO. Waiting for the target is done by ACK polling.
+   AN4286 frames start with a SOF byte rather than a CS edge, so CS goes low with the first
+   transfer and stays low until end() instead of costing a transaction per polled byte. */
+class STM32SpiTransport
+{
+	public:
+	STM32SpiTransport(SPIClass& spi, uint8_t csPin, uint32_t hz) : _spi(&spi), _cs(csPin), _hz(hz), _selected(false) {}
+
+	void begin()
+	{
+		pinMode(_cs, OUTPUT);
+		digitalWrite(_cs, HIGH);
+		_spi->begin();
+	}
+
+	void end()
+	{
+		deselect();
+		_spi->end();
+	}
+
+	/* Every read clocks a byte in, so there is always one to read and nothing to wait for */
+	int available() { return 1; }
+
+	int read()
+	{
+		uint8_t b = STM32_SPI_DUMMY;
+		transfer(&b, 1);
+		return b;
+	}
+
+	size_t read(uint8_t* buf, size_t len)
+	{
+		memset(buf, STM32_SPI_DUMMY, len);
+		transfer(buf, len);
+		return len;
+	}
+
+	bool waitAvailable(size_t n, uint32_t timeoutMs) { return true; }
+
+	size_t write(const uint8_t* data, size_t len)
+	{
+		select();
+		_spi->writeBytes(data, len);
+		return len;
+	}
+
+	void flush() {}
+	bool spiFraming() const { return true; }
+
+	private:
+	SPIClass* _spi;
+	uint8_t _cs;
+	uint32_t _hz;
+	bool _selected;
+
+	void select()
+	{
+		if (_selected) return;
+		_spi->beginTransaction(SPISettings(_hz, MSBFIRST, SPI_MODE0));
+		digitalWrite(_cs, LOW);
+		_selected = true;
+	}
+
+	void deselect()
+	{
+		if (!_selected) return;
+		digitalWrite(_cs, HIGH);
+		_spi->endTransaction();
+		_selected = false;
+	}
+
+	/* Full duplex in place: buf goes out on MOSI and is replaced by what came in on MISO */
+	void transfer(uint8_t* buf, size_t len)
+	{
+		select();
+		_spi->transferBytes(buf, buf, len);
+	}
+};
+
+/* UART or SPI chosen at run time (STM32WebFlasherConfig::link); one predictable branch per call */
+class STM32EspTransport
+{
+	public:
+	STM32EspTransport(STM32Uart& uart, const STM32SpiTransport& spi, bool useSpi) : _uart(uart), _spi(spi), _useSpi(useSpi) {}
+
+	int available() { return _useSpi ? _spi.available() : _uart.available(); }
+	int read() { return _useSpi ? _spi.read() : _uart.read(); }
+	size_t read(uint8_t* buf, size_t len) { return _useSpi ? _spi.read(buf, len) : _uart.read(buf, len); }
+	bool waitAvailable(size_t n, uint32_t timeoutMs) { return _useSpi ? _spi.waitAvailable(n, timeoutMs) : _uart.waitAvailable(n, timeoutMs); }
+	size_t write(const uint8_t* data, size_t len) { return _useSpi ? _spi.write(data, len) : _uart.write(data, len); }
+	void flush() { if (_useSpi) _spi.flush(); else _uart.flush(); }
+	bool spiFraming() const { return _useSpi; }
+
+	STM32UartTransport& uart() { return _uart; }
+	STM32SpiTransport& spi() { return _spi; }
+
+	private:
+	STM32UartTransport _uart;
+	STM32SpiTransport _spi;
+	bool _useSpi;
+};
+#endif
+
+#endif	/* STM32_ROM_TRANSPORT_H */
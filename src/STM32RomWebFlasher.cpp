@@ -8,28 +8,309 @@
 #ifdef ESP8266
 #include "STM32RomWebFlasher.h"
 
+static const char* const ROUTE_NAMES[] =
+{
+	"/", "/upload", "/cmd", "/status", "/connect", "/disconnect", "/login", "/logout", "/heap", "/metrics", "/batch", "/telemetry", "/events", "/trace", "/history", "/manifest", "/image", "/patch", "notFound"
+};
+
+static const char NO_PATCH[] = "no patch in the request";
+static const char BRIDGE_BUSY[] = "serial bridge in use";
+
+static uint32_t freeHeap()
+{
+	return ESP.getFreeHeap();
+}
+
+Stream* STM32LittleFsFiles::open(const char* name, size_t& len)
+{
+	if (!LittleFS.exists(name)) return nullptr;
+	_file = LittleFS.open(name, "r");
+	if (!_file) return nullptr;
+	len = _file.size();
+	return &_file;
+}
+
+void STM32LittleFsFiles::close()
+{
+	if (_file) _file.close();
+}
+
+Stream* STM32LittleFsFiles::openScratch(uint8_t slot, bool write)
+{
+	if (!_scratch || !_scratch[0]) return nullptr;
+	char path[48];
+	snprintf(path, sizeof(path), "%s%u.bin", _scratch, (unsigned)slot);
+	if (!write && !LittleFS.exists(path)) return nullptr;
+	_file = LittleFS.open(path, write ? "w" : "r");
+	if (!_file) return nullptr;
+	return &_file;
+}
+
+bool STM32LittleFsPatch::open(const char* path)
+{
+	_path = path;
+	_started = false;
+	_base = LittleFS.open(path, "r");
+	return (bool)_base;
+}
+
+void STM32LittleFsPatch::close()
+{
+	if (_base) _base.close();
+}
+
+bool STM32LittleFsPatch::begin(uint32_t newSize)
+{
+	_started = true;
+	return _writer->begin(_path, newSize);
+}
+
+size_t STM32LittleFsPatch::readBase(uint32_t offset, uint8_t* dst, size_t len)
+{
+	if (_base.position() != offset && !_base.seek(offset, SeekSet)) return 0;
+	return _base.read(dst, len);
+}
+
+STM32LittleFsRecords::STM32LittleFsRecords() : _path(nullptr), _maxBytes(0), _size(1)
+{
+	_old[0] = '\0';
+}
+
+void STM32LittleFsRecords::begin(const char* path, uint32_t maxBytes, size_t recordSize)
+{
+	_path = path;
+	_maxBytes = maxBytes;
+	_size = recordSize;
+	snprintf(_old, sizeof(_old), "%s.1", path);
+}
+
+size_t STM32LittleFsRecords::records(const char* path) const
+{
+	if (!path || !LittleFS.exists(path)) return 0;
+	File f = LittleFS.open(path, "r");
+	if (!f) return 0;
+	size_t n = f.size() / _size;
+	f.close();
+	return n;
+}
+
+size_t STM32LittleFsRecords::count() const
+{
+	return records(_old) + records(_path);
+}
+
+size_t STM32LittleFsRecords::readFile(const char* path, size_t from, uint8_t* out, size_t max) const
+{
+	if (max == 0) return 0;
+	File f = LittleFS.open(path, "r");
+	if (!f) return 0;
+	size_t n = f.size() / _size;
+	if (from >= n) { f.close(); return 0; }
+	if (max > n - from) max = n - from;
+	f.seek((uint32_t)(from * _size), SeekSet);
+	size_t got = f.read(out, max * _size) / _size;
+	f.close();
+	return got;
+}
+
+size_t STM32LittleFsRecords::read(size_t from, void* out, size_t max) const
+{
+	uint8_t* p = (uint8_t*)out;
+	size_t old = records(_old);
+	size_t n = 0;
+	if (from < old)
+	{
+		n = readFile(_old, from, p, (max < old - from) ? max : old - from);
+		if (n < max && from + n < old) return n;
+	}
+	size_t cur = (from + n > old) ? from + n - old : 0;
+	return n + readFile(_path, cur, p + n * _size, max - n);
+}
+
+void STM32LittleFsRecords::append(const void* rec)
+{
+	File f = LittleFS.open(_path, "a");
+	if (!f) return;
+	/* A torn record would misalign everything after it, so it ends the file like a full one */
+	if (f.size() + _size > _maxBytes || f.size() % _size)
+	{
+		f.close();
+		LittleFS.remove(_old);
+		LittleFS.rename(_path, _old);
+		f = LittleFS.open(_path, "a");
+		if (!f) return;
+	}
+	f.write((const uint8_t*)rec, _size);
+	f.close();
+}
+
+size_t STM32LittleFsEventStore::load(STM32Event* out, size_t max)
+{
+	size_t n = _file.count();
+	if (max > n) max = n;
+	return _file.read(n - max, out, max);
+}
+
 STM32WebFlasherESP8266::STM32WebFlasherESP8266(HardwareSerial& serial, const STM32WebFlasherConfig& cfg)
 : _serial(&serial),
 _cfg(cfg),
 _server(cfg.httpPort),
-_flasher(serial, cfg.boot0Pin, cfg.resetPin),
+_flasher(STM32EspTransport(_uart, STM32SpiTransport(SPI, cfg.spiCsPin, cfg.spiHz), cfg.link == STM32_LINK_SPI), cfg.boot0Pin, cfg.resetPin),
+_bridge(_uart, _flasher, cfg.boot0Pin, cfg.resetPin, (cfg.link == STM32_LINK_SPI) ? 0 : cfg.bridgePort),
+_job('-'),
+_jobSkipped(0),
+_batch(_flasher, _batchFiles),
+_delta(_flasher, _batchFiles),
 _loggedIn(false),
-_loggedIp(0,0,0,0)
+_loggedIp(0,0,0,0),
+_imageKnown(false),
+_patchFiles(_upload),
+_patchError(NO_PATCH)
 {
+	memset(_routeHeap, 0, sizeof(_routeHeap));
+	_flasher.setMetrics(&_metrics);
+	_metrics.observer = &_telemetry;
+	_telemetry.setHeapSource(freeHeap);
+	_flasher.setStubEnabled(cfg.fastLoader);
 }
 
-void STM32WebFlasherESP8266::sendHtml_P(const char* pgmHtml)
+void STM32WebFlasherESP8266::startJob(char job)
 {
-	_server.send_P(200, "text/html", pgmHtml);
+	_job = job;
+	_jobSkipped = 0;
+	pollUartErrors();
+	_telemetry.beginJob(job, _metrics);
+	_history.beginJob(job, _metrics);
 }
 
-void STM32WebFlasherESP8266::sendHtmlWithHost_P(const char* partA, const char* host, const char* partB)
+void STM32WebFlasherESP8266::countJob(bool ok, const STM32RomResult& res)
 {
-	_server.setContentLength(CONTENT_LENGTH_UNKNOWN);
-	_server.send(200, "text/html", "");
-	if (partA) _server.sendContent_P(partA);
-	_server.sendContent(host ? host : "");
-	if (partB) _server.sendContent_P(partB);
+	if (ok) _metrics.jobsOk++;
+	else _metrics.jobsFailed++;
+	pollUartErrors();
+	_telemetry.endJob(ok, _metrics);
+
+	if (ok) _events.log(STM32_EV_JOB_OK, 0, _telemetry.jobBytes(), _job);
+	else _events.logFailure(STM32_EV_JOB_FAILED, res, _job);
+
+	STM32HistoryRecord r;
+	memset(&r, 0, sizeof(r));
+	/* Before SNTP has answered, time() counts from boot */
+	time_t now = time(nullptr);
+	r.time = (now > 1600000000) ? (uint32_t)now : 0;
+	r.devId = _flasher.devId();
+	r.family = (uint8_t)_flasher.familyInfo().family;
+	if (_flasher.uid())
+	{
+		memcpy(r.uid, _flasher.uid(), STM32_UID_LEN);
+		r.flags |= STM32_HIST_UID;
+	}
+	bool spi = (_cfg.link == STM32_LINK_SPI);
+	r.rate = spi ? _cfg.spiHz : _cfg.uartBaud;
+	if (spi) r.flags |= STM32_HIST_SPI;
+	r.bytesSkipped = _jobSkipped;
+	/* Batches name their own files, so only the /cmd jobs on updatePath carry its hash */
+	if (_job && strchr("SUVXD", _job) && loadImageInfo(true))
+	{
+		memcpy(r.imageHash, _image.sha256, STM32_HISTORY_HASH_LEN);
+		r.flags |= STM32_HIST_HASH;
+	}
+	_history.endJob(r, ok, res, _metrics);
+}
+
+void STM32WebFlasherESP8266::pollUartErrors()
+{
+	if (!_uart.started()) return;
+	_metrics.uartParityErrors = _uart.parityErrors();
+	_metrics.uartFramingErrors = _uart.framingErrors();
+	_metrics.uartOverruns = _uart.overruns();
+	_metrics.uartRxDropped = _uart.rxDropped();
+}
+
+void STM32WebFlasherESP8266::runRoute(Route route, void (STM32WebFlasherESP8266::*handler)())
+{
+	uint32_t before = ESP.getFreeHeap();
+	(this->*handler)();
+	uint32_t after = ESP.getFreeHeap();
+	pollUartErrors();
+
+	RouteHeap& h = _routeHeap[route];
+	int32_t delta = (int32_t)after - (int32_t)before;
+	h.calls++;
+	h.lastDelta = delta;
+	if (delta < h.worstDelta) h.worstDelta = delta;
+	if (h.minFree == 0 || after < h.minFree) h.minFree = after;
+}
+
+void STM32WebFlasherESP8266::sendAsset(const STM32WebAsset& asset)
+{
+	char etag[24];
+	strncpy_P(etag, asset.etag, sizeof(etag) - 1);
+	etag[sizeof(etag) - 1] = '\0';
+
+	/* "/" serves login or index depending on session, so always revalidate */
+	_server.sendHeader(F("ETag"), etag);
+	_server.sendHeader(F("Cache-Control"), F("no-cache"));
+
+	if (_server.hasHeader(F("If-None-Match")) && _server.header(F("If-None-Match")) == etag)
+	{
+		_server.send(304);
+		return;
+	}
+
+	_server.sendHeader(F("Content-Encoding"), F("gzip"));
+	_server.send_P(200, asset.mime, (PGM_P)asset.gz, asset.gzLen);
+}
+
+STM32ChunkedPrint::STM32ChunkedPrint(ESP8266WebServer& server) : _server(&server), _len(0) {}
+
+STM32ChunkedPrint::~STM32ChunkedPrint()
+{
+	flush();
+}
+
+size_t STM32ChunkedPrint::write(uint8_t c)
+{
+	return write(&c, 1);
+}
+
+size_t STM32ChunkedPrint::write(const uint8_t* data, size_t len)
+{
+	size_t done = 0;
+	while (done < len)
+	{
+		size_t n = len - done;
+		if (n > sizeof(_buf) - _len) n = sizeof(_buf) - _len;
+		memcpy(_buf + _len, data + done, n);
+		_len += n;
+		done += n;
+		if (_len == sizeof(_buf)) flush();
+	}
+	return len;
+}
+
+void STM32ChunkedPrint::flush()
+{
+	if (_len == 0) return;
+	_server->sendContent(_buf, _len);
+	_len = 0;
+}
+
+void STM32WebFlasherESP8266::sendJson(int code, const STM32BufferPrint& body)
+{
+	_server.send(code, "application/json", body.c_str(), body.length());
+}
+
+void STM32WebFlasherESP8266::sendJsonError(int code, const char* error)
+{
+	char buf[160];
+	STM32BufferPrint out(buf, sizeof(buf));
+	STM32JsonWriter json(out);
+	json.beginObject();
+	json.add("ok", false);
+	json.add("error", error);
+	json.endObject();
+	sendJson(code, out);
 }
 
 bool STM32WebFlasherESP8266::requireLogin()
@@ -47,11 +328,37 @@ bool STM32WebFlasherESP8266::begin()
 
 	_flasher.beginPins();
 
-	_serial->begin(_cfg.uartBaud, SERIAL_8E1);
-	if (_cfg.uartSwap) _serial->swap();
+	if (_cfg.link == STM32_LINK_SPI)
+	{
+		_flasher.bootloader().transport().spi().begin();
+	}
+	else
+	{
+		/* The core driver cannot tell parity from framing errors and has no RX wakeup */
+		_serial->end();
+		STM32UartConfig uart;
+		uart.baud = _cfg.uartBaud;
+		uart.format = SERIAL_8E1;
+		uart.swap = _cfg.uartSwap;
+		uart.rxRing = _cfg.uartRxRing;
+		uart.txRing = _cfg.uartTxRing;
+		if (!_uart.begin(uart)) return false;
+	}
 
 	if (!LittleFS.begin()) return false;
 
+	bool spill = _cfg.eventLogPath && _cfg.eventLogPath[0] && _cfg.eventLogBytes >= sizeof(STM32Event);
+	if (spill) _eventStore.begin(_cfg.eventLogPath, _cfg.eventLogBytes);
+	_events.begin(spill ? &_eventStore : nullptr, ESP.getResetInfoPtr()->reason);
+
+	bool keep = _cfg.historyPath && _cfg.historyPath[0] && _cfg.historyBytes >= sizeof(STM32HistoryRecord);
+	if (keep) _historyStore.begin(_cfg.historyPath, _cfg.historyBytes);
+	_history.begin(keep ? &_historyStore : nullptr);
+
+	/* The ring itself is allocated by POST /trace */
+	if (_cfg.traceBytes) _flasher.bootloader().setTracer(&_tracer);
+	_batchFiles.setScratchPath(_cfg.preservePath);
+
 	WiFi.begin(_cfg.wifiSsid, _cfg.wifiPass);
 	uint32_t start = millis();
 	while (WiFi.status() != WL_CONNECTED)
@@ -62,34 +369,80 @@ bool STM32WebFlasherESP8266::begin()
 	}
 	if (WiFi.status() != WL_CONNECTED) return false;
 
+	if (_cfg.ntpServer && _cfg.ntpServer[0]) configTime(0, 0, _cfg.ntpServer);
+
 	if (!MDNS.begin(_cfg.mdnsHost)) return false;
 	MDNS.addService("http", "tcp", _cfg.httpPort);
 
-	_server.on("/", HTTP_GET, [this](){ routeRoot(); });
-	_server.onNotFound([this](){ routeNotFound(); });
+	static const char* headerKeys[] = { "If-None-Match" };
+	_server.collectHeaders(headerKeys, 1);
+
+	_server.on("/", HTTP_GET, [this](){ runRoute(ROUTE_ROOT, &STM32WebFlasherESP8266::routeRoot); });
+	_server.onNotFound([this](){ runRoute(ROUTE_NOT_FOUND, &STM32WebFlasherESP8266::routeNotFound); });
 
 	_server.on("/upload", HTTP_POST,
 	[this](){
-		if (!requireLogin()) { _server.send(403, "text/plain", "Not logged in"); return; }
-		_server.send(200, "text/plain", "Upload OK");
+		runRoute(ROUTE_UPLOAD, &STM32WebFlasherESP8266::routeUploadDone);
 	},
 	[this](){ routeUpload(); }
 	);
 
-	_server.on("/cmd", HTTP_GET, [this](){ routeCmd(); });
-	_server.on("/status", HTTP_GET, [this](){ routeStatus(); });
-	_server.on("/connect", HTTP_POST, [this](){ routeConnect(); });
-	_server.on("/disconnect", HTTP_POST, [this](){ routeDisconnect(); });
-	_server.on("/login", HTTP_POST, [this](){ routeLogin(); });
-	_server.on("/logout", HTTP_POST, [this](){ routeLogout(); });
+	_server.on("/cmd", HTTP_GET, [this](){ runRoute(ROUTE_CMD, &STM32WebFlasherESP8266::routeCmd); });
+	_server.on("/status", HTTP_GET, [this](){ runRoute(ROUTE_STATUS, &STM32WebFlasherESP8266::routeStatus); });
+	_server.on("/connect", HTTP_POST, [this](){ runRoute(ROUTE_CONNECT, &STM32WebFlasherESP8266::routeConnect); });
+	_server.on("/disconnect", HTTP_POST, [this](){ runRoute(ROUTE_DISCONNECT, &STM32WebFlasherESP8266::routeDisconnect); });
+	_server.on("/login", HTTP_POST, [this](){ runRoute(ROUTE_LOGIN, &STM32WebFlasherESP8266::routeLogin); });
+	_server.on("/logout", HTTP_POST, [this](){ runRoute(ROUTE_LOGOUT, &STM32WebFlasherESP8266::routeLogout); });
+	_server.on("/heap", HTTP_GET, [this](){ runRoute(ROUTE_HEAP, &STM32WebFlasherESP8266::routeHeap); });
+	_server.on("/metrics", HTTP_GET, [this](){ runRoute(ROUTE_METRICS, &STM32WebFlasherESP8266::routeMetrics); });
+	_server.on("/batch", HTTP_POST, [this](){ runRoute(ROUTE_BATCH, &STM32WebFlasherESP8266::routeBatch); });
+	_server.on("/telemetry", HTTP_GET, [this](){ runRoute(ROUTE_TELEMETRY, &STM32WebFlasherESP8266::routeTelemetry); });
+	_server.on("/events", HTTP_GET, [this](){ runRoute(ROUTE_EVENTS, &STM32WebFlasherESP8266::routeEvents); });
+	_server.on("/trace", HTTP_GET, [this](){ runRoute(ROUTE_TRACE, &STM32WebFlasherESP8266::routeTrace); });
+	_server.on("/trace", HTTP_POST, [this](){ runRoute(ROUTE_TRACE, &STM32WebFlasherESP8266::routeTraceControl); });
+	_server.on("/history", HTTP_GET, [this](){ runRoute(ROUTE_HISTORY, &STM32WebFlasherESP8266::routeHistory); });
+	_server.on("/manifest", HTTP_POST, [this](){ runRoute(ROUTE_MANIFEST, &STM32WebFlasherESP8266::routeManifest); });
+	_server.on("/image", HTTP_GET, [this](){ runRoute(ROUTE_IMAGE, &STM32WebFlasherESP8266::routeImage); });
+
+	_server.on("/patch", HTTP_POST,
+	[this](){
+		runRoute(ROUTE_PATCH, &STM32WebFlasherESP8266::routePatchDone);
+	},
+	[this](){ routePatch(); }
+	);
 
 	_server.begin();
+	_bridge.begin();
+	if (_cfg.bridgePort && _cfg.link != STM32_LINK_SPI) MDNS.addService("telnet", "tcp", _cfg.bridgePort);
 	return true;
 }
 
 void STM32WebFlasherESP8266::loop()
 {
 	_server.handleClient();
+
+	switch (_bridge.poll())
+	{
+		case STM32_BRIDGE_OPENED:
+		/* The client owns the target now; whatever the flasher knew about it may stop being true */
+		if (_flasher.isConnected())
+		{
+			char path[48];
+			if (shadowFile(path, sizeof(path))) LittleFS.remove(path);
+			_flasher.disconnect();
+			_events.log(STM32_EV_DISCONNECT);
+		}
+		_events.log(STM32_EV_BRIDGE_OPEN, (uint32_t)_bridge.clientIp());
+		break;
+
+		case STM32_BRIDGE_CLOSED:
+		_events.log(STM32_EV_BRIDGE_CLOSED, _bridge.fromTarget(), _bridge.toTarget());
+		break;
+
+		default:
+		break;
+	}
+
 	MDNS.update();
 	yield();
 }
@@ -98,10 +451,10 @@ void STM32WebFlasherESP8266::routeRoot()
 {
 	if (!requireLogin())
 	{
-		sendHtmlWithHost_P(LOGIN_HTML_A, _cfg.mdnsHost, LOGIN_HTML_B);
+		sendAsset(LOGIN_PAGE);
 		return;
 	}
-	sendHtmlWithHost_P(INDEX_HTML_A, _cfg.mdnsHost, INDEX_HTML_B);
+	sendAsset(INDEX_PAGE);
 }
 
 void STM32WebFlasherESP8266::routeNotFound()
@@ -109,6 +462,27 @@ void STM32WebFlasherESP8266::routeNotFound()
 	_server.send(404, "text/plain", "Not found");
 }
 
+void STM32WebFlasherESP8266::routeUploadDone()
+{
+	if (!requireLogin()) { _server.send(403, "text/plain", "Not logged in"); return; }
+	if (_upload.error())
+	{
+		_events.log(STM32_EV_UPLOAD_FAILED);
+		char msg[80];
+		snprintf(msg, sizeof(msg), "Upload failed: %s", _upload.error());
+		_server.send(507, "text/plain", msg);
+		return;
+	}
+
+	/* Rates in kB/s; writeUs only counts time inside LittleFS */
+	uint32_t fsRate = _upload.writeUs() ? (uint32_t)((uint64_t)_upload.bytes() * 1000 / _upload.writeUs()) : 0;
+	uint32_t rate = _upload.elapsedMs() ? (uint32_t)(_upload.bytes() / _upload.elapsedMs()) : 0;
+	_events.log(STM32_EV_UPLOAD, 0, _upload.bytes());
+	char msg[96];
+	snprintf(msg, sizeof(msg), "Upload OK, Bytes = %u, FS write %u kB/s, overall %u kB/s", (unsigned)_upload.bytes(), (unsigned)fsRate, (unsigned)rate);
+	_server.send(200, "text/plain", msg);
+}
+
 void STM32WebFlasherESP8266::routeUpload()
 {
 	if (!requireLogin()) return;
@@ -116,183 +490,348 @@ void STM32WebFlasherESP8266::routeUpload()
 	HTTPUpload& upload = _server.upload();
 	if (upload.status == UPLOAD_FILE_START)
 	{
-		if (LittleFS.exists(_cfg.updatePath)) LittleFS.remove(_cfg.updatePath);
-		_uploadFile = LittleFS.open(_cfg.updatePath, "w");
+		/* The multipart body is a little larger than the file, so this errs on the safe side */
+		_upload.begin(_cfg.updatePath, upload.contentLength);
 	}
 	else if (upload.status == UPLOAD_FILE_WRITE)
 	{
-		if (_uploadFile) _uploadFile.write(upload.buf, upload.currentSize);
+		if (_upload.active()) _upload.write(upload.buf, upload.currentSize);
 	}
 	else if (upload.status == UPLOAD_FILE_END)
 	{
-		if (_uploadFile) _uploadFile.close();
+		if (_upload.active())
+		{
+			bool ok = _upload.commit();
+			_image = _upload.imageInfo();
+			_imageKnown = ok;
+		}
+	}
+	else if (upload.status == UPLOAD_FILE_ABORTED)
+	{
+		_upload.abort();
 	}
 }
 
+void STM32WebFlasherESP8266::routeImage()
+{
+	if (!requireLogin()) { sendJsonError(403, "not logged in"); return; }
+	if (!loadImageInfo(true)) { sendJsonError(404, "no image"); return; }
+
+	char sha[2 * STM32_SHA256_LEN + 1];
+	STM32Sha256::toHex(_image.sha256, sha);
+	char buf[160];
+	STM32BufferPrint out(buf, sizeof(buf));
+	STM32JsonWriter json(out);
+	json.beginObject();
+	json.add("ok", true);
+	json.add("size", (unsigned long)_image.size);
+	json.addHex("crc", _image.crc, 8);
+	json.add("sha256", sha);
+	json.endObject();
+	sendJson(200, out);
+}
+
+void STM32WebFlasherESP8266::routePatchDone()
+{
+	if (!requireLogin()) { _server.send(403, "text/plain", "Not logged in"); return; }
+	const char* error = _patchError ? _patchError : _patch.error();
+	bool storage = !_patchError && _patchFiles.started() && _upload.error();
+	if (storage) error = _upload.error();
+	/* A request without a file part never reaches routePatch() */
+	_patchError = NO_PATCH;
+	if (error)
+	{
+		_events.log(STM32_EV_UPLOAD_FAILED);
+		char msg[96];
+		snprintf(msg, sizeof(msg), "Patch failed: %s", error);
+		/* 409 tells the UI to fall back to a full upload; a full file system would refuse that too */
+		_server.send(storage ? 507 : 409, "text/plain", msg);
+		return;
+	}
+
+	uint32_t rate = _upload.elapsedMs() ? (uint32_t)(_patch.patchBytes() / _upload.elapsedMs()) : 0;
+	_events.log(STM32_EV_UPLOAD, 0, _upload.bytes());
+	char msg[128];
+	snprintf(msg, sizeof(msg), "Patch OK, Bytes = %u from a %u byte patch, %u copied from the stored image, overall %u kB/s",
+	(unsigned)_patch.outBytes(), (unsigned)_patch.patchBytes(), (unsigned)_patch.copied(), (unsigned)rate);
+	_server.send(200, "text/plain", msg);
+}
+
+void STM32WebFlasherESP8266::routePatch()
+{
+	if (!requireLogin()) return;
+
+	HTTPUpload& upload = _server.upload();
+	if (upload.status == UPLOAD_FILE_START)
+	{
+		_patchError = nullptr;
+		/* The header names the base by size and SHA-256; the upload writer starts once it matches */
+		if (!loadImageInfo(true)) _patchError = "no stored image to patch";
+		else if (!_patchFiles.open(_cfg.updatePath)) _patchError = "cannot open the stored image";
+		else _patch.begin(_patchFiles, _image.size, _image.sha256);
+	}
+	else if (upload.status == UPLOAD_FILE_WRITE)
+	{
+		if (!_patchError && _patch.active() && !_patch.write(upload.buf, upload.currentSize)) _upload.abort();
+	}
+	else if (upload.status == UPLOAD_FILE_END)
+	{
+		if (_patchError) return;
+		bool ok = _patch.finish();
+		_patchFiles.close();
+		if (!ok)
+		{
+			_upload.abort();
+			return;
+		}
+		ok = _upload.commit();
+		_image = _upload.imageInfo();
+		_imageKnown = ok;
+	}
+	else if (upload.status == UPLOAD_FILE_ABORTED)
+	{
+		_patchFiles.close();
+		_upload.abort();
+	}
+}
+
+void STM32WebFlasherESP8266::sendResult(const char* prefix, const STM32RomResult& res)
+{
+	char msg[96];
+	res.format(msg, sizeof(msg));
+	char tmp[128];
+	snprintf(tmp, sizeof(tmp), "%s%s", prefix, msg);
+	_server.send(200, "text/plain", tmp);
+}
+
+void STM32WebFlasherESP8266::sendPreflight(const STM32Preflight& pf)
+{
+	char msg[256];
+	size_t n = (size_t)snprintf(msg, sizeof(msg), "Preflight ");
+	pf.format(msg + n, sizeof(msg) - n);
+	_server.send(200, "text/plain", msg);
+}
+
+bool STM32WebFlasherESP8266::loadImageInfo(bool crc)
+{
+	if (_imageKnown && (!crc || _image.crcKnown)) return true;
+
+	File f = LittleFS.open(_cfg.updatePath, "r");
+	if (!f) return false;
+	if (!_imageKnown) _imageKnown = _image.read(f, (uint32_t)f.size());
+	if (_imageKnown && crc)
+	{
+		f.seek(0, SeekSet);
+		_image.hash(f);
+	}
+	f.close();
+	return _imageKnown && (!crc || _image.crcKnown);
+}
+
+bool STM32WebFlasherESP8266::preflight(STM32Preflight& out)
+{
+	if (!loadImageInfo(false)) return false;
+
+	/* 8E1 UART frames are 11 bits a byte; SPI clocks 8 */
+	uint32_t rate = (_cfg.link == STM32_LINK_SPI) ? _cfg.spiHz / 8 : _cfg.uartBaud / 11;
+	STM32ImagePreflight::analyze(_image, _flasher.familyInfo(), _flasher.flashKb(), _flasher.flashStart(), rate, out);
+	return true;
+}
+
 void STM32WebFlasherESP8266::routeCmd()
 {
 	if (!requireLogin()) { _server.send(403, "text/plain", "Not logged in"); return; }
 	if (!_server.hasArg("c")) { _server.send(400, "text/plain", "Missing c"); return; }
 
-	String arg = _server.arg("c");
+	const String& arg = _server.arg("c");
 	if (arg.length() == 0) { _server.send(400, "text/plain", "Empty c"); return; }
 
 	char c = arg[0];
+	if (_bridge.active()) { _server.send(409, "text/plain", BRIDGE_BUSY); return; }
+	_events.log(STM32_EV_COMMAND, 0, 0, c);
 
-	if (!_flasher.isConnected() && (c == 'S' || c == 'E' || c == 'U' || c == 'J'))
+	if (!_flasher.isConnected() && (c == 'S' || c == 'E' || c == 'U' || c == 'V' || c == 'D' || c == 'J' || c == 'X' || c == 'P'))
 	{
 		_server.send(400, "text/plain", "Target not connected. Use Connect first.");
 		return;
 	}
 
+	STM32RomResult res;
+	char tmp[192];
+
 	if (c == 'C')
 	{
-		STM32RomBootloader bl(*_serial);
-		_flasher.enterRomBootloader();
+		if (!_flasher.openSession(res)) { sendResult("", res); return; }
 
-		if (!bl.sync(1000))
-		{
-			_flasher.exitToUserApp();
-			_server.send(200, "text/plain", "SYNC failed");
-			return;
-		}
+		uint8_t cmds[32];
+		size_t n = 0;
+		uint8_t proto = 0;
+		bool ok = _flasher.bootloader().getSupportedCommands(cmds, sizeof(cmds), n, proto, res);
+		_flasher.exitToUserApp();
+		if (!ok) { sendResult("", res); return; }
 
-		String out, err;
-		if (!bl.getSupportedCommandsText(out, err))
+		int len = snprintf(tmp, sizeof(tmp), "Protocol version = 0x%x, CMDs: ", proto);
+		for (size_t i = 0; i < n && len > 0 && (size_t)len < sizeof(tmp); i++)
 		{
-			_flasher.exitToUserApp();
-			_server.send(200, "text/plain", err);
-			return;
+			len += snprintf(tmp + len, sizeof(tmp) - len, "%s0x%x", i ? ", " : "", cmds[i]);
 		}
-
-		_flasher.exitToUserApp();
-		_server.send(200, "text/plain", out);
+		_server.send(200, "text/plain", tmp);
 		return;
 	}
 
 	if (c == 'G')
 	{
-		STM32RomBootloader bl(*_serial);
-		_flasher.enterRomBootloader();
-
-		if (!bl.sync(1000))
-		{
-			_flasher.exitToUserApp();
-			_server.send(200, "text/plain", "SYNC failed");
-			return;
-		}
+		if (!_flasher.openSession(res)) { sendResult("", res); return; }
 
 		uint16_t id = 0;
-		String err;
-		if (!bl.getId(id, err))
-		{
-			_flasher.exitToUserApp();
-			_server.send(200, "text/plain", err);
-			return;
-		}
-
+		bool ok = _flasher.bootloader().getId(id, res);
 		_flasher.exitToUserApp();
+		if (!ok) { sendResult("", res); return; }
 
-		char tmp[32];
 		snprintf(tmp, sizeof(tmp), "Chip ID = 0x%03X", id);
-		_server.send(200, "text/plain", String(tmp));
+		_server.send(200, "text/plain", tmp);
 		return;
 	}
 
 	if (c == 'R')
 	{
-		STM32RomBootloader bl(*_serial);
-		_flasher.enterRomBootloader();
-
-		if (!bl.sync(1000))
-		{
-			_flasher.exitToUserApp();
-			_server.send(200, "text/plain", "SYNC failed");
-			return;
-		}
+		if (!_flasher.openSession(res)) { sendResult("", res); return; }
 
 		uint8_t v, o1, o2;
-		String err;
-		if (!bl.getVersion(v, o1, o2, err))
-		{
-			_flasher.exitToUserApp();
-			_server.send(200, "text/plain", err);
-			return;
-		}
-
+		bool ok = _flasher.bootloader().getVersion(v, o1, o2, res);
 		_flasher.exitToUserApp();
+		if (!ok) { sendResult("", res); return; }
 
-		char tmp[64];
 		snprintf(tmp, sizeof(tmp), "Protocol version = 0x%02X, Opt1 = 0x%02X, Opt2 = 0x%02X", v, o1, o2);
-		_server.send(200, "text/plain", String(tmp));
+		_server.send(200, "text/plain", tmp);
 		return;
 	}
 
 	if (c == 'E')
 	{
-		String err;
-		bool ok = _flasher.massErase(err);
-		_server.send(200, "text/plain", ok ? "Erase OK" : ("Erase failed: " + err));
+		startJob(c);
+		bool ok = _flasher.massErase(res);
+		countJob(ok, res);
+		updateShadow(c, ok);
+		if (!ok) { sendResult("Erase failed: ", res); return; }
+		_server.send(200, "text/plain", "Erase OK");
 		return;
 	}
 
 	if (c == 'T')
 	{
-		String out;
-		_flasher.testRam(out);
-		_server.send(200, "text/plain", out);
+		if (!_flasher.testRam(res)) { sendResult("", res); return; }
+		snprintf(tmp, sizeof(tmp), "RAM Write/Read at 0x%lx OK", (unsigned long)_flasher.sramTestAddr());
+		_server.send(200, "text/plain", tmp);
 		return;
 	}
 
-	if (c == 'U' || c == 'S')
+	if (c == 'U' || c == 'S' || c == 'V' || c == 'D')
 	{
 		if (!LittleFS.exists(_cfg.updatePath))
 		{
-			_server.send(200, "text/plain", String("No ") + _cfg.updatePath);
+			snprintf(tmp, sizeof(tmp), "No %s", _cfg.updatePath);
+			_server.send(200, "text/plain", tmp);
 			return;
 		}
 
-		String err;
-		if (c == 'S')
+		/* Nothing is touched for an image that cannot run here; f=1 flashes it anyway */
+		STM32Preflight pf;
+		bool force = _server.hasArg("f") && _server.arg("f") == "1";
+		if (c != 'V' && !force && preflight(pf) && !pf.go)
 		{
-			bool okErase = _flasher.massErase(err);
-			if (!okErase) { _server.send(200, "text/plain", "Erase failed: " + err); return; }
+			uint32_t failed = 0;
+			for (uint8_t i = 0; i < STM32_PF_COUNT; i++)
+			{
+				if (pf.level[i] == STM32_PF_FAIL) failed |= 1UL << i;
+			}
+			_events.log(STM32_EV_PREFLIGHT_REFUSED, 0, failed, c);
+			sendPreflight(pf);
+			return;
 		}
 
-		File f = LittleFS.open(_cfg.updatePath, "r");
-		if (!f) { _server.send(200, "text/plain", "Open update failed"); return; }
+		if (c == 'D')
+		{
+			deltaUpdate();
+			return;
+		}
 
-		STM32RomBootloader bl(*_serial);
-		_flasher.enterRomBootloader();
-		if (!bl.sync(1000)) { f.close(); _flasher.exitToUserApp(); _server.send(200, "text/plain", "SYNC failed"); return; }
+		const char* keep = _server.hasArg("keep") ? _server.arg("keep").c_str() : _cfg.preserve;
+		if (c == 'S' && keep && keep[0])
+		{
+			flashPreserving(keep);
+			return;
+		}
 
-		uint32_t addr = _flasher.flashStart();
-		uint8_t buf[STM32_CHUNK];
-		size_t total = 0;
+		startJob(c);
+		if (c == 'S' && !_flasher.massErase(res))
+		{
+			countJob(false, res);
+			updateShadow(c, false);
+			sendResult("Erase failed: ", res);
+			return;
+		}
 
-		while (true)
+		File f = LittleFS.open(_cfg.updatePath, "r");
+		if (!f)
 		{
-			size_t n = f.read(buf, STM32_CHUNK);
-			if (n == 0) break;
+			res.fail(STM32_ERR_SOURCE, STM32_RO_NONE, STM32_ST_NONE);
+			countJob(false, res);
+			/* S got as far as the erase */
+			if (c == 'S') updateShadow('E', true);
+			_server.send(200, "text/plain", "Open update failed");
+			return;
+		}
 
-			if (!bl.writeMemory(addr, buf, n, err))
-			{
-				f.close();
-				_flasher.exitToUserApp();
-				char tmp[160];
-				snprintf(tmp, sizeof(tmp), "Write error at 0x%08lX: %s", (unsigned long)addr, err.c_str());
-				_server.send(200, "text/plain", String(tmp));
-				return;
-			}
+		size_t total = 0;
+		bool ok = (c == 'V')
+			? _flasher.verifyStream(f, _flasher.flashStart(), total, res)
+			: _flasher.programStream(f, _flasher.flashStart(), total, res);
+		f.close();
+		countJob(ok, res);
+		updateShadow(c, ok);
 
-			addr += (uint32_t)((n + 3) & ~((size_t)3));
-			total += n;
-			yield();
+		if (!ok) { sendResult("", res); return; }
+		snprintf(tmp, sizeof(tmp), "%s OK, Bytes = %lu", (c == 'V') ? "Verify" : "Upload", (unsigned long)total);
+		_server.send(200, "text/plain", tmp);
+		return;
+	}
+
+	/* Go/no-go and time estimate for the stored image, without touching the target */
+	if (c == 'P')
+	{
+		STM32Preflight pf;
+		if (!preflight(pf))
+		{
+			snprintf(tmp, sizeof(tmp), "No %s", _cfg.updatePath);
+			_server.send(200, "text/plain", tmp);
+			return;
 		}
+		sendPreflight(pf);
+		return;
+	}
 
+	/* Load the uploaded image into SRAM and GO; optional a=<hex> overrides the load address */
+	if (c == 'X')
+	{
+		File f = LittleFS.open(_cfg.updatePath, "r");
+		if (!f)
+		{
+			snprintf(tmp, sizeof(tmp), "No %s", _cfg.updatePath);
+			_server.send(200, "text/plain", tmp);
+			return;
+		}
+
+		uint32_t addr = _server.hasArg("a") ? (uint32_t)strtoul(_server.arg("a").c_str(), nullptr, 16) : 0;
+		size_t len = f.size();
+		startJob(c);
+		bool ok = _flasher.runFromRam(f, len, addr, res);
 		f.close();
-		_flasher.exitToUserApp();
-		_server.send(200, "text/plain", String("Upload OK, Bytes = ") + String((unsigned long)total));
+		countJob(ok, res);
+
+		if (!ok) { sendResult("Run failed: ", res); return; }
+		snprintf(tmp, sizeof(tmp), "Running from RAM at 0x%08lX, Bytes = %lu", (unsigned long)addr, (unsigned long)len);
+		_server.send(200, "text/plain", tmp);
 		return;
 	}
 
@@ -303,58 +842,83 @@ void STM32WebFlasherESP8266::routeCmd()
 		return;
 	}
 
-	_server.send(200, "text/plain", String("Unknown CMD: ") + c);
+	snprintf(tmp, sizeof(tmp), "Unknown CMD: %c", c);
+	_server.send(200, "text/plain", tmp);
 }
 
 
 void STM32WebFlasherESP8266::routeStatus()
 {
+	char buf[320];
+	STM32BufferPrint out(buf, sizeof(buf));
+	STM32JsonWriter json(out);
+
 	if (!requireLogin())
 	{
-		_server.send(403, "application/json", "{\"ok\":false,\"error\":\"not logged in\"}");
+		json.beginObject();
+		json.add("ok", false);
+		json.add("error", "not logged in");
+		json.add("host", _cfg.mdnsHost);
+		json.endObject();
+		sendJson(403, out);
 		return;
 	}
 
-	bool hasFile = LittleFS.exists(_cfg.updatePath);
-	String json = "{";
-		json += "\"ok\":true";
-		json += ",\"connected\":";
-		json += _flasher.isConnected() ? "true" : "false";
-		json += ",\"desc\":\"";
-		json += _flasher.isConnected() ? _flasher.desc() : "";
-		json += "\"";
-		json += ",\"hasFile\":";
-		json += hasFile ? "true" : "false";
-		json += ",\"flashKB\":";
-		json += _flasher.flashKb();
-		json += ",\"devId\":";
-		json += _flasher.devId();
-	json += "}";
-	_server.send(200, "application/json", json);
+	bool connected = _flasher.isConnected();
+	json.beginObject();
+	json.add("ok", true);
+	json.add("host", _cfg.mdnsHost);
+	json.add("connected", connected);
+	json.add("desc", connected ? _flasher.desc() : "");
+	json.add("hasFile", LittleFS.exists(_cfg.updatePath));
+	json.add("flashKB", (uint32_t)_flasher.flashKb());
+	json.add("devId", (uint32_t)_flasher.devId());
+	json.add("link", (_cfg.link == STM32_LINK_SPI) ? "spi" : "uart");
+	/* Only when programStream() will really use a stub; the built-in table may be empty */
+	json.add("fastLoader", _flasher.stubAvailable());
+	json.add("bridge", _bridge.active());
+	json.add("heapFree", ESP.getFreeHeap());
+	json.endObject();
+	sendJson(200, out);
 }
 
 void STM32WebFlasherESP8266::routeConnect()
 {
-	if (!requireLogin()) { _server.send(403, "application/json", "{\"ok\":false,\"error\":\"not logged in\"}"); return; }
+	if (!requireLogin()) { sendJsonError(403, "not logged in"); return; }
+	if (_bridge.active()) { sendJsonError(409, BRIDGE_BUSY); return; }
 
-	String desc, err;
-	bool ok = _flasher.detect(desc, err);
+	STM32RomResult res;
+	bool ok = _flasher.detect(res);
+	if (ok) _events.log(STM32_EV_CONNECT, _flasher.devId(), _flasher.flashKb());
+	else _events.logFailure(STM32_EV_CONNECT_FAILED, res);
+
+	char buf[192];
+	STM32BufferPrint out(buf, sizeof(buf));
+	STM32JsonWriter json(out);
+	json.beginObject();
+	json.add("ok", ok);
+	json.add("connected", ok);
 	if (ok)
 	{
-		String json = "{\"ok\":true,\"connected\":true,\"desc\":\"" + desc + "\"}";
-		_server.send(200, "application/json", json);
+		json.add("desc", _flasher.desc());
 	}
 	else
 	{
-		String json = "{\"ok\":false,\"connected\":false,\"error\":\"" + err + "\"}";
-		_server.send(200, "application/json", json);
+		char msg[96];
+		res.format(msg, sizeof(msg));
+		json.add("error", msg);
+		json.add("code", (unsigned)res.code);
 	}
+	json.endObject();
+	sendJson(200, out);
 }
 
 void STM32WebFlasherESP8266::routeDisconnect()
 {
-	if (!requireLogin()) { _server.send(403, "application/json", "{\"ok\":false,\"error\":\"not logged in\"}"); return; }
+	if (!requireLogin()) { sendJsonError(403, "not logged in"); return; }
+	if (_bridge.active()) { sendJsonError(409, BRIDGE_BUSY); return; }
 	_flasher.disconnect();
+	_events.log(STM32_EV_DISCONNECT);
 	_server.send(200, "application/json", "{\"ok\":true,\"connected\":false}");
 }
 
@@ -363,7 +927,7 @@ void STM32WebFlasherESP8266::routeLogin()
 {
 	if (!_server.hasArg("user") || !_server.hasArg("pass"))
 	{
-		_server.send(400, "application/json", "{\"ok\":false,\"error\":\"Missing credentials\"}");
+		sendJsonError(400, "Missing credentials");
 		return;
 	}
 
@@ -374,22 +938,437 @@ void STM32WebFlasherESP8266::routeLogin()
 	{
 		_loggedIn = true;
 		_loggedIp = _server.client().remoteIP();
+		_events.log(STM32_EV_LOGIN, (uint32_t)_loggedIp);
 		_server.send(200, "application/json", "{\"ok\":true}");
 	}
 	else
 	{
 		_loggedIn = false;
 		_loggedIp = IPAddress(0,0,0,0);
-		_server.send(200, "application/json", "{\"ok\":false,\"error\":\"Invalid username or password\"}");
+		_events.log(STM32_EV_LOGIN_FAILED, (uint32_t)_server.client().remoteIP());
+		sendJsonError(200, "Invalid username or password");
 	}
 }
 
 void STM32WebFlasherESP8266::routeLogout()
 {
+	if (_loggedIn) _events.log(STM32_EV_LOGOUT);
 	_loggedIn = false;
 	_loggedIp = IPAddress(0,0,0,0);
-	_flasher.exitToUserApp();
+	/* A bridge client owns NRST and BOOT0; logging out of the web UI must not reset under it */
+	if (!_bridge.active()) _flasher.exitToUserApp();
 	_server.send(200, "application/json", "{\"ok\":true}");
 }
 
+void STM32WebFlasherESP8266::routeHeap()
+{
+	if (!requireLogin()) { sendJsonError(403, "not logged in"); return; }
+
+	/* Read before the reply starts, so the numbers do not include the response itself */
+	uint32_t freeHeap = ESP.getFreeHeap();
+	uint32_t maxBlock = ESP.getMaxFreeBlockSize();
+	uint32_t fragPct = ESP.getHeapFragmentation();
+
+	/* One object per route, so the reply grows with every route added */
+	_server.setContentLength(CONTENT_LENGTH_UNKNOWN);
+	_server.send(200, "application/json", "");
+	{
+		STM32ChunkedPrint out(_server);
+		STM32JsonWriter json(out);
+		json.beginObject();
+		json.add("ok", true);
+		json.add("free", freeHeap);
+		json.add("maxBlock", maxBlock);
+		json.add("fragPct", fragPct);
+		json.beginArray("routes");
+		for (uint8_t i = 0; i < ROUTE_COUNT; i++)
+		{
+			const RouteHeap& h = _routeHeap[i];
+			json.beginObject();
+			json.add("route", ROUTE_NAMES[i]);
+			json.add("calls", h.calls);
+			json.add("lastDelta", h.lastDelta);
+			json.add("worstDelta", h.worstDelta);
+			json.add("minFree", h.minFree);
+			json.endObject();
+		}
+		json.endArray();
+		json.endObject();
+	}
+	_server.sendContent("");
+}
+
+void STM32WebFlasherESP8266::routeMetrics()
+{
+	_server.setContentLength(CONTENT_LENGTH_UNKNOWN);
+	_server.send(200, "text/plain; version=0.0.4", "");
+	pollUartErrors();
+
+	{
+		STM32ChunkedPrint out(_server);
+		_metrics.writePrometheus(out);
+
+		/* Live rate: a bridge client may have changed it with SET-BAUDRATE */
+		STM32FlasherMetrics::writeHeader(out, "stm32flasher_uart_baud", "gauge", "Current target UART baud rate.");
+		out.print("stm32flasher_uart_baud ");
+		out.print((unsigned long)_uart.baud());
+		out.print('\n');
+		STM32FlasherMetrics::writeHeader(out, "stm32flasher_uart_rx_high_water_bytes", "gauge", "Most bytes held in the UART RX ring.");
+		out.print("stm32flasher_uart_rx_high_water_bytes ");
+		out.print((unsigned long)_uart.rxHighWater());
+		out.print('\n');
+
+		STM32FlasherMetrics::writeHeader(out, "stm32flasher_heap_free_bytes", "gauge", "ESP free heap.");
+		out.print("stm32flasher_heap_free_bytes ");
+		out.print((unsigned long)ESP.getFreeHeap());
+		out.print('\n');
+		STM32FlasherMetrics::writeHeader(out, "stm32flasher_heap_max_block_bytes", "gauge", "Largest free heap block.");
+		out.print("stm32flasher_heap_max_block_bytes ");
+		out.print((unsigned long)ESP.getMaxFreeBlockSize());
+		out.print('\n');
+		STM32FlasherMetrics::writeHeader(out, "stm32flasher_heap_fragmentation_percent", "gauge", "Heap fragmentation.");
+		out.print("stm32flasher_heap_fragmentation_percent ");
+		out.print((unsigned long)ESP.getHeapFragmentation());
+		out.print('\n');
+
+		FSInfo fs;
+		if (LittleFS.info(fs))
+		{
+			STM32FlasherMetrics::writeHeader(out, "stm32flasher_fs_total_bytes", "gauge", "LittleFS capacity.");
+			out.print("stm32flasher_fs_total_bytes ");
+			out.print((unsigned long)fs.totalBytes);
+			out.print('\n');
+			STM32FlasherMetrics::writeHeader(out, "stm32flasher_fs_used_bytes", "gauge", "LittleFS bytes in use.");
+			out.print("stm32flasher_fs_used_bytes ");
+			out.print((unsigned long)fs.usedBytes);
+			out.print('\n');
+		}
+
+		STM32FlasherMetrics::writeHeader(out, "stm32flasher_http_requests_total", "counter", "HTTP requests by route.");
+		for (uint8_t i = 0; i < ROUTE_COUNT; i++)
+		{
+			out.print("stm32flasher_http_requests_total{route=\"");
+			out.print(ROUTE_NAMES[i]);
+			out.print("\"} ");
+			out.print((unsigned long)_routeHeap[i].calls);
+			out.print('\n');
+		}
+	}
+
+	_server.sendContent("");
+}
+
+/* Timeline and counters of the last job; jobs block the server, so the UI fetches this after each one */
+void STM32WebFlasherESP8266::routeTelemetry()
+{
+	if (!requireLogin()) { sendJsonError(403, "not logged in"); return; }
+
+	_server.setContentLength(CONTENT_LENGTH_UNKNOWN);
+	_server.send(200, "application/json", "");
+	{
+		STM32ChunkedPrint out(_server);
+		_telemetry.writeJson(out, _metrics);
+	}
+	_server.sendContent("");
+}
+
+/* Events after sequence number `after` (default 0: all that are held), at most `max` of them */
+void STM32WebFlasherESP8266::routeEvents()
+{
+	if (!requireLogin()) { sendJsonError(403, "not logged in"); return; }
+
+	uint32_t after = _server.hasArg("after") ? (uint32_t)strtoul(_server.arg("after").c_str(), nullptr, 10) : 0;
+	unsigned long max = _server.hasArg("max") ? strtoul(_server.arg("max").c_str(), nullptr, 10) : STM32EventLog::CAPACITY;
+	if (max == 0 || max > STM32EventLog::CAPACITY) max = STM32EventLog::CAPACITY;
+
+	_server.setContentLength(CONTENT_LENGTH_UNKNOWN);
+	_server.send(200, "application/json", "");
+	{
+		STM32ChunkedPrint out(_server);
+		_events.writeJson(out, after, (uint8_t)max);
+	}
+	_server.sendContent("");
+}
+
+/* The frame capture as a download for extras/host/tools/stm32frames */
+void STM32WebFlasherESP8266::routeTrace()
+{
+	if (!requireLogin()) { sendJsonError(403, "not logged in"); return; }
+	if (!_tracer.capacity()) { sendJsonError(404, "no capture"); return; }
+
+	bool spi = (_cfg.link == STM32_LINK_SPI);
+	_server.sendHeader(F("Content-Disposition"), F("attachment; filename=\"stm32trace.bin\""));
+	_server.setContentLength(CONTENT_LENGTH_UNKNOWN);
+	_server.send(200, "application/octet-stream", "");
+	{
+		STM32ChunkedPrint out(_server);
+		_tracer.writeCapture(out, spi ? STM32_FRAME_LINK_SPI : STM32_FRAME_LINK_UART, spi ? _cfg.spiHz : _cfg.uartBaud);
+	}
+	_server.sendContent("");
+}
+
+/* on=1|0 starts or stops tracing, clear=1 empties the ring; answers with the tracer state */
+void STM32WebFlasherESP8266::routeTraceControl()
+{
+	if (!requireLogin()) { sendJsonError(403, "not logged in"); return; }
+	if (!_cfg.traceBytes) { sendJsonError(404, "tracer not configured"); return; }
+
+	bool on = _server.hasArg("on") ? (_server.arg("on") == "1") : _tracer.enabled();
+	if (on && !_tracer.capacity() && !_tracer.begin(_cfg.traceBytes))
+	{
+		sendJsonError(507, "trace ring does not fit in the heap");
+		return;
+	}
+	if (_server.hasArg("clear") && _server.arg("clear") == "1") _tracer.clear();
+	_tracer.setEnabled(on);
+	/* The ring is held only while recording or while it holds a capture to download */
+	if (!on && !_tracer.frames()) _tracer.end();
+
+	char buf[128];
+	STM32BufferPrint out(buf, sizeof(buf));
+	STM32JsonWriter json(out);
+	json.beginObject();
+	json.add("ok", true);
+	json.add("on", _tracer.enabled());
+	json.add("frames", (unsigned long)_tracer.frames());
+	json.add("dropped", (unsigned long)_tracer.dropped());
+	json.add("bytes", (unsigned long)_tracer.captureBytes());
+	json.add("capacity", (unsigned long)_tracer.capacity());
+	json.endObject();
+	sendJson(200, out);
+}
+
+/* Summary of the stored flash history plus the newest `recent` records (default 10) */
+void STM32WebFlasherESP8266::routeHistory()
+{
+	if (!requireLogin()) { sendJsonError(403, "not logged in"); return; }
+
+	unsigned long recent = _server.hasArg("recent") ? strtoul(_server.arg("recent").c_str(), nullptr, 10) : 10;
+	if (recent > STM32FlashHistory::MAX_RECENT) recent = STM32FlashHistory::MAX_RECENT;
+
+	_server.setContentLength(CONTENT_LENGTH_UNKNOWN);
+	_server.send(200, "application/json", "");
+	{
+		STM32ChunkedPrint out(_server);
+		_history.writeJson(out, (uint8_t)recent);
+	}
+	_server.sendContent("");
+}
+
+/* Script in the request body (text/plain); validated in full before the target is touched */
+void STM32WebFlasherESP8266::routeBatch()
+{
+	if (!requireLogin()) { sendJsonError(403, "not logged in"); return; }
+
+	if (_bridge.active()) { sendJsonError(409, BRIDGE_BUSY); return; }
+
+	const String& script = _server.arg("plain");
+	if (!_batch.parse(script.c_str(), script.length())) { sendBatchError(); return; }
+
+	_events.log(STM32_EV_COMMAND, 0, 0, 'B');
+	startJob('B');
+	sendBatchReport(_batch.run(script.c_str(), script.length()));
+}
+
+/* Manifest in the request body (text/plain); its files are sized, and planned against the part when
+   it is already detected, before the target is touched */
+void STM32WebFlasherESP8266::routeManifest()
+{
+	if (!requireLogin()) { sendJsonError(403, "not logged in"); return; }
+
+	if (_bridge.active()) { sendJsonError(409, BRIDGE_BUSY); return; }
+
+	const String& manifest = _server.arg("plain");
+	if (!_batch.parseManifest(manifest.c_str(), manifest.length())) { sendBatchError(); return; }
+
+	_events.log(STM32_EV_COMMAND, 0, 0, 'M');
+	startJob('M');
+	sendBatchReport(_batch.runManifest(manifest.c_str(), manifest.length()));
+}
+
+/* Only the pages/sectors the image covers are erased. Ranges in them are saved to LittleFS first,
+   written back after the image and verified; the image itself is left to V as with a mass erase. */
+void STM32WebFlasherESP8266::flashPreserving(const char* keep)
+{
+	char manifest[STM32_BATCH_LINE_MAX * 2];
+	int len = snprintf(manifest, sizeof(manifest), "image %s 0x%08lX\n", _cfg.updatePath, (unsigned long)_flasher.flashStart());
+	for (const char* p = keep; *p && len > 0 && (size_t)len + 16 < sizeof(manifest); )
+	{
+		const char* end = strchr(p, ',');
+		if (!end) end = p + strlen(p);
+		len += snprintf(manifest + len, sizeof(manifest) - len, "preserve %.*s\n", (int)(end - p), p);
+		p = *end ? end + 1 : end;
+	}
+	if (len <= 0 || (size_t)len >= sizeof(manifest))
+	{
+		_server.send(400, "text/plain", "Preserve list too long");
+		return;
+	}
+	for (char* p = manifest; *p; p++)
+	{
+		if (*p == ':') *p = ' ';
+	}
+
+	/* The plan is checked here since the target is connected; line 1 is the image */
+	char tmp[160];
+	if (!_batch.parseManifest(manifest, (size_t)len))
+	{
+		snprintf(tmp, sizeof(tmp), "Bad preserve list (range %u): %s", (unsigned)(_batch.errorLine() ? _batch.errorLine() - 1 : 0), _batch.error());
+		_server.send(400, "text/plain", tmp);
+		return;
+	}
+
+	startJob('S');
+	bool ok = _batch.runManifest(manifest, (size_t)len, false);
+	const STM32BatchStep* last = _batch.stepCount() ? &_batch.step(_batch.stepCount() - 1) : nullptr;
+	STM32RomResult res = last ? last->res : STM32RomResult();
+	countJob(ok, res);
+	updateShadow('M', ok);
+	if (!ok && !last)
+	{
+		/* Failed before the first step ran, e.g. the image could not be opened */
+		snprintf(tmp, sizeof(tmp), "Preserving update failed: %s", _batch.error() ? _batch.error() : "nothing ran");
+		_server.send(200, "text/plain", tmp);
+		return;
+	}
+	if (!ok) { sendResult((last->op == STM32_BATCH_ERASE) ? "Erase failed: " : "", res); return; }
+
+	uint32_t bytes = 0;
+	uint8_t saved = 0;
+	for (uint8_t i = 0; i < _batch.stepCount(); i++)
+	{
+		const STM32BatchStep& s = _batch.step(i);
+		if (s.op == STM32_BATCH_PROGRAM) bytes = s.bytes;
+		if (s.op == STM32_BATCH_SAVE) saved++;
+	}
+	snprintf(tmp, sizeof(tmp), "Upload OK, Bytes = %lu, %u preserved range(s) written back", (unsigned long)bytes, (unsigned)saved);
+	_server.send(200, "text/plain", tmp);
+}
+
+void STM32WebFlasherESP8266::deltaUpdate()
+{
+	char path[48];
+	if (!_flasher.uid())
+	{
+		_server.send(200, "text/plain", "Delta update needs the part's UID, which could not be read");
+		return;
+	}
+	if (!openShadow(path, sizeof(path)))
+	{
+		_server.send(200, "text/plain", "Delta update needs shadowPath and heap for the shadow");
+		return;
+	}
+
+	startJob('D');
+	STM32RomResult res;
+	STM32DeltaReport rep;
+	bool ok = _delta.run(_cfg.updatePath, _shadow, rep, res);
+	closeShadow(path);
+	_jobSkipped = rep.skipped;
+	countJob(ok, res);
+
+	if (!ok) { sendResult("", res); return; }
+	char tmp[160];
+	snprintf(tmp, sizeof(tmp), "Delta OK, Bytes = %lu, skipped %lu, %u of %u blocks rewritten%s",
+	(unsigned long)rep.written, (unsigned long)rep.skipped, (unsigned)rep.rewritten, (unsigned)rep.blocks,
+	rep.stale ? " (shadow was stale)" : "");
+	_server.send(200, "text/plain", tmp);
+}
+
+bool STM32WebFlasherESP8266::shadowFile(char* path, size_t cap)
+{
+	const uint8_t* uid = _flasher.uid();
+	if (!uid || !_cfg.shadowPath || !_cfg.shadowPath[0]) return false;
+	int len = snprintf(path, cap, "%s", _cfg.shadowPath);
+	for (size_t i = 0; i < STM32_UID_LEN && len > 0 && (size_t)len < cap; i++)
+	{
+		len += snprintf(path + len, cap - len, "%02x", uid[i]);
+	}
+	return len > 0 && (size_t)len < cap;
+}
+
+bool STM32WebFlasherESP8266::openShadow(char* path, size_t cap)
+{
+	if (!shadowFile(path, cap)) return false;
+	STM32FlashGeometry g = STM32FamilyDb::getFlashGeometry(_flasher.familyInfo(), _flasher.flashKb());
+	if (!_shadow.begin(_flasher.devId(), _flasher.flashKb(), g, _flasher.uid())) return false;
+	if (LittleFS.exists(path))
+	{
+		File f = LittleFS.open(path, "r");
+		if (f)
+		{
+			_shadow.load(f);
+			f.close();
+		}
+	}
+	return true;
+}
+
+void STM32WebFlasherESP8266::closeShadow(const char* path)
+{
+	File f = LittleFS.open(path, "w");
+	if (f)
+	{
+		bool ok = _shadow.save(f);
+		f.close();
+		if (!ok) LittleFS.remove(path);
+	}
+	_shadow.end();
+}
+
+/* A mass erase is known exactly, and programmed blocks are unknown until a verify hashes them.
+   Scripts and manifests may write anywhere, so they drop the shadow. */
+void STM32WebFlasherESP8266::updateShadow(char job, bool ok)
+{
+	char path[48];
+	if (job == 'B' || job == 'M')
+	{
+		if (shadowFile(path, sizeof(path))) LittleFS.remove(path);
+		return;
+	}
+	if (!openShadow(path, sizeof(path))) return;
+
+	uint32_t len = loadImageInfo(false) ? _image.size : 0;
+	if (job == 'E' || job == 'S')
+	{
+		if (ok) _shadow.markErased();
+		else _shadow.forgetAll();
+	}
+	if (job == 'S' || job == 'U') _shadow.forget(0, len);
+	if (job == 'V')
+	{
+		File f = LittleFS.open(_cfg.updatePath, "r");
+		if (!ok || !f || !_shadow.setImage(f, len)) _shadow.forget(0, len);
+		if (f) f.close();
+	}
+	closeShadow(path);
+}
+
+void STM32WebFlasherESP8266::sendBatchError()
+{
+	char buf[160];
+	STM32BufferPrint out(buf, sizeof(buf));
+	STM32JsonWriter json(out);
+	json.beginObject();
+	json.add("ok", false);
+	json.add("line", (unsigned)_batch.errorLine());
+	json.add("error", _batch.error());
+	json.endObject();
+	sendJson(400, out);
+}
+
+void STM32WebFlasherESP8266::sendBatchReport(bool ok)
+{
+	countJob(ok, _batch.stepCount() ? _batch.step(_batch.stepCount() - 1).res : STM32RomResult());
+	updateShadow(_job, ok);
+
+	_server.setContentLength(CONTENT_LENGTH_UNKNOWN);
+	_server.send(200, "application/json", "");
+	{
+		STM32ChunkedPrint out(_server);
+		_batch.writeReport(out);
+	}
+	_server.sendContent("");
+}
+
 #endif
@@ -19,8 +19,125 @@
 #include <LittleFS.h>
 
 #include "STM32WebPages.h"
+#include "STM32JsonWriter.h"
 #include "STM32WebFlasherConfig.h"
 #include "STM32RomFlasher.h"
+#include "STM32Uart.h"
+#include "STM32BatchRunner.h"
+#include "STM32UploadWriter.h"
+#include "STM32ImagePatch.h"
+#include "STM32ImagePreflight.h"
+#include "STM32Telemetry.h"
+#include "STM32EventLog.h"
+#include "STM32FrameTracer.h"
+#include "STM32FlashHistory.h"
+#include "STM32FlashShadow.h"
+#include "STM32SerialBridge.h"
+
+/* Print that batches output into fixed-size chunks of a chunked HTTP response */
+class STM32ChunkedPrint : public Print
+{
+	public:
+	explicit STM32ChunkedPrint(ESP8266WebServer& server);
+	~STM32ChunkedPrint();
+
+	size_t write(uint8_t c) override;
+	size_t write(const uint8_t* data, size_t len) override;
+	void flush() override;
+
+	private:
+	ESP8266WebServer* _server;
+	char _buf[512];
+	size_t _len;
+};
+
+/* Batch script file names are LittleFS paths; scratch file N is "<scratchPath>N.bin" */
+class STM32LittleFsFiles : public STM32BatchFiles
+{
+	public:
+	STM32LittleFsFiles() : _scratch(nullptr) {}
+
+	void setScratchPath(const char* prefix) { _scratch = prefix; }
+	Stream* open(const char* name, size_t& len) override;
+	void close() override;
+	Stream* openScratch(uint8_t slot, bool write) override;
+
+	private:
+	File _file;
+	const char* _scratch;
+};
+
+/* Patches the stored image: the base is read from `path`, the result goes through the upload writer
+   to "<path>.tmp" and only replaces the base once the caller commits it */
+class STM32LittleFsPatch : public STM32PatchTarget
+{
+	public:
+	explicit STM32LittleFsPatch(STM32UploadWriter& writer) : _writer(&writer), _path(nullptr), _started(false) {}
+
+	bool open(const char* path);
+	void close();
+	/* The writer was begun for this patch, so its error() belongs to it */
+	bool started() const { return _started; }
+
+	size_t readBase(uint32_t offset, uint8_t* dst, size_t len) override;
+	bool begin(uint32_t newSize) override;
+	bool write(const uint8_t* data, size_t len) override { return _writer->write(data, len); }
+
+	private:
+	STM32UploadWriter* _writer;
+	File _base;
+	const char* _path;
+	bool _started;
+};
+
+/* Fixed-size records appended to one LittleFS file, which is rotated to "<path>.1" when full, so
+   what is kept on flash is bounded at twice maxBytes */
+class STM32LittleFsRecords
+{
+	public:
+	STM32LittleFsRecords();
+	void begin(const char* path, uint32_t maxBytes, size_t recordSize);
+
+	void append(const void* rec);
+	/* Whole records in both files; a torn record at the end is not counted */
+	size_t count() const;
+	/* Records [from, from + max) of both files, oldest first; returns how many */
+	size_t read(size_t from, void* out, size_t max) const;
+
+	private:
+	const char* _path;
+	char _old[40];
+	uint32_t _maxBytes;
+	size_t _size;
+
+	size_t records(const char* path) const;
+	size_t readFile(const char* path, size_t from, uint8_t* out, size_t max) const;
+};
+
+class STM32LittleFsEventStore : public STM32EventStore
+{
+	public:
+	void begin(const char* path, uint32_t maxBytes) { _file.begin(path, maxBytes, sizeof(STM32Event)); }
+
+	void append(const STM32Event& e) override { _file.append(&e); }
+	size_t load(STM32Event* out, size_t max) override;
+
+	private:
+	STM32LittleFsRecords _file;
+};
+
+class STM32LittleFsHistoryStore : public STM32HistoryStore
+{
+	public:
+	void begin(const char* path, uint32_t maxBytes) { _file.begin(path, maxBytes, sizeof(STM32HistoryRecord)); }
+
+	void append(const STM32HistoryRecord& r) override { _file.append(&r); }
+	size_t count() override { return _file.count(); }
+	size_t read(size_t from, STM32HistoryRecord* out, size_t max) override { return _file.read(from, out, max); }
+
+	private:
+	STM32LittleFsRecords _file;
+};
 
 class STM32WebFlasherESP8266
 {
@@ -31,32 +148,135 @@ class STM32WebFlasherESP8266
 	void loop();
 
 	private:
-	void sendHtml_P(const char* pgmHtml);
-	void sendHtmlWithHost_P(const char* partA, const char* host, const char* partB);
+	enum Route : uint8_t
+	{
+		ROUTE_ROOT,
+		ROUTE_UPLOAD,
+		ROUTE_CMD,
+		ROUTE_STATUS,
+		ROUTE_CONNECT,
+		ROUTE_DISCONNECT,
+		ROUTE_LOGIN,
+		ROUTE_LOGOUT,
+		ROUTE_HEAP,
+		ROUTE_METRICS,
+		ROUTE_BATCH,
+		ROUTE_TELEMETRY,
+		ROUTE_EVENTS,
+		ROUTE_TRACE,
+		ROUTE_HISTORY,
+		ROUTE_MANIFEST,
+		ROUTE_IMAGE,
+		ROUTE_PATCH,
+		ROUTE_NOT_FOUND,
+		ROUTE_COUNT
+	};
+
+	/* Free-heap change measured around each handler (after - before) */
+	struct RouteHeap
+	{
+		uint32_t calls;
+		int32_t lastDelta;
+		int32_t worstDelta;
+		uint32_t minFree;
+	};
+
+	void runRoute(Route route, void (STM32WebFlasherESP8266::*handler)());
+	/* Bracket every target job: telemetry, the job counters, the job_ok/job_failed event and the
+	   flash history record */
+	void startJob(char job);
+	void countJob(bool ok, const STM32RomResult& res);
+	void pollUartErrors();
+
+	void sendAsset(const STM32WebAsset& asset);
+	void sendJson(int code, const STM32BufferPrint& body);
+	void sendJsonError(int code, const char* error);
+	void sendResult(const char* prefix, const STM32RomResult& res);
+	/* Checks the stored image against the connected part; false if there is no image */
+	bool preflight(STM32Preflight& out);
+	/* Fills _image from updatePath on first use; with `crc` also hashes the whole file once */
+	bool loadImageInfo(bool crc);
+	void sendPreflight(const STM32Preflight& pf);
+	/* Job S with a preserve list: erase, program and keep the listed ranges through a manifest */
+	void flashPreserving(const char* keep);
+	/* Job D: erase and write only the blocks of updatePath that differ from the shadow */
+	void deltaUpdate();
+	/* "<shadowPath><UID in hex>"; false without a UID or shadowPath */
+	bool shadowFile(char* path, size_t cap);
+	/* Lays _shadow out for the connected part and loads what was saved for its UID */
+	bool openShadow(char* path, size_t cap);
+	void closeShadow(const char* path);
+	/* Brings the saved shadow in line with a finished job that wrote flash */
+	void updateShadow(char job, bool ok);
+	/* 400 with the line and error of a script or manifest that did not parse */
+	void sendBatchError();
+	/* 200 with the batch report once a script or manifest has run */
+	void sendBatchReport(bool ok);
 
 	bool requireLogin();
 
 	void routeRoot();
 	void routeNotFound();
 	void routeUpload();
+	void routeUploadDone();
 	void routeCmd();
 	void routeStatus();
 	void routeConnect();
 	void routeDisconnect();
 	void routeLogin();
 	void routeLogout();
+	void routeHeap();
+	void routeMetrics();
+	void routeBatch();
+	void routeTelemetry();
+	void routeEvents();
+	void routeTrace();
+	void routeTraceControl();
+	void routeHistory();
+	void routeManifest();
+	void routeImage();
+	void routePatch();
+	void routePatchDone();
 
 	private:
 	HardwareSerial* _serial;
 	STM32WebFlasherConfig _cfg;
 	ESP8266WebServer _server;
 
-	STM32RomFlasher _flasher;
+	/* Takes UART0 over from _serial in begin() */
+	STM32Uart _uart;
+	STM32EspFlasher _flasher;
+	/* Host tools on the UART; routes that drive the target answer 409 while it has a client */
+	STM32SerialBridge _bridge;
+	STM32FlasherMetrics _metrics;
+	STM32Telemetry _telemetry;
+	STM32EventLog _events;
+	STM32LittleFsEventStore _eventStore;
+	char _job;
+	/* Image bytes the running job left alone because flash already held them */
+	uint32_t _jobSkipped;
+	STM32FrameTracer _tracer;
+	STM32FlashHistory _history;
+	STM32LittleFsHistoryStore _historyStore;
+
+	STM32LittleFsFiles _batchFiles;
+	STM32EspBatchRunner _batch;
+	STM32FlashShadow _shadow;
+	STM32EspDeltaUpdater _delta;
 
 	bool _loggedIn;
 	IPAddress _loggedIp;
 
-	File _uploadFile;
+	STM32UploadWriter _upload;
+	/* Vector table words and size of updatePath, from the last upload or read on first use */
+	STM32ImageInfo _image;
+	bool _imageKnown;
+	STM32LittleFsPatch _patchFiles;
+	STM32PatchApplier _patch;
+	/* Why the last POST /patch was refused before the applier ran */
+	const char* _patchError;
+
+	RouteHeap _routeHeap[ROUTE_COUNT];
 };
 
 #endif
@@ -0,0 +1,373 @@
+/********************************************************************************************************
+ *  [FILE NAME]   :      <STM32SerialBridge.cpp>                                                        *
+ *  [AUTHOR]      :      <David S. Alexander>                                                           *
+ *  [DATE CREATED]:      <Dec 10, 2025>                                                                 *
+ *  [Description] :      <Source file for the TCP to target UART bridge>                                *
+ ********************************************************************************************************/
+
+#ifdef ESP8266
+#include "STM32SerialBridge.h"
+
+/* Telnet (RFC 854) */
+static const uint8_t TN_SE = 240;
+static const uint8_t TN_SB = 250;
+static const uint8_t TN_WILL = 251;
+static const uint8_t TN_WONT = 252;
+static const uint8_t TN_DO = 253;
+static const uint8_t TN_DONT = 254;
+static const uint8_t TN_IAC = 255;
+static const uint8_t OPT_BINARY = 0;
+static const uint8_t OPT_SGA = 3;
+static const uint8_t OPT_COM_PORT = 44;
+
+/* COM-PORT-OPTION commands (RFC 2217); the server answers each with the command + 100 */
+enum ComPortCmd : uint8_t
+{
+	CPO_SIGNATURE = 0,
+	CPO_SET_BAUDRATE = 1,
+	CPO_SET_DATASIZE = 2,
+	CPO_SET_PARITY = 3,
+	CPO_SET_STOPSIZE = 4,
+	CPO_SET_CONTROL = 5,
+	CPO_NOTIFY_LINESTATE = 6,
+	CPO_NOTIFY_MODEMSTATE = 7,
+	CPO_PURGE_DATA = 12
+};
+
+static const uint8_t CPO_SERVER = 100;
+static const uint8_t PARITY_EVEN = 3;
+static const char SIGNATURE[] = "ESP8266 STM32 bridge";
+
+STM32SerialBridge::STM32SerialBridge(STM32Uart& uart, STM32EspFlasher& flasher, uint8_t boot0Pin, uint8_t resetPin, uint16_t port)
+: _uart(&uart),
+_flasher(&flasher),
+_boot0(boot0Pin),
+_reset(resetPin),
+_port(port),
+_idleBaud(0),
+_server(port),
+_open(false),
+_mode(STM32_BRIDGE_NONE),
+_tn(TN_DATA),
+_verb(0),
+_sbLen(0),
+_dtr(false),
+_rts(false),
+_toTarget(0),
+_fromTarget(0)
+{
+}
+
+void STM32SerialBridge::begin()
+{
+	if (_port == 0) return;
+	_idleBaud = _uart->baud();
+	_server.begin();
+	_server.setNoDelay(true);
+}
+
+STM32BridgeEvent STM32SerialBridge::poll()
+{
+	if (_port == 0) return STM32_BRIDGE_IDLE;
+
+	if (_open && !_client.connected())
+	{
+		close();
+		return STM32_BRIDGE_CLOSED;
+	}
+
+	if (!_open)
+	{
+		_client = _server.accept();
+		if (!_client) return STM32_BRIDGE_IDLE;
+		_client.setNoDelay(true);
+		_open = true;
+		_mode = STM32_BRIDGE_NONE;
+		_tn = TN_DATA;
+		_dtr = false;
+		_rts = false;
+		_toTarget = 0;
+		_fromTarget = 0;
+		/* Whatever the target sent before the session is not the client's */
+		uint8_t junk[64];
+		while (_uart->read(junk, sizeof(junk))) {}
+		return STM32_BRIDGE_OPENED;
+	}
+
+	/* One client at a time */
+	if (_server.hasClient()) _server.accept().stop();
+
+	toUart();
+	toClient();
+	return STM32_BRIDGE_IDLE;
+}
+
+void STM32SerialBridge::close()
+{
+	_client.stop();
+	_open = false;
+	if (_mode == STM32_BRIDGE_RAW)
+	{
+		_flasher->exitToUserApp();
+	}
+	else if (_mode == STM32_BRIDGE_RFC2217)
+	{
+		/* Released, not pulsed: whatever the client left running keeps running */
+		digitalWrite(_boot0, LOW);
+		digitalWrite(_reset, HIGH);
+	}
+	if (_uart->baud() != _idleBaud) _uart->setBaud(_idleBaud);
+	_mode = STM32_BRIDGE_NONE;
+}
+
+void STM32SerialBridge::toUart()
+{
+	uint8_t buf[STM32_BRIDGE_CHUNK];
+	int avail;
+	while ((avail = _client.available()) > 0)
+	{
+		size_t want = ((size_t)avail < sizeof(buf)) ? (size_t)avail : sizeof(buf);
+		int got = _client.read(buf, want);
+		if (got <= 0) break;
+		size_t n = (size_t)got;
+
+		if (_mode == STM32_BRIDGE_NONE)
+		{
+			_mode = (buf[0] == TN_IAC) ? STM32_BRIDGE_RFC2217 : STM32_BRIDGE_RAW;
+			/* A raw client cannot reach the pins, so it gets the bootloader; its first bytes wait in buf */
+			if (_mode == STM32_BRIDGE_RAW) _flasher->enterRomBootloader();
+		}
+		if (_mode == STM32_BRIDGE_RFC2217) n = decode(buf, n);
+		if (n)
+		{
+			_uart->write(buf, n);
+			_toTarget += (uint32_t)n;
+		}
+	}
+}
+
+void STM32SerialBridge::toClient()
+{
+	uint8_t in[STM32_BRIDGE_CHUNK];
+	uint8_t out[2 * STM32_BRIDGE_CHUNK];
+	size_t n;
+	while ((n = _uart->read(in, sizeof(in))) > 0)
+	{
+		_fromTarget += (uint32_t)n;
+		if (_mode != STM32_BRIDGE_RFC2217)
+		{
+			_client.write(in, n);
+			continue;
+		}
+		size_t m = 0;
+		for (size_t i = 0; i < n; i++)
+		{
+			out[m++] = in[i];
+			if (in[i] == TN_IAC) out[m++] = TN_IAC;
+		}
+		_client.write(out, m);
+	}
+}
+
+size_t STM32SerialBridge::decode(uint8_t* buf, size_t len)
+{
+	size_t out = 0;
+	for (size_t i = 0; i < len; i++)
+	{
+		uint8_t b = buf[i];
+		switch (_tn)
+		{
+			case TN_DATA:
+			if (b == TN_IAC) _tn = TN_IAC;
+			else buf[out++] = b;
+			break;
+
+			case TN_IAC:
+			_tn = TN_DATA;
+			if (b == TN_IAC) buf[out++] = b;
+			else if (b >= TN_WILL && b <= TN_DONT)
+			{
+				_verb = b;
+				_tn = TN_OPTION;
+			}
+			else if (b == TN_SB)
+			{
+				_sbLen = 0;
+				_tn = TN_SB;
+			}
+			/* NOP, break and the other one-byte commands mean nothing to a UART */
+			break;
+
+			case TN_OPTION:
+			negotiate(_verb, b);
+			_tn = TN_DATA;
+			break;
+
+			case TN_SB:
+			if (b == TN_IAC) _tn = TN_SB_IAC;
+			else if (_sbLen < sizeof(_sb)) _sb[_sbLen++] = b;
+			break;
+
+			case TN_SB_IAC:
+			default:
+			if (b == TN_SE)
+			{
+				comPortOption();
+				_tn = TN_DATA;
+			}
+			else
+			{
+				/* IAC IAC inside a subnegotiation is a 0xFF value byte */
+				if (_sbLen < sizeof(_sb)) _sb[_sbLen++] = b;
+				_tn = TN_SB;
+			}
+			break;
+		}
+	}
+	return out;
+}
+
+void STM32SerialBridge::negotiate(uint8_t verb, uint8_t option)
+{
+	/* WONT and DONT turn off what was never on, so they need no answer */
+	if (verb != TN_WILL && verb != TN_DO) return;
+	bool ok = option == OPT_BINARY || option == OPT_SGA || option == OPT_COM_PORT;
+	uint8_t answer[3] = { TN_IAC, 0, option };
+	if (verb == TN_WILL) answer[1] = ok ? TN_DO : TN_DONT;
+	else answer[1] = ok ? TN_WILL : TN_WONT;
+	_client.write(answer, sizeof(answer));
+}
+
+void STM32SerialBridge::comPortOption()
+{
+	if (_sbLen < 2 || _sb[0] != OPT_COM_PORT) return;
+	uint8_t cmd = _sb[1];
+	const uint8_t* value = _sb + 2;
+	size_t len = _sbLen - 2;
+
+	switch (cmd)
+	{
+		case CPO_SIGNATURE:
+		reply(cmd, (const uint8_t*)SIGNATURE, sizeof(SIGNATURE) - 1);
+		break;
+
+		case CPO_SET_BAUDRATE:
+		{
+			/* 0 asks for the current rate */
+			uint32_t baud = (len >= 4) ? ((uint32_t)value[0] << 24) | ((uint32_t)value[1] << 16) | ((uint32_t)value[2] << 8) | value[3] : 0;
+			if (baud) _uart->setBaud(baud);
+			baud = _uart->baud();
+			uint8_t answer[4] = { (uint8_t)(baud >> 24), (uint8_t)(baud >> 16), (uint8_t)(baud >> 8), (uint8_t)baud };
+			reply(cmd, answer, sizeof(answer));
+			break;
+		}
+
+		/* The bootloader needs 8E1, so other framings are answered with what the UART keeps */
+		case CPO_SET_DATASIZE:
+		replyByte(cmd, 8);
+		break;
+
+		case CPO_SET_PARITY:
+		replyByte(cmd, PARITY_EVEN);
+		break;
+
+		case CPO_SET_STOPSIZE:
+		replyByte(cmd, 1);
+		break;
+
+		case CPO_SET_CONTROL:
+		setControl(len ? value[0] : 0);
+		break;
+
+		case CPO_NOTIFY_LINESTATE:
+		case CPO_NOTIFY_MODEMSTATE:
+		replyByte(cmd, 0);
+		break;
+
+		case CPO_PURGE_DATA:
+		/* 1 and 3 drop what the target sent and the client has not read yet */
+		if (len && (value[0] & 1))
+		{
+			uint8_t junk[64];
+			while (_uart->read(junk, sizeof(junk))) {}
+		}
+		reply(cmd, value, len);
+		break;
+
+		default:
+		/* Masks and flow control suspend/resume: acknowledged, there is nothing to report */
+		reply(cmd, value, len);
+		break;
+	}
+}
+
+void STM32SerialBridge::setControl(uint8_t value)
+{
+	uint8_t answer = value;
+	switch (value)
+	{
+		/* Only "no flow control" */
+		case 0:
+		case 1:
+		case 2:
+		case 3:
+		answer = 1;
+		break;
+
+		/* BREAK stays off */
+		case 4:
+		case 5:
+		case 6:
+		answer = 6;
+		break;
+
+		case 7:
+		answer = _dtr ? 8 : 9;
+		break;
+
+		case 8:
+		case 9:
+		_dtr = (value == 8);
+		digitalWrite(_reset, _dtr ? LOW : HIGH);
+		break;
+
+		case 10:
+		answer = _rts ? 11 : 12;
+		break;
+
+		case 11:
+		case 12:
+		_rts = (value == 11);
+		digitalWrite(_boot0, _rts ? HIGH : LOW);
+		break;
+
+		default:
+		break;
+	}
+	replyByte(CPO_SET_CONTROL, answer);
+}
+
+void STM32SerialBridge::replyByte(uint8_t cmd, uint8_t value)
+{
+	reply(cmd, &value, 1);
+}
+
+void STM32SerialBridge::reply(uint8_t cmd, const uint8_t* value, size_t len)
+{
+	uint8_t out[2 * sizeof(SIGNATURE) + 6];
+	size_t n = 0;
+	out[n++] = TN_IAC;
+	out[n++] = TN_SB;
+	out[n++] = OPT_COM_PORT;
+	out[n++] = (uint8_t)(cmd + CPO_SERVER);
+	for (size_t i = 0; i < len && n + 4 <= sizeof(out); i++)
+	{
+		out[n++] = value[i];
+		if (value[i] == TN_IAC) out[n++] = TN_IAC;
+	}
+	out[n++] = TN_IAC;
+	out[n++] = TN_SE;
+	_client.write(out, n);
+}
+
+#endif
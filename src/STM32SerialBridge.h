@@ -0,0 +1,104 @@
+/********************************************************************************************************
+ *  [FILE NAME]   :      <STM32SerialBridge.h>                                                          *
+ *  [AUTHOR]      :      <David S. Alexander>                                                           *
+ *  [DATE CREATED]:      <Dec 10, 2025>                                                                 *
+ *  [Description] :      <Header file for the TCP to target UART bridge>                                *
+ ********************************************************************************************************/
+
+#ifndef STM32_SERIAL_BRIDGE_H
+#define	STM32_SERIAL_BRIDGE_H
+
+
+#ifdef ESP8266
+
+#include <Arduino.h>
+#include <ESP8266WiFi.h>
+#include "STM32Uart.h"
+#include "STM32RomFlasher.h"
+
+/* TCP bytes moved to the UART per read: one TX FIFO */
+static const size_t STM32_BRIDGE_CHUNK = 128;
+
+enum STM32BridgeMode : uint8_t
+{
+	STM32_BRIDGE_NONE,		/* no client, or nothing received from it yet */
+	STM32_BRIDGE_RAW,		/* plain bytes; the target is reset into the ROM bootloader for it */
+	STM32_BRIDGE_RFC2217	/* telnet with COM-PORT-OPTION; the client drives BOOT0 and NRST */
+};
+
+enum STM32BridgeEvent : uint8_t
+{
+	STM32_BRIDGE_IDLE,
+	STM32_BRIDGE_OPENED,
+	STM32_BRIDGE_CLOSED
+};
+
+/* Forwards one TCP client to the target UART, 8E1 at uartBaud, so host tools can run AN3155
+   themselves. The first byte picks the mode: a telnet IAC starts RFC 2217, where DTR asserted holds
+   NRST low, RTS asserted drives BOOT0 high and SET-BAUDRATE changes the UART rate (parity and
+   framing requests are answered with 8E1); anything else is a raw stream such as socat gives
+   stm32flash. TCP data goes to the UART in FIFO-sized writes, and the socket runs without Nagle so
+   single ACK bytes go out on the next poll. */
+class STM32SerialBridge
+{
+	public:
+	STM32SerialBridge(STM32Uart& uart, STM32EspFlasher& flasher, uint8_t boot0Pin, uint8_t resetPin, uint16_t port);
+
+	void begin();
+	/* Call from loop(): accepts a client and moves whatever is waiting in both directions */
+	STM32BridgeEvent poll();
+
+	bool active() const { return _open; }
+	STM32BridgeMode mode() const { return _mode; }
+	IPAddress clientIp() { return _client.remoteIP(); }
+	/* Bytes of the current or last session */
+	uint32_t toTarget() const { return _toTarget; }
+	uint32_t fromTarget() const { return _fromTarget; }
+
+	private:
+	enum TelnetState : uint8_t
+	{
+		TN_DATA,
+		TN_IAC,
+		TN_OPTION,	/* after WILL/WONT/DO/DONT */
+		TN_SB,
+		TN_SB_IAC
+	};
+
+	STM32Uart* _uart;
+	STM32EspFlasher* _flasher;
+	uint8_t _boot0;
+	uint8_t _reset;
+	uint16_t _port;
+	uint32_t _idleBaud;
+
+	WiFiServer _server;
+	WiFiClient _client;
+	bool _open;
+	STM32BridgeMode _mode;
+
+	TelnetState _tn;
+	uint8_t _verb;
+	uint8_t _sb[8];
+	uint8_t _sbLen;
+	bool _dtr;
+	bool _rts;
+
+	uint32_t _toTarget;
+	uint32_t _fromTarget;
+
+	void close();
+	void toUart();
+	void toClient();
+	/* Telnet decoding of one TCP read; data bytes are compacted to the front of buf */
+	size_t decode(uint8_t* buf, size_t len);
+	void negotiate(uint8_t verb, uint8_t option);
+	void comPortOption();
+	void reply(uint8_t cmd, const uint8_t* value, size_t len);
+	void replyByte(uint8_t cmd, uint8_t value);
+	void setControl(uint8_t value);
+};
+
+#endif
+
+#endif	/* STM32_SERIAL_BRIDGE_H */
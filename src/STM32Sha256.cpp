@@ -0,0 +1,149 @@
+/********************************************************************************************************
+ *  [FILE NAME]   :      <STM32Sha256.cpp>                                                              *
+ *  [AUTHOR]      :      <David S. Alexander>                                                           *
+ *  [DATE CREATED]:      <Dec 10, 2025>                                                                 *
+ *  [Description] :      <Source file for the streaming SHA-256 hash>                                   *
+ ********************************************************************************************************/
+
+#include "STM32Sha256.h"
+
+static const uint32_t K[64] PROGMEM =
+{
+	0x428a2f98, 0x71374491, 0xb5c0fbcf, 0xe9b5dba5, 0x3956c25b, 0x59f111f1, 0x923f82a4, 0xab1c5ed5,
+	0xd807aa98, 0x12835b01, 0x243185be, 0x550c7dc3, 0x72be5d74, 0x80deb1fe, 0x9bdc06a7, 0xc19bf174,
+	0xe49b69c1, 0xefbe4786, 0x0fc19dc6, 0x240ca1cc, 0x2de92c6f, 0x4a7484aa, 0x5cb0a9dc, 0x76f988da,
+	0x983e5152, 0xa831c66d, 0xb00327c8, 0xbf597fc7, 0xc6e00bf3, 0xd5a79147, 0x06ca6351, 0x14292967,
+	0x27b70a85, 0x2e1b2138, 0x4d2c6dfc, 0x53380d13, 0x650a7354, 0x766a0abb, 0x81c2c92e, 0x92722c85,
+	0xa2bfe8a1, 0xa81a664b, 0xc24b8b70, 0xc76c51a3, 0xd192e819, 0xd6990624, 0xf40e3585, 0x106aa070,
+	0x19a4c116, 0x1e376c08, 0x2748774c, 0x34b0bcb5, 0x391c0cb3, 0x4ed8aa4a, 0x5b9cca4f, 0x682e6ff3,
+	0x748f82ee, 0x78a5636f, 0x84c87814, 0x8cc70208, 0x90befffa, 0xa4506ceb, 0xbef9a3f7, 0xc67178f2
+};
+
+static inline uint32_t ror(uint32_t x, uint8_t n)
+{
+	return (x >> n) | (x << (32 - n));
+}
+
+void STM32Sha256::begin()
+{
+	_h[0] = 0x6a09e667;
+	_h[1] = 0xbb67ae85;
+	_h[2] = 0x3c6ef372;
+	_h[3] = 0xa54ff53a;
+	_h[4] = 0x510e527f;
+	_h[5] = 0x9b05688c;
+	_h[6] = 0x1f83d9ab;
+	_h[7] = 0x5be0cd19;
+	_fill = 0;
+	_bytes = 0;
+}
+
+void STM32Sha256::compress(const uint8_t* block)
+{
+	/* 16-word rolling schedule instead of the full 64 words, to keep the stack small */
+	uint32_t w[16];
+	for (uint8_t i = 0; i < 16; i++)
+	{
+		w[i] = ((uint32_t)block[4 * i] << 24) | ((uint32_t)block[4 * i + 1] << 16) | ((uint32_t)block[4 * i + 2] << 8) | block[4 * i + 3];
+	}
+
+	uint32_t a = _h[0], b = _h[1], c = _h[2], d = _h[3];
+	uint32_t e = _h[4], f = _h[5], g = _h[6], h = _h[7];
+	for (uint8_t i = 0; i < 64; i++)
+	{
+		if (i >= 16)
+		{
+			uint32_t w15 = w[(i + 1) & 15];
+			uint32_t w2 = w[(i + 14) & 15];
+			uint32_t s0 = ror(w15, 7) ^ ror(w15, 18) ^ (w15 >> 3);
+			uint32_t s1 = ror(w2, 17) ^ ror(w2, 19) ^ (w2 >> 10);
+			w[i & 15] += s0 + w[(i + 9) & 15] + s1;
+		}
+		uint32_t t1 = h + (ror(e, 6) ^ ror(e, 11) ^ ror(e, 25)) + ((e & f) ^ (~e & g)) + pgm_read_dword(&K[i]) + w[i & 15];
+		uint32_t t2 = (ror(a, 2) ^ ror(a, 13) ^ ror(a, 22)) + ((a & b) ^ (a & c) ^ (b & c));
+		h = g;
+		g = f;
+		f = e;
+		e = d + t1;
+		d = c;
+		c = b;
+		b = a;
+		a = t1 + t2;
+	}
+
+	_h[0] += a;
+	_h[1] += b;
+	_h[2] += c;
+	_h[3] += d;
+	_h[4] += e;
+	_h[5] += f;
+	_h[6] += g;
+	_h[7] += h;
+}
+
+void STM32Sha256::update(const uint8_t* data, size_t len)
+{
+	_bytes += (uint32_t)len;
+	if (_fill)
+	{
+		size_t n = 64 - _fill;
+		if (n > len) n = len;
+		memcpy(_block + _fill, data, n);
+		_fill += (uint32_t)n;
+		data += n;
+		len -= n;
+		if (_fill < 64) return;
+		compress(_block);
+		_fill = 0;
+	}
+	while (len >= 64)
+	{
+		compress(data);
+		data += 64;
+		len -= 64;
+	}
+	memcpy(_block, data, len);
+	_fill = (uint32_t)len;
+}
+
+void STM32Sha256::finish(uint8_t* digest)
+{
+	/* The length in bits is a 64-bit big-endian field; a 32-bit byte count fills 35 bits of it */
+	uint32_t bits = _bytes << 3;
+	_block[_fill++] = 0x80;
+	if (_fill > 56)
+	{
+		memset(_block + _fill, 0, 64 - _fill);
+		compress(_block);
+		_fill = 0;
+	}
+	memset(_block + _fill, 0, 56 - _fill);
+	_block[56] = 0;
+	_block[57] = 0;
+	_block[58] = 0;
+	_block[59] = (uint8_t)(_bytes >> 29);
+	_block[60] = (uint8_t)(bits >> 24);
+	_block[61] = (uint8_t)(bits >> 16);
+	_block[62] = (uint8_t)(bits >> 8);
+	_block[63] = (uint8_t)bits;
+	compress(_block);
+
+	for (uint8_t i = 0; i < 8; i++)
+	{
+		digest[4 * i] = (uint8_t)(_h[i] >> 24);
+		digest[4 * i + 1] = (uint8_t)(_h[i] >> 16);
+		digest[4 * i + 2] = (uint8_t)(_h[i] >> 8);
+		digest[4 * i + 3] = (uint8_t)_h[i];
+	}
+}
+
+void STM32Sha256::toHex(const uint8_t* digest, char* out)
+{
+	static const char HEX_DIGITS[] = "0123456789abcdef";
+	for (size_t i = 0; i < STM32_SHA256_LEN; i++)
+	{
+		out[2 * i] = HEX_DIGITS[digest[i] >> 4];
+		out[2 * i + 1] = HEX_DIGITS[digest[i] & 0x0F];
+	}
+	out[2 * STM32_SHA256_LEN] = '\0';
+}
@@ -0,0 +1,38 @@
+/********************************************************************************************************
+ *  [FILE NAME]   :      <STM32Sha256.h>                                                                *
+ *  [AUTHOR]      :      <David S. Alexander>                                                           *
+ *  [DATE CREATED]:      <Dec 10, 2025>                                                                 *
+ *  [Description] :      <Header file for the streaming SHA-256 hash>                                   *
+ ********************************************************************************************************/
+
+#ifndef STM32_SHA256_H
+#define	STM32_SHA256_H
+
+#include <Arduino.h>
+
+static const size_t STM32_SHA256_LEN = 32;
+
+/* FIPS 180-4 SHA-256 over data fed in pieces of any size; 104 bytes of state, no heap */
+class STM32Sha256
+{
+	public:
+	STM32Sha256() { begin(); }
+
+	void begin();
+	void update(const uint8_t* data, size_t len);
+	/* Writes the digest; begin() again before reusing the object */
+	void finish(uint8_t* digest);
+
+	/* 64 lowercase hex digits and a terminator into `out` */
+	static void toHex(const uint8_t* digest, char* out);
+
+	private:
+	uint32_t _h[8];
+	uint8_t _block[64];
+	uint32_t _fill;
+	uint32_t _bytes;
+
+	void compress(const uint8_t* block);
+};
+
+#endif	/* STM32_SHA256_H */
@@ -0,0 +1,26 @@
+/********************************************************************************************************
+ *  [FILE NAME]   :      <STM32StubImages.cpp>                                                          *
+ *  [AUTHOR]      :      <David S. Alexander>                                                           *
+ *  [DATE CREATED]:      <Dec 10, 2025>                                                                 *
+ *  [Description] :      <Source file for the built-in RAM loader stub binaries>                        *
+ ********************************************************************************************************/
+
+/* Generated by extras/stub/embed_stubs.py from the binaries in extras/stub/build - do not edit by hand. */
+
+#include "STM32StubImages.h"
+
+/* No stub binaries have been built; run `make -C extras/stub embed`. */
+
+static const STM32StubImage STUB_IMAGES[] =
+{
+	{ STM32_UNKNOWN, 0, nullptr, 0 }
+};
+
+const STM32StubImage* STM32StubImages::find(STM32Family family)
+{
+	for (size_t i = 0; STUB_IMAGES[i].data; i++)
+	{
+		if (STUB_IMAGES[i].family == family) return &STUB_IMAGES[i];
+	}
+	return nullptr;
+}
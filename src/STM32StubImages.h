@@ -0,0 +1,31 @@
+/********************************************************************************************************
+ *  [FILE NAME]   :      <STM32StubImages.h>                                                            *
+ *  [AUTHOR]      :      <David S. Alexander>                                                           *
+ *  [DATE CREATED]:      <Dec 10, 2025>                                                                 *
+ *  [Description] :      <Header file for the built-in RAM loader stub binaries>                        *
+ ********************************************************************************************************/
+
+#ifndef STM32_STUB_IMAGES_H
+#define	STM32_STUB_IMAGES_H
+
+#include <Arduino.h>
+#include "STM32StubProtocol.h"
+
+/* Binaries in STM32StubImages.cpp; extras/stub/embed_stubs.py rewrites this line */
+#define STM32_STUB_IMAGE_COUNT 0
+
+/* The stub path and its frame buffers (about 2 KB of RAM) are only built when there is a stub to run.
+   The host build defines it to 1 for the simulator's emulated stub (setStubImage). */
+#ifndef STM32_STUB_SUPPORT
+#define STM32_STUB_SUPPORT (STM32_STUB_IMAGE_COUNT > 0)
+#endif
+
+/* Stub binaries built from extras/stub and embedded by extras/stub/embed_stubs.py */
+class STM32StubImages
+{
+	public:
+	/* nullptr when no stub is built for the family; the flasher then uses the ROM protocol */
+	static const STM32StubImage* find(STM32Family family);
+};
+
+#endif	/* STM32_STUB_IMAGES_H */
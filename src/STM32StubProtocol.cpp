@@ -0,0 +1,151 @@
+/********************************************************************************************************
+ *  [FILE NAME]   :      <STM32StubProtocol.cpp>                                                        *
+ *  [AUTHOR]      :      <David S. Alexander>                                                           *
+ *  [DATE CREATED]:      <Dec 10, 2025>                                                                 *
+ *  [Description] :      <Source file for the RAM flash loader stub protocol>                           *
+ ********************************************************************************************************/
+
+#include "STM32StubProtocol.h"
+
+/* Nibble table for the reflected IEEE polynomial; same table as extras/stub/stm32_stub.c */
+static const uint32_t CRC_NIBBLE[16] =
+{
+	0x00000000UL, 0x1DB71064UL, 0x3B6E20C8UL, 0x26D930ACUL, 0x76DC4190UL, 0x6B6B51F4UL, 0x4DB26158UL, 0x5005713CUL,
+	0xEDB88320UL, 0xF00F9344UL, 0xD6D6A3E8UL, 0xCB61B38CUL, 0x9B64C2B0UL, 0x86D3D2D4UL, 0xA00AE278UL, 0xBDBDF21CUL
+};
+
+uint32_t STM32StubCodec::crc32(uint32_t crc, const uint8_t* data, size_t len)
+{
+	crc = ~crc;
+	for (size_t i = 0; i < len; i++)
+	{
+		crc ^= data[i];
+		crc = (crc >> 4) ^ CRC_NIBBLE[crc & 0x0F];
+		crc = (crc >> 4) ^ CRC_NIBBLE[crc & 0x0F];
+	}
+	return ~crc;
+}
+
+size_t STM32StubCodec::rleEncode(const uint8_t* in, size_t len, uint8_t* out, size_t cap)
+{
+	size_t o = 0;
+	size_t i = 0;
+	size_t lit = 0;	/* start of the pending literal run */
+
+	while (i < len)
+	{
+		size_t run = 1;
+		while (i + run < len && run < 130 && in[i + run] == in[i]) run++;
+
+		if (run >= 3 || i + run >= len)
+		{
+			/* Flush pending literals in runs of at most 128; memmove because out may alias in */
+			size_t end = (run >= 3) ? i : len;
+			while (lit < end)
+			{
+				size_t n = end - lit;
+				if (n > 128) n = 128;
+				if (o + 1 + n >= cap) return 0;
+				if (out)
+				{
+					out[o] = (uint8_t)(n - 1);
+					memmove(out + o + 1, in + lit, n);
+				}
+				o += 1 + n;
+				lit += n;
+			}
+			if (run < 3) break;
+
+			if (o + 2 >= cap) return 0;
+			if (out)
+			{
+				uint8_t v = in[i];
+				out[o] = (uint8_t)(0x80 + run - 3);
+				out[o + 1] = v;
+			}
+			o += 2;
+			i += run;
+			lit = i;
+		}
+		else
+		{
+			i += run;
+		}
+	}
+	return o;
+}
+
+bool STM32StubCodec::rleDecode(const uint8_t* in, size_t len, uint8_t* out, size_t cap, size_t& outLen)
+{
+	size_t i = 0;
+	size_t o = 0;
+	while (i < len)
+	{
+		uint8_t c = in[i++];
+		if (c < 0x80)
+		{
+			size_t n = (size_t)c + 1;
+			if (i + n > len || o + n > cap) return false;
+			memcpy(out + o, in + i, n);
+			i += n;
+			o += n;
+		}
+		else
+		{
+			size_t n = (size_t)c - 0x80 + 3;
+			if (i >= len || o + n > cap) return false;
+			memset(out + o, in[i++], n);
+			o += n;
+		}
+	}
+	outLen = o;
+	return true;
+}
+
+size_t STM32StubCodec::buildFrame(uint8_t* frame, uint8_t seq, uint32_t addr, size_t len, bool rle)
+{
+	uint8_t* payload = frame + STM32_STUB_FRAME_HDR;
+	uint8_t* raw = frameData(frame);
+
+	/* Sized first, since a failed in-place encode would leave the raw block half overwritten.
+	   In place is safe: the output never gets ahead of the input by more than the literal
+	   headers, and the raw block starts STM32_STUB_RLE_SLACK bytes further on. */
+	size_t plen = rle ? rleEncode(raw, len, nullptr, len) : 0;
+	uint8_t flags = plen ? STM32_STUB_FLAG_RLE : 0;
+	if (plen)
+	{
+		rleEncode(raw, len, payload, len);
+	}
+	else
+	{
+		memmove(payload, raw, len);
+		plen = len;
+	}
+
+	frame[0] = STM32_STUB_SOF;
+	frame[1] = seq;
+	frame[2] = flags;
+	put32(frame + 3, addr);
+	put16(frame + 7, (uint16_t)plen);
+	put32(payload + plen, crc32(0, frame + 1, STM32_STUB_FRAME_HDR - 1 + plen));
+	return STM32_STUB_FRAME_HDR + plen + STM32_STUB_FRAME_CRC;
+}
+
+bool STM32StubCodec::parseHello(const uint8_t* b, STM32StubHello& hello)
+{
+	if (get32(b) != STM32_STUB_MAGIC) return false;
+	hello.version = b[4];
+	hello.caps = b[5];
+	hello.window = b[6];
+	hello.block = get16(b + 7);
+	return hello.version == STM32_STUB_VERSION && hello.window > 0 && hello.block >= 4;
+}
+
+void STM32StubCodec::writeHello(uint8_t* b, const STM32StubHello& hello)
+{
+	put32(b, STM32_STUB_MAGIC);
+	b[4] = hello.version;
+	b[5] = hello.caps;
+	b[6] = hello.window;
+	put16(b + 7, hello.block);
+}
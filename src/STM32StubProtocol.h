@@ -0,0 +1,119 @@
+/********************************************************************************************************
+ *  [FILE NAME]   :      <STM32StubProtocol.h>                                                          *
+ *  [AUTHOR]      :      <David S. Alexander>                                                           *
+ *  [DATE CREATED]:      <Dec 10, 2025>                                                                 *
+ *  [Description] :      <Header file for the RAM flash loader stub protocol>                           *
+ ********************************************************************************************************/
+
+#ifndef STM32_STUB_PROTOCOL_H
+#define	STM32_STUB_PROTOCOL_H
+
+#include <Arduino.h>
+#include "STM32FamilyDb.h"
+
+/* Protocol spoken by the RAM-resident loader in extras/stub once the ROM bootloader has started it
+   with GO. All multi-byte fields are little-endian.
+
+   Image header, at the load address (GO uses the first two words as SP and reset vector):
+     u32 initialSp, u32 entry, u32 magic "STB1", u8 version, u8 caps, u8 window,
+     u8 reserved, u16 block, u16 reserved
+
+   Hello, stub -> host, once after start:
+     'S' 'T' 'B' '1', version, caps, window, block lo, block hi
+
+   Frame, host -> stub:
+     0xA5, seq, flags, addr[4], len[2], payload[len], crc32[4]
+     crc32 (IEEE) covers seq .. end of payload. With STM32_STUB_FLAG_RLE the payload decodes to at
+     most `block` bytes: control c < 0x80 copies c + 1 literal bytes, c >= 0x80 repeats the next
+     byte c - 0x80 + 3 times.
+
+   Reply, stub -> host, in order:
+     seq, status, seq ^ status ^ 0xFF
+
+   Up to `window` frames may be outstanding (go-back-N). A good frame is programmed and answered
+   with its own seq and STM32_STUB_OK; a repeat of one already programmed is answered OK again
+   without touching flash. Anything else - bad CRC, an unexpected seq, a frame left incomplete for
+   STM32_STUB_IDLE_MS - is answered with the seq the stub expects next and STM32_STUB_ERR_CRC, after
+   which the stub ignores input until the line has been idle for STM32_STUB_IDLE_MS. The host then
+   waits for the line to go quiet and resends everything from that seq on. */
+
+static const uint32_t STM32_STUB_MAGIC    = 0x31425453UL;	/* "STB1" */
+static const uint8_t  STM32_STUB_VERSION  = 1;
+static const uint8_t  STM32_STUB_SOF      = 0xA5;
+
+static const uint8_t  STM32_STUB_CAP_RLE  = 0x01;
+static const uint8_t  STM32_STUB_FLAG_RLE = 0x01;
+
+/* Host-side limits; the stub's hello may ask for less */
+static const size_t   STM32_STUB_BLOCK    = 1024;
+static const uint8_t  STM32_STUB_WINDOW   = 2;
+
+static const size_t   STM32_STUB_HEADER_LEN = 20;
+static const size_t   STM32_STUB_HELLO_LEN  = 9;
+static const size_t   STM32_STUB_REPLY_LEN  = 3;
+static const size_t   STM32_STUB_FRAME_HDR  = 9;
+static const size_t   STM32_STUB_FRAME_CRC  = 4;
+/* Room for the worst-case RLE literal headers so a block can be encoded in place */
+static const size_t   STM32_STUB_RLE_SLACK  = STM32_STUB_BLOCK / 128 + 1;
+static const size_t   STM32_STUB_FRAME_MAX  = STM32_STUB_FRAME_HDR + STM32_STUB_RLE_SLACK + STM32_STUB_BLOCK + STM32_STUB_FRAME_CRC;
+
+static const uint32_t STM32_STUB_HELLO_MS   = 200;
+static const uint32_t STM32_STUB_REPLY_MS   = 2000;
+static const uint32_t STM32_STUB_IDLE_MS    = 5;
+/* Host waits this long with no RX before resending, well past the stub's idle timeout */
+static const uint32_t STM32_STUB_QUIET_MS   = 50;
+/* Resends of the same frame before the job is failed */
+static const uint8_t  STM32_STUB_RETRIES    = 8;
+
+enum STM32StubStatus : uint8_t
+{
+	STM32_STUB_OK,
+	STM32_STUB_ERR_CRC,
+	STM32_STUB_ERR_PROGRAM,
+	STM32_STUB_ERR_RANGE,
+	STM32_STUB_ERR_DECODE
+};
+
+/* A stub binary for one family, see STM32StubImages.h */
+struct STM32StubImage
+{
+	STM32Family family;
+	uint32_t loadAddr;
+	const uint8_t* data;	/* PROGMEM on the ESP8266 */
+	uint16_t len;
+};
+
+struct STM32StubHello
+{
+	uint8_t version;
+	uint8_t caps;
+	uint8_t window;
+	uint16_t block;
+};
+
+class STM32StubCodec
+{
+	public:
+	static uint32_t crc32(uint32_t crc, const uint8_t* data, size_t len);
+
+	/* Returns the encoded length, or 0 if it would not be shorter than `cap`; a null `out` only
+	   measures. `out` may alias `in` as long as it starts at least len / 128 + 1 bytes earlier. */
+	static size_t rleEncode(const uint8_t* in, size_t len, uint8_t* out, size_t cap);
+	/* Returns false on truncated input or output past `cap` */
+	static bool rleDecode(const uint8_t* in, size_t len, uint8_t* out, size_t cap, size_t& outLen);
+
+	/* `frame` holds the raw block at frame + STM32_STUB_FRAME_HDR + STM32_STUB_RLE_SLACK; it is
+	   encoded in place and the finished frame length is returned */
+	static size_t buildFrame(uint8_t* frame, uint8_t seq, uint32_t addr, size_t len, bool rle);
+	static uint8_t* frameData(uint8_t* frame) { return frame + STM32_STUB_FRAME_HDR + STM32_STUB_RLE_SLACK; }
+
+	static bool parseHello(const uint8_t* b, STM32StubHello& hello);
+	static void writeHello(uint8_t* b, const STM32StubHello& hello);
+
+	static uint16_t get16(const uint8_t* p) { return (uint16_t)(p[0] | (p[1] << 8)); }
+	static uint32_t get32(const uint8_t* p) { return (uint32_t)p[0] | ((uint32_t)p[1] << 8) | ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24); }
+	static void put16(uint8_t* p, uint16_t v) { p[0] = (uint8_t)v; p[1] = (uint8_t)(v >> 8); }
+	static void put32(uint8_t* p, uint32_t v) { p[0] = (uint8_t)v; p[1] = (uint8_t)(v >> 8); p[2] = (uint8_t)(v >> 16); p[3] = (uint8_t)(v >> 24); }
+};
+
+#endif	/* STM32_STUB_PROTOCOL_H */
@@ -0,0 +1,192 @@
+/********************************************************************************************************
+ *  [FILE NAME]   :      <STM32Telemetry.cpp>                                                           *
+ *  [AUTHOR]      :      <David S. Alexander>                                                           *
+ *  [DATE CREATED]:      <Dec 10, 2025>                                                                 *
+ *  [Description] :      <Source file for the per-job flash telemetry recorder>                         *
+ ********************************************************************************************************/
+
+#include "STM32Telemetry.h"
+#include "STM32JsonWriter.h"
+
+STM32Telemetry::STM32Telemetry()
+: _n(0),
+_intervalMs(FIRST_INTERVAL_MS),
+_startMs(0),
+_durationMs(0),
+_lastPhase(STM32_PHASE_COUNT),
+_lastErrors(0),
+_job('-'),
+_running(false),
+_ok(false),
+_bytes0(0),
+_retries0(0),
+_nacks0(0),
+_timeouts0(0),
+_uartErrors0(0),
+_heap(nullptr)
+{
+	memset(_phaseUs0, 0, sizeof(_phaseUs0));
+	memset(_ack0, 0, sizeof(_ack0));
+}
+
+uint32_t STM32Telemetry::uartErrors(const STM32FlasherMetrics& m)
+{
+	return m.uartParityErrors + m.uartFramingErrors + m.uartOverruns + m.uartRxDropped;
+}
+
+/* Reading the image belongs to the program or verify phase around it as far as the timeline is
+   concerned; it alternates with every frame and would otherwise cut a sample per chunk */
+uint8_t STM32Telemetry::samplePhase(const STM32FlasherMetrics& m) const
+{
+	return (m.activePhase == STM32_PHASE_FS_READ) ? _lastPhase : m.activePhase;
+}
+
+void STM32Telemetry::beginJob(char job, const STM32FlasherMetrics& m)
+{
+	_job = job;
+	_running = true;
+	_ok = false;
+	_n = 0;
+	_intervalMs = FIRST_INTERVAL_MS;
+	_startMs = millis();
+	_durationMs = 0;
+	_lastPhase = STM32_PHASE_COUNT;
+
+	_bytes0 = m.bytesProgrammed + m.bytesRead;
+	_retries0 = m.retries;
+	_nacks0 = m.nacks;
+	_timeouts0 = m.timeouts;
+	_lastErrors = errors(m);
+	_uartErrors0 = uartErrors(m);
+	for (uint8_t i = 0; i < STM32_PHASE_COUNT; i++) _phaseUs0[i] = m.phase[i].sumUs;
+	for (uint8_t i = 0; i < STM32_OP_COUNT; i++) _ack0[i] = m.ack[i];
+
+	add(m, _startMs, samplePhase(m));
+}
+
+void STM32Telemetry::endJob(bool ok, const STM32FlasherMetrics& m)
+{
+	if (!_running) return;
+	uint32_t now = millis();
+	if (_lastPhase != STM32_PHASE_COUNT || _s[_n - 1].ms != now - _startMs) add(m, now, STM32_PHASE_COUNT);
+	_durationMs = now - _startMs;
+	_ok = ok;
+	_running = false;
+}
+
+void STM32Telemetry::onProgress(const STM32FlasherMetrics& m)
+{
+	if (!_running) return;
+	uint32_t now = millis();
+	uint8_t phase = samplePhase(m);
+	uint32_t last = _startMs + _s[_n - 1].ms;
+	if (phase == _lastPhase && now - last < _intervalMs) return;
+	add(m, now, phase);
+}
+
+void STM32Telemetry::add(const STM32FlasherMetrics& m, uint32_t now, uint8_t phase)
+{
+	if (_n == MAX_SAMPLES) decimate();
+
+	STM32TelemetrySample& s = _s[_n++];
+	s.ms = now - _startMs;
+	s.bytes = m.bytesProgrammed + m.bytesRead - _bytes0;
+	uint32_t heap = _heap ? _heap() : 0;
+	s.heap = (heap > 0xFFFF) ? 0xFFFF : (uint16_t)heap;
+	s.phase = phase;
+	uint32_t e = errors(m) - _lastErrors;
+	s.errors = (e > 0xFF) ? 0xFF : (uint8_t)e;
+
+	_lastErrors = errors(m);
+	_lastPhase = phase;
+}
+
+void STM32Telemetry::decimate()
+{
+	/* Drops every second sample except the first and last and those that start a phase, so the
+	   phase bands survive; dropped error counts move into the next kept sample */
+	uint8_t out = 1;
+	uint8_t prev = _s[0].phase;
+	uint16_t carry = 0;
+	for (uint8_t i = 1; i < _n; i++)
+	{
+		STM32TelemetrySample s = _s[i];
+		bool boundary = (s.phase != prev);
+		prev = s.phase;
+		carry += s.errors;
+		if ((i & 1) && !boundary && i + 1 < _n) continue;
+
+		s.errors = (carry > 0xFF) ? 0xFF : (uint8_t)carry;
+		carry = 0;
+		_s[out++] = s;
+	}
+	/* A ring of nothing but phase changes still has to make room */
+	if (out == _n)
+	{
+		_s[out - 2] = _s[out - 1];
+		out--;
+	}
+	_n = out;
+	_intervalMs *= 2;
+}
+
+void STM32Telemetry::writeJson(Print& out, const STM32FlasherMetrics& m) const
+{
+	STM32JsonWriter json(out);
+	char job[2] = { _job, '\0' };
+
+	json.beginObject();
+	json.add("ok", true);
+	json.add("job", job);
+	json.add("running", _running);
+	json.add("result", _ok);
+	json.add("ms", (unsigned long)(_running ? millis() - _startMs : _durationMs));
+	json.add("intervalMs", (unsigned long)_intervalMs);
+
+	json.beginArray("phases");
+	for (uint8_t i = 0; i < STM32_PHASE_COUNT; i++) json.value(STM32FlasherMetrics::phaseName(i));
+	json.endArray();
+
+	json.beginArray("samples");
+	for (uint8_t i = 0; i < _n; i++)
+	{
+		const STM32TelemetrySample& s = _s[i];
+		json.beginArray();
+		json.value((unsigned long)s.ms);
+		json.value((unsigned long)s.bytes);
+		json.value((unsigned long)s.heap);
+		json.value((unsigned long)s.phase);
+		json.value((unsigned long)s.errors);
+		json.endArray();
+	}
+	json.endArray();
+
+	json.beginObject("phaseMs");
+	for (uint8_t i = 0; i < STM32_PHASE_COUNT; i++)
+	{
+		json.add(STM32FlasherMetrics::phaseName(i), (unsigned long)((m.phase[i].sumUs - _phaseUs0[i]) / 1000));
+	}
+	json.endObject();
+
+	json.beginArray("ack");
+	for (uint8_t i = 0; i < STM32_OP_COUNT; i++)
+	{
+		const STM32LatencyHist& h = m.ack[i];
+		json.beginObject();
+		json.add("op", STM32FlasherMetrics::opName(i));
+		json.add("n", (unsigned long)(h.count - _ack0[i].count));
+		json.add("p50", (unsigned long)h.percentileUs(50, &_ack0[i]));
+		json.add("p90", (unsigned long)h.percentileUs(90, &_ack0[i]));
+		json.add("p99", (unsigned long)h.percentileUs(99, &_ack0[i]));
+		json.endObject();
+	}
+	json.endArray();
+
+	json.add("bytes", (unsigned long)(m.bytesProgrammed + m.bytesRead - _bytes0));
+	json.add("retries", (unsigned long)(m.retries - _retries0));
+	json.add("nacks", (unsigned long)(m.nacks - _nacks0));
+	json.add("timeouts", (unsigned long)(m.timeouts - _timeouts0));
+	json.add("uartErrors", (unsigned long)(uartErrors(m) - _uartErrors0));
+	json.add("heap", (unsigned long)(_heap ? _heap() : 0));
+	json.endObject();
+}
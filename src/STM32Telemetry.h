@@ -0,0 +1,85 @@
+/********************************************************************************************************
+ *  [FILE NAME]   :      <STM32Telemetry.h>                                                             *
+ *  [AUTHOR]      :      <David S. Alexander>                                                           *
+ *  [DATE CREATED]:      <Dec 10, 2025>                                                                 *
+ *  [Description] :      <Header file for the per-job flash telemetry recorder>                         *
+ ********************************************************************************************************/
+
+#ifndef STM32_TELEMETRY_H
+#define	STM32_TELEMETRY_H
+
+#include <Arduino.h>
+#include "STM32FlasherMetrics.h"
+
+struct STM32TelemetrySample
+{
+	uint32_t ms;		/* since beginJob() */
+	uint32_t bytes;		/* programmed + read in this job */
+	uint16_t heap;		/* free heap, saturated */
+	uint8_t phase;		/* STM32JobPhase, STM32_PHASE_COUNT between phases */
+	uint8_t errors;		/* retries, NACKs and timeouts since the previous sample, saturated */
+};
+
+/* Timeline and counters of the last flasher job, for the web UI's telemetry panel. Samples are
+   taken from STM32MetricsObserver callbacks, so recording needs no timer and costs one millis()
+   per ACK. When the ring fills, every other sample is dropped and the interval doubles, so a job
+   of any length fits in the same memory. */
+class STM32Telemetry : public STM32MetricsObserver
+{
+	public:
+	static const uint8_t MAX_SAMPLES = 120;
+	static const uint32_t FIRST_INTERVAL_MS = 100;
+
+	STM32Telemetry();
+
+	/* Free heap for the samples; without one the heap column is 0 */
+	void setHeapSource(uint32_t (*freeHeap)()) { _heap = freeHeap; }
+
+	/* `job` is the /cmd letter (or 'B' for a batch) shown with the report */
+	void beginJob(char job, const STM32FlasherMetrics& m);
+	void endJob(bool ok, const STM32FlasherMetrics& m);
+	void onProgress(const STM32FlasherMetrics& m) override;
+
+	/* {"job","running","result","ms","intervalMs","phases":[..],"samples":[[ms,bytes,heap,phase,
+	   errors],..],"phaseMs":{..},"ack":[{"op","n","p50","p90","p99"},..],"retries",..}; ACK
+	   percentiles are in microseconds and sample phases index "phases" */
+	void writeJson(Print& out, const STM32FlasherMetrics& m) const;
+
+	/* Payload bytes of the last (or running) job as of its newest sample */
+	uint32_t jobBytes() const { return _n ? _s[_n - 1].bytes : 0; }
+	uint8_t sampleCount() const { return _n; }
+	uint32_t sampleIntervalMs() const { return _intervalMs; }
+	const STM32TelemetrySample& sample(uint8_t i) const { return _s[i]; }
+
+	private:
+	STM32TelemetrySample _s[MAX_SAMPLES];
+	uint8_t _n;
+	uint32_t _intervalMs;
+	uint32_t _startMs;
+	uint32_t _durationMs;
+	uint8_t _lastPhase;
+	uint32_t _lastErrors;
+
+	char _job;
+	bool _running;
+	bool _ok;
+
+	/* Counters at beginJob(), so the report covers one job */
+	uint32_t _bytes0;
+	uint32_t _retries0;
+	uint32_t _nacks0;
+	uint32_t _timeouts0;
+	uint32_t _uartErrors0;
+	uint64_t _phaseUs0[STM32_PHASE_COUNT];
+	STM32LatencyHist _ack0[STM32_OP_COUNT];
+
+	uint32_t (*_heap)();
+
+	void add(const STM32FlasherMetrics& m, uint32_t now, uint8_t phase);
+	void decimate();
+	uint8_t samplePhase(const STM32FlasherMetrics& m) const;
+	static uint32_t errors(const STM32FlasherMetrics& m) { return m.retries + m.nacks + m.timeouts; }
+	static uint32_t uartErrors(const STM32FlasherMetrics& m);
+};
+
+#endif	/* STM32_TELEMETRY_H */
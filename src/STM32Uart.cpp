@@ -0,0 +1,304 @@
+/********************************************************************************************************
+ *  [FILE NAME]   :      <STM32Uart.cpp>                                                                *
+ *  [AUTHOR]      :      <David S. Alexander>                                                           *
+ *  [DATE CREATED]:      <Dec 10, 2025>                                                                 *
+ *  [Description] :      <Source file for the interrupt-driven ESP8266 UART0 driver>                    *
+ ********************************************************************************************************/
+
+#ifdef ESP8266
+#include "STM32Uart.h"
+#include <user_interface.h>
+#include <coredecls.h>
+
+static const size_t UART_FIFO_SIZE = 128;
+/* USC1 threshold fields are 7 bits */
+static const uint8_t UART_THRESHOLD_MAX = 127;
+/* Bit times of an 8E1 frame with a spare stop bit, waited out after the FIFO empties */
+static const uint32_t UART_FRAME_BITS = 11;
+
+static const uint32_t UART_RX_INTS = (1 << UIFF) | (1 << UITO) | (1 << UIOF) | (1 << UIPE) | (1 << UIFR);
+
+STM32Uart::STM32Uart()
+: _rx(nullptr),
+_rxMask(0),
+_rxHead(0),
+_rxTail(0),
+_rxWant(0),
+_rxHigh(0),
+_tx(nullptr),
+_txMask(0),
+_txHead(0),
+_txTail(0),
+_parity(0),
+_framing(0),
+_overruns(0),
+_dropped(0)
+{}
+
+STM32Uart::~STM32Uart()
+{
+	end();
+}
+
+size_t STM32Uart::ringSize(uint16_t want)
+{
+	size_t n = 64;
+	while (n < want) n <<= 1;
+	return n;
+}
+
+static uint8_t clampThreshold(uint8_t v)
+{
+	if (v == 0) return 1;
+	return (v > UART_THRESHOLD_MAX) ? UART_THRESHOLD_MAX : v;
+}
+
+bool STM32Uart::begin(const STM32UartConfig& cfg)
+{
+	end();
+	_cfg = cfg;
+
+	size_t rxSize = ringSize(cfg.rxRing);
+	size_t txSize = ringSize(cfg.txRing);
+	_rx = (uint8_t*)malloc(rxSize);
+	_tx = (uint8_t*)malloc(txSize);
+	if (!_rx || !_tx)
+	{
+		free(_rx);
+		free(_tx);
+		_rx = nullptr;
+		_tx = nullptr;
+		return false;
+	}
+	_rxMask = rxSize - 1;
+	_txMask = txSize - 1;
+	_rxHead = _rxTail = 0;
+	_txHead = _txTail = 0;
+	_rxWant = 0;
+	_rxHigh = 0;
+	_parity = _framing = _overruns = _dropped = 0;
+
+	ETS_UART_INTR_DISABLE();
+	USIE(0) = 0;
+	USIC(0) = 0xFFFF;
+
+	setPins(cfg.swap);
+	USD(0) = ESP8266_CLOCK / cfg.baud;
+	USC0(0) = cfg.format;
+	USC0(0) |= (1 << UCRXRST) | (1 << UCTXRST);
+	USC0(0) &= ~((1 << UCRXRST) | (1 << UCTXRST));
+	USC1(0) = ((uint32_t)clampThreshold(cfg.rxFull) << UCFFT)
+		| ((uint32_t)clampThreshold(cfg.txEmpty) << UCFET)
+		| ((uint32_t)clampThreshold(cfg.rxTimeout) << UCTOT)
+		| (1UL << UCTOE);
+
+	USIC(0) = 0xFFFF;
+	USIE(0) = UART_RX_INTS;
+	ETS_UART_INTR_ATTACH(isr, this);
+	ETS_UART_INTR_ENABLE();
+	return true;
+}
+
+void STM32Uart::end()
+{
+	if (!_rx) return;
+
+	ETS_UART_INTR_DISABLE();
+	USIE(0) = 0;
+	USIC(0) = 0xFFFF;
+	ETS_UART_INTR_ATTACH(NULL, NULL);
+
+	if (_cfg.swap)
+	{
+		pinMode(15, INPUT);
+		pinMode(13, INPUT);
+		IOSWAP &= ~(1 << IOSWAPU0);
+	}
+	else
+	{
+		pinMode(1, INPUT);
+		pinMode(3, INPUT);
+	}
+
+	free(_rx);
+	free(_tx);
+	_rx = nullptr;
+	_tx = nullptr;
+}
+
+void STM32Uart::setPins(bool swap)
+{
+	if (swap)
+	{
+		pinMode(1, INPUT);
+		pinMode(3, INPUT);
+		pinMode(15, FUNCTION_4);
+		pinMode(13, FUNCTION_4);
+		IOSWAP |= (1 << IOSWAPU0);
+	}
+	else
+	{
+		IOSWAP &= ~(1 << IOSWAPU0);
+		pinMode(1, SPECIAL);
+		pinMode(3, SPECIAL);
+	}
+}
+
+/* Everything the ISR reaches must be in IRAM: LittleFS writes turn the flash cache off while
+   the UART keeps interrupting */
+void IRAM_ATTR STM32Uart::drainRx()
+{
+	size_t n = (USS(0) >> USRXC) & 0xFF;
+	size_t head = _rxHead;
+	const size_t tail = _rxTail;
+	while (n--)
+	{
+		uint8_t b = (uint8_t)USF(0);
+		size_t next = (head + 1) & _rxMask;
+		if (next == tail)
+		{
+			_dropped++;
+			continue;
+		}
+		_rx[head] = b;
+		head = next;
+	}
+	_rxHead = head;
+
+	size_t count = (head - tail) & _rxMask;
+	if (count > _rxHigh) _rxHigh = count;
+}
+
+void IRAM_ATTR STM32Uart::fillTx()
+{
+	size_t room = UART_FIFO_SIZE - ((USS(0) >> USTXC) & 0xFF);
+	size_t tail = _txTail;
+	const size_t head = _txHead;
+	while (room-- && tail != head)
+	{
+		USF(0) = _tx[tail];
+		tail = (tail + 1) & _txMask;
+	}
+	_txTail = tail;
+	if (tail == head) USIE(0) &= ~(1 << UIFE);
+}
+
+void IRAM_ATTR STM32Uart::isr(void* arg, void* frame)
+{
+	(void)frame;
+	STM32Uart* u = (STM32Uart*)arg;
+	uint32_t status = USIS(0);
+
+	if (status & (1 << UIPE)) u->_parity++;
+	if (status & (1 << UIFR)) u->_framing++;
+	if (status & (1 << UIOF)) u->_overruns++;
+	if (status & UART_RX_INTS) u->drainRx();
+	if (status & (1 << UIFE)) u->fillTx();
+
+	/* Cleared after the FIFO is drained, or the full interrupt latches again at once */
+	USIC(0) = status;
+
+	size_t want = u->_rxWant;
+	if (want && ((u->_rxHead - u->_rxTail) & u->_rxMask) >= want)
+	{
+		u->_rxWant = 0;
+		esp_schedule();
+	}
+}
+
+int STM32Uart::available()
+{
+	if (!_rx) return 0;
+	/* Bytes below the FIFO threshold wait for the RX timeout; take them now */
+	ETS_UART_INTR_DISABLE();
+	drainRx();
+	ETS_UART_INTR_ENABLE();
+	return (int)rxCount();
+}
+
+int STM32Uart::read()
+{
+	if (available() <= 0) return -1;
+	size_t tail = _rxTail;
+	uint8_t b = _rx[tail];
+	_rxTail = (tail + 1) & _rxMask;
+	return b;
+}
+
+size_t STM32Uart::read(uint8_t* buf, size_t len)
+{
+	int avail = available();
+	size_t n = (avail > 0) ? (size_t)avail : 0;
+	if (n > len) n = len;
+	if (n == 0) return 0;
+
+	size_t tail = _rxTail;
+	size_t first = _rxMask + 1 - tail;
+	if (first > n) first = n;
+	memcpy(buf, _rx + tail, first);
+	memcpy(buf + first, _rx, n - first);
+	_rxTail = (tail + n) & _rxMask;
+	return n;
+}
+
+size_t STM32Uart::write(const uint8_t* data, size_t len)
+{
+	if (!_tx) return 0;
+
+	size_t done = 0;
+	while (done < len)
+	{
+		size_t head = _txHead;
+		size_t room = (_txTail - head - 1) & _txMask;
+		if (room == 0)
+		{
+			yield();
+			continue;
+		}
+
+		size_t n = len - done;
+		if (n > room) n = room;
+		if (n > _txMask + 1 - head) n = _txMask + 1 - head;
+		memcpy(_tx + head, data + done, n);
+		_txHead = (head + n) & _txMask;
+		done += n;
+
+		ETS_UART_INTR_DISABLE();
+		USIE(0) |= (1 << UIFE);
+		ETS_UART_INTR_ENABLE();
+	}
+	return len;
+}
+
+void STM32Uart::flush()
+{
+	if (!_tx) return;
+	while (_txTail != _txHead || ((USS(0) >> USTXC) & 0xFF)) yield();
+	/* The FIFO count drops as the last byte starts shifting out */
+	delayMicroseconds(UART_FRAME_BITS * 1000000UL / _cfg.baud + 1);
+}
+
+void STM32Uart::setBaud(uint32_t baud)
+{
+	if (!_tx || baud == 0) return;
+	flush();
+	_cfg.baud = baud;
+	USD(0) = ESP8266_CLOCK / baud;
+}
+
+bool STM32Uart::waitAvailable(size_t n, uint32_t timeoutMs)
+{
+	if (!_rx) return false;
+	if (n > _rxMask) n = _rxMask;
+
+	/* Armed before the check, so bytes landing in between still wake us */
+	_rxWant = n;
+	if ((size_t)available() < n)
+	{
+		esp_delay(timeoutMs, [this, n]() { return (size_t)available() < n; });
+	}
+	_rxWant = 0;
+	return (size_t)available() >= n;
+}
+
+#endif
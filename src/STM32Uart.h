@@ -0,0 +1,122 @@
+/********************************************************************************************************
+ *  [FILE NAME]   :      <STM32Uart.h>                                                                  *
+ *  [AUTHOR]      :      <David S. Alexander>                                                           *
+ *  [DATE CREATED]:      <Dec 10, 2025>                                                                 *
+ *  [Description] :      <Header file for the interrupt-driven ESP8266 UART0 driver>                    *
+ ********************************************************************************************************/
+
+#ifndef STM32_UART_H
+#define	STM32_UART_H
+
+
+#ifdef ESP8266
+
+#include <Arduino.h>
+
+/* Ring sizes and FIFO thresholds; the defaults suit AN3155 traffic: 256-byte READ/WRITE frames
+   answered by single ACK bytes */
+struct STM32UartConfig
+{
+	uint32_t baud;
+	uint8_t format;		/* SERIAL_8E1 and friends, written to UART_CONF0 as the core does */
+	bool swap;			/* GPIO13 RX / GPIO15 TX instead of GPIO3 / GPIO1 */
+
+	/* Rounded up to a power of two; one byte of each ring stays free */
+	uint16_t rxRing;
+	uint16_t txRing;
+
+	/* The RX interrupt fires at rxFull bytes in the 128-byte FIFO, or after rxTimeout idle byte
+	   times with anything in it. The core uses 127, which leaves one byte time for the ISR to
+	   run before an overrun; half the FIFO covers WiFi interrupt latency at 921600 baud. */
+	uint8_t rxFull;
+	uint8_t rxTimeout;
+	/* The TX FIFO is refilled from the ring when it drops below txEmpty bytes */
+	uint8_t txEmpty;
+
+	STM32UartConfig()
+	: baud(115200),
+	format(SERIAL_8E1),
+	swap(true),
+	rxRing(1024),
+	txRing(512),
+	rxFull(64),
+	rxTimeout(2),
+	txEmpty(16)
+	{}
+};
+
+/* UART0 with its own interrupt handler, RX/TX rings and per-cause error counters. It replaces
+   the core's driver on UART0, so Serial must not be used while it runs; Serial1 (TX only) still
+   works. Only one instance can be begun at a time. */
+class STM32Uart
+{
+	public:
+	STM32Uart();
+	~STM32Uart();
+
+	/* Allocates the rings and takes over UART0; false if the rings do not fit in the heap */
+	bool begin(const STM32UartConfig& cfg);
+	void end();
+	bool started() const { return _rx != nullptr; }
+
+	int available();
+	int read();
+	/* Whatever is buffered, up to len, without waiting */
+	size_t read(uint8_t* buf, size_t len);
+	/* Queues data for the TX interrupt; waits only while the TX ring is full */
+	size_t write(const uint8_t* data, size_t len);
+	/* Waits until the ring and the FIFO are empty and the last stop bit is out */
+	void flush();
+
+	/* Sleeps (the SDK keeps running WiFi) until n bytes are buffered or timeoutMs passes; the RX
+	   interrupt wakes the caller as soon as the count is reached. n is capped at the ring size. */
+	bool waitAvailable(size_t n, uint32_t timeoutMs);
+
+	uint32_t baud() const { return _cfg.baud; }
+	/* Waits for pending TX, then changes the divider; the rings and format are kept */
+	void setBaud(uint32_t baud);
+	size_t rxRingSize() const { return _rxMask; }
+	size_t txRingSize() const { return _txMask; }
+
+	/* Error events since begin(), counted per interrupt: hardware FIFO overflows, parity and
+	   framing errors. Dropped bytes are counted one by one when the RX ring is full. */
+	uint32_t parityErrors() const { return _parity; }
+	uint32_t framingErrors() const { return _framing; }
+	uint32_t overruns() const { return _overruns; }
+	uint32_t rxDropped() const { return _dropped; }
+	/* Most bytes the RX ring has held, to size rxRing */
+	size_t rxHighWater() const { return _rxHigh; }
+
+	private:
+	STM32UartConfig _cfg;
+
+	uint8_t* _rx;
+	size_t _rxMask;
+	volatile size_t _rxHead;	/* written by the ISR */
+	volatile size_t _rxTail;
+	volatile size_t _rxWant;	/* waitAvailable() target; the ISR wakes the caller at this count */
+	volatile size_t _rxHigh;
+
+	uint8_t* _tx;
+	size_t _txMask;
+	volatile size_t _txHead;
+	volatile size_t _txTail;	/* written by the ISR */
+
+	volatile uint32_t _parity;
+	volatile uint32_t _framing;
+	volatile uint32_t _overruns;
+	volatile uint32_t _dropped;
+
+	static void isr(void* arg, void* frame);
+	/* Both run with the UART interrupt masked, from the ISR or from the foreground */
+	void drainRx();
+	void fillTx();
+
+	size_t rxCount() const { return (_rxHead - _rxTail) & _rxMask; }
+	void setPins(bool swap);
+	static size_t ringSize(uint16_t want);
+};
+
+#endif
+
+#endif	/* STM32_UART_H */
@@ -0,0 +1,168 @@
+/********************************************************************************************************
+ *  [FILE NAME]   :      <STM32UploadWriter.cpp>                                                        *
+ *  [AUTHOR]      :      <David S. Alexander>                                                           *
+ *  [DATE CREATED]:      <Dec 10, 2025>                                                                 *
+ *  [Description] :      <Source file for the block-aligned LittleFS upload writer>                     *
+ ********************************************************************************************************/
+
+#ifdef ESP8266
+#include "STM32UploadWriter.h"
+#include "STM32StubProtocol.h"
+
+/* Blocks LittleFS needs besides the data: directory entry, file CTZ skip list, copy-on-write spare */
+static const size_t UPLOAD_META_BLOCKS = 3;
+
+STM32UploadWriter::STM32UploadWriter()
+: _active(false),
+_error(nullptr),
+_block(STM32_UPLOAD_BLOCK_MAX),
+_fill(0),
+_bytes(0),
+_crc(0),
+_writeUs(0),
+_startMs(0),
+_elapsedMs(0)
+{
+	_path[0] = '\0';
+	_tmp[0] = '\0';
+	memset(_digest, 0, sizeof(_digest));
+}
+
+bool STM32UploadWriter::begin(const char* path, size_t expected)
+{
+	if (_active) abort();
+	_error = nullptr;
+	_fill = 0;
+	_bytes = 0;
+	_crc = 0;
+	_sha.begin();
+	_writeUs = 0;
+	_elapsedMs = 0;
+	_startMs = millis();
+
+	if (strlen(path) >= sizeof(_path)) { _error = "path too long"; return false; }
+	strcpy(_path, path);
+	snprintf(_tmp, sizeof(_tmp), "%s.tmp", path);
+
+	/* LittleFS cannot preallocate, so check the space up front rather than fail halfway */
+	FSInfo info;
+	if (LittleFS.info(info))
+	{
+		_block = (info.blockSize && info.blockSize < STM32_UPLOAD_BLOCK_MAX) ? info.blockSize : STM32_UPLOAD_BLOCK_MAX;
+		size_t freeBytes = (info.totalBytes > info.usedBytes) ? info.totalBytes - info.usedBytes : 0;
+		size_t reserve = UPLOAD_META_BLOCKS * info.blockSize;
+		if (expected && expected + reserve > freeBytes) { _error = "not enough file system space"; return false; }
+	}
+
+	/* A stale temp file from an interrupted upload */
+	if (LittleFS.exists(_tmp)) LittleFS.remove(_tmp);
+	_file = LittleFS.open(_tmp, "w");
+	if (!_file) { _error = "cannot create temp file"; return false; }
+	_active = true;
+	return true;
+}
+
+bool STM32UploadWriter::writeFs(const uint8_t* data, size_t len)
+{
+	uint32_t t0 = micros();
+	size_t n = _file.write(data, len);
+	_writeUs += micros() - t0;
+	if (n != len)
+	{
+		_error = "file system write failed";
+		return false;
+	}
+	return true;
+}
+
+bool STM32UploadWriter::write(const uint8_t* data, size_t len)
+{
+	if (!_active) return false;
+	if (_bytes < sizeof(_head))
+	{
+		size_t n = sizeof(_head) - _bytes;
+		memcpy(_head + _bytes, data, (n < len) ? n : len);
+	}
+	_bytes += len;
+	_crc = STM32StubCodec::crc32(_crc, data, len);
+	_sha.update(data, len);
+
+	while (len)
+	{
+		size_t n;
+		if (_fill == 0 && len >= _block)
+		{
+			/* Whole blocks straight from the request buffer */
+			n = len - len % _block;
+			if (!writeFs(data, n)) break;
+		}
+		else
+		{
+			n = _block - _fill;
+			if (n > len) n = len;
+			memcpy(_buf + _fill, data, n);
+			_fill += n;
+			if (_fill == _block)
+			{
+				_fill = 0;
+				if (!writeFs(_buf, _block)) break;
+			}
+		}
+		data += n;
+		len -= n;
+	}
+
+	if (_error)
+	{
+		abort();
+		return false;
+	}
+	return true;
+}
+
+bool STM32UploadWriter::commit()
+{
+	if (!_active) return false;
+	if (_fill && !writeFs(_buf, _fill))
+	{
+		abort();
+		return false;
+	}
+	_fill = 0;
+	_sha.finish(_digest);
+
+	uint32_t t0 = micros();
+	_file.close();
+	_writeUs += micros() - t0;
+	_active = false;
+
+	/* lfs_rename replaces _path in one step, so a failure or power loss leaves the old image */
+	if (!LittleFS.rename(_tmp, _path))
+	{
+		_error = "rename failed";
+		LittleFS.remove(_tmp);
+		return false;
+	}
+	_elapsedMs = millis() - _startMs;
+	return true;
+}
+
+STM32ImageInfo STM32UploadWriter::imageInfo() const
+{
+	STM32ImageInfo info;
+	info.set(_head, (uint32_t)_bytes);
+	info.crc = _crc;
+	memcpy(info.sha256, _digest, sizeof(info.sha256));
+	info.crcKnown = true;
+	return info;
+}
+
+void STM32UploadWriter::abort()
+{
+	if (_active) _file.close();
+	_active = false;
+	_fill = 0;
+	LittleFS.remove(_tmp);
+}
+
+#endif
@@ -0,0 +1,75 @@
+/********************************************************************************************************
+ *  [FILE NAME]   :      <STM32UploadWriter.h>                                                          *
+ *  [AUTHOR]      :      <David S. Alexander>                                                           *
+ *  [DATE CREATED]:      <Dec 10, 2025>                                                                 *
+ *  [Description] :      <Header file for the block-aligned LittleFS upload writer>                     *
+ ********************************************************************************************************/
+
+#ifndef STM32_UPLOAD_WRITER_H
+#define	STM32_UPLOAD_WRITER_H
+
+
+#ifdef ESP8266
+
+#include <Arduino.h>
+#include <FS.h>
+#include <LittleFS.h>
+#include "STM32ImagePreflight.h"
+#include "STM32Sha256.h"
+
+/* Largest LittleFS block the writer combines into; the ESP8266 core uses 4 KB (8 KB on some builds,
+   in which case whole 4 KB halves are written) */
+static const size_t STM32_UPLOAD_BLOCK_MAX = 4096;
+
+/* Collects HTTPUpload fragments into whole file-system blocks and writes them to `<path>.tmp`, which
+   replaces `path` only once the upload completes. The previous image stays intact until then. */
+class STM32UploadWriter
+{
+	public:
+	STM32UploadWriter();
+
+	/* `expected` is the request's Content-Length (0 if unknown); false with error() set if the
+	   file system cannot hold that much next to the current image */
+	bool begin(const char* path, size_t expected);
+	bool write(const uint8_t* data, size_t len);
+	/* Writes the tail, closes and renames over the target path; on failure the old file stays */
+	bool commit();
+	/* Drops the temp file; the previous image is untouched */
+	void abort();
+
+	bool active() const { return _active; }
+	const char* error() const { return _error; }
+
+	size_t bytes() const { return _bytes; }
+	/* Time spent inside LittleFS writes, and from begin() to commit() */
+	uint32_t writeUs() const { return _writeUs; }
+	uint32_t elapsedMs() const { return _elapsedMs; }
+	/* Size, vector table words, CRC-32 and SHA-256 of the last committed upload */
+	STM32ImageInfo imageInfo() const;
+
+	private:
+	File _file;
+	char _path[48];
+	char _tmp[52];
+	bool _active;
+	const char* _error;
+
+	uint8_t _buf[STM32_UPLOAD_BLOCK_MAX];
+	size_t _block;
+	size_t _fill;
+
+	size_t _bytes;
+	uint8_t _head[8];
+	uint32_t _crc;
+	STM32Sha256 _sha;
+	uint8_t _digest[STM32_SHA256_LEN];
+	uint32_t _writeUs;
+	uint32_t _startMs;
+	uint32_t _elapsedMs;
+
+	bool writeFs(const uint8_t* data, size_t len);
+};
+
+#endif
+
+#endif	/* STM32_UPLOAD_WRITER_H */
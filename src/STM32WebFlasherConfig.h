@@ -10,6 +10,13 @@
 
 #include <Arduino.h>
 
+/* How the ESP8266 talks to the STM32 ROM bootloader */
+enum STM32Link : uint8_t
+{
+	STM32_LINK_UART,	/* AN3155, 8E1 on Serial (swapped to GPIO13/15 by default) */
+	STM32_LINK_SPI		/* AN4286, HSPI: SCK 14, MISO 12, MOSI 13, CS spiCsPin; experimental, simulator-tested only */
+};
+
 struct STM32WebFlasherConfig
 {
 	const char* wifiSsid;
@@ -27,11 +34,51 @@ struct STM32WebFlasherConfig
 
 	uint32_t uartBaud;
 	bool uartSwap;
+	/* STM32Uart ring sizes in bytes, rounded up to a power of two */
+	uint16_t uartRxRing;
+	uint16_t uartTxRing;
 
 	uint32_t syncTimeoutMs;
 
 	const char* updatePath;
 
+	/* SPI shares GPIO13/15 with the swapped UART, so only one link is brought up */
+	STM32Link link;
+	uint8_t spiCsPin;
+	uint32_t spiHz;
+
+	/* Program through the RAM loader stub (extras/stub) when one is built for the target family */
+	bool fastLoader;
+
+	/* STM32EventLog spill file, rotated to "<path>.1" at eventLogBytes; nullptr keeps the log in RAM only */
+	const char* eventLogPath;
+	uint32_t eventLogBytes;
+
+	/* STM32FrameTracer ring size; 0 leaves the tracer out. The ring is allocated when POST /trace turns
+	   tracing on and freed once tracing is off and the capture is cleared, so it costs no heap until used. */
+	uint32_t traceBytes;
+
+	/* STM32FlashHistory file, one 88-byte record per job, rotated to "<path>.1" at historyBytes;
+	   nullptr keeps no history */
+	const char* historyPath;
+	uint32_t historyBytes;
+
+	/* SNTP server for the history's wall-clock time; nullptr leaves the clock unset */
+	const char* ntpServer;
+
+	/* Flash kept by job S, "<addr>:<len>" ranges separated by commas (e.g. calibration or emulated
+	   EEPROM pages); /cmd?c=S&keep=... overrides it per job. nullptr erases the whole chip. */
+	const char* preserve;
+	/* LittleFS prefix of the files preserved ranges are saved to while their pages are erased */
+	const char* preservePath;
+	/* LittleFS prefix of the per-UID flash shadows job D works from (the UID in hex is appended,
+	   so keep it short: LittleFS names stop at 31 characters); nullptr keeps none */
+	const char* shadowPath;
+
+	/* TCP port of the serial bridge to the target UART (RFC 2217 or raw); 0 leaves it off. UART link
+	   only. The bridge has no authentication, so only enable it on a trusted network. */
+	uint16_t bridgePort;
+
 	STM32WebFlasherConfig()
 	: wifiSsid(""),
 	wifiPass(""),
@@ -43,8 +90,24 @@ struct STM32WebFlasherConfig
 	resetPin(0xFF),
 	uartBaud(115200),
 	uartSwap(true),
+	uartRxRing(1024),
+	uartTxRing(512),
 	syncTimeoutMs(1000),
-	updatePath("/update.bin")
+	updatePath("/update.bin"),
+	link(STM32_LINK_UART),
+	spiCsPin(15),
+	spiHz(4000000),
+	fastLoader(false),
+	eventLogPath("/events.log"),
+	eventLogBytes(8192),
+	traceBytes(16384),
+	historyPath("/history.bin"),
+	historyBytes(16384),
+	ntpServer("pool.ntp.org"),
+	preserve(nullptr),
+	preservePath("/preserve"),
+	shadowPath("/sh"),
+	bridgePort(0)
 	{}
 
 	STM32WebFlasherConfig(
@@ -71,8 +134,24 @@ struct STM32WebFlasherConfig
 	resetPin(rst),
 	uartBaud(baud),
 	uartSwap(swapUart),
+	uartRxRing(1024),
+	uartTxRing(512),
 	syncTimeoutMs(syncTo),
-	updatePath(path)
+	updatePath(path),
+	link(STM32_LINK_UART),
+	spiCsPin(15),
+	spiHz(4000000),
+	fastLoader(false),
+	eventLogPath("/events.log"),
+	eventLogBytes(8192),
+	traceBytes(16384),
+	historyPath("/history.bin"),
+	historyBytes(16384),
+	ntpServer("pool.ntp.org"),
+	preserve(nullptr),
+	preservePath("/preserve"),
+	shadowPath("/sh"),
+	bridgePort(0)
 	{}
 };
 
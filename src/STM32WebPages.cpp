@@ -1,1149 +1,990 @@
-﻿/********************************************************************************************************
- *  [FILE NAME]   :      <STM32WebPages.cpp>                                                            *
- *  [AUTHOR]      :      <David S. Alexander>                                                           *
- *  [DATE CREATED]:      <Dec 10, 2025>                                                                 *
- *  [Description] :      <Source file for STM32 Web Pages>                                              *
+﻿/********************************************************************************************************
+ *  [FILE NAME]   :      <STM32WebPages.cpp>                                                            *
+ *  [AUTHOR]      :      <David S. Alexander>                                                           *
+ *  [DATE CREATED]:      <Dec 10, 2025>                                                                 *
+ *  [Description] :      <Source file for STM32 Web Pages>                                              *
  ********************************************************************************************************/
 
+/* Generated by extras/web/embed_pages.py from the HTML sources in extras/web - do not edit by hand. */
 
 #include "STM32WebPages.h"
 
-const char LOGIN_HTML_A[] PROGMEM = R"rawliteral(
-<!DOCTYPE html>
-<html lang="en">
-<head>
-<meta charset="UTF-8">
-<meta name="viewport" content="width=device-width, initial-scale=1.0">
-<title>STM32 Bootloader Login</title>
-<link rel="stylesheet" href="https://cdnjs.cloudflare.com/ajax/libs/font-awesome/6.4.0/css/all.min.css">
-<style>
-:root {
-	--primary: #2c3e50;
-	--secondary: #3498db;
-	--accent: #2ecc71;
-	--danger: #e74c3c;
-	--light: #ecf0f1;
-	--card-bg: #ffffff;
-	--shadow: rgba(0, 0, 0, 0.12);
-}
 
-* {
-	margin: 0;
-	padding: 0;
-	box-sizing: border-box;
-}
-
-body {
-	font-family: 'Segoe UI', Tahoma, Geneva, Verdana, sans-serif;
-	background: linear-gradient(135deg, #667eea 0%, #764ba2 100%);
-	min-height: 100vh;
-	display: flex;
-	align-items: center;
-	justify-content: center;
-	padding: 20px;
-	color: #333;
-}
-
-.login-card {
-	background: var(--card-bg);
-	border-radius: 16px;
-	padding: 30px 28px;
-	max-width: 380px;
-	width: 100%;
-	box-shadow: 0 14px 40px var(--shadow);
-}
-
-.login-header {
-	text-align: center;
-	margin-bottom: 20px;
-}
-
-.login-header h1 {
-	font-size: 22px;
-	color: var(--primary);
-	margin-bottom: 6px;
-	display: flex;
-	align-items: center;
-	justify-content: center;
-	gap: 8px;
-}
-
-.login-header p {
-	font-size: 13px;
-	color: #777;
-}
-
-.login-header i {
-	color: var(--secondary);
-}
-
-.field-group {
-	margin-bottom: 15px;
-}
-
-label {
-	display: block;
-	font-size: 13px;
-	color: #555;
-	margin-bottom: 5px;
-	font-weight: 600;
-}
-
-input[type="text"],
-input[type="password"] {
-	width: 100%;
-	padding: 10px 12px;
-	border-radius: 8px;
-	border: 1px solid #ccc;
-	font-size: 14px;
-	outline: none;
-	transition: border 0.2s ease, box-shadow 0.2s ease;
-}
-
-input[type="text"]:focus,
-input[type="password"]:focus {
-	border-color: var(--secondary);
-	box-shadow: 0 0 0 2px rgba(52, 152, 219, 0.15);
-}
-
-.btn {
-	width: 100%;
-	padding: 11px 16px;
-	border-radius: 10px;
-	border: none;
-	font-size: 14px;
-	font-weight: 600;
-	cursor: pointer;
-	display: inline-flex;
-	align-items: center;
-	justify-content: center;
-	gap: 8px;
-	color: #fff;
-	background: var(--secondary);
-	transition: background 0.2s, transform 0.15s, box-shadow 0.15s;
-}
-
-.btn:hover {
-	background: #2980b9;
-	transform: translateY(-1px);
-	box-shadow: 0 7px 18px rgba(52, 152, 219, 0.3);
-}
-
-.btn:disabled {
-	opacity: 0.65;
-	cursor: not-allowed;
-	box-shadow: none;
-	transform: none;
-}
-
-.status {
-	margin-top: 10px;
-	font-size: 13px;
-	min-height: 18px;
-	text-align: center;
-}
-
-.status.ok {
-	color: var(--accent);
-}
-
-.status.err {
-	color: var(--danger);
-}
-
-.footer {
-	margin-top: 16px;
-	font-size: 11px;
-	text-align: center;
-	color: #999;
-}
-
-.footer code {
-	background: #f4f5f7;
-	padding: 2px 4px;
-	border-radius: 4px;
-	font-size: 11px;
-}
-</style>
-</head>
-<body>
-<div class="login-card">
-<div class="login-header">
-<h1><i class="fas fa-microchip"></i> STM32 Bootloader</h1>
-<p>Sign in to access the FOTA control panel</p>
-</div>
-
-<form id="loginForm">
-<div class="field-group">
-<label for="user">Username</label>
-<input type="text" id="user" name="user" autocomplete="username" required>
-</div>
-
-<div class="field-group">
-<label for="pass">Password</label>
-<input type="password" id="pass" name="pass" autocomplete="current-password" required>
-</div>
-
-<button type="submit" id="loginBtn" class="btn">
-<i class="fas fa-sign-in-alt"></i> Login
-</button>
-</form>
-
-<div id="statusMsg" class="status"></div>
-
-<div class="footer">
-<p>Device host: <code>http://)rawliteral";
-
-const char LOGIN_HTML_B[] PROGMEM = R"rawliteral(.local/</code></p>
-<p>By David S. Alexander</p>
-</div>
-</div>
-
-<script>
-const form = document.getElementById('loginForm');
-const btn  = document.getElementById('loginBtn');
-const msg  = document.getElementById('statusMsg');
-
-form.addEventListener('submit', async (e) => {
-	e.preventDefault();
-	msg.textContent = '';
-	msg.className = 'status';
-
-	const u = document.getElementById('user').value.trim();
-	const p = document.getElementById('pass').value;
-
-	if (!u || !p) {
-		msg.textContent = 'Please enter username and password.';
-		msg.classList.add('err');
-		return;
-	}
-
-	btn.disabled = true;
-	const originalHtml = btn.innerHTML;
-	btn.innerHTML = '<i class="fas fa-spinner fa-spin"></i> Checking...';
-
-	try {
-		const body = 'user=' + encodeURIComponent(u) + '&pass=' + encodeURIComponent(p);
-		const res = await fetch('/login', {
-			method: 'POST',
-			headers: {'Content-Type': 'application/x-www-form-urlencoded'},
-			body
-		});
-		const data = await res.json();
-		if (data.ok) {
-			msg.textContent = 'Login successful. Redirecting...';
-			msg.classList.add('ok');
-			setTimeout(() => { window.location.href = '/'; }, 600);
-			} else {
-			msg.textContent = data.error || 'Invalid username or password.';
-			msg.classList.add('err');
-		}
-		} catch (err) {
-		msg.textContent = 'Login error: ' + err.message;
-		msg.classList.add('err');
-		} finally {
-		btn.disabled = false;
-		btn.innerHTML = originalHtml;
-	}
-});
-</script>
-</body>
-</html>
-)rawliteral";
-
-const char INDEX_HTML_A[] PROGMEM = R"rawliteral(
-<!DOCTYPE html>
-<html lang="en">
-<head>
-<meta charset="UTF-8">
-<meta name="viewport" content="width=device-width, initial-scale=1.0">
-<title>STM32 FOTA Control Panel</title>
-<link rel="stylesheet" href="https://cdnjs.cloudflare.com/ajax/libs/font-awesome/6.4.0/css/all.min.css">
-<style>
-:root {
-	--primary: #2c3e50;
-	--secondary: #3498db;
-	--accent: #2ecc71;
-	--danger: #e74c3c;
-	--warning: #f39c12;
-	--light: #ecf0f1;
-	--dark: #2c3e50;
-	--card-bg: #ffffff;
-	--shadow: rgba(0, 0, 0, 0.08);
-}
-
-* {
-	margin: 0;
-	padding: 0;
-	box-sizing: border-box;
-}
-
-body {
-	font-family: 'Segoe UI', Tahoma, Geneva, Verdana, sans-serif;
-	background: linear-gradient(135deg, #667eea 0%, #764ba2 100%);
-	color: #333;
-	line-height: 1.6;
-	min-height: 100vh;
-	padding: 20px;
-}
-
-.container {
-	max-width: 1000px;
-	margin: 0 auto;
-}
-
-header {
-	background: var(--card-bg);
-	border-radius: 15px;
-	padding: 25px 30px;
-	margin-bottom: 25px;
-	box-shadow: 0 10px 30px var(--shadow);
-	border-left: 5px solid var(--secondary);
-}
-
-h1 {
-	color: var(--primary);
-	font-size: 28px;
-	margin-bottom: 8px;
-	display: flex;
-	align-items: center;
-	gap: 12px;
-}
-
-h1 i {
-	color: var(--secondary);
-}
-
-.subtitle {
-	color: #666;
-	font-size: 16px;
-	margin-bottom: 15px;
-}
-
-.header-row {
-	display: flex;
-	flex-wrap: wrap;
-	align-items: center;
-	justify-content: space-between;
-	gap: 12px;
-}
-
-.header-actions {
-	display: flex;
-	gap: 8px;
-	align-items: center;
-	flex-wrap: wrap;
-}
-
-.info-box {
-	background: #f8f9fa;
-	border-radius: 10px;
-	padding: 15px;
-	margin-top: 15px;
-	border-left: 4px solid var(--warning);
-}
-
-.target-info {
-	font-size: 14px;
-	color: #444;
-	margin-top: 8px;
-}
-
-.target-info span {
-	font-weight: 600;
-	color: var(--secondary);
-}
-
-.card {
-	background: var(--card-bg);
-	border-radius: 15px;
-	padding: 25px;
-	margin-bottom: 25px;
-	box-shadow: 0 8px 25px var(--shadow);
-	transition: transform 0.3s ease, box-shadow 0.3s ease;
-}
-
-.card:hover {
-	transform: translateY(-5px);
-	box-shadow: 0 15px 35px rgba(0, 0, 0, 0.1);
-}
-
-.card-title {
-	color: var(--primary);
-	font-size: 20px;
-	margin-bottom: 20px;
-	display: flex;
-	align-items: center;
-	gap: 10px;
-}
-
-.card-title i {
-	color: var(--secondary);
-}
-
-.upload-area {
-	border: 3px dashed #ddd;
-	border-radius: 10px;
-	padding: 40px 20px;
-	text-align: center;
-	margin-bottom: 20px;
-	transition: all 0.3s;
-	background: #fafafa;
-}
-
-.upload-area:hover, .upload-area.dragover {
-	border-color: var(--secondary);
-	background: #f0f8ff;
-}
-
-.upload-icon {
-	font-size: 48px;
-	color: var(--secondary);
-	margin-bottom: 15px;
-}
-
-.file-input-wrapper {
-	position: relative;
-	display: inline-block;
-	margin-top: 15px;
-}
-
-.file-input-wrapper input[type="file"] {
-	position: absolute;
-	left: 0;
-	top: 0;
-	opacity: 0;
-	width: 100%;
-	height: 100%;
-	cursor: pointer;
-}
-
-.file-btn {
-	background: var(--secondary);
-	color: white;
-	border: none;
-	padding: 12px 25px;
-	border-radius: 8px;
-	font-weight: 600;
-	cursor: pointer;
-	display: inline-flex;
-	align-items: center;
-	gap: 8px;
-	transition: all 0.3s;
-}
-
-.file-btn:hover {
-	background: #2980b9;
-	transform: scale(1.05);
-}
-
-.btn {
-	padding: 10px 18px;
-	border: none;
-	border-radius: 10px;
-	font-weight: 600;
-	cursor: pointer;
-	transition: all 0.3s;
-	display: inline-flex;
-	align-items: center;
-	justify-content: center;
-	gap: 8px;
-	font-size: 14px;
-}
-
-.btn-primary {
-	background: var(--secondary);
-	color: white;
-}
-
-.btn-primary:hover {
-	background: #2980b9;
-	transform: translateY(-2px);
-	box-shadow: 0 4px 12px rgba(52, 152, 219, 0.3);
-}
-
-.btn-danger {
-	background: var(--danger);
-	color: white;
-}
-
-.btn-danger:hover {
-	background: #c0392b;
-	transform: translateY(-2px);
-	box-shadow: 0 4px 12px rgba(231, 76, 60, 0.3);
-}
-
-.btn-success {
-	background: var(--accent);
-	color: white;
-}
-
-.btn-success:hover {
-	background: #27ae60;
-	transform: translateY(-2px);
-	box-shadow: 0 4px 12px rgba(46, 204, 113, 0.3);
-}
-
-.btn-warning {
-	background: var(--warning);
-	color: white;
-}
-
-.btn-warning:hover {
-	background: #e67e22;
-	transform: translateY(-2px);
-	box-shadow: 0 4px 12px rgba(243, 156, 18, 0.3);
-}
-
-.btn-info {
-	background: #9b59b6;
-	color: white;
-}
-
-.btn-info:hover {
-	background: #8e44ad;
-	transform: translateY(-2px);
-	box-shadow: 0 4px 12px rgba(155, 89, 182, 0.3);
-}
-
-.btn:disabled {
-	opacity: 0.6;
-	cursor: not-allowed;
-	transform: none !important;
-	box-shadow: none !important;
-}
-
-.button-grid {
-	display: grid;
-	grid-template-columns: repeat(auto-fill, minmax(220px, 1fr));
-	gap: 15px;
-	margin-top: 10px;
-}
-
-.log-container {
-	background: #1a1a1a;
-	border-radius: 10px;
-	padding: 20px;
-	margin-top: 10px;
-	overflow: hidden;
-}
-
-#log {
-	background: #1a1a1a;
-	color: #00ff00;
-	font-family: 'Consolas', 'Monaco', monospace;
-	min-height: 200px;
-	max-height: 400px;
-	overflow-y: auto;
-	padding: 15px;
-	border-radius: 8px;
-	white-space: pre-wrap;
-	word-break: break-all;
-	font-size: 14px;
-	border: 1px solid #333;
-}
-
-.log-header {
-	display: flex;
-	justify-content: space-between;
-	align-items: center;
-	margin-bottom: 15px;
-}
-
-.log-controls button {
-	background: #444;
-	color: white;
-	border: none;
-	padding: 6px 12px;
-	border-radius: 5px;
-	font-size: 13px;
-	cursor: pointer;
-	margin-left: 8px;
-}
-
-.log-entry {
-	padding: 5px 0;
-	border-bottom: 1px solid #2a2a2a;
-}
-
-.log-time {
-	color: #888;
-}
-
-.log-cmd {
-	color: #3498db;
-	font-weight: bold;
-}
-
-.log-response {
-	color: #2ecc71;
-}
-
-.log-error {
-	color: #e74c3c;
-}
-
-.status-indicator {
-	display: inline-flex;
-	align-items: center;
-	gap: 8px;
-	padding: 6px 12px;
-	border-radius: 20px;
-	background: #f0f0f0;
-	font-size: 13px;
-}
-
-.status-dot {
-	width: 10px;
-	height: 10px;
-	border-radius: 50%;
-	background: #95a5a6;
-}
-
-.status-dot.active {
-	background: var(--accent);
-	animation: pulse 1.5s infinite;
-}
-
-@keyframes pulse {
-	0% { opacity: 1; }
-	50% { opacity: 0.5; }
-	100% { opacity: 1; }
-}
-
-.progress-container {
-	margin-top: 15px;
-	display: none;
-}
-
-.progress-bar {
-	height: 10px;
-	background: #eee;
-	border-radius: 5px;
-	overflow: hidden;
-	margin-top: 10px;
-}
-
-.progress-fill {
-	height: 100%;
-	background: linear-gradient(90deg, var(--secondary), var(--accent));
-	width: 0%;
-	transition: width 0.3s;
-}
-
-.legend-wrapper {
-	margin-top: 18px;
-	font-size: 13px;
-	color: #666;
-}
-
-.legend-badge {
-	display: inline-block;
-	padding: 4px 10px;
-	border-radius: 12px;
-	margin-right: 8px;
-	font-size: 12px;
-	font-weight: 600;
-	cursor: default;
-}
-
-.legend-full     { background: rgba(46, 204, 113, 0.12); color: #27ae60; }
-.legend-destr    { background: rgba(243, 156, 18, 0.12); color: #e67e22; }
-.legend-prog     { background: rgba(52, 152, 219, 0.12); color: #2980b9; }
-.legend-info     { background: rgba(155, 89, 182, 0.12); color: #8e44ad; }
-
-.footer {
-	text-align: center;
-	margin-top: 30px;
-	color: rgba(255, 255, 255, 0.7);
-	font-size: 14px;
-}
-
-@media (max-width: 768px) {
-	.card {
-		padding: 20px;
-	}
-	h1 {
-		font-size: 24px;
-	}
-	.header-row {
-		flex-direction: column;
-		align-items: flex-start;
-		gap: 10px;
-	}
-	.header-actions {
-		width: 100%;
-		justify-content: flex-start;
-	}
-}
-</style>
-</head>
-<body>
-<div class="container">
-<header>
-<h1><i class="fas fa-microchip"></i> STM32 FOTA Control Panel</h1>
-<p class="subtitle">ESP8266-based Firmware Update System using STM32 ROM Bootloader</p>
-
-<div class="header-row">
-<div>
-<div class="target-info">
-<strong>Target:</strong> <span id="targetInfo">Not connected</span>
-</div>
-<div class="status-indicator" style="margin-top: 10px;">
-<div class="status-dot active"></div>
-<span>ESP8266 Online</span>
-</div>
-</div>
-
-<div class="header-actions">
-<button id="connectBtn" class="btn btn-primary">
-<i class="fas fa-plug"></i> Connect Target
-</button>
-<button id="logoutBtn" class="btn" style="background:#7f8c8d;color:#fff;">
-<i class="fas fa-sign-out-alt"></i> Logout
-</button>
-</div>
-</div>
-
-<div class="info-box">
-<p><strong>Workflow:</strong> Connect target → Upload <code>update.bin</code> → Run bootloader commands.</p>
-<p><strong>Current file:</strong> <span id="currentFile">None</span></p>
-</div>
-</header>
-
-<div class="card" id="uploadCard" style="display:none;">
-<h2 class="card-title"><i class="fas fa-upload"></i> 1. Upload Firmware</h2>
-<p>Select a binary (.bin) file to upload to ESP8266 filesystem (saved as /update.bin)</p>
-
-<div class="upload-area" id="dropArea">
-<div class="upload-icon">
-<i class="fas fa-cloud-upload-alt"></i>
-</div>
-<p><strong>Drag & drop your firmware file here</strong></p>
-<p>or</p>
-<div class="file-input-wrapper">
-<button class="file-btn">
-<i class="fas fa-folder-open"></i> Browse Files
-</button>
-<form id="uploadForm" method="POST" action="/upload" enctype="multipart/form-data">
-<input type="file" name="firmware" id="fwFile" accept=".bin" required>
-</form>
-</div>
-<p class="file-hint">Maximum file size limited by ESP8266 FS (LittleFS).</p>
-</div>
-
-<div class="progress-container" id="progressContainer">
-<div>Uploading: <span id="progressText">0%</span></div>
-<div class="progress-bar">
-<div class="progress-fill" id="progressFill"></div>
-</div>
-</div>
-
-<div id="uploadStatus" style="margin-top: 15px; font-weight: 600;"></div>
-
-<button id="uploadBtn" class="btn btn-primary" style="margin-top: 15px; width: 100%;">
-<i class="fas fa-upload"></i> Upload Firmware
-</button>
-</div>
-
-<div class="card" id="cmdCard" style="display:none;">
-<h2 class="card-title"><i class="fas fa-terminal"></i> 2. Bootloader Commands</h2>
-<p>Control the STM32 built-in ROM bootloader via ESP8266</p>
-
-<div class="button-grid">
-<button class="btn btn-success" data-cmd="S">
-<i class="fas fa-play-circle"></i> Full Update
-</button>
-
-<button class="btn btn-warning" data-cmd="E">
-<i class="fas fa-eraser"></i> Erase Only
-</button>
-
-<button class="btn btn-primary" data-cmd="U">
-<i class="fas fa-code"></i> Program Only
-</button>
-
-<button class="btn btn-info" data-cmd="J">
-<i class="fas fa-redo"></i> Reset to App
-</button>
-
-<button class="btn btn-info" data-cmd="G">
-<i class="fas fa-id-card"></i> Read Chip ID
-</button>
-
-<button class="btn btn-info" data-cmd="R">
-<i class="fas fa-info-circle"></i> Bootloader Version
-</button>
-
-<button class="btn btn-info" data-cmd="C">
-<i class="fas fa-list"></i> Get Commands
-</button>
-
-<button class="btn btn-danger" data-cmd="T">
-<i class="fas fa-vial"></i> Test RAM Write
-</button>
-</div>
-
-<div class="legend-wrapper">
-<strong>Legend:</strong>
-<span class="legend-badge legend-full">Full Process</span>
-<span class="legend-badge legend-destr">Destructive</span>
-<span class="legend-badge legend-prog">Programming</span>
-<span class="legend-badge legend-info">Info / Utility</span>
-</div>
-</div>
-
-<div class="card">
-<div class="log-header">
-<h2 class="card-title"><i class="fas fa-list-alt"></i> Command Log</h2>
-<div class="log-controls">
-<button onclick="clearLog()"><i class="fas fa-trash"></i> Clear</button>
-<button onclick="toggleAutoScroll()" id="scrollToggle"><i class="fas fa-arrow-down"></i> Auto-scroll ON</button>
-</div>
-</div>
-
-<div class="log-container">
-<div id="log"></div>
-</div>
-
-<div style="margin-top: 15px; display: flex; gap: 10px; flex-wrap: wrap;">
-<button class="btn" onclick="exportLog()" style="background: #7f8c8d; color: white;">
-<i class="fas fa-download"></i> Export Log
-</button>
-</div>
-</div>
-
-<div class="footer">
-<p>STM32 FOTA Panel | ESP8266 Web Interface | ROM Bootloader</p>
-<p>Access via mDNS: <code>http://)rawliteral";
-
-const char INDEX_HTML_B[] PROGMEM = R"rawliteral(.local/</code></p>
-<p>By David S. Alexander</p>
-</div>
-</div>
-
-<script>
-const logDiv = document.getElementById('log');
-const uploadBtn = document.getElementById('uploadBtn');
-const uploadForm = document.getElementById('uploadForm');
-const fwFileInput = document.getElementById('fwFile');
-const uploadStatus = document.getElementById('uploadStatus');
-const dropArea = document.getElementById('dropArea');
-const progressContainer = document.getElementById('progressContainer');
-const progressFill = document.getElementById('progressFill');
-const progressText = document.getElementById('progressText');
-const currentFileSpan = document.getElementById('currentFile');
-const connectBtn = document.getElementById('connectBtn');
-const logoutBtn = document.getElementById('logoutBtn');
-const targetInfoSpan = document.getElementById('targetInfo');
-const uploadCard = document.getElementById('uploadCard');
-const cmdCard = document.getElementById('cmdCard');
-let autoScroll = true;
-let isConnected = false;
-
-addLog('System initialized. Ready for connect.', 'system');
-
-['dragenter', 'dragover', 'dragleave', 'drop'].forEach(eventName => {
-	dropArea.addEventListener(eventName, e => {
-		e.preventDefault();
-		e.stopPropagation();
-	}, false);
-});
-
-['dragenter', 'dragover'].forEach(eventName => {
-	dropArea.addEventListener(eventName, () => dropArea.classList.add('dragover'), false);
-});
-
-['dragleave', 'drop'].forEach(eventName => {
-	dropArea.addEventListener(eventName, () => dropArea.classList.remove('dragover'), false);
-});
-
-dropArea.addEventListener('drop', e => {
-	const dt = e.dataTransfer;
-	const files = dt.files;
-	if (files.length) {
-		fwFileInput.files = files;
-		updateFileInfo(files[0]);
-		showUploadStatus('File selected: ' + files[0].name, 'info');
-	}
-}, false);
-
-fwFileInput.addEventListener('change', function() {
-	if (this.files.length) updateFileInfo(this.files[0]);
-});
-
-function updateFileInfo(file) {
-	currentFileSpan.textContent = file.name + ' (' + formatFileSize(file.size) + ')';
-	currentFileSpan.style.color = '#2ecc71';
-	currentFileSpan.style.fontWeight = 'bold';
-}
-
-function formatFileSize(bytes) {
-	if (bytes === 0) return '0 Bytes';
-	const k = 1024;
-	const sizes = ['Bytes', 'KB', 'MB', 'GB'];
-	const i = Math.floor(Math.log(bytes) / Math.log(k));
-	return parseFloat((bytes / Math.pow(k, i)).toFixed(2)) + ' ' + sizes[i];
-}
-
-uploadBtn.addEventListener('click', function() {
-	if (!isConnected) {
-		showUploadStatus('Connect target first.', 'error');
-		return;
-	}
-	if (!fwFileInput.files.length) {
-		showUploadStatus('Please select a firmware file first.', 'error');
-		return;
-	}
-	const file = fwFileInput.files[0];
-	if (!file.name.endsWith('.bin')) {
-		showUploadStatus('Please select a .bin file.', 'error');
-		return;
-	}
-	uploadFile(file);
-});
-
-function uploadFile(file) {
-	const formData = new FormData();
-	formData.append('firmware', file);
-
-	uploadBtn.disabled = true;
-	uploadBtn.innerHTML = '<i class="fas fa-spinner fa-spin"></i> Uploading...';
-	progressContainer.style.display = 'block';
-	progressFill.style.width = '0%';
-	progressText.textContent = '0%';
-
-	const xhr = new XMLHttpRequest();
-
-	xhr.upload.addEventListener('progress', function(e) {
-		if (e.lengthComputable) {
-			const percentComplete = (e.loaded / e.total) * 100;
-			progressFill.style.width = percentComplete + '%';
-			progressText.textContent = Math.round(percentComplete) + '%';
-		}
-	});
-
-	xhr.addEventListener('load', function() {
-		uploadBtn.disabled = false;
-		uploadBtn.innerHTML = '<i class="fas fa-upload"></i> Upload Firmware';
-
-		if (xhr.status === 200) {
-			showUploadStatus('Upload successful: ' + xhr.responseText, 'success');
-			addLog('Firmware uploaded: ' + file.name + ' (' + formatFileSize(file.size) + ')', 'upload');
-			} else {
-			showUploadStatus('Upload failed: ' + xhr.statusText, 'error');
-		}
-
-		setTimeout(() => { progressContainer.style.display = 'none'; }, 2000);
-	});
-
-	xhr.addEventListener('error', function() {
-		uploadBtn.disabled = false;
-		uploadBtn.innerHTML = '<i class="fas fa-upload"></i> Upload Firmware';
-		showUploadStatus('Upload error. Check connection.', 'error');
-		progressContainer.style.display = 'none';
-	});
-
-	xhr.open('POST', '/upload');
-	xhr.send(formData);
-}
-
-function showUploadStatus(message, type) {
-	uploadStatus.textContent = message;
-	uploadStatus.style.color =
-	type === 'success' ? '#2ecc71' :
-	type === 'error'   ? '#e74c3c' :
-	type === 'info'    ? '#3498db' : '#333';
-}
-
-connectBtn.addEventListener('click', async () => {
-	connectBtn.disabled = true;
-	try {
-		if (!isConnected) {
-			connectBtn.innerHTML = '<i class="fas fa-spinner fa-spin"></i> Connecting...';
-			const res = await fetch('/connect', { method: 'POST' });
-			const data = await res.json();
-			if (data.ok) {
-				addLog('Connected: ' + (data.desc || ''), 'response');
-				} else {
-				alert('Connect failed: ' + (data.error || 'unknown error'));
-			}
-			await refreshStatus();
-			} else {
-			connectBtn.innerHTML = '<i class="fas fa-spinner fa-spin"></i> Disconnecting...';
-			const res = await fetch('/disconnect', { method: 'POST' });
-			await res.json().catch(() => {});
-			addLog('Target disconnected', 'system');
-			await refreshStatus();
-		}
-		} catch (err) {
-		alert('Connect/disconnect error: ' + err.message);
-		} finally {
-		connectBtn.disabled = false;
-	}
-});
-
-logoutBtn.addEventListener('click', async () => {
-	if (!confirm('Logout and require login again on all devices?')) return;
-	logoutBtn.disabled = true;
-	const original = logoutBtn.innerHTML;
-	logoutBtn.innerHTML = '<i class="fas fa-spinner fa-spin"></i> Logging out...';
-	try {
-		const res = await fetch('/logout', { method: 'POST' });
-		await res.json().catch(() => {});
-		window.location.href = '/';
-		} catch (err) {
-		alert('Logout failed: ' + err.message);
-		logoutBtn.disabled = false;
-		logoutBtn.innerHTML = original;
-	}
-});
-
-async function refreshStatus() {
-	try {
-		const res = await fetch('/status');
-		if (!res.ok) return;
-		const data = await res.json();
-		updateUiForStatus(data);
-		} catch (e) {}
-	}
-
-	function updateUiForStatus(status) {
-		isConnected = !!status.connected;
-
-		if (isConnected) {
-			connectBtn.innerHTML = '<i class="fas fa-unlink"></i> Disconnect Target';
-			connectBtn.classList.remove('btn-primary');
-			connectBtn.classList.add('btn-danger');
-			targetInfoSpan.textContent = status.desc || 'Target connected';
-			uploadCard.style.display = 'block';
-			cmdCard.style.display = 'block';
-			} else {
-			connectBtn.innerHTML = '<i class="fas fa-plug"></i> Connect Target';
-			connectBtn.classList.remove('btn-danger');
-			connectBtn.classList.add('btn-primary');
-			targetInfoSpan.textContent = 'Not connected';
-			uploadCard.style.display = 'none';
-			cmdCard.style.display = 'none';
-		}
-
-		if (status.hasFile && status.connected) {
-			currentFileSpan.textContent = 'update.bin on device (Flash ' + status.flashKB + ' KB, devID 0x0' +
-			status.devId.toString(16) + ')';
-			currentFileSpan.style.color = '#2ecc71';
-			} else if (status.hasFile) {
-			currentFileSpan.textContent = 'update.bin on device (connect target to use)';
-			currentFileSpan.style.color = '#3498db';
-			} else {
-			currentFileSpan.textContent = 'None';
-			currentFileSpan.style.color = '#444';
-		}
-	}
-
-	document.querySelectorAll('#cmdCard .btn').forEach(btn => {
-		const cmd = btn.getAttribute('data-cmd');
-		if (!cmd) return;
-		btn.addEventListener('click', () => sendCmd(cmd, btn));
-	});
-
-	async function sendCmd(cmd, button) {
-		if (!isConnected) {
-			addLog('Target not connected. Connect first.', 'error');
-			alert('Connect target first.');
-			return;
-		}
-
-		const cmdNames =
-		{
-			'S': 'Full Update',
-			'E': 'Erase Only',
-			'U': 'Program Only',
-			'J': 'Jump to Application',
-			'G': 'Read Chip ID',
-			'R': 'Read Bootloader Version',
-			'C': 'Get Supported Commands',
-			'T': 'Test RAM Write'
-		};
-
-		addLog('Sending: ' + (cmdNames[cmd] || cmd), 'cmd');
-
-		const originalText = button.innerHTML;
-		button.disabled = true;
-		button.innerHTML = '<i class="fas fa-spinner fa-spin"></i> Processing...';
-
-		try {
-			const response = await fetch('/cmd?c=' + encodeURIComponent(cmd));
-			const text = await response.text();
-			addLog('Response: ' + text, 'response');
-			} catch (err) {
-			addLog('Error: ' + err.message, 'error');
-			} finally {
-			button.disabled = false;
-			button.innerHTML = originalText;
-		}
-	}
-
-	function addLog(message, type = 'info') {
-		const now = new Date();
-		const timeString = now.toLocaleTimeString([], {hour: '2-digit', minute:'2-digit', second:'2-digit'});
-		const typeClass = type === 'cmd' ? 'log-cmd' :
-		type === 'response' ? 'log-response' :
-		type === 'error' ? 'log-error' : '';
-
-		const logEntry = document.createElement('div');
-		logEntry.className = 'log-entry';
-		logEntry.innerHTML = `<span class="log-time">[${timeString}]</span> <span class="${typeClass}">${message}</span>`;
-		logDiv.prepend(logEntry);
-
-		if (logDiv.children.length > 200) {
-			logDiv.removeChild(logDiv.lastChild);
-		}
-
-		if (autoScroll && logDiv.firstChild) {
-			logDiv.scrollTop = 0;
-		}
-	}
-
-	function clearLog() {
-		logDiv.innerHTML = '';
-		addLog('Log cleared', 'system');
-	}
-
-	function toggleAutoScroll() {
-		autoScroll = !autoScroll;
-		const toggleBtn = document.getElementById('scrollToggle');
-		if (autoScroll) {
-			toggleBtn.innerHTML = '<i class="fas fa-arrow-down"></i> Auto-scroll ON';
-			toggleBtn.style.background = '#2ecc71';
-			} else {
-			toggleBtn.innerHTML = '<i class="fas fa-times"></i> Auto-scroll OFF';
-			toggleBtn.style.background = '#e74c3c';
-		}
-	}
-
-	function exportLog() {
-		const logContent = Array.from(logDiv.children)
-		.map(entry => entry.textContent)
-		.reverse()
-		.join('\n');
-
-		const blob = new Blob([logContent], {type: 'text/plain'});
-		const url = URL.createObjectURL(blob);
-		const a = document.createElement('a');
-		a.href = url;
-		a.download = `fota-log-${new Date().toISOString().slice(0,10)}.txt`;
-		document.body.appendChild(a);
-		a.click();
-		document.body.removeChild(a);
-		URL.revokeObjectURL(url);
-
-		addLog('Log exported', 'system');
-	}
-
-	document.addEventListener('DOMContentLoaded', () => {
-		refreshStatus();
-	});
-	</script>
-	</body>
-	</html>
-	)rawliteral";
+/* login.html: 5260 bytes of HTML, 2225 bytes gzip */
+static const uint8_t LOGIN_PAGE_GZ[] PROGMEM =
+{
+	0x1F, 0x8B, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0x9D, 0x58, 0x6D, 0x73, 0xDB, 0x36,
+	0x12, 0xFE, 0xAE, 0x5F, 0x81, 0x32, 0xD3, 0x93, 0x74, 0x27, 0x52, 0xA2, 0x64, 0xF9, 0x45, 0x94,
+	0x34, 0x6D, 0xDE, 0x2E, 0x99, 0x49, 0x2E, 0x99, 0xC6, 0xB9, 0x99, 0xCE, 0x4D, 0x3F, 0x40, 0x24,
+	0x28, 0x22, 0xA6, 0x08, 0x1E, 0x08, 0xC9, 0xF6, 0xA9, 0xFA, 0xEF, 0xF7, 0x2C, 0x40, 0xD1, 0x92,
+	0x6C, 0xA7, 0x9D, 0xC6, 0x19, 0x93, 0x5C, 0x02, 0xD8, 0x67, 0xF7, 0x79, 0xB0, 0x58, 0x7A, 0xFA,
+	0xC3, 0xEB, 0x4F, 0xAF, 0xAE, 0x7F, 0xFD, 0xFC, 0x86, 0x65, 0x66, 0x95, 0xCF, 0x5B, 0x53, 0xBA,
+	0xB0, 0x9C, 0x17, 0xCB, 0x99, 0x27, 0x0A, 0x8F, 0x0C, 0x82, 0x27, 0xB8, 0xAC, 0x84, 0xE1, 0x2C,
+	0xCE, 0xB8, 0xAE, 0x84, 0x99, 0x79, 0x5F, 0xAF, 0xDF, 0xFA, 0x97, 0xDE, 0xDE, 0x5C, 0xF0, 0x95,
+	0x98, 0x79, 0x1B, 0x29, 0x6E, 0x4B, 0xA5, 0x8D, 0xC7, 0x62, 0x55, 0x18, 0x51, 0x60, 0xD8, 0xAD,
+	0x4C, 0x4C, 0x36, 0x4B, 0xC4, 0x46, 0xC6, 0xC2, 0xB7, 0x0F, 0x3D, 0x26, 0x0B, 0x69, 0x24, 0xCF,
+	0xFD, 0x2A, 0xE6, 0xB9, 0x98, 0x85, 0xC1, 0x80, 0x96, 0x31, 0xD2, 0xE4, 0x62, 0xFE, 0xE5, 0xFA,
+	0xE3, 0x68, 0xC8, 0x5E, 0x2A, 0x65, 0x72, 0xC5, 0x13, 0xA1, 0xD9, 0x07, 0xB5, 0x94, 0xC5, 0xB4,
+	0xEF, 0xDE, 0xB6, 0xA6, 0x95, 0xB9, 0xC7, 0x75, 0xA2, 0x31, 0x80, 0x6D, 0x7D, 0xBF, 0xD4, 0x72,
+	0xC5, 0xF5, 0xFD, 0x84, 0xBD, 0x18, 0xC6, 0x23, 0x31, 0x1E, 0x44, 0xBE, 0x5F, 0x09, 0xF8, 0x4E,
+	0x9C, 0x71, 0x74, 0x76, 0x75, 0x99, 0x2C, 0x60, 0xE4, 0x71, 0x0C, 0x34, 0x34, 0x4C, 0xC4, 0xF1,
+	0x45, 0x08, 0x4B, 0x82, 0xF8, 0x84, 0x86, 0x45, 0x5C, 0x9C, 0xC5, 0xA3, 0x18, 0x96, 0x5C, 0x2E,
+	0x33, 0x1A, 0x22, 0xE2, 0x74, 0x90, 0xD2, 0x90, 0x98, 0xEB, 0xC4, 0x5F, 0x2C, 0x61, 0x4A, 0xED,
+	0x3F, 0x5A, 0x3C, 0xE3, 0x89, 0xBA, 0x9D, 0x30, 0xBD, 0x5C, 0xF0, 0xCE, 0xA0, 0xC7, 0xEA, 0xFF,
+	0x41, 0x38, 0xEC, 0x46, 0xBB, 0xBF, 0xB3, 0x2D, 0xC0, 0x00, 0xEE, 0x84, 0x0D, 0xA2, 0x92, 0x27,
+	0x89, 0x2C, 0x96, 0x74, 0xBB, 0x50, 0x77, 0x7E, 0x25, 0xFF, 0x67, 0x9F, 0x16, 0x4A, 0x23, 0x2A,
+	0x1F, 0xA6, 0x68, 0xB7, 0x50, 0xC9, 0x3D, 0xDB, 0xA6, 0xC8, 0x94, 0x9F, 0xF2, 0x95, 0xCC, 0x81,
+	0xB8, 0xFD, 0x45, 0x2C, 0x95, 0x60, 0x5F, 0xDF, 0xB7, 0x7B, 0xEC, 0x9A, 0x67, 0x6A, 0xC5, 0x7B,
+	0xEC, 0x9F, 0xA2, 0x10, 0x1B, 0x5C, 0xFF, 0x2D, 0x34, 0x40, 0xE3, 0xA6, 0xE2, 0x45, 0x85, 0x30,
+	0xB5, 0x4C, 0xA3, 0x05, 0x8F, 0x6F, 0x96, 0x5A, 0xAD, 0x8B, 0x64, 0xC2, 0x72, 0x59, 0x08, 0xAE,
+	0xFD, 0xA5, 0xE6, 0x89, 0x44, 0xB0, 0x9D, 0x70, 0x34, 0x4E, 0xC4, 0xB2, 0xC7, 0x5E, 0x9C, 0x9F,
+	0x5F, 0x08, 0xC1, 0xD9, 0xE0, 0x47, 0xDC, 0x5F, 0x9C, 0x9F, 0x2D, 0xF8, 0x90, 0x85, 0x83, 0xC1,
+	0x8F, 0xDD, 0x68, 0x25, 0x0B, 0x3F, 0x13, 0x2E, 0x6C, 0x58, 0x36, 0x59, 0x94, 0xC8, 0xAA, 0xCC,
+	0x39, 0x80, 0xA4, 0xB9, 0xB8, 0x8B, 0x38, 0x52, 0x52, 0xF8, 0xD2, 0x88, 0x55, 0x35, 0x61, 0x94,
+	0x40, 0xA1, 0xA3, 0x6F, 0xEB, 0xCA, 0xC8, 0xF4, 0xDE, 0xAF, 0x09, 0x6E, 0xEC, 0x4D, 0xBC, 0xC3,
+	0x41, 0x79, 0x17, 0xC5, 0x2A, 0x57, 0x94, 0xDC, 0xD1, 0x68, 0x14, 0xED, 0x82, 0x9C, 0x38, 0xB4,
+	0xE9, 0x64, 0xDB, 0x43, 0xC4, 0x1B, 0xAE, 0x3B, 0x4D, 0x9A, 0xBB, 0x51, 0x9D, 0x1B, 0xC2, 0xBF,
+	0x86, 0xC3, 0xF0, 0x1C, 0x0B, 0x35, 0xCB, 0x8E, 0xB0, 0x2C, 0x1B, 0x5E, 0xC2, 0xB4, 0xE2, 0x77,
+	0x4E, 0x48, 0x30, 0x5E, 0x92, 0xB3, 0xFA, 0x81, 0x62, 0x72, 0xB9, 0xAE, 0x49, 0x1A, 0xB0, 0xF0,
+	0x0C, 0x93, 0xCE, 0x68, 0xA6, 0x73, 0xE5, 0xDE, 0x74, 0x1B, 0x48, 0x24, 0x6C, 0x68, 0x6C, 0x6B,
+	0xC4, 0x9D, 0xF1, 0x6D, 0xB4, 0x4D, 0x3C, 0x8E, 0x49, 0x10, 0x65, 0x8C, 0x5A, 0xD5, 0x51, 0x9D,
+	0x4C, 0xCB, 0xC2, 0x9A, 0x3D, 0x90, 0x2B, 0x30, 0x64, 0xF8, 0x10, 0xB8, 0x73, 0x57, 0xAB, 0xB3,
+	0x7B, 0xBA, 0x18, 0x05, 0xF6, 0xD7, 0x33, 0xBD, 0xE4, 0xE5, 0x84, 0x5D, 0x3E, 0x86, 0x53, 0x1E,
+	0xA1, 0x09, 0x47, 0x07, 0x34, 0x5C, 0x5C, 0x5C, 0x9C, 0x8E, 0x0E, 0x64, 0xCC, 0xB6, 0x47, 0x68,
+	0x9B, 0x8D, 0x43, 0xF9, 0x49, 0xA5, 0xC8, 0x13, 0x9F, 0x88, 0x2A, 0xF7, 0xAA, 0x6E, 0xE0, 0x87,
+	0x63, 0x72, 0x9E, 0xF3, 0x85, 0xC8, 0xD9, 0xB6, 0x89, 0x63, 0x91, 0xAB, 0xF8, 0x26, 0x7A, 0x0E,
+	0xC1, 0x78, 0x3C, 0x3E, 0xCD, 0x02, 0xAD, 0x62, 0x87, 0xDF, 0xD6, 0x12, 0x3C, 0x1F, 0x0C, 0xA2,
+	0x9D, 0x2C, 0xCA, 0xB5, 0xF9, 0x8F, 0xB9, 0x2F, 0x51, 0x4E, 0x88, 0x16, 0xEF, 0xB7, 0xDE, 0xA1,
+	0xA9, 0xE4, 0x55, 0x75, 0x0B, 0x9D, 0x78, 0xBF, 0xB1, 0xED, 0x21, 0xEF, 0x8D, 0x4E, 0x42, 0x62,
+	0x3B, 0x24, 0x2A, 0x4E, 0xE4, 0x74, 0xD9, 0x98, 0x30, 0x08, 0x63, 0x2A, 0x95, 0xCB, 0x84, 0xBD,
+	0x88, 0xE3, 0xF8, 0x08, 0x34, 0x14, 0x13, 0xA9, 0xB5, 0xA1, 0xCD, 0x34, 0x61, 0x85, 0x2A, 0x44,
+	0x64, 0x34, 0xF6, 0x1B, 0x0A, 0x96, 0x2A, 0xF6, 0xDB, 0x17, 0x1B, 0x7E, 0x58, 0x31, 0xC1, 0x2B,
+	0xD1, 0x63, 0x0F, 0x82, 0x7B, 0xB0, 0x3E, 0x15, 0xC5, 0x24, 0x55, 0xF1, 0xBA, 0x7A, 0x26, 0x16,
+	0xF7, 0x12, 0x9B, 0xC3, 0x41, 0x7E, 0x8E, 0x96, 0x63, 0x71, 0xD3, 0x0F, 0xE2, 0x74, 0xB5, 0x68,
+	0x3C, 0xEC, 0x81, 0x17, 0xFC, 0x1A, 0x86, 0x57, 0xB6, 0x20, 0x8D, 0x89, 0xC5, 0x85, 0x29, 0x9E,
+	0x4B, 0x13, 0xA5, 0xC0, 0xEE, 0xB0, 0xD3, 0x5D, 0x37, 0x38, 0xC8, 0x93, 0x8D, 0xFF, 0x34, 0x3B,
+	0x8F, 0x38, 0x8B, 0xD7, 0xBA, 0x22, 0xBC, 0xA5, 0x92, 0x56, 0xA0, 0x8D, 0x24, 0x64, 0x41, 0x69,
+	0xF4, 0xFF, 0xBA, 0xC2, 0xF7, 0xEA, 0xA1, 0xE2, 0xFB, 0xB8, 0x70, 0x1C, 0x64, 0xE6, 0x88, 0xA3,
+	0x66, 0xA0, 0x65, 0xA4, 0xC7, 0xEC, 0xCB, 0x54, 0xE9, 0x95, 0xCD, 0x4B, 0x75, 0xC2, 0x19, 0x2C,
+	0x2E, 0x53, 0x93, 0x4C, 0x6D, 0xA8, 0x18, 0x1C, 0x3A, 0x7A, 0x31, 0xBC, 0xBA, 0x1C, 0x2C, 0xAE,
+	0xA2, 0x66, 0x89, 0x89, 0x5B, 0x2D, 0xE7, 0x46, 0xFC, 0xDA, 0xF1, 0x91, 0xC4, 0x53, 0x56, 0x2E,
+	0x28, 0xAF, 0x97, 0xCF, 0xD1, 0x32, 0xAA, 0x59, 0x99, 0x20, 0x47, 0x7C, 0x91, 0x0B, 0x14, 0x44,
+	0x55, 0xF2, 0x58, 0x1A, 0x64, 0x6B, 0x10, 0x9C, 0x8F, 0x9B, 0x5C, 0x16, 0x8A, 0x0A, 0x52, 0xAE,
+	0x6E, 0x45, 0x72, 0xE4, 0xE0, 0x41, 0x91, 0x0E, 0x8D, 0x7D, 0xDE, 0x05, 0x95, 0xE1, 0x86, 0x04,
+	0x54, 0x6F, 0x31, 0xA3, 0xCA, 0x9A, 0xC9, 0xD3, 0xFD, 0x78, 0x54, 0xF2, 0x29, 0xC5, 0x4F, 0x94,
+	0xBE, 0xFD, 0x72, 0x81, 0xBA, 0x39, 0x29, 0x11, 0xEE, 0x18, 0xED, 0x3E, 0x8C, 0x10, 0x5A, 0x9F,
+	0x0C, 0x71, 0xE7, 0xAA, 0x2D, 0x21, 0x38, 0xA3, 0x29, 0x9F, 0x47, 0x98, 0xCE, 0x4F, 0x30, 0x85,
+	0x4F, 0x43, 0xD8, 0x13, 0x7F, 0x75, 0x75, 0xF5, 0xB0, 0x52, 0xAC, 0x12, 0x71, 0x42, 0x4F, 0x7A,
+	0x96, 0x8E, 0xD3, 0x8B, 0x83, 0xC3, 0x87, 0xEA, 0xFD, 0x63, 0x51, 0x9F, 0x3D, 0xE1, 0x75, 0x67,
+	0x2B, 0xE0, 0x7E, 0x73, 0x88, 0x55, 0xD4, 0xA4, 0x05, 0xF7, 0x10, 0x82, 0x91, 0xE8, 0x4E, 0xF6,
+	0xB0, 0x7C, 0x3A, 0xE2, 0xC7, 0x78, 0x91, 0xCA, 0x3C, 0xAF, 0xB3, 0x5E, 0x19, 0xAD, 0x6E, 0xB0,
+	0x1A, 0x28, 0xD3, 0x40, 0xFD, 0x8A, 0x20, 0xD7, 0xC6, 0xFD, 0xF9, 0x34, 0xDC, 0x3F, 0xD3, 0x3E,
+	0x88, 0x49, 0xD5, 0x16, 0xF8, 0xA1, 0xF5, 0x9B, 0xA2, 0x7E, 0xC1, 0x99, 0x91, 0xD6, 0x52, 0x62,
+	0xC7, 0xF2, 0x02, 0xE7, 0x86, 0x13, 0xB3, 0x35, 0x84, 0x55, 0x7D, 0xB8, 0x63, 0x47, 0xA5, 0xD4,
+	0x3C, 0x81, 0xF2, 0x9F, 0x6E, 0xC4, 0x7D, 0xAA, 0xD1, 0x75, 0x55, 0x6E, 0xCC, 0xD6, 0x28, 0xB6,
+	0x65, 0x07, 0xCA, 0xD0, 0x0A, 0x14, 0x89, 0xCE, 0xE8, 0x7C, 0x80, 0x2E, 0xA0, 0x1B, 0xB1, 0xDD,
+	0x6E, 0xDA, 0x77, 0xDD, 0x53, 0x6B, 0xDA, 0xAF, 0x3B, 0x3A, 0xEA, 0x40, 0xA8, 0xA9, 0xDA, 0x2C,
+	0x99, 0x7D, 0x35, 0xF3, 0xF6, 0x7B, 0x97, 0x22, 0xF4, 0xE6, 0xD3, 0xEA, 0x7E, 0xB5, 0x50, 0x39,
+	0x93, 0xC9, 0xCC, 0x93, 0xFE, 0x4A, 0xC6, 0x5A, 0xC5, 0x99, 0x2C, 0x3D, 0x46, 0x8D, 0xDE, 0x4B,
+	0x75, 0x37, 0xF3, 0x6C, 0x11, 0x3A, 0xC3, 0x7F, 0x0C, 0xD6, 0x22, 0x36, 0x0C, 0xB6, 0x73, 0x8F,
+	0xDD, 0xDB, 0xDF, 0xAE, 0xF7, 0xF3, 0xC2, 0xA1, 0xC7, 0x5C, 0x72, 0xDD, 0xBD, 0xC6, 0x98, 0xD0,
+	0xEB, 0xCF, 0xA7, 0x25, 0x37, 0x19, 0xC3, 0xD2, 0x1F, 0xAF, 0xD8, 0x70, 0x73, 0xF6, 0x31, 0x1C,
+	0xDB, 0xCB, 0x15, 0x84, 0xE9, 0x9E, 0xEC, 0x75, 0xC8, 0xAE, 0x32, 0xFA, 0x1D, 0x8E, 0x71, 0x09,
+	0x2F, 0xED, 0x13, 0x2E, 0xF4, 0x48, 0x6B, 0xF4, 0x1D, 0xC4, 0x13, 0xA8, 0x95, 0x2D, 0x36, 0xC5,
+	0x33, 0x40, 0x1B, 0xBF, 0xF0, 0x31, 0xCA, 0xCE, 0xD0, 0x0F, 0x0D, 0x6D, 0x35, 0x0D, 0x71, 0x1D,
+	0x6E, 0xC2, 0x03, 0x83, 0x8F, 0xBB, 0xCC, 0x87, 0x43, 0xDC, 0x5F, 0xE4, 0x63, 0xDF, 0xFE, 0x58,
+	0x68, 0xC3, 0x77, 0xA3, 0xEF, 0xB8, 0x07, 0x23, 0x85, 0xD0, 0x7F, 0xE8, 0x1E, 0xAB, 0x73, 0x5A,
+	0xDA, 0x39, 0xB7, 0x37, 0xE1, 0xE0, 0x68, 0xD9, 0x3E, 0xB8, 0x01, 0x43, 0x89, 0xDC, 0xB0, 0x38,
+	0xC7, 0x79, 0x31, 0xF3, 0x1E, 0x9A, 0x29, 0xEF, 0xA9, 0x17, 0xEE, 0x78, 0xB7, 0x5D, 0x7B, 0x38,
+	0xB7, 0xCC, 0xD6, 0xAF, 0x65, 0x0C, 0xD7, 0xEB, 0x4A, 0xB0, 0x4C, 0x8B, 0x74, 0xE6, 0xBD, 0x38,
+	0xE4, 0xB3, 0x5F, 0x3B, 0x62, 0xA7, 0xED, 0x37, 0x94, 0x12, 0x62, 0xA9, 0x72, 0xFE, 0x05, 0x09,
+	0x85, 0xFA, 0x18, 0x54, 0x46, 0x45, 0xA0, 0xAA, 0x98, 0xC9, 0x04, 0x7B, 0xFB, 0xE9, 0xFA, 0x67,
+	0xDB, 0xEA, 0x6B, 0x84, 0x5E, 0xF2, 0x42, 0xE4, 0xD3, 0x7E, 0x49, 0xFA, 0x02, 0x2C, 0x5C, 0x6C,
+	0xCD, 0xA5, 0x8C, 0x58, 0x68, 0x6F, 0xF1, 0x74, 0x02, 0xF9, 0xA0, 0xCB, 0xA0, 0x37, 0xAE, 0xA5,
+	0xC0, 0xAC, 0x99, 0x07, 0xA0, 0x08, 0xE2, 0x2B, 0x7E, 0xD3, 0x97, 0xC5, 0xB4, 0x6F, 0x5F, 0x61,
+	0x88, 0x3D, 0x3F, 0xD9, 0xC1, 0xC1, 0x6A, 0xD7, 0xB7, 0xA3, 0xEB, 0x6F, 0x10, 0x77, 0xCF, 0xD7,
+	0x46, 0xC5, 0x6A, 0x55, 0xE6, 0xC2, 0xD4, 0x36, 0x7A, 0x0B, 0xED, 0x89, 0xFF, 0xAE, 0xA5, 0x16,
+	0xC9, 0x03, 0xC8, 0x3F, 0x05, 0x87, 0x8E, 0x6A, 0x6F, 0xFE, 0xB9, 0x3E, 0xB0, 0x9F, 0x86, 0xD3,
+	0x1C, 0xE7, 0x16, 0x92, 0x9D, 0x51, 0x43, 0x72, 0xF7, 0xC7, 0x90, 0xEA, 0xAA, 0xE1, 0x3F, 0xCC,
+	0x7A, 0x0C, 0x6D, 0xB1, 0x46, 0xA7, 0x54, 0xD4, 0xCB, 0x57, 0xEB, 0xC5, 0x4A, 0xD6, 0xF1, 0xDA,
+	0x7C, 0xBE, 0x34, 0xD0, 0x77, 0x8D, 0x1C, 0x47, 0x8A, 0x57, 0x6F, 0xE4, 0x67, 0xE9, 0xDE, 0xEF,
+	0x89, 0x86, 0x6C, 0xFB, 0x69, 0x05, 0x67, 0xCE, 0x0D, 0xB9, 0x25, 0xC2, 0xEA, 0x94, 0x90, 0x1B,
+	0x57, 0xE4, 0x3F, 0x56, 0xCB, 0xC6, 0x8F, 0xB3, 0x60, 0xE5, 0x27, 0x92, 0x67, 0x8B, 0xB4, 0x67,
+	0xD5, 0xF2, 0xDA, 0x7E, 0xEE, 0xB1, 0x4C, 0x55, 0xA8, 0xA7, 0x53, 0xAA, 0xDB, 0xF3, 0xCC, 0x98,
+	0x72, 0xD2, 0xEF, 0x4F, 0x2B, 0xC8, 0xC4, 0x2E, 0xBE, 0x4A, 0x8A, 0xEA, 0x1D, 0x06, 0x78, 0xF3,
+	0xCA, 0xAC, 0x46, 0xC3, 0x14, 0xAB, 0x64, 0x24, 0x38, 0x1A, 0x30, 0x47, 0xAF, 0x8A, 0xEA, 0xDB,
+	0x9F, 0xF6, 0xED, 0x5C, 0x27, 0xAA, 0x72, 0xFE, 0xF2, 0x9E, 0xBD, 0xE6, 0x1B, 0x74, 0x6D, 0x5F,
+	0x02, 0xF6, 0x33, 0x9A, 0x0A, 0x5E, 0x58, 0x89, 0x1E, 0x28, 0xAE, 0xBE, 0x54, 0xB1, 0x96, 0xA5,
+	0x99, 0xB7, 0x20, 0xCD, 0xCA, 0x30, 0x2B, 0xC3, 0x19, 0x4B, 0xD0, 0x63, 0xAD, 0x90, 0xF2, 0x60,
+	0x29, 0xCC, 0x9B, 0x5C, 0xD0, 0xED, 0xCB, 0xFB, 0xF7, 0x49, 0xA7, 0xDD, 0xA8, 0xB3, 0xDD, 0x8D,
+	0xEA, 0x29, 0xD4, 0x38, 0xFD, 0xE1, 0x14, 0x10, 0xF0, 0x30, 0x63, 0x55, 0x2D, 0xBF, 0x3B, 0xA3,
+	0xC9, 0x25, 0x4D, 0x21, 0x44, 0x01, 0xCE, 0xAC, 0x37, 0x1B, 0xBC, 0xFF, 0x20, 0x2B, 0x74, 0x3F,
+	0x42, 0x63, 0x8C, 0xA5, 0x18, 0x9F, 0x7E, 0xBC, 0xBA, 0x2F, 0x62, 0xD6, 0x11, 0x5D, 0x36, 0x9B,
+	0xB3, 0x6D, 0x4B, 0x04, 0xA5, 0x16, 0x34, 0xF4, 0xB5, 0x48, 0xF9, 0x3A, 0x37, 0x1D, 0x2C, 0x01,
+	0x7F, 0x01, 0x6D, 0x80, 0x57, 0xAE, 0x77, 0x82, 0xEB, 0x76, 0xDB, 0x59, 0x2D, 0x1F, 0xFF, 0x82,
+	0xF0, 0xC8, 0xE6, 0xDC, 0xB6, 0xF7, 0x28, 0xD7, 0xDF, 0x83, 0x48, 0xBB, 0xA4, 0xDD, 0x0D, 0x36,
+	0x3C, 0x5F, 0x8B, 0xC0, 0xE0, 0xDB, 0xA5, 0xD3, 0x44, 0x57, 0x7E, 0x6F, 0x1E, 0x49, 0x78, 0x3F,
+	0x2F, 0x6A, 0xC9, 0x94, 0x75, 0x7E, 0x58, 0xB3, 0xDF, 0x7F, 0x67, 0x3F, 0x94, 0x5D, 0x80, 0x7F,
+	0x02, 0xE8, 0xE7, 0x9C, 0xBA, 0x64, 0x66, 0x8F, 0x7A, 0xB6, 0xDF, 0x9B, 0x0C, 0x6C, 0xB2, 0xFD,
+	0x6E, 0x08, 0x0E, 0x63, 0xA1, 0x04, 0x51, 0xB6, 0x3A, 0x6D, 0xB4, 0x1B, 0x94, 0x3E, 0x2D, 0xCC,
+	0x5A, 0x17, 0x51, 0x6B, 0xD7, 0x02, 0x4F, 0x41, 0xD3, 0x4A, 0xCD, 0x70, 0xFC, 0x11, 0x02, 0x07,
+	0x59, 0x69, 0x09, 0x8E, 0x78, 0xFE, 0x8E, 0xFE, 0x9A, 0x31, 0x23, 0x46, 0x03, 0x5B, 0x94, 0xDF,
+	0x5D, 0x7F, 0xFC, 0x10, 0xB5, 0x8E, 0x1E, 0x09, 0xD3, 0xF1, 0xDE, 0xB1, 0x67, 0xEA, 0xA3, 0x0D,
+	0x54, 0x57, 0xF5, 0x66, 0x03, 0xBD, 0xCA, 0x44, 0x7C, 0x83, 0xBE, 0x23, 0x08, 0x08, 0xAF, 0xD1,
+	0xF8, 0x9A, 0xDF, 0xEB, 0x87, 0x3E, 0xED, 0xB1, 0x2A, 0x05, 0x37, 0x6B, 0xB3, 0x7F, 0x20, 0x56,
+	0x52, 0xF2, 0xD7, 0x5F, 0xDE, 0xBF, 0x42, 0x05, 0xC0, 0xD9, 0x8A, 0xEF, 0xF3, 0x75, 0x17, 0xF6,
+	0xF6, 0xDF, 0x28, 0xE4, 0xE7, 0x86, 0x94, 0x0D, 0x01, 0x1A, 0xE7, 0xFC, 0x8C, 0xF1, 0x5B, 0x2E,
+	0xA1, 0x67, 0x61, 0xE2, 0xAC, 0xD3, 0xEE, 0x5B, 0x11, 0x42, 0x2D, 0xC8, 0xB1, 0x30, 0x99, 0x42,
+	0x3F, 0xD4, 0xFE, 0xFC, 0xE9, 0xCB, 0x75, 0xBB, 0xD7, 0x72, 0x87, 0x00, 0x1A, 0x9F, 0x6D, 0xBB,
+	0x4E, 0xBB, 0x7F, 0x8D, 0x22, 0xD2, 0xC6, 0x08, 0x5E, 0x96, 0x39, 0x3A, 0x1B, 0xEA, 0x2E, 0xFA,
+	0xF8, 0x8E, 0xBE, 0xBD, 0xF5, 0x49, 0x8C, 0xFE, 0x5A, 0xE7, 0xCE, 0x7F, 0xD2, 0xDE, 0xF5, 0x5A,
+	0x04, 0xBF, 0xB5, 0x6B, 0x9C, 0x27, 0xDC, 0xF0, 0xC6, 0x3B, 0x90, 0x04, 0xDF, 0x2A, 0x55, 0x90,
+	0x38, 0x88, 0x6B, 0x7A, 0x89, 0x4E, 0xF1, 0x19, 0xAA, 0x6D, 0x8D, 0x61, 0xD5, 0xDA, 0x9E, 0x19,
+	0xE9, 0x3A, 0x0F, 0xD8, 0x2F, 0x22, 0x91, 0xD4, 0x29, 0x34, 0x79, 0x7B, 0x82, 0x67, 0x75, 0x43,
+	0x34, 0x57, 0xC2, 0x5C, 0xCB, 0x95, 0xC0, 0xD7, 0x58, 0xA7, 0xE3, 0x76, 0x02, 0x3A, 0x8A, 0x02,
+	0x6D, 0xB0, 0xAD, 0x0E, 0x14, 0x41, 0x40, 0xDC, 0x90, 0x9B, 0x7E, 0x1B, 0x0D, 0x4E, 0x8F, 0xBE,
+	0x46, 0x30, 0x6F, 0xC7, 0x44, 0x0E, 0xDE, 0x9E, 0xC2, 0x63, 0xC1, 0x42, 0x45, 0x4A, 0x93, 0x40,
+	0xDB, 0xEF, 0x0B, 0x88, 0x16, 0xF5, 0xA4, 0xD1, 0x20, 0xEC, 0x7F, 0x4E, 0x82, 0x3B, 0x78, 0x01,
+	0x86, 0x38, 0xC3, 0x2E, 0xD5, 0xFA, 0xBB, 0xC1, 0x5B, 0x77, 0xC8, 0x3C, 0x51, 0xAC, 0x75, 0x80,
+	0x8E, 0xAD, 0xE2, 0x4B, 0xF1, 0xDD, 0xC5, 0x59, 0x4A, 0xCA, 0xCD, 0x49, 0x4F, 0x27, 0x0A, 0x4F,
+	0x39, 0x42, 0x7B, 0x2C, 0xDF, 0x43, 0xB1, 0x5B, 0x70, 0x54, 0x64, 0x6A, 0x99, 0xD4, 0x25, 0xA0,
+	0xDB, 0x0A, 0x70, 0x64, 0x17, 0x1D, 0xAB, 0xA4, 0xF9, 0x01, 0x8D, 0xFB, 0x17, 0x8E, 0x65, 0xCA,
+	0x72, 0x43, 0x2B, 0x15, 0xF0, 0xEE, 0xF3, 0x1B, 0x7F, 0x5F, 0xC2, 0xB1, 0xF9, 0x9F, 0x48, 0x33,
+	0x4D, 0x06, 0x2B, 0x58, 0xDE, 0x26, 0x6A, 0xCF, 0x21, 0x41, 0xC3, 0xFE, 0xA9, 0x2B, 0x34, 0x4E,
+	0x1F, 0xD7, 0x83, 0xF6, 0xED, 0x1F, 0x1F, 0xFF, 0x0F, 0xBE, 0xA0, 0xC2, 0xF6, 0x8C, 0x14, 0x00,
+	0x00,
+};
+
+static const char LOGIN_PAGE_ETAG[] PROGMEM = "\"1c574b6edbb437e9\"";
+static const char LOGIN_PAGE_MIME[] PROGMEM = "text/html";
+
+const STM32WebAsset LOGIN_PAGE = { LOGIN_PAGE_GZ, sizeof(LOGIN_PAGE_GZ), LOGIN_PAGE_ETAG, LOGIN_PAGE_MIME };
+
+/* index.html: 41373 bytes of HTML, 13092 bytes gzip */
+static const uint8_t INDEX_PAGE_GZ[] PROGMEM =
+{
+	0x1F, 0x8B, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xC5, 0x7D, 0xEB, 0x7A, 0xDB, 0x46,
+	0xB2, 0xE0, 0x7F, 0x3D, 0x45, 0x47, 0x99, 0x0C, 0xC1, 0x98, 0x84, 0x00, 0xF0, 0x2E, 0x5A, 0xCA,
+	0xB1, 0x65, 0x3B, 0xF6, 0xC4, 0x8A, 0xFD, 0x59, 0x72, 0x32, 0xE7, 0xD3, 0x78, 0x33, 0x20, 0xD0,
+	0x24, 0x11, 0x83, 0x04, 0x03, 0x80, 0xBA, 0x8C, 0x46, 0xE7, 0xE7, 0x3E, 0xC0, 0x3E, 0xE2, 0x3E,
+	0xC9, 0x56, 0x55, 0x5F, 0xD0, 0x00, 0x41, 0x52, 0xF6, 0xCC, 0x7E, 0x13, 0xCF, 0x88, 0x60, 0xA3,
+	0xBB, 0xAA, 0xBA, 0xBA, 0xAA, 0xBA, 0xAA, 0xFA, 0xC2, 0xA7, 0xDF, 0xBC, 0x78, 0x77, 0x76, 0xF9,
+	0xDF, 0xEF, 0x5F, 0xB2, 0x79, 0xBE, 0x88, 0x4F, 0x0F, 0x9E, 0xE2, 0x07, 0x8B, 0xFD, 0xE5, 0xEC,
+	0xE4, 0x90, 0x2F, 0x0F, 0xB1, 0x80, 0xFB, 0x21, 0x7C, 0x2C, 0x78, 0xEE, 0xB3, 0x60, 0xEE, 0xA7,
+	0x19, 0xCF, 0x4F, 0x0E, 0x3F, 0x5E, 0xBE, 0x6A, 0x0F, 0x0F, 0x55, 0xF1, 0xD2, 0x5F, 0xF0, 0x93,
+	0xC3, 0xEB, 0x88, 0xDF, 0xAC, 0x92, 0x34, 0x3F, 0x64, 0x41, 0xB2, 0xCC, 0xF9, 0x12, 0xAA, 0xDD,
+	0x44, 0x61, 0x3E, 0x3F, 0x09, 0xF9, 0x75, 0x14, 0xF0, 0x36, 0x7D, 0x69, 0xB1, 0x68, 0x19, 0xE5,
+	0x91, 0x1F, 0xB7, 0xB3, 0xC0, 0x8F, 0xF9, 0x89, 0x6B, 0x3B, 0x08, 0x26, 0x8F, 0xF2, 0x98, 0x9F,
+	0x5E, 0x5C, 0x9E, 0x77, 0x3C, 0xF6, 0xEA, 0xDD, 0xE5, 0x33, 0x76, 0x06, 0x20, 0xD2, 0x24, 0x66,
+	0xEF, 0xFD, 0x25, 0x8F, 0x9F, 0x1E, 0x89, 0xF7, 0x07, 0x4F, 0xB3, 0xFC, 0x0E, 0x3E, 0x8F, 0xD3,
+	0x24, 0xC9, 0xD9, 0x7D, 0xBB, 0xBD, 0x4A, 0xA3, 0x85, 0x9F, 0xDE, 0x1D, 0xB3, 0x6F, 0xBD, 0xA0,
+	0xC3, 0x7B, 0xCE, 0xB8, 0xDD, 0xCE, 0x38, 0x60, 0x0F, 0x45, 0x61, 0xA7, 0x3B, 0x1A, 0x86, 0x13,
+	0x28, 0xF4, 0x83, 0x00, 0xE8, 0xC1, 0x6A, 0x3C, 0x08, 0x06, 0x2E, 0x94, 0x84, 0xD0, 0x43, 0x9E,
+	0x42, 0x09, 0x1F, 0x74, 0x83, 0x4E, 0x00, 0x25, 0x37, 0x7E, 0xBA, 0x8C, 0x96, 0x33, 0x28, 0x9A,
+	0x76, 0x46, 0x81, 0xEB, 0x41, 0x51, 0x1C, 0xCD, 0xE6, 0xD8, 0x8A, 0x07, 0x53, 0x67, 0x2A, 0x5A,
+	0xA5, 0x9F, 0x4D, 0x64, 0x81, 0x9F, 0x86, 0xED, 0x09, 0xB5, 0xA1, 0xFF, 0x10, 0xFF, 0xDC, 0x0F,
+	0x93, 0x9B, 0x63, 0x96, 0xCE, 0x26, 0xBE, 0xE5, 0xB4, 0x98, 0xFC, 0x9F, 0xED, 0x0C, 0x9B, 0xE3,
+	0x87, 0xEF, 0xD9, 0x3D, 0xD0, 0x3B, 0x8B, 0x96, 0xC7, 0xCC, 0x19, 0xAF, 0xFC, 0x30, 0x24, 0x84,
+	0xCE, 0x78, 0x92, 0xDC, 0xB6, 0xB3, 0xE8, 0x1F, 0xF4, 0x6D, 0x92, 0xA4, 0x21, 0x4F, 0xDB, 0x50,
+	0x34, 0x7E, 0x98, 0x24, 0xE1, 0x1D, 0xBB, 0x9F, 0x02, 0x2F, 0xDA, 0x53, 0x7F, 0x11, 0xC5, 0xD0,
+	0xA9, 0xC6, 0x05, 0x9F, 0x25, 0x9C, 0x7D, 0x7C, 0xD3, 0x68, 0xB1, 0x4B, 0x7F, 0x9E, 0x2C, 0xFC,
+	0x16, 0xFB, 0x91, 0x2F, 0xF9, 0x35, 0x7C, 0xFE, 0xC2, 0x53, 0xE8, 0x17, 0x3C, 0x64, 0xFE, 0x32,
+	0x03, 0x4E, 0xA4, 0xD1, 0x74, 0x3C, 0xF1, 0x83, 0xCF, 0xB3, 0x34, 0x59, 0x2F, 0xC3, 0x63, 0x16,
+	0x47, 0x4B, 0xEE, 0xA7, 0xED, 0x59, 0xEA, 0x87, 0x11, 0xF0, 0xC3, 0x72, 0x3B, 0xBD, 0x90, 0xCF,
+	0x5A, 0xEC, 0xDB, 0x7E, 0x7F, 0xC0, 0xB9, 0xCF, 0x9C, 0xEF, 0xE0, 0x79, 0xD0, 0xEF, 0x4E, 0x7C,
+	0x8F, 0xB9, 0x8E, 0xF3, 0x5D, 0x73, 0x1C, 0x24, 0x71, 0x82, 0x5C, 0xEA, 0x74, 0x3A, 0x63, 0x6C,
+	0xDD, 0x9E, 0x73, 0xC1, 0x13, 0xD7, 0xEE, 0x8F, 0x17, 0xD1, 0xB2, 0xF8, 0xEE, 0x38, 0xD7, 0xF3,
+	0xA2, 0x4B, 0x9E, 0xB3, 0x02, 0xF2, 0x6D, 0x14, 0x04, 0x1F, 0x9A, 0xA5, 0xD8, 0xEF, 0x5B, 0x21,
+	0x01, 0x54, 0x17, 0x5F, 0x6B, 0x4E, 0x30, 0x7F, 0x9D, 0x27, 0xE3, 0x07, 0x14, 0x34, 0xAC, 0x69,
+	0x52, 0x7C, 0xED, 0xA7, 0x96, 0x66, 0x73, 0x73, 0x2C, 0x79, 0x83, 0xF4, 0xAF, 0x33, 0x00, 0xD4,
+	0x03, 0x30, 0x05, 0x4E, 0xF8, 0xC6, 0x3A, 0x05, 0x64, 0x60, 0x61, 0x9E, 0x27, 0x0B, 0xF1, 0x42,
+	0xB0, 0x58, 0x8E, 0x8D, 0x03, 0x24, 0xC8, 0xBA, 0x12, 0x83, 0x78, 0xA3, 0x11, 0xC4, 0x7C, 0x0A,
+	0x7D, 0x42, 0x78, 0x59, 0x12, 0x47, 0xA1, 0xAA, 0xA4, 0x44, 0x0B, 0x46, 0x72, 0xEE, 0xB2, 0x7B,
+	0xC9, 0x1C, 0xF1, 0x52, 0x8A, 0x62, 0x73, 0x4C, 0xA3, 0x05, 0x83, 0xC9, 0x01, 0xF1, 0x70, 0x93,
+	0x18, 0x2C, 0x0A, 0xA3, 0x6C, 0x15, 0xFB, 0x30, 0x98, 0xD3, 0x98, 0xDF, 0x8E, 0x7D, 0x10, 0xB3,
+	0x65, 0x3B, 0xCA, 0xF9, 0x02, 0xBA, 0x84, 0x72, 0xCA, 0xD3, 0xF1, 0xCC, 0x5F, 0x41, 0xF7, 0x3C,
+	0x64, 0x22, 0x60, 0xB2, 0xA3, 0xA0, 0x82, 0xCD, 0x24, 0xC5, 0xCE, 0xD6, 0x13, 0xD2, 0x0F, 0x5D,
+	0x07, 0xC6, 0xB3, 0x6F, 0xD2, 0xE1, 0xF6, 0x37, 0xE9, 0x20, 0xDE, 0x3D, 0xD8, 0x82, 0xE9, 0xED,
+	0x34, 0xB9, 0x61, 0xF7, 0x65, 0xB2, 0xF0, 0x4F, 0xFB, 0x26, 0x45, 0x42, 0xF0, 0x6F, 0x2D, 0x99,
+	0xBF, 0xAF, 0xB3, 0x3C, 0x9A, 0xDE, 0xB5, 0xA5, 0xC2, 0x1F, 0xB3, 0x6C, 0xE5, 0x83, 0xA6, 0x4F,
+	0x78, 0x7E, 0xC3, 0xF9, 0xD2, 0xEC, 0x85, 0x42, 0xE4, 0x07, 0x79, 0x94, 0x2C, 0xB3, 0x2A, 0x32,
+	0xAA, 0x89, 0xAC, 0xA9, 0xC3, 0x52, 0xA5, 0xE4, 0xC1, 0x8E, 0x96, 0xD3, 0x04, 0x35, 0xA4, 0x2C,
+	0x2C, 0xDF, 0x4E, 0x87, 0xD3, 0xD1, 0xD4, 0xDF, 0x90, 0x12, 0xC7, 0x94, 0x12, 0xEA, 0xB7, 0xE4,
+	0x45, 0x9E, 0xAC, 0x64, 0x41, 0x69, 0xDC, 0xBB, 0x95, 0x71, 0x97, 0x96, 0x01, 0x59, 0x9D, 0x43,
+	0x43, 0x9E, 0xB7, 0x11, 0xBF, 0xD4, 0x4B, 0xC9, 0x61, 0x68, 0xA3, 0x95, 0xA5, 0xDB, 0xED, 0x96,
+	0x30, 0x0C, 0x89, 0x01, 0x66, 0x53, 0x60, 0xD3, 0x52, 0xB6, 0xBF, 0x91, 0x0A, 0xD4, 0x77, 0x9C,
+	0xF1, 0xF6, 0x21, 0x46, 0x0D, 0xF8, 0xD7, 0x34, 0xE3, 0x11, 0x4A, 0x01, 0x74, 0x0A, 0x25, 0x2A,
+	0xEB, 0x44, 0x9E, 0x82, 0x35, 0x89, 0x70, 0xD8, 0x8E, 0x19, 0x3D, 0x4F, 0x93, 0x74, 0x01, 0x16,
+	0xAD, 0x93, 0x31, 0xEE, 0x67, 0xBC, 0xC5, 0x0A, 0x28, 0x45, 0xA9, 0xA4, 0xF9, 0x78, 0x9E, 0x5C,
+	0xA3, 0x4E, 0xEB, 0x76, 0x12, 0x44, 0xEC, 0xE7, 0xFC, 0xBF, 0xAD, 0x36, 0x20, 0x6B, 0x56, 0x35,
+	0x93, 0xB4, 0x18, 0xFF, 0x54, 0x2D, 0xA8, 0xAB, 0x18, 0xD1, 0x2E, 0x4B, 0xFB, 0x0E, 0xFD, 0xAB,
+	0x33, 0x06, 0xCE, 0x17, 0x28, 0xA0, 0xB4, 0x62, 0x05, 0xCE, 0x3D, 0x9A, 0xB8, 0x5E, 0xC5, 0x89,
+	0x1F, 0xB6, 0xFD, 0x14, 0x8C, 0xE9, 0xBD, 0x18, 0x92, 0x63, 0xD6, 0x81, 0xBE, 0x84, 0x7E, 0x36,
+	0xE7, 0x21, 0xFB, 0x36, 0x0C, 0xC3, 0xDD, 0xE2, 0xD9, 0x45, 0x9B, 0x44, 0x34, 0xE6, 0xFC, 0x36,
+	0x6F, 0x13, 0x69, 0x9A, 0xA8, 0xBA, 0xAE, 0x98, 0xA3, 0xE3, 0xC7, 0x31, 0x8D, 0xC0, 0xB8, 0xAC,
+	0x15, 0x3E, 0xFE, 0x2B, 0x53, 0x27, 0xC6, 0xA5, 0xC5, 0xCC, 0x32, 0x3B, 0x4C, 0xFD, 0x99, 0x18,
+	0x2E, 0x49, 0xE2, 0xB6, 0x8E, 0x96, 0xC1, 0x3B, 0xA0, 0x76, 0xD3, 0x02, 0x7C, 0x04, 0xD5, 0x4A,
+	0xBA, 0xD1, 0x1D, 0x16, 0xBA, 0xB1, 0x01, 0xAA, 0xDE, 0x2A, 0x4D, 0xA3, 0x98, 0x83, 0xA6, 0xAC,
+	0xD6, 0x39, 0xE9, 0xFD, 0x0A, 0x69, 0x5A, 0x25, 0xAA, 0x9B, 0x29, 0x07, 0xF1, 0x89, 0xAE, 0x79,
+	0x31, 0x8C, 0xD1, 0x92, 0x26, 0xA7, 0x49, 0x9C, 0x04, 0x9F, 0x37, 0x95, 0xBB, 0x16, 0x1E, 0x7D,
+	0xBB, 0xCA, 0xEF, 0x56, 0xE0, 0xB9, 0xE0, 0xEB, 0xC3, 0x4F, 0x26, 0x0A, 0x7F, 0x02, 0x06, 0x60,
+	0x9D, 0xF3, 0xB1, 0xB0, 0x08, 0xCE, 0x98, 0xA0, 0x39, 0xE3, 0x04, 0xEC, 0x5B, 0x94, 0xDF, 0xE1,
+	0x63, 0x31, 0x99, 0x7D, 0x37, 0x36, 0x66, 0xC1, 0xEF, 0xC6, 0xC1, 0x3A, 0xCD, 0xB0, 0xAF, 0xAB,
+	0x24, 0xA2, 0x51, 0x93, 0xE8, 0x27, 0xF9, 0xB2, 0x4E, 0x83, 0x0D, 0x5E, 0x48, 0x1E, 0xDD, 0xCC,
+	0x41, 0x14, 0xC7, 0x4A, 0x7A, 0x96, 0xC9, 0x92, 0x1B, 0xD6, 0xCB, 0x93, 0x3A, 0x5A, 0x95, 0x22,
+	0xE4, 0xF1, 0xA6, 0x3D, 0xA9, 0x50, 0x52, 0xE5, 0xD7, 0x6E, 0xE9, 0x1F, 0x6E, 0x93, 0xAE, 0xA2,
+	0x43, 0x4A, 0xBD, 0x4B, 0x02, 0xE1, 0x8D, 0x86, 0xCE, 0x64, 0x34, 0x36, 0x54, 0x9E, 0x5C, 0x3D,
+	0x0B, 0x5C, 0xBD, 0x1E, 0x2A, 0x09, 0x31, 0xA2, 0xE8, 0x11, 0x0A, 0xBC, 0x3B, 0xD4, 0x3D, 0x92,
+	0x3D, 0xAE, 0x53, 0x92, 0xBD, 0xFD, 0xAB, 0xA5, 0xF6, 0xD1, 0x9D, 0xDE, 0x98, 0xCC, 0xAA, 0xCC,
+	0xA8, 0xDA, 0x7B, 0xEA, 0x8A, 0x32, 0x3C, 0x5F, 0x32, 0xB6, 0xA5, 0x86, 0x8F, 0xE4, 0xA1, 0x69,
+	0x36, 0xBD, 0x4D, 0xB3, 0x89, 0x73, 0x16, 0x09, 0x07, 0x59, 0xCD, 0x9E, 0xD7, 0x02, 0xD1, 0x87,
+	0x3F, 0x9E, 0x3B, 0x42, 0xD3, 0xD9, 0x91, 0x7C, 0x97, 0x6E, 0x6F, 0x1D, 0xAD, 0xE2, 0x4D, 0x2D,
+	0xA1, 0xD2, 0x57, 0xAE, 0xA3, 0x33, 0x70, 0x3A, 0x23, 0x6F, 0xF2, 0xD5, 0x74, 0x7A, 0x1D, 0xB7,
+	0xC5, 0x06, 0xFD, 0x16, 0x8C, 0x66, 0x89, 0xCC, 0x6C, 0x0D, 0x0E, 0x7B, 0x96, 0xD5, 0xD1, 0x29,
+	0x5C, 0xF9, 0x5A, 0x3A, 0x65, 0xAB, 0x7A, 0x86, 0x0E, 0x7C, 0xDE, 0x77, 0xBE, 0x9A, 0xD0, 0x2E,
+	0xD0, 0xE8, 0x39, 0x5D, 0xE0, 0xAA, 0xDB, 0x29, 0x51, 0x2A, 0x7D, 0x83, 0x3A, 0x4A, 0xB5, 0xDB,
+	0x50, 0x43, 0xAA, 0x0A, 0x36, 0xEA, 0x48, 0xE5, 0xE0, 0x8C, 0x7B, 0xDE, 0xD7, 0xF3, 0xB4, 0xDB,
+	0xC1, 0xC1, 0x07, 0x82, 0xDD, 0x61, 0x89, 0x54, 0xE1, 0xB4, 0x94, 0x50, 0x8D, 0x26, 0xBD, 0xD1,
+	0xA4, 0x5F, 0x47, 0x20, 0x56, 0xAE, 0xA5, 0x6E, 0xC8, 0xBB, 0x5D, 0x3F, 0xFC, 0x6A, 0xEA, 0xDC,
+	0x5E, 0xAF, 0xC5, 0x86, 0x23, 0x24, 0xCE, 0x33, 0xA9, 0x3B, 0x06, 0x35, 0xF5, 0x27, 0x31, 0xCC,
+	0x91, 0xF7, 0x85, 0x8D, 0x85, 0x18, 0x43, 0xA9, 0xF8, 0x32, 0xC1, 0xC9, 0x30, 0x4E, 0x6E, 0x78,
+	0x09, 0x37, 0xDA, 0x0A, 0xF6, 0x4D, 0xB4, 0xC0, 0xB8, 0xD3, 0x5F, 0xE6, 0x25, 0xD4, 0xD5, 0x77,
+	0x80, 0x67, 0x0D, 0xB3, 0xCC, 0x12, 0xE2, 0x1F, 0x70, 0xED, 0x0A, 0x07, 0x14, 0xBF, 0x8E, 0xF1,
+	0x4F, 0x1B, 0xCC, 0xC1, 0x0A, 0x3B, 0x82, 0x13, 0xDF, 0x7A, 0xB1, 0xCC, 0x70, 0xAA, 0x59, 0x71,
+	0x3F, 0xB7, 0x30, 0x40, 0x69, 0x83, 0xD1, 0x8B, 0x5B, 0x0C, 0x82, 0x1E, 0x08, 0x65, 0x2C, 0x0F,
+	0x27, 0x5F, 0xE8, 0xC5, 0x34, 0x6D, 0x36, 0xA5, 0xB3, 0xB0, 0xE1, 0x58, 0x0A, 0xEF, 0x21, 0x4E,
+	0x66, 0x6D, 0x23, 0x0E, 0x2A, 0x31, 0xD3, 0xF5, 0xF1, 0xDF, 0x6E, 0x8F, 0xC0, 0x74, 0x62, 0x0A,
+	0xB8, 0x38, 0x32, 0xD3, 0x18, 0xBB, 0x39, 0x8F, 0xC2, 0x10, 0x7C, 0xED, 0x87, 0x6F, 0x01, 0x51,
+	0x3D, 0x78, 0xE5, 0x97, 0x3A, 0xCE, 0x74, 0x0A, 0x56, 0xB3, 0x1C, 0x4E, 0x42, 0xA0, 0x0D, 0x53,
+	0x9D, 0x9F, 0x41, 0x38, 0xD9, 0x38, 0x4F, 0x96, 0x7E, 0x90, 0xC0, 0xD3, 0x22, 0x59, 0x26, 0xE4,
+	0xCA, 0x97, 0x62, 0x3C, 0x4F, 0x86, 0x6D, 0xB7, 0xBA, 0xA4, 0xEB, 0x98, 0xB4, 0xB4, 0x01, 0x1E,
+	0x85, 0x72, 0x65, 0x67, 0xBB, 0x66, 0xA6, 0x22, 0x49, 0x6B, 0x13, 0x06, 0xB0, 0xDE, 0x29, 0xA7,
+	0x59, 0x79, 0x7C, 0x93, 0xA0, 0x33, 0x0B, 0x9E, 0x08, 0xC4, 0xD8, 0xF4, 0x81, 0x23, 0xBE, 0x61,
+	0x75, 0xD5, 0x34, 0xE1, 0x6A, 0x2F, 0x9D, 0xA2, 0x53, 0xC1, 0x68, 0x15, 0x43, 0x96, 0x1D, 0xBC,
+	0x3D, 0x61, 0x4A, 0xDD, 0x64, 0x50, 0xEF, 0x97, 0xA8, 0xB1, 0x4C, 0x93, 0x38, 0x63, 0x42, 0x9A,
+	0x2A, 0x2C, 0x47, 0xDF, 0xFF, 0x11, 0xF3, 0x78, 0x5F, 0x2A, 0x45, 0x95, 0x39, 0xBD, 0xCA, 0x34,
+	0xD3, 0x41, 0xD7, 0xA9, 0x32, 0xCB, 0x49, 0xD2, 0x84, 0x67, 0x32, 0xD4, 0x74, 0x01, 0xDD, 0x38,
+	0x0B, 0x69, 0x14, 0xE8, 0x42, 0x3B, 0x63, 0x9D, 0x4D, 0x90, 0xFD, 0x28, 0x98, 0xE6, 0xF9, 0xF8,
+	0x4F, 0x36, 0xCE, 0xA3, 0x85, 0x11, 0x3E, 0x0E, 0x87, 0x43, 0xD5, 0xD9, 0x45, 0x58, 0x14, 0xCB,
+	0x74, 0x4A, 0x69, 0x1A, 0x9E, 0x24, 0x71, 0x28, 0xEB, 0xA6, 0x3C, 0x5B, 0x81, 0x30, 0x19, 0x70,
+	0x64, 0xB6, 0x45, 0xD2, 0x97, 0xA6, 0x49, 0x5A, 0xBC, 0x93, 0x79, 0x17, 0x88, 0x5E, 0x73, 0x3F,
+	0x5F, 0x67, 0x60, 0x70, 0xC2, 0x28, 0xF0, 0xF3, 0xC4, 0x1C, 0xBC, 0x47, 0xBB, 0x29, 0x7B, 0xF9,
+	0x4A, 0x4A, 0x54, 0x75, 0x5B, 0xE1, 0xDF, 0x06, 0xB3, 0x35, 0x3D, 0x21, 0x66, 0x98, 0xB4, 0x8F,
+	0x07, 0x6F, 0x0A, 0x1F, 0xAF, 0x66, 0xD8, 0xC0, 0xED, 0x2B, 0x1B, 0xD6, 0x9E, 0xDF, 0xF3, 0xFB,
+	0x25, 0x68, 0x36, 0x86, 0xBE, 0xD7, 0x7C, 0xD7, 0x9C, 0xE6, 0x2F, 0xC1, 0x23, 0x10, 0xEE, 0xCB,
+	0x6A, 0x1D, 0x03, 0x27, 0x5D, 0xBB, 0x97, 0x01, 0x17, 0xA6, 0x98, 0x33, 0x03, 0xCB, 0xFC, 0x5F,
+	0x9F, 0xF9, 0xDD, 0x34, 0xF5, 0x17, 0x3C, 0x93, 0xEF, 0xEF, 0x9D, 0xEF, 0xD8, 0x3D, 0xD3, 0x06,
+	0xD3, 0x1D, 0xB3, 0x87, 0x5E, 0xB9, 0xC8, 0xB1, 0x7B, 0x50, 0x88, 0x7E, 0x69, 0xB5, 0xE2, 0x83,
+	0xBD, 0x4A, 0x93, 0x19, 0x0C, 0x5A, 0xD6, 0x2E, 0xA5, 0x69, 0x2A, 0xCE, 0xB3, 0x1E, 0x0C, 0x12,
+	0x60, 0xA3, 0xD1, 0xC4, 0x87, 0xEA, 0x65, 0xA6, 0x94, 0x66, 0x31, 0xCE, 0xEB, 0x84, 0x7B, 0xC3,
+	0x6E, 0xD5, 0x58, 0x4C, 0x8D, 0x02, 0x2D, 0xAE, 0x89, 0xA3, 0xC2, 0xE5, 0x6A, 0x3A, 0x6B, 0xE4,
+	0x50, 0x36, 0xAB, 0xEA, 0x7B, 0xB5, 0xCA, 0x5C, 0x6E, 0x2A, 0xCF, 0x1D, 0xA0, 0x99, 0x0E, 0x23,
+	0x95, 0x2A, 0x07, 0x37, 0xE7, 0x31, 0x5F, 0x70, 0x50, 0xA8, 0xAF, 0x9F, 0x2C, 0xF2, 0x62, 0xAE,
+	0x18, 0xD6, 0xCE, 0x15, 0x1B, 0x58, 0xA6, 0xD1, 0x6C, 0x9D, 0xF2, 0xAF, 0xC9, 0x69, 0x38, 0x5B,
+	0xC0, 0x05, 0xFE, 0x0A, 0x3B, 0x57, 0x4E, 0x55, 0x74, 0x6A, 0x5D, 0x69, 0xA9, 0x96, 0xBD, 0x5E,
+	0xAF, 0x6A, 0xFB, 0xFA, 0x75, 0xC0, 0x03, 0x7F, 0x79, 0xED, 0x67, 0x86, 0x86, 0x98, 0x51, 0x50,
+	0xBF, 0x14, 0x63, 0x8B, 0xA8, 0xCC, 0x84, 0x90, 0xAD, 0x17, 0xC2, 0x65, 0x7E, 0x44, 0x06, 0xA5,
+	0x62, 0x81, 0x37, 0x81, 0x7C, 0x61, 0x2E, 0x45, 0x82, 0x4D, 0x25, 0xA9, 0x22, 0x39, 0x15, 0xF3,
+	0x19, 0x5F, 0x86, 0x45, 0xAC, 0x59, 0x12, 0xCA, 0x61, 0x9D, 0x4D, 0x36, 0x12, 0x6D, 0xBA, 0xF9,
+	0xC4, 0x0F, 0x67, 0x7C, 0xD3, 0x7C, 0x89, 0xFE, 0x17, 0x11, 0x3E, 0x9A, 0xA8, 0x1A, 0x1B, 0x42,
+	0xA4, 0x94, 0xA9, 0xAB, 0x62, 0xF6, 0x76, 0x05, 0x41, 0x21, 0x9F, 0xFA, 0xEB, 0x38, 0x2F, 0xC8,
+	0x99, 0xAE, 0x41, 0x7B, 0xF0, 0xBF, 0x7B, 0x66, 0x4A, 0x54, 0xAD, 0x3F, 0xEB, 0x7A, 0xCD, 0x31,
+	0xD3, 0x66, 0x5B, 0xF8, 0xCA, 0x4C, 0x43, 0x0A, 0x79, 0x96, 0xA7, 0x5B, 0x20, 0x55, 0xDD, 0xCD,
+	0x12, 0x24, 0xE9, 0xCA, 0x16, 0x90, 0x50, 0xB5, 0xB7, 0xD1, 0x54, 0x0D, 0x5A, 0xCA, 0x34, 0x89,
+	0x80, 0xA8, 0x80, 0x44, 0xDE, 0xEC, 0x16, 0x48, 0x55, 0x27, 0xB3, 0x04, 0x49, 0x3A, 0xB0, 0x00,
+	0x69, 0x9A, 0x24, 0x39, 0x25, 0xA7, 0xB6, 0x66, 0x5A, 0x48, 0x00, 0x28, 0xA5, 0x2C, 0x5B, 0x8B,
+	0x2E, 0x23, 0xF8, 0xE2, 0x8F, 0x63, 0x0F, 0x9A, 0x9B, 0xB1, 0xE1, 0x7F, 0x2D, 0x78, 0x18, 0xF9,
+	0xCC, 0x32, 0xF2, 0xDE, 0x83, 0x3E, 0x0C, 0x68, 0x93, 0xDD, 0xCB, 0x6C, 0x5E, 0x25, 0x59, 0x8E,
+	0x19, 0x65, 0x33, 0x77, 0xD5, 0xDD, 0xC8, 0xCF, 0x52, 0x1E, 0x34, 0x8C, 0x52, 0x1E, 0x08, 0x8B,
+	0x25, 0x0C, 0x4F, 0x79, 0x66, 0xA4, 0x3A, 0x30, 0xE9, 0xA4, 0x79, 0x29, 0x85, 0x55, 0xCD, 0xBE,
+	0x9A, 0x6A, 0xBB, 0xE1, 0x1D, 0x19, 0x30, 0x60, 0x96, 0xC0, 0x8C, 0x97, 0xAA, 0xCE, 0x17, 0x85,
+	0x92, 0xC3, 0x33, 0xD8, 0xF2, 0x1C, 0x26, 0xED, 0x58, 0x31, 0xAF, 0x8D, 0xAC, 0xEE, 0xC1, 0x0B,
+	0x34, 0xDC, 0x72, 0xC6, 0x00, 0xC9, 0x49, 0x3E, 0x43, 0x7F, 0x40, 0x4C, 0x53, 0x80, 0x7E, 0x86,
+	0x7C, 0x94, 0x85, 0x8A, 0x2F, 0x9E, 0xFA, 0x8E, 0xEA, 0x12, 0x20, 0xD5, 0x34, 0x98, 0x66, 0xE9,
+	0xEF, 0x09, 0xAE, 0x14, 0x88, 0x62, 0x98, 0x54, 0x57, 0x11, 0xA8, 0xBC, 0x31, 0x5B, 0x52, 0x81,
+	0x9B, 0xC9, 0x19, 0xA1, 0x7E, 0xC6, 0x14, 0x8D, 0x72, 0x08, 0x81, 0x98, 0x11, 0x40, 0xA4, 0x09,
+	0x4C, 0xD0, 0xDC, 0xEA, 0xF4, 0x71, 0xEE, 0x68, 0xE2, 0xB4, 0xF8, 0xF4, 0x48, 0x2C, 0x32, 0x1D,
+	0x3C, 0x3D, 0x92, 0x4B, 0x5F, 0xB8, 0x0A, 0x83, 0x6B, 0x4F, 0xD7, 0x33, 0x46, 0xAF, 0x4E, 0x0E,
+	0x95, 0x8A, 0x63, 0x0F, 0x0F, 0x4F, 0x9F, 0x66, 0x77, 0x0B, 0xF0, 0x83, 0x58, 0x14, 0x9E, 0x1C,
+	0x46, 0x6D, 0x1F, 0xFC, 0x9C, 0x1B, 0x98, 0xF0, 0x6F, 0x96, 0x87, 0x0C, 0x97, 0xC4, 0x9E, 0x27,
+	0xB7, 0x27, 0x87, 0x0E, 0x04, 0x42, 0x5E, 0x17, 0xFE, 0x07, 0xB5, 0x57, 0x3E, 0xCC, 0x33, 0x50,
+	0xF5, 0xDC, 0xF5, 0x58, 0xEF, 0xDA, 0xED, 0x9E, 0xBB, 0x23, 0x50, 0xED, 0xB8, 0x3D, 0x60, 0x83,
+	0x36, 0xFC, 0x3B, 0x3C, 0x3A, 0x05, 0x12, 0x08, 0x62, 0x05, 0x32, 0xAE, 0xBE, 0xE5, 0xFB, 0x80,
+	0x76, 0x58, 0xE7, 0xDA, 0x1D, 0xCE, 0xDD, 0xE1, 0xF9, 0x00, 0xB4, 0x29, 0xEE, 0xB6, 0xBB, 0x0C,
+	0x8A, 0x58, 0x7F, 0x37, 0x60, 0x1E, 0x7C, 0x6E, 0x07, 0x51, 0x1A, 0xC4, 0x7C, 0x0B, 0x7C, 0xF1,
+	0x92, 0x05, 0x50, 0xEC, 0x7A, 0x87, 0x2C, 0xB8, 0x13, 0x9F, 0x29, 0x7C, 0x38, 0x08, 0x58, 0xE3,
+	0x1F, 0x62, 0x5F, 0x10, 0x63, 0xAF, 0xDD, 0xDF, 0x81, 0x31, 0x4E, 0xD6, 0x61, 0x5B, 0x64, 0x0C,
+	0xF7, 0xB2, 0xA9, 0x0F, 0x33, 0x4A, 0xDC, 0xEE, 0xE2, 0x3F, 0xD6, 0x45, 0xAE, 0xB9, 0xDE, 0xF5,
+	0xE8, 0xDC, 0x73, 0xEC, 0x2E, 0x28, 0xB8, 0xDD, 0x7D, 0xD6, 0x63, 0x3D, 0xE6, 0xD0, 0x3F, 0x77,
+	0xC8, 0x46, 0xF3, 0xB6, 0x6B, 0x77, 0x9E, 0x0D, 0xD9, 0x10, 0xBF, 0xC3, 0xFF, 0x3B, 0xD0, 0xDA,
+	0xEE, 0xEC, 0x20, 0x25, 0x09, 0xF9, 0x63, 0x48, 0x18, 0xC6, 0xFD, 0x36, 0xFD, 0x83, 0x2E, 0x02,
+	0x39, 0x7D, 0x46, 0xFF, 0xB6, 0xC3, 0x45, 0x09, 0x78, 0x4C, 0xF7, 0x3C, 0x17, 0xC6, 0xE9, 0xBA,
+	0xEB, 0x7B, 0xCC, 0x13, 0x7D, 0x68, 0xC3, 0xD3, 0xEB, 0x9E, 0xF9, 0xBD, 0xED, 0x5D, 0xB7, 0xBB,
+	0x38, 0x9E, 0x4E, 0x8C, 0x7D, 0xED, 0xB5, 0x7B, 0xC4, 0x85, 0xDE, 0x2F, 0x3B, 0xBA, 0xC5, 0x53,
+	0x3F, 0xE3, 0xE9, 0x5E, 0xE4, 0x50, 0xE6, 0xBC, 0x1E, 0xC5, 0xD8, 0x2F, 0x00, 0xDF, 0x76, 0x1D,
+	0xE0, 0xDB, 0x10, 0x3B, 0x07, 0xBD, 0x1C, 0xC5, 0x20, 0x92, 0xDB, 0x31, 0x4C, 0xC1, 0xF5, 0x07,
+	0x9B, 0x92, 0xAC, 0xF8, 0x72, 0xBF, 0x50, 0x0E, 0x8A, 0xFE, 0x30, 0xE8, 0xCF, 0xBC, 0x1B, 0xC3,
+	0xF7, 0xF9, 0xD0, 0x2C, 0x65, 0xDE, 0xF5, 0x70, 0x37, 0x17, 0xFE, 0xB1, 0x9D, 0x18, 0x70, 0xC8,
+	0xD0, 0xAA, 0x6E, 0x21, 0x04, 0x4D, 0x26, 0x83, 0x32, 0x90, 0x58, 0x10, 0xDC, 0xDE, 0xA1, 0x70,
+	0xF6, 0xE0, 0xBB, 0x73, 0xC8, 0x84, 0x41, 0x03, 0x39, 0xEE, 0x82, 0x38, 0x53, 0x9D, 0xA3, 0x92,
+	0xB8, 0x0F, 0xA5, 0xB4, 0xBB, 0x24, 0xED, 0x5E, 0x49, 0xD8, 0x7B, 0x20, 0x5B, 0x3E, 0x0A, 0xBB,
+	0xE8, 0x42, 0x9F, 0x39, 0xE7, 0x2E, 0x08, 0xA5, 0x33, 0xEF, 0xD1, 0x67, 0x77, 0xDE, 0xDB, 0x41,
+	0x31, 0xAE, 0x61, 0xFD, 0x7B, 0x74, 0x0E, 0x85, 0xA1, 0x8F, 0x22, 0x02, 0x0F, 0xC3, 0xB9, 0xED,
+	0xB8, 0xDB, 0xB1, 0xC6, 0x51, 0xB6, 0xD7, 0x84, 0x80, 0x7C, 0xCF, 0xDD, 0x0E, 0x69, 0xB2, 0xFC,
+	0x1C, 0xE2, 0x27, 0x18, 0x11, 0x84, 0x0D, 0x9F, 0x50, 0x2E, 0x1F, 0x1E, 0x81, 0x0D, 0x26, 0x87,
+	0x7C, 0xCF, 0xB0, 0x74, 0x68, 0x58, 0x3A, 0x7A, 0x58, 0xDC, 0xA1, 0x31, 0x2C, 0x43, 0x63, 0x58,
+	0x34, 0x89, 0x03, 0xE8, 0xA7, 0xEB, 0xA0, 0x4A, 0x78, 0xF2, 0xB3, 0x3F, 0xDF, 0xA1, 0x8B, 0x8B,
+	0x28, 0x48, 0x93, 0x60, 0x1E, 0xAD, 0xF6, 0x10, 0xD2, 0x27, 0x42, 0xFA, 0x05, 0x21, 0x9E, 0x41,
+	0x88, 0x27, 0x08, 0x71, 0x4B, 0x84, 0x8C, 0x40, 0x6A, 0x81, 0xEF, 0x3D, 0xFA, 0x00, 0x3B, 0x3E,
+	0x14, 0xDF, 0xE8, 0xD3, 0x03, 0x63, 0x84, 0x7F, 0xDD, 0x1E, 0x7C, 0x90, 0x69, 0xA2, 0x0F, 0xFC,
+	0xBA, 0x9D, 0x54, 0x9C, 0x57, 0xFE, 0x5D, 0x62, 0x01, 0xCA, 0x1C, 0xF7, 0x59, 0x17, 0xD4, 0xB9,
+	0xFB, 0x8F, 0x5D, 0x18, 0xD7, 0xB3, 0x7D, 0x22, 0x81, 0xDD, 0xEC, 0x8B, 0x6E, 0xF6, 0xCF, 0xFB,
+	0xC8, 0x7C, 0xE8, 0xAF, 0x8F, 0x16, 0x50, 0x28, 0x27, 0x08, 0x9E, 0xF3, 0x0F, 0x92, 0x43, 0xE8,
+	0xF8, 0x76, 0x54, 0x29, 0x0F, 0x93, 0xBD, 0x26, 0xA9, 0xC3, 0xBA, 0xD7, 0xFD, 0x39, 0xD8, 0x59,
+	0xB0, 0xF0, 0xC0, 0xC9, 0x9E, 0x3F, 0x62, 0x23, 0x52, 0x2F, 0xB0, 0x01, 0xB6, 0xDB, 0x1E, 0xD9,
+	0xDD, 0xB7, 0x50, 0x47, 0xF4, 0xB5, 0x1E, 0x4D, 0x86, 0x0E, 0x51, 0xB2, 0xCE, 0x1F, 0xD1, 0x2B,
+	0xB7, 0x6A, 0x63, 0x7E, 0xE9, 0x55, 0x2D, 0x15, 0x59, 0xFF, 0x41, 0x0C, 0x56, 0x17, 0xFF, 0x91,
+	0xBD, 0xF6, 0x5E, 0x8F, 0x76, 0x60, 0x07, 0x47, 0x63, 0xB9, 0xDF, 0xF4, 0x02, 0xB3, 0x3C, 0xDF,
+	0xC5, 0xAD, 0x08, 0x72, 0xA2, 0xA2, 0xE7, 0xED, 0x60, 0xC1, 0x2D, 0x85, 0x78, 0xD2, 0x8F, 0xF7,
+	0xC1, 0xED, 0x22, 0xB1, 0x6A, 0xAA, 0xC2, 0x11, 0x19, 0xCD, 0x87, 0x3B, 0xA0, 0x46, 0xE0, 0x1B,
+	0xED, 0x25, 0x15, 0x2C, 0xC2, 0x5B, 0x9C, 0x02, 0x61, 0xE8, 0xFB, 0x31, 0x4D, 0xC0, 0x3B, 0x20,
+	0xC2, 0xC4, 0x33, 0xDF, 0x3F, 0x21, 0xF4, 0xD1, 0x45, 0x01, 0xB8, 0xBF, 0x74, 0xE7, 0xC3, 0x6B,
+	0x0F, 0x7D, 0x20, 0x98, 0x54, 0x81, 0xB5, 0xDD, 0xD7, 0xFD, 0xB7, 0x3D, 0x98, 0x7E, 0x90, 0x1B,
+	0x2E, 0xCA, 0x5C, 0x97, 0x3E, 0xB7, 0xE3, 0x5B, 0x63, 0x94, 0xF5, 0x79, 0xFF, 0x50, 0xBB, 0x83,
+	0xD7, 0x03, 0x5F, 0xB9, 0x0A, 0xC0, 0x6F, 0x98, 0xEB, 0xE6, 0x1E, 0x8A, 0xF4, 0x60, 0xEE, 0x99,
+	0xE5, 0x68, 0xBE, 0xDB, 0x1E, 0xB0, 0xB1, 0x1B, 0x93, 0xE7, 0xB1, 0x03, 0xF3, 0xEA, 0xDF, 0x3A,
+	0xBF, 0xBB, 0x60, 0xD4, 0x62, 0x21, 0x64, 0x8C, 0x26, 0x78, 0x70, 0xE4, 0x76, 0xF0, 0xF9, 0x3A,
+	0xDA, 0x2F, 0x0B, 0x20, 0xE0, 0x73, 0x62, 0xA5, 0x07, 0x7E, 0xA6, 0xC6, 0xE8, 0xB0, 0x2E, 0x73,
+	0x7E, 0xF1, 0x88, 0xC5, 0x4E, 0xC5, 0x16, 0x1D, 0x81, 0x97, 0x0B, 0xBE, 0x6E, 0x18, 0x5D, 0xB3,
+	0x20, 0xF6, 0xB3, 0xEC, 0xE4, 0x50, 0x27, 0x87, 0xD4, 0x66, 0x30, 0x9E, 0xE2, 0x83, 0x7B, 0x4A,
+	0x0E, 0xB1, 0xAC, 0x14, 0x05, 0x80, 0x76, 0x9D, 0x71, 0x36, 0x4F, 0xF9, 0xF4, 0xE4, 0xF0, 0x5B,
+	0xD3, 0xE4, 0x1E, 0x49, 0xA8, 0x6C, 0xFB, 0xF6, 0x2E, 0x80, 0x76, 0xF0, 0x74, 0xA5, 0x80, 0xA9,
+	0xFD, 0x2C, 0x87, 0xA7, 0x2F, 0x2F, 0xDE, 0x0F, 0xBD, 0x7E, 0x1F, 0x22, 0xEB, 0x8C, 0x87, 0xEC,
+	0x55, 0x94, 0x2E, 0x6E, 0xFC, 0x94, 0xB3, 0x8F, 0xAB, 0x10, 0x9C, 0x76, 0x76, 0x71, 0x97, 0x41,
+	0xD0, 0xC3, 0xD6, 0x19, 0x2E, 0xC0, 0x08, 0xE0, 0x1F, 0xDE, 0x9D, 0xB3, 0xE7, 0x10, 0xD6, 0xE1,
+	0xC0, 0xF0, 0xF4, 0xE9, 0xD1, 0xAA, 0xDC, 0x97, 0x22, 0x9A, 0x3A, 0x14, 0x2F, 0xCA, 0xAF, 0x8D,
+	0x2D, 0x1A, 0x87, 0xB4, 0xD9, 0x2C, 0x4D, 0x96, 0xB3, 0xD3, 0x4B, 0x2A, 0x3D, 0xC6, 0xB8, 0x80,
+	0xBE, 0xB3, 0xA7, 0x94, 0x72, 0xC0, 0x51, 0x10, 0x0D, 0xDE, 0x50, 0xFD, 0x9F, 0x93, 0x1C, 0x37,
+	0xBE, 0x41, 0x04, 0x93, 0xF3, 0x10, 0x2A, 0x43, 0x1D, 0x8C, 0x21, 0x36, 0x90, 0x54, 0xF3, 0x9D,
+	0x87, 0x2A, 0xA8, 0xD8, 0xC8, 0x84, 0x1D, 0xD6, 0x36, 0xC4, 0xC4, 0xA4, 0x48, 0x25, 0x02, 0xCB,
+	0x25, 0x78, 0x42, 0x26, 0x99, 0xC5, 0xDE, 0x51, 0xDA, 0xA1, 0x4A, 0xC1, 0x26, 0x21, 0xE5, 0x98,
+	0x10, 0x91, 0xC9, 0x8C, 0x36, 0xF6, 0x4C, 0xF6, 0xE4, 0x79, 0x0E, 0xBE, 0x9D, 0xAC, 0x8F, 0xEB,
+	0xB6, 0xC6, 0xBA, 0xE5, 0xA1, 0x0C, 0x89, 0xB6, 0x4A, 0x00, 0xCD, 0x2B, 0x7A, 0xF0, 0xCF, 0x04,
+	0x40, 0x26, 0xB8, 0x09, 0xF4, 0x08, 0x64, 0x65, 0xAC, 0x71, 0x32, 0x03, 0xB3, 0x5D, 0x41, 0xAA,
+	0x19, 0x64, 0xC4, 0xF9, 0xDF, 0x0E, 0xA6, 0xC3, 0x60, 0x18, 0xCA, 0xB0, 0x1C, 0x77, 0xDF, 0x8D,
+	0xF7, 0xD2, 0xA3, 0x67, 0x05, 0x4D, 0xD3, 0x5B, 0x42, 0x67, 0xD2, 0xB2, 0x95, 0x59, 0x6A, 0xC7,
+	0x11, 0x62, 0x59, 0x9D, 0x2A, 0xD1, 0xF8, 0x35, 0x49, 0x3F, 0x53, 0x36, 0xB3, 0x10, 0x0E, 0xD5,
+	0x4F, 0x21, 0x1A, 0xEC, 0xFF, 0xFE, 0xEF, 0xFF, 0x03, 0xE2, 0x8A, 0xE2, 0xC8, 0x9E, 0x62, 0xA4,
+	0x71, 0xBA, 0x26, 0xD9, 0xB5, 0x27, 0xD1, 0xF2, 0xE9, 0x11, 0x15, 0x50, 0x95, 0x0F, 0x6B, 0xE0,
+	0xAD, 0x96, 0x5B, 0x90, 0xA3, 0xC5, 0xC2, 0x5F, 0x86, 0x99, 0x2D, 0x24, 0xB8, 0x40, 0x78, 0x26,
+	0xA2, 0x68, 0x86, 0x0B, 0xF0, 0xB5, 0x12, 0x29, 0xC3, 0xEC, 0x57, 0xB8, 0xA3, 0x01, 0x44, 0x52,
+	0xCB, 0x81, 0x00, 0xA4, 0xBA, 0xA7, 0xD5, 0xD8, 0xD4, 0x73, 0x72, 0x9F, 0x11, 0x86, 0xB0, 0x6B,
+	0x67, 0xF4, 0xBD, 0x26, 0xE0, 0x25, 0x4E, 0xCF, 0x3D, 0xB3, 0x5D, 0x5B, 0xEA, 0xEB, 0xEE, 0x01,
+	0x90, 0xF6, 0x52, 0xB3, 0xDF, 0xB5, 0x15, 0x6B, 0x94, 0x66, 0x03, 0x65, 0x1E, 0xF5, 0xF7, 0x82,
+	0xC7, 0xC8, 0x44, 0x9F, 0x01, 0x9F, 0x30, 0xC9, 0x67, 0x21, 0xC3, 0x9A, 0xD4, 0x6D, 0x06, 0x21,
+	0xBC, 0x80, 0x84, 0x4F, 0x4A, 0xE8, 0xF1, 0x4D, 0x26, 0xEC, 0x81, 0x95, 0xF9, 0xD7, 0x60, 0x2D,
+	0xFC, 0x8C, 0x1D, 0x15, 0xCC, 0x6E, 0x6E, 0xD8, 0x02, 0x63, 0xE7, 0x8B, 0xE8, 0x76, 0x98, 0x26,
+	0xAB, 0x67, 0xF8, 0xAD, 0xB6, 0x1E, 0x6E, 0x6B, 0xD9, 0x2B, 0x62, 0xA5, 0xB0, 0xF6, 0x48, 0x5B,
+	0x53, 0xC9, 0xF6, 0x62, 0x18, 0x5F, 0xA4, 0xFE, 0x8C, 0xFD, 0x99, 0x21, 0x46, 0x76, 0x97, 0xAC,
+	0x53, 0x20, 0x5F, 0x9A, 0x36, 0xEA, 0xE1, 0x9C, 0x23, 0x2B, 0x64, 0x5D, 0x25, 0x02, 0xC9, 0xA6,
+	0x39, 0xDB, 0xDC, 0xD6, 0x62, 0x68, 0xB1, 0x59, 0x07, 0xB5, 0x68, 0x1F, 0xED, 0x66, 0x38, 0xA7,
+	0x87, 0xE8, 0x39, 0x98, 0x4A, 0xA8, 0x84, 0xE2, 0x94, 0x99, 0x7A, 0x42, 0x5B, 0xC0, 0x0A, 0x59,
+	0x79, 0x05, 0x5F, 0x0F, 0xD9, 0x82, 0xE7, 0xF3, 0x04, 0xCA, 0xDE, 0xBF, 0xBB, 0xB8, 0x3C, 0x64,
+	0xC2, 0xAE, 0x9C, 0x1C, 0x1E, 0xA9, 0x69, 0x92, 0x2F, 0x03, 0xB1, 0xDD, 0x66, 0xB1, 0x8E, 0xF3,
+	0x68, 0xE5, 0xA7, 0xF9, 0x11, 0x82, 0x69, 0xC3, 0x10, 0x11, 0xCF, 0xA9, 0x23, 0xCC, 0xD8, 0x91,
+	0x23, 0xF7, 0x15, 0x2B, 0xDE, 0x88, 0x51, 0x9A, 0xDE, 0x90, 0x6C, 0x33, 0xCC, 0xE6, 0xAF, 0xC0,
+	0x2D, 0xC7, 0xC1, 0x05, 0xE7, 0x97, 0xFF, 0xB1, 0x8E, 0xC0, 0xBB, 0x44, 0x66, 0x23, 0x50, 0x83,
+	0xE9, 0x25, 0x46, 0xCC, 0xA3, 0x65, 0x7E, 0x78, 0x7A, 0xEE, 0xDF, 0x46, 0x8B, 0xF5, 0x42, 0x30,
+	0x1B, 0xD3, 0x6D, 0x2C, 0x8E, 0x16, 0x11, 0x98, 0x6D, 0x36, 0xB9, 0xD3, 0x12, 0xF5, 0xEA, 0x82,
+	0x59, 0x6F, 0xA3, 0x1C, 0xE4, 0xFA, 0xD5, 0x45, 0xD3, 0x2E, 0xE9, 0x8F, 0x31, 0x04, 0x9B, 0x6B,
+	0x28, 0x82, 0x4C, 0x55, 0x7E, 0x66, 0xCE, 0x9E, 0xD8, 0x5A, 0x48, 0x3C, 0xE5, 0xFD, 0x0A, 0xAD,
+	0x55, 0xB5, 0x2F, 0xF9, 0x2D, 0x90, 0xE7, 0x7C, 0xA7, 0x95, 0x76, 0x3B, 0xBE, 0x89, 0x9F, 0x1E,
+	0x6E, 0x79, 0x85, 0xD9, 0xB7, 0x32, 0x15, 0xAF, 0xB0, 0xE4, 0xB4, 0x62, 0xDD, 0x0C, 0xE0, 0xC5,
+	0x48, 0x5E, 0xD0, 0x24, 0x53, 0x3F, 0x27, 0x61, 0x06, 0x9E, 0x6D, 0xE4, 0x9F, 0x0B, 0xB8, 0x86,
+	0x21, 0x17, 0xC0, 0x76, 0xCD, 0x1E, 0xDB, 0x31, 0x98, 0xB9, 0xC9, 0xBD, 0x52, 0x5B, 0xB5, 0x29,
+	0x15, 0x83, 0x52, 0x63, 0xDB, 0x6B, 0x4D, 0x5E, 0xB0, 0xF8, 0xFF, 0x60, 0xEF, 0xB4, 0xC7, 0xAE,
+	0xA9, 0xF3, 0x6C, 0xC3, 0x3B, 0x81, 0xA9, 0x42, 0x58, 0x79, 0x6D, 0xF5, 0x94, 0x57, 0x94, 0xCF,
+	0xB9, 0xF4, 0x67, 0x26, 0xEB, 0x28, 0x46, 0x87, 0x84, 0x1C, 0x1B, 0x63, 0x82, 0x00, 0xE7, 0x4F,
+	0x09, 0xEA, 0x86, 0x55, 0x30, 0x76, 0x39, 0x6C, 0x9A, 0x03, 0x35, 0x0C, 0x72, 0xAF, 0xCC, 0x21,
+	0x43, 0xED, 0xC3, 0x65, 0xDE, 0x93, 0xC3, 0x8B, 0x47, 0xCC, 0xE8, 0x45, 0x6C, 0xAA, 0xFB, 0xF4,
+	0x0A, 0x97, 0x19, 0x84, 0x47, 0x56, 0x33, 0xAB, 0xEF, 0x47, 0xFB, 0xE2, 0xEB, 0xD0, 0xBE, 0xE0,
+	0x71, 0xEE, 0x3F, 0x1A, 0xAF, 0xDC, 0x6F, 0x63, 0xE2, 0x7D, 0xB9, 0x17, 0xAF, 0x4C, 0xA1, 0x69,
+	0x94, 0x2F, 0xF1, 0x3B, 0xBA, 0x57, 0x77, 0xFB, 0x11, 0x6A, 0x31, 0x2F, 0x10, 0x7E, 0xDC, 0x3F,
+	0x7D, 0x60, 0x2A, 0x52, 0xA3, 0x7B, 0x8F, 0xCA, 0xEB, 0x2F, 0xBE, 0x1E, 0xE1, 0x2F, 0xFB, 0x11,
+	0x9A, 0x89, 0x5F, 0x8D, 0xF8, 0x17, 0x3C, 0x38, 0x70, 0xC7, 0x5E, 0x41, 0xAB, 0xF9, 0x7E, 0xC4,
+	0xE4, 0x2D, 0x1B, 0x58, 0xDF, 0x7F, 0x25, 0xD6, 0xF7, 0xF0, 0x9A, 0x0E, 0x5C, 0xB0, 0x33, 0x7C,
+	0xFF, 0x55, 0x3D, 0xFE, 0xEB, 0xD7, 0xC9, 0x12, 0x7A, 0x5F, 0xA8, 0x63, 0xCF, 0xCE, 0xBF, 0xBC,
+	0xBB, 0x7F, 0xD9, 0x8B, 0x92, 0x92, 0x1E, 0x05, 0x2E, 0x9E, 0x81, 0x5B, 0x08, 0x9E, 0xCB, 0xB3,
+	0xD5, 0xEA, 0xCB, 0xB1, 0xFD, 0xB8, 0x17, 0x9B, 0x4A, 0x84, 0x1A, 0x08, 0xC1, 0x1E, 0x9E, 0x41,
+	0x20, 0xC6, 0xDE, 0xBC, 0xF8, 0x72, 0x84, 0x1F, 0xF6, 0x23, 0x34, 0xF2, 0x98, 0x85, 0xDF, 0x50,
+	0x98, 0x2A, 0x90, 0xA6, 0x0C, 0x1C, 0x81, 0x2F, 0x47, 0x7D, 0xB6, 0x17, 0x35, 0x25, 0x33, 0x35,
+	0xCE, 0x1F, 0x81, 0xAF, 0xCA, 0xA4, 0xEE, 0xC7, 0x26, 0x36, 0x35, 0x9A, 0xF8, 0x2E, 0xF7, 0xE2,
+	0xA3, 0x90, 0x5B, 0xE3, 0xBB, 0xE4, 0x59, 0x8E, 0x32, 0xC3, 0x7E, 0x4D, 0xA3, 0x7C, 0xCF, 0x4C,
+	0x53, 0x5E, 0x60, 0x36, 0x82, 0xCB, 0xB7, 0xF4, 0xA2, 0x70, 0xE5, 0x45, 0x2C, 0x57, 0x69, 0x26,
+	0x16, 0x96, 0x8D, 0x65, 0xDD, 0xC3, 0x53, 0xB2, 0xBA, 0x60, 0x21, 0xD0, 0x9A, 0xEA, 0x50, 0x6F,
+	0x5F, 0x53, 0x5A, 0xC7, 0x3D, 0x3C, 0x7D, 0x81, 0x1F, 0x6B, 0x0A, 0x21, 0x1F, 0xDD, 0x14, 0x3D,
+	0x89, 0xC3, 0x53, 0x69, 0x92, 0x60, 0x56, 0x9B, 0x3D, 0xBA, 0xA5, 0x88, 0xA6, 0x31, 0x46, 0x66,
+	0x47, 0xEC, 0x63, 0x1E, 0xC5, 0x51, 0x7E, 0xB7, 0x3F, 0x38, 0x2D, 0xA6, 0x66, 0xBD, 0xE2, 0xBF,
+	0x7B, 0x82, 0x36, 0x99, 0xAD, 0x37, 0x82, 0x7D, 0xED, 0xCC, 0x2D, 0x56, 0xDA, 0x8A, 0x38, 0xD1,
+	0x87, 0x91, 0xFE, 0x4B, 0x32, 0x81, 0x21, 0x97, 0xB4, 0xC8, 0x29, 0xBB, 0x82, 0x54, 0x6D, 0x0D,
+	0x33, 0xA6, 0xDD, 0x64, 0x19, 0xC4, 0x51, 0xF0, 0xF9, 0xE4, 0x10, 0x40, 0x83, 0x27, 0x36, 0xD7,
+	0x10, 0xAC, 0xE6, 0x3E, 0x22, 0xAA, 0x76, 0x83, 0xDA, 0x6F, 0xCA, 0xB5, 0xC6, 0x90, 0x27, 0xB3,
+	0x59, 0xCC, 0x2F, 0x53, 0x3F, 0xE0, 0x00, 0x5C, 0xF0, 0x0E, 0xBF, 0x5C, 0x52, 0xF9, 0x3E, 0x6C,
+	0x65, 0xD9, 0x7E, 0x85, 0x6B, 0xA6, 0x8C, 0x9A, 0xB3, 0x77, 0xAF, 0x5E, 0xED, 0xC0, 0x7A, 0x13,
+	0x2D, 0xC3, 0xE4, 0xC6, 0x8E, 0x93, 0x80, 0xD6, 0x62, 0x4F, 0x1A, 0x47, 0xD4, 0xAA, 0x61, 0x10,
+	0xF0, 0x42, 0xAF, 0x84, 0xA9, 0x4D, 0x9E, 0x7B, 0x68, 0xD1, 0x4B, 0x67, 0x45, 0xF6, 0xC0, 0x5F,
+	0xE5, 0x6B, 0x0C, 0x8A, 0xF6, 0x47, 0xEA, 0x1B, 0x3B, 0x44, 0x2A, 0x62, 0x74, 0x21, 0x4B, 0x21,
+	0x3A, 0x66, 0xBF, 0xC3, 0x98, 0xDE, 0xF1, 0x7C, 0x27, 0x14, 0xE5, 0x47, 0x89, 0xDD, 0x39, 0xA7,
+	0x4F, 0x8B, 0x6D, 0x35, 0xA7, 0x97, 0xF3, 0x34, 0x59, 0xCF, 0xE6, 0x18, 0xB6, 0x58, 0x3F, 0x3D,
+	0x3F, 0xCA, 0x9A, 0x18, 0x3F, 0xAC, 0xE6, 0xE0, 0x25, 0x40, 0x14, 0x52, 0x54, 0x7B, 0x2A, 0x37,
+	0xCB, 0x20, 0x19, 0x29, 0xB8, 0x2B, 0x67, 0x24, 0x5D, 0xD0, 0x35, 0x51, 0x7E, 0x4A, 0x95, 0x11,
+	0x76, 0x2D, 0x12, 0x70, 0xF3, 0x18, 0x0C, 0x3D, 0x46, 0x85, 0xFE, 0x0A, 0xF1, 0x34, 0xB7, 0x02,
+	0xC7, 0x1A, 0x5F, 0x06, 0xFC, 0x12, 0xF7, 0xFD, 0xE1, 0x96, 0x17, 0xA2, 0x9A, 0x59, 0x8B, 0x6C,
+	0x3B, 0x74, 0xAA, 0xF2, 0x65, 0xE0, 0x9F, 0x9D, 0xFD, 0xC4, 0x70, 0x8F, 0xD4, 0x32, 0x00, 0xBE,
+	0xF4, 0x1C, 0x30, 0x00, 0xAB, 0x91, 0xF8, 0x3B, 0xDA, 0x8D, 0xCB, 0x0F, 0x3E, 0xEF, 0xC0, 0xB4,
+	0xDB, 0x6A, 0xFC, 0xBB, 0x8D, 0x81, 0x5E, 0xC4, 0x32, 0x72, 0x59, 0x34, 0xCB, 0x60, 0xFE, 0xE8,
+	0xCB, 0x0D, 0x01, 0xCC, 0x93, 0x7E, 0x0A, 0x2D, 0xF7, 0x1B, 0x00, 0x91, 0x49, 0x2F, 0xB0, 0x62,
+	0xC3, 0xBD, 0xFA, 0xFF, 0x6C, 0x9D, 0x27, 0x17, 0x01, 0x20, 0x8F, 0x95, 0x11, 0xC8, 0xE8, 0xDB,
+	0xE3, 0xAC, 0x80, 0xB1, 0x79, 0x41, 0xE3, 0x45, 0x88, 0x6D, 0x01, 0x84, 0xBD, 0xFB, 0xF9, 0x31,
+	0x2A, 0x58, 0xDA, 0xF2, 0x7C, 0x68, 0xC4, 0x98, 0x31, 0x4E, 0x22, 0x35, 0xED, 0xB6, 0xC6, 0x82,
+	0xE5, 0x7D, 0xBC, 0xAC, 0xD8, 0xD2, 0xC2, 0xAA, 0x87, 0x02, 0x6B, 0x43, 0x9D, 0xC3, 0x82, 0x3B,
+	0xFC, 0x16, 0xF7, 0x81, 0x0B, 0xBE, 0xD7, 0x24, 0x14, 0x99, 0xCA, 0x28, 0xB2, 0xD2, 0xEE, 0xDD,
+	0xBD, 0x2E, 0xC1, 0xA6, 0xA9, 0x7A, 0x49, 0x88, 0x50, 0x36, 0x1E, 0x95, 0x58, 0x14, 0x9B, 0x90,
+	0x44, 0x5A, 0xD1, 0x48, 0x90, 0x53, 0x62, 0x9C, 0xFD, 0x53, 0x67, 0x23, 0x7E, 0xE5, 0x13, 0xF6,
+	0x06, 0xB7, 0x26, 0x4D, 0xD1, 0x24, 0xFF, 0xB3, 0x36, 0xD1, 0xBD, 0x3A, 0x7D, 0x26, 0x8E, 0x4D,
+	0x60, 0x74, 0xB8, 0x78, 0xF1, 0xF3, 0xC5, 0xB1, 0xCC, 0x39, 0xCE, 0xF3, 0x7C, 0x75, 0x7C, 0x74,
+	0x54, 0xE4, 0x1B, 0x16, 0xE1, 0x32, 0x7B, 0x9D, 0x80, 0xF3, 0x74, 0x9A, 0xE5, 0x8B, 0x8E, 0x37,
+	0x45, 0x4F, 0x1F, 0xA1, 0xD0, 0xAC, 0x4C, 0xB6, 0x3C, 0x3E, 0x92, 0xE9, 0x49, 0x05, 0xFA, 0xF9,
+	0x1D, 0x7B, 0xE1, 0x5F, 0x47, 0x21, 0xBB, 0xB0, 0xD9, 0x33, 0xE0, 0x3D, 0xC8, 0xBF, 0xC2, 0x5B,
+	0xEE, 0x1B, 0x48, 0x4A, 0xB4, 0xCA, 0x4F, 0x0F, 0x40, 0x00, 0x60, 0xD6, 0x84, 0x11, 0x7F, 0x01,
+	0x9D, 0x3D, 0x61, 0x61, 0x12, 0xAC, 0x17, 0x7C, 0x99, 0xDB, 0x33, 0x9E, 0xBF, 0x44, 0xDB, 0xBA,
+	0xCC, 0x9F, 0xDF, 0xBD, 0x09, 0xAD, 0x06, 0xD4, 0x68, 0x34, 0xC7, 0xB2, 0xBA, 0xCE, 0x1B, 0xEC,
+	0x6A, 0xA1, 0x2B, 0x55, 0xDB, 0x61, 0x1A, 0x6A, 0x7F, 0x43, 0xAC, 0x55, 0xB4, 0x14, 0xF9, 0xA4,
+	0x37, 0x94, 0x7B, 0xDA, 0xD1, 0x54, 0x54, 0xAB, 0x22, 0x14, 0xD9, 0x92, 0xFD, 0x28, 0x45, 0xBD,
+	0xA2, 0xB5, 0x4A, 0x35, 0xEE, 0x6A, 0xA9, 0xEA, 0x14, 0xAD, 0x36, 0x72, 0x4A, 0xBB, 0x9A, 0x6F,
+	0x54, 0xDE, 0x84, 0x83, 0x59, 0xA1, 0xC7, 0x80, 0xC0, 0x7A, 0x9B, 0xAD, 0x31, 0x57, 0xF5, 0x98,
+	0xD6, 0x58, 0xAF, 0x68, 0x6D, 0xE4, 0xA7, 0x2F, 0x50, 0x1A, 0x77, 0x00, 0x30, 0xAA, 0x1A, 0xED,
+	0xF5, 0xBA, 0xC4, 0xCE, 0xA6, 0xBA, 0x56, 0xD1, 0x52, 0xAF, 0x2D, 0xEC, 0x11, 0x46, 0x51, 0xA9,
+	0x68, 0x57, 0xAC, 0xF1, 0xEC, 0x23, 0xB8, 0xA8, 0x59, 0xB4, 0x56, 0x9A, 0xB6, 0xAF, 0xAD, 0xAA,
+	0x57, 0x95, 0x30, 0x74, 0x7A, 0xF7, 0xCB, 0x17, 0xD6, 0x32, 0x78, 0xB4, 0xD8, 0xDB, 0x4C, 0x56,
+	0x31, 0x7A, 0x69, 0x7A, 0xD9, 0x3B, 0x3B, 0x69, 0x56, 0xAC, 0x69, 0x2F, 0xDD, 0xAB, 0x47, 0x81,
+	0x90, 0x75, 0x11, 0xCA, 0xD1, 0xF7, 0x60, 0xDE, 0x42, 0x7E, 0xCB, 0x43, 0x16, 0x47, 0x9F, 0x39,
+	0xA5, 0xC0, 0xC8, 0xE1, 0xC0, 0x4D, 0x7D, 0x00, 0x3F, 0x99, 0xB2, 0x23, 0xDD, 0x6E, 0xCC, 0x32,
+	0x7F, 0xB1, 0x8A, 0xE1, 0x9D, 0x3C, 0xC2, 0xA1, 0xAA, 0xC2, 0xA4, 0x0E, 0xA8, 0xA3, 0x1C, 0x1A,
+	0xF1, 0xE5, 0x2C, 0x9F, 0xB3, 0xEF, 0x8F, 0x24, 0x7D, 0xEF, 0x5F, 0x3F, 0xBB, 0x78, 0xF9, 0xDB,
+	0xD9, 0xBB, 0xB7, 0xEF, 0x3E, 0x5C, 0x00, 0x6D, 0x57, 0x0D, 0x79, 0xF6, 0x09, 0x8F, 0xBD, 0xC8,
+	0x6D, 0xAA, 0xF4, 0x28, 0xCE, 0x38, 0xD0, 0xA3, 0xEB, 0x4F, 0x82, 0x51, 0x40, 0x8F, 0x53, 0x37,
+	0xE8, 0x3A, 0xD3, 0xC6, 0xA7, 0xF1, 0x41, 0x0C, 0x41, 0xA6, 0xAF, 0xA7, 0x58, 0x80, 0x04, 0x91,
+	0x14, 0x17, 0xC5, 0x51, 0x76, 0xA6, 0x96, 0xFF, 0xA0, 0x7C, 0xEA, 0xC7, 0x19, 0xA7, 0x7E, 0xFD,
+	0xCC, 0x6F, 0x30, 0x52, 0xCC, 0x78, 0x8A, 0xA7, 0xA9, 0xF8, 0x35, 0xAE, 0xDF, 0x64, 0x73, 0x98,
+	0x37, 0xC6, 0xD4, 0x4B, 0x3C, 0xB6, 0x13, 0x65, 0x2C, 0xE5, 0x94, 0xEB, 0x03, 0x57, 0x2F, 0x59,
+	0xB0, 0x23, 0xAA, 0x95, 0xC1, 0xEC, 0x85, 0x87, 0x5D, 0x31, 0xA1, 0x09, 0x1D, 0x41, 0x1C, 0x60,
+	0xA8, 0xF3, 0x97, 0xF8, 0xEE, 0x82, 0xFF, 0x01, 0x48, 0x1C, 0xC5, 0xFE, 0xB3, 0xF3, 0x17, 0xBF,
+	0xFD, 0xFC, 0xEC, 0xFC, 0x25, 0xF4, 0xED, 0xE0, 0xFE, 0xA0, 0x71, 0xD1, 0x38, 0x66, 0x0D, 0x23,
+	0x31, 0xD7, 0x68, 0x1D, 0x34, 0x5E, 0x60, 0x99, 0x99, 0x35, 0xC3, 0xC2, 0x97, 0x58, 0x58, 0xE4,
+	0xB5, 0xB0, 0xE8, 0x23, 0x16, 0x99, 0xB9, 0x27, 0x2C, 0xFC, 0x05, 0x0B, 0xCD, 0xBC, 0x10, 0x16,
+	0xFE, 0x15, 0x0B, 0x8B, 0xDC, 0x09, 0x16, 0xBD, 0x17, 0x8D, 0x4B, 0x99, 0x1C, 0x2C, 0xFF, 0x0B,
+	0x96, 0xFF, 0x65, 0xBD, 0x58, 0xC9, 0xCC, 0x47, 0x1C, 0x89, 0x70, 0x01, 0xDF, 0xFD, 0x48, 0x60,
+	0x8C, 0x2C, 0x05, 0x16, 0x7E, 0xD0, 0x85, 0x9B, 0xA9, 0x04, 0x7C, 0x7F, 0x86, 0xEF, 0x31, 0xE2,
+	0xBF, 0x58, 0xAF, 0x70, 0xBE, 0x05, 0x9E, 0xAB, 0xD8, 0x1F, 0x5F, 0x5F, 0xE2, 0xEB, 0x72, 0x80,
+	0x8E, 0xC5, 0xCF, 0xB1, 0xF8, 0xB9, 0x9F, 0x07, 0x44, 0xFF, 0x39, 0x7E, 0x3B, 0xF7, 0x97, 0xD1,
+	0x14, 0x2A, 0x36, 0x0E, 0x1E, 0xC6, 0x07, 0x7E, 0x18, 0xA2, 0x87, 0xD0, 0x90, 0x2B, 0xCB, 0xF2,
+	0xAA, 0x92, 0xE8, 0x1F, 0x3C, 0xB4, 0x29, 0x8F, 0x72, 0xC7, 0xA6, 0x49, 0xAA, 0x6C, 0x90, 0x8D,
+	0xA2, 0x21, 0xD6, 0x9C, 0x50, 0x82, 0xAF, 0x1A, 0x78, 0x7E, 0x9A, 0xB6, 0x0F, 0xE3, 0x0B, 0x75,
+	0x98, 0x5A, 0x3D, 0x83, 0xF3, 0x76, 0xCD, 0xC5, 0x97, 0x64, 0xD5, 0xF8, 0x64, 0x03, 0xA0, 0x97,
+	0x7E, 0x30, 0xB7, 0x68, 0xA4, 0x7F, 0xC6, 0x68, 0xEB, 0xE4, 0x94, 0xDD, 0x1F, 0x28, 0xAB, 0x6F,
+	0x03, 0x29, 0x34, 0xD0, 0x6F, 0x41, 0xFA, 0x39, 0x98, 0xEF, 0xA2, 0x62, 0x8B, 0xC9, 0xBA, 0xDC,
+	0x5E, 0xA5, 0x54, 0xFA, 0x42, 0x6C, 0xFD, 0xB6, 0x80, 0x0A, 0x6E, 0x67, 0xE0, 0x3E, 0xC1, 0xF0,
+	0xAD, 0xFC, 0x19, 0x71, 0x18, 0x0B, 0x1F, 0x5A, 0x42, 0x1C, 0xF1, 0x71, 0x07, 0xA5, 0xFF, 0x1A,
+	0x51, 0x56, 0x13, 0x2B, 0xEB, 0xAA, 0xE4, 0xDE, 0x60, 0x3D, 0x6C, 0x64, 0x15, 0x48, 0x9A, 0x75,
+	0xB4, 0xFC, 0x3B, 0x99, 0xB3, 0x95, 0x8E, 0x94, 0x2F, 0x80, 0x82, 0xED, 0xA4, 0x6C, 0x87, 0x2E,
+	0xC8, 0xD2, 0x7C, 0x97, 0x73, 0x38, 0xCE, 0x7E, 0xDC, 0xC6, 0xFC, 0xD1, 0x25, 0xED, 0x27, 0xE6,
+	0xA9, 0xF6, 0x29, 0x70, 0xB9, 0x0C, 0x2D, 0x60, 0x4E, 0x27, 0xA5, 0xB3, 0xF1, 0x41, 0x34, 0x65,
+	0x16, 0x3D, 0xDA, 0xC2, 0x30, 0x35, 0x01, 0x8C, 0xE1, 0x79, 0xD8, 0xAA, 0x85, 0xAC, 0x2E, 0xD6,
+	0x2D, 0xC5, 0xEB, 0x69, 0x22, 0x5A, 0x5E, 0x39, 0x9F, 0x80, 0x48, 0x34, 0x1C, 0x1F, 0x0D, 0x9F,
+	0xC2, 0x6A, 0xBC, 0xA2, 0x45, 0x2C, 0x5A, 0x2F, 0xE5, 0xE0, 0xC7, 0x36, 0xD8, 0x13, 0xA6, 0xEA,
+	0xDB, 0x4B, 0xE2, 0x48, 0x23, 0x92, 0x53, 0xD2, 0x83, 0x29, 0x09, 0x26, 0xFA, 0xCD, 0x1E, 0x07,
+	0x73, 0xCC, 0x8F, 0x41, 0x9F, 0xA7, 0xEB, 0x65, 0x20, 0xE4, 0x08, 0x48, 0xC6, 0x6E, 0xE4, 0xF3,
+	0x28, 0xB3, 0xCB, 0x7D, 0xA9, 0x90, 0x5B, 0xD4, 0x10, 0x34, 0x23, 0x73, 0x15, 0x18, 0x56, 0xD3,
+	0x35, 0x84, 0x5C, 0xF1, 0x0B, 0x6C, 0xDC, 0x93, 0x7F, 0x26, 0x36, 0xA4, 0x4B, 0xB6, 0x50, 0x67,
+	0xA0, 0x73, 0x0D, 0x66, 0x51, 0x1F, 0xC1, 0x8B, 0xF3, 0x45, 0x7D, 0xD0, 0x4F, 0x82, 0x63, 0xE3,
+	0x52, 0x5E, 0x13, 0xAB, 0x34, 0x1B, 0xE3, 0x0D, 0x88, 0xE4, 0xF3, 0xDB, 0xE4, 0xDD, 0x03, 0xC4,
+	0x86, 0x3C, 0x9C, 0xB6, 0xB5, 0x22, 0xAE, 0x73, 0xFD, 0x4A, 0xCB, 0x5C, 0x58, 0x1B, 0x8F, 0xB9,
+	0x35, 0x90, 0x81, 0xBA, 0x1F, 0x15, 0xFC, 0x93, 0xBB, 0x9C, 0x67, 0x8A, 0x45, 0xF4, 0x85, 0x9D,
+	0x9C, 0x80, 0x81, 0x6E, 0x82, 0x01, 0xCF, 0xD7, 0xE9, 0x92, 0x35, 0x1C, 0xF6, 0x1C, 0x8B, 0x1B,
+	0x4A, 0x48, 0x3E, 0x03, 0x5C, 0xD7, 0xF1, 0xBA, 0xEA, 0x3B, 0x12, 0x9F, 0xD1, 0xD4, 0x24, 0xEA,
+	0xC1, 0xB8, 0xFD, 0xF4, 0x9C, 0x4E, 0x65, 0xD2, 0xDF, 0x1F, 0x9F, 0xE3, 0xF4, 0x23, 0xAA, 0x46,
+	0x50, 0xED, 0xDC, 0xCF, 0xE7, 0xF6, 0x34, 0x4E, 0x92, 0xD4, 0xA2, 0x47, 0x98, 0x46, 0x14, 0x11,
+	0x47, 0x4C, 0x97, 0x7C, 0x6E, 0x02, 0xEF, 0x25, 0x05, 0x2B, 0xBC, 0xBB, 0xE9, 0x15, 0x88, 0x4E,
+	0x6E, 0x49, 0x0A, 0x65, 0xC5, 0x55, 0x72, 0x63, 0x7D, 0x6E, 0xB1, 0xA8, 0xD9, 0xB4, 0xF3, 0xE4,
+	0x55, 0x04, 0x73, 0xB0, 0xE5, 0x35, 0x89, 0x8F, 0x24, 0x4D, 0x44, 0xD8, 0x55, 0xF4, 0x09, 0xBB,
+	0xAF, 0x5D, 0xEF, 0x3A, 0x91, 0xC1, 0x40, 0xAB, 0x4E, 0x62, 0xBE, 0x31, 0x66, 0x46, 0x2C, 0xDB,
+	0x94, 0xE1, 0xCA, 0xA6, 0x89, 0x69, 0x94, 0x66, 0xC2, 0xBC, 0xD2, 0xA1, 0xC1, 0x86, 0xEE, 0x03,
+	0x92, 0x40, 0x10, 0x37, 0x74, 0xC7, 0xD0, 0xAB, 0x4D, 0xF0, 0xEF, 0x63, 0xBC, 0x92, 0x44, 0x2A,
+	0x09, 0xF3, 0x2B, 0xAB, 0xED, 0x3B, 0xB1, 0x15, 0x0A, 0x8D, 0x62, 0x58, 0xC5, 0x0A, 0xF2, 0x3D,
+	0x96, 0x04, 0x29, 0x09, 0xB5, 0x39, 0x4C, 0x41, 0xBF, 0x46, 0xF9, 0xDC, 0x6A, 0xE0, 0xD2, 0x74,
+	0xA3, 0xF9, 0x38, 0x92, 0xB0, 0xAE, 0x10, 0xF3, 0x2D, 0x84, 0xC8, 0xD8, 0x05, 0x6A, 0x08, 0x9D,
+	0x11, 0x6A, 0x05, 0xEE, 0xC5, 0x7B, 0x9C, 0xCE, 0xA4, 0xB7, 0x98, 0x1D, 0xB3, 0x68, 0x01, 0xA6,
+	0x3D, 0x03, 0xC0, 0x4B, 0xE9, 0x4B, 0xA0, 0x36, 0xB2, 0x09, 0xAD, 0xE3, 0xA7, 0x0C, 0x3B, 0xFD,
+	0x99, 0xAF, 0x72, 0x9C, 0xB2, 0xA5, 0xBF, 0xF5, 0xE2, 0x39, 0x66, 0xAD, 0x2E, 0x5E, 0x3F, 0x6B,
+	0x7B, 0x78, 0x8A, 0x27, 0x4B, 0x20, 0xF4, 0x05, 0x8F, 0x0A, 0x5C, 0x93, 0x03, 0x71, 0x71, 0x17,
+	0x44, 0xCB, 0x18, 0x28, 0xCC, 0x41, 0x05, 0xD0, 0x23, 0xE1, 0xE8, 0x8B, 0xC1, 0xDB, 0x05, 0x3C,
+	0xC7, 0x77, 0x40, 0x7A, 0x18, 0x4D, 0xA7, 0x0C, 0x66, 0x9B, 0x88, 0x44, 0x13, 0xFD, 0x20, 0x81,
+	0xDD, 0xC2, 0x7D, 0x00, 0xEC, 0x68, 0x85, 0xF4, 0x35, 0x0D, 0x4F, 0xEC, 0xD9, 0xE5, 0xD9, 0xEB,
+	0xDF, 0x9E, 0xBF, 0x7D, 0x77, 0xF6, 0x13, 0xB0, 0xB4, 0xE3, 0x29, 0xA1, 0xFE, 0xE9, 0xE5, 0xCB,
+	0xF7, 0xBF, 0xBD, 0x39, 0x7F, 0xF6, 0x23, 0x3A, 0x31, 0xAC, 0xA3, 0x8A, 0x81, 0x30, 0xA0, 0xEB,
+	0x37, 0xAC, 0xBB, 0xE4, 0x37, 0xEC, 0x63, 0xB4, 0xCC, 0x3B, 0xDE, 0xB3, 0x34, 0xF5, 0xEF, 0xAC,
+	0xAB, 0x03, 0xE7, 0xB6, 0xEB, 0x0D, 0x7D, 0x6F, 0x3A, 0xC2, 0xA3, 0x47, 0xB7, 0x03, 0xB7, 0x33,
+	0xE8, 0x76, 0x47, 0x2E, 0x3E, 0x4F, 0x7A, 0x81, 0x33, 0x9D, 0x04, 0x53, 0x7C, 0xE6, 0xE0, 0xEA,
+	0x85, 0x13, 0x1F, 0x8F, 0xEA, 0xDC, 0x76, 0x46, 0xBD, 0x7E, 0xE0, 0xF5, 0x26, 0xF8, 0xDC, 0x1B,
+	0x4D, 0x5D, 0xD7, 0x9D, 0x52, 0xFD, 0x91, 0xD7, 0x99, 0x0E, 0x3D, 0xBF, 0x8B, 0xCF, 0xFE, 0xC4,
+	0x0D, 0x7A, 0x3C, 0xEC, 0xB5, 0x00, 0x7E, 0x38, 0x74, 0x06, 0xBE, 0x2F, 0xE0, 0xBB, 0xDE, 0xB0,
+	0xD3, 0x9B, 0x38, 0x54, 0xDF, 0xEB, 0x76, 0xDC, 0x61, 0x6F, 0xC2, 0x09, 0x4E, 0xCF, 0x09, 0x06,
+	0x61, 0xD0, 0x21, 0x1A, 0xBC, 0x09, 0xEF, 0x85, 0x03, 0x82, 0x33, 0x74, 0x42, 0x3E, 0x71, 0xA7,
+	0x54, 0x67, 0x34, 0x09, 0x03, 0xA7, 0xEF, 0x0F, 0xF0, 0x39, 0x70, 0x47, 0x93, 0xA9, 0x0B, 0x75,
+	0x00, 0x3E, 0xEF, 0x82, 0x13, 0x3A, 0x0A, 0x08, 0x26, 0x9F, 0x4E, 0x78, 0x77, 0x30, 0xEC, 0xE3,
+	0xB3, 0x33, 0x85, 0x5A, 0x61, 0xD0, 0x17, 0xB8, 0x9C, 0xC0, 0x77, 0x83, 0x80, 0x9E, 0x43, 0x3E,
+	0xF2, 0x82, 0x3E, 0xF5, 0xAB, 0xEB, 0x0F, 0xBA, 0xC3, 0xAE, 0xEF, 0x13, 0x0D, 0xC1, 0xC4, 0xF1,
+	0xA1, 0x01, 0xD1, 0xD0, 0x07, 0x86, 0x0C, 0x43, 0x1F, 0xE1, 0x8F, 0x86, 0x1D, 0xDE, 0xA3, 0x53,
+	0x55, 0xD0, 0xAF, 0x61, 0xC7, 0x0D, 0xFA, 0xFD, 0x90, 0xF8, 0xE3, 0x38, 0x1D, 0x6F, 0x10, 0x50,
+	0xBF, 0x26, 0xD3, 0xDE, 0x68, 0x30, 0x0D, 0x04, 0x6D, 0x7D, 0xEE, 0x38, 0x93, 0x29, 0xF5, 0x25,
+	0xEC, 0xF9, 0x83, 0x91, 0xDB, 0xA5, 0x72, 0xA7, 0x1F, 0xF8, 0xFD, 0x4E, 0x8F, 0xE8, 0x74, 0xBB,
+	0xDE, 0xC8, 0x1B, 0xF5, 0x07, 0x08, 0xDF, 0x1B, 0x4C, 0x06, 0x8E, 0x3F, 0x24, 0xDE, 0x7A, 0xDC,
+	0x9D, 0x78, 0x6E, 0x87, 0x60, 0x76, 0x43, 0xA0, 0x32, 0x9C, 0x12, 0x3D, 0xBD, 0x4E, 0x07, 0x58,
+	0x41, 0x07, 0xCD, 0x6E, 0xFB, 0x3D, 0xC7, 0x1F, 0x74, 0x7A, 0x5D, 0x41, 0x67, 0xDF, 0x77, 0xFC,
+	0x09, 0x8D, 0xC5, 0xD0, 0x0D, 0xBC, 0x60, 0xE4, 0x09, 0x5E, 0x79, 0x03, 0xCF, 0x0B, 0x86, 0xC4,
+	0x7F, 0xDF, 0x9B, 0x4C, 0xF9, 0xD0, 0x77, 0x05, 0xFD, 0xAE, 0xDF, 0xEF, 0x77, 0xA9, 0x7E, 0xE0,
+	0x75, 0x27, 0x43, 0x40, 0x4D, 0xCF, 0x83, 0x7E, 0xD0, 0x73, 0x7D, 0x41, 0xB3, 0x0B, 0x40, 0x86,
+	0x74, 0x80, 0xEC, 0x36, 0xEC, 0x8F, 0x46, 0x4E, 0xDF, 0x23, 0x5C, 0xD3, 0xAE, 0xC3, 0x3B, 0x3D,
+	0x41, 0xA7, 0x0B, 0x03, 0xE1, 0x3B, 0xD0, 0x16, 0xE0, 0xBB, 0x23, 0xBF, 0x1B, 0xB8, 0x2E, 0xF1,
+	0xD9, 0xE5, 0x1D, 0x80, 0xE4, 0x10, 0xFD, 0x1E, 0xB0, 0x76, 0x30, 0xE8, 0x12, 0xFD, 0x9D, 0xEE,
+	0xC4, 0x99, 0x04, 0x13, 0x29, 0x3F, 0x6E, 0xE0, 0x04, 0x13, 0xC2, 0xD5, 0xE5, 0xE1, 0xD0, 0xF7,
+	0xBB, 0x82, 0xFF, 0x93, 0x51, 0x10, 0xF8, 0x5D, 0x1A, 0x97, 0xFE, 0xD0, 0xE3, 0xFD, 0x29, 0xF0,
+	0x10, 0xE0, 0x03, 0x18, 0x90, 0x2B, 0x4E, 0xFD, 0x1A, 0x0C, 0xFD, 0x5E, 0xBF, 0x23, 0xC6, 0x6E,
+	0xD8, 0x0D, 0x86, 0x83, 0xA1, 0x2B, 0xE4, 0x04, 0x26, 0x22, 0xC7, 0x13, 0x78, 0x47, 0xCE, 0x84,
+	0x4F, 0xA7, 0x53, 0x82, 0xE9, 0x77, 0x7B, 0xC0, 0x76, 0x4E, 0xFD, 0x85, 0xD2, 0x91, 0xDF, 0x99,
+	0xCA, 0x31, 0x1A, 0xB8, 0x83, 0xE1, 0xD4, 0x3B, 0xF8, 0x24, 0x2C, 0x40, 0x90, 0xDE, 0xAD, 0xF2,
+	0x84, 0xAE, 0x01, 0x03, 0x33, 0x45, 0x5A, 0xC9, 0x6F, 0xC1, 0x2C, 0x53, 0xFC, 0xF0, 0xFA, 0xF2,
+	0xF2, 0xFD, 0x05, 0xD8, 0x7E, 0x30, 0x0A, 0x2D, 0x86, 0x49, 0x4B, 0x8C, 0x39, 0x94, 0x62, 0x63,
+	0x48, 0x92, 0xB1, 0x55, 0x0C, 0xBA, 0x4B, 0x15, 0x51, 0x4B, 0xF5, 0x0C, 0x97, 0xCD, 0x7D, 0xD0,
+	0x3C, 0x0B, 0x1D, 0x9C, 0xA6, 0xF6, 0x7A, 0xF0, 0xD0, 0x1A, 0xC5, 0x37, 0x4A, 0x19, 0x87, 0x42,
+	0x17, 0x2D, 0xAA, 0x27, 0xAD, 0x30, 0x4C, 0x1A, 0x03, 0xAF, 0xC9, 0x4E, 0x4F, 0x59, 0xBF, 0xC9,
+	0x9E, 0x3E, 0x85, 0xBF, 0xE3, 0x03, 0xD1, 0xD0, 0xCE, 0x78, 0x2E, 0x20, 0xAA, 0x92, 0x2B, 0xA3,
+	0xDD, 0x27, 0x0C, 0x69, 0x40, 0x6D, 0x94, 0xEE, 0xE3, 0xE6, 0x56, 0x89, 0xEA, 0x05, 0xD4, 0xFA,
+	0x05, 0xBE, 0x5A, 0x12, 0xCE, 0x64, 0x3D, 0x9D, 0xE2, 0x75, 0x25, 0x07, 0x58, 0x07, 0xA1, 0x0A,
+	0xC3, 0xA0, 0x5E, 0x4B, 0x3A, 0xDA, 0x0C, 0x98, 0x6A, 0xCC, 0x94, 0x26, 0x8D, 0x47, 0x38, 0xCA,
+	0x8E, 0xF8, 0xAF, 0xB9, 0x1F, 0x10, 0x8C, 0x54, 0xA9, 0x39, 0x74, 0xAB, 0x83, 0x5D, 0x3C, 0x85,
+	0x39, 0x5E, 0xD1, 0x3B, 0xAF, 0x33, 0x52, 0x20, 0x0F, 0xBE, 0x33, 0xE2, 0xFD, 0x3E, 0x8D, 0xDD,
+	0x64, 0xD2, 0x1F, 0xF8, 0x5C, 0xC8, 0x61, 0x07, 0x94, 0x6D, 0xDA, 0x19, 0x08, 0xDD, 0xEC, 0x75,
+	0xA7, 0xD3, 0x5E, 0x47, 0xC8, 0x92, 0xEB, 0xF0, 0x9E, 0x37, 0x98, 0x0A, 0xBB, 0xE1, 0xF4, 0xFA,
+	0xC3, 0x21, 0xC9, 0xA1, 0x3B, 0x1D, 0x76, 0xC2, 0x91, 0x2F, 0x6C, 0xD7, 0x84, 0x3B, 0x01, 0x08,
+	0xFB, 0x27, 0x8D, 0xFC, 0xA6, 0x06, 0x79, 0xBF, 0xAB, 0x5F, 0xA7, 0xE4, 0xF6, 0x58, 0xB7, 0x2D,
+	0xB6, 0x24, 0x07, 0xD9, 0xBA, 0x25, 0xE2, 0xE1, 0xCB, 0x3F, 0xF1, 0x19, 0xBA, 0x63, 0x75, 0x3C,
+	0xE8, 0xE7, 0x12, 0x79, 0x81, 0x51, 0x8E, 0x85, 0xF1, 0x66, 0x02, 0xA6, 0x1D, 0xC3, 0x4C, 0x7A,
+	0x78, 0xCA, 0x4A, 0x4C, 0x11, 0x85, 0x4F, 0x4E, 0x18, 0x60, 0x41, 0x77, 0x56, 0xB5, 0x89, 0x44,
+	0x8B, 0x08, 0xEA, 0xBB, 0x7D, 0xF8, 0x7C, 0xF2, 0xA4, 0xC9, 0x6E, 0xC0, 0x7F, 0x80, 0x62, 0xE2,
+	0xF1, 0x4C, 0xF3, 0x98, 0xDA, 0xB3, 0x2E, 0xFB, 0x1E, 0x7C, 0x8F, 0x71, 0x19, 0x00, 0xB5, 0x04,
+	0x08, 0xFD, 0xAE, 0x84, 0xA0, 0x04, 0x30, 0x73, 0xE0, 0x2D, 0x74, 0xC6, 0x02, 0x90, 0x40, 0xAE,
+	0xDB, 0xFB, 0xD4, 0x62, 0x83, 0x26, 0xFB, 0x5F, 0xD5, 0x32, 0x77, 0x88, 0x85, 0x45, 0x09, 0xF5,
+	0xB6, 0xA3, 0xD9, 0x91, 0xB9, 0x25, 0x30, 0x1E, 0xB6, 0xA8, 0x80, 0xA1, 0xB2, 0x91, 0x01, 0xC5,
+	0x13, 0x40, 0x5C, 0x1C, 0x70, 0xD9, 0x21, 0x09, 0xBE, 0xFF, 0x09, 0xFD, 0x24, 0x07, 0xFE, 0x88,
+	0x82, 0x01, 0x7D, 0x77, 0x71, 0xDE, 0xC6, 0x0E, 0x5D, 0xC1, 0xB0, 0xC2, 0xA8, 0xC1, 0x20, 0x82,
+	0xED, 0x05, 0x53, 0x00, 0x23, 0x3B, 0x6B, 0xB1, 0x39, 0xC9, 0xFB, 0x7C, 0x5C, 0xCB, 0xB9, 0x8D,
+	0x7E, 0xE7, 0x48, 0xB0, 0x35, 0x47, 0xDD, 0xB2, 0x90, 0x46, 0x00, 0xD3, 0x57, 0xF4, 0x72, 0x3C,
+	0xC7, 0x6B, 0x7C, 0xF1, 0x7A, 0xE4, 0xBE, 0x59, 0x16, 0x67, 0x7F, 0x66, 0x53, 0xEA, 0xC1, 0xFF,
+	0xE0, 0xE3, 0x8C, 0x8A, 0xD5, 0x8C, 0x8A, 0x3D, 0x20, 0x82, 0x3F, 0x49, 0x39, 0xD6, 0xB9, 0x1C,
+	0x0F, 0x51, 0x11, 0x16, 0x20, 0xDC, 0x53, 0x80, 0xE1, 0xD9, 0xED, 0x18, 0x5F, 0x3C, 0x4F, 0x62,
+	0xF1, 0x01, 0xF4, 0x84, 0xB0, 0xE0, 0x53, 0x40, 0x4F, 0x13, 0x7A, 0x6A, 0x6A, 0xC8, 0x73, 0xD4,
+	0x8D, 0xD9, 0x98, 0xCD, 0xD0, 0x8D, 0x1A, 0x33, 0x94, 0x2A, 0x3E, 0xC6, 0x80, 0x0A, 0xB4, 0x0A,
+	0x80, 0xE4, 0xAE, 0xAE, 0x89, 0xC6, 0x25, 0x18, 0xB3, 0x00, 0x3E, 0x26, 0x63, 0x36, 0x81, 0x0F,
+	0x7F, 0xCC, 0x30, 0x53, 0x6A, 0x01, 0x0B, 0xA0, 0xA6, 0xA7, 0x6B, 0x3E, 0x1C, 0xCC, 0xC1, 0x01,
+	0x43, 0x09, 0x84, 0x1A, 0xF3, 0x2B, 0x97, 0x1E, 0x27, 0xF8, 0xE8, 0xD1, 0x63, 0x80, 0x8F, 0x1D,
+	0x7A, 0x0C, 0x81, 0x82, 0xAB, 0x2E, 0x3D, 0x72, 0x2C, 0xED, 0xD1, 0xE3, 0x14, 0x1F, 0xFB, 0xF4,
+	0x38, 0xC3, 0xC7, 0x01, 0x3D, 0xCE, 0xE7, 0x85, 0xE3, 0x97, 0x50, 0x56, 0xB8, 0x62, 0xEB, 0x3A,
+	0x9E, 0x16, 0x23, 0x78, 0xFF, 0x4B, 0x8D, 0x91, 0x82, 0xE2, 0xC2, 0x42, 0xD5, 0x0D, 0xEF, 0x50,
+	0x8E, 0xAE, 0x6C, 0x6F, 0xD8, 0x1D, 0xD2, 0x06, 0x10, 0x0E, 0x1C, 0x16, 0xED, 0xBA, 0x43, 0xB5,
+	0x52, 0xF0, 0x91, 0x27, 0xAF, 0xF9, 0x6D, 0x11, 0x73, 0xC8, 0x5A, 0x44, 0x9D, 0x8D, 0x4E, 0x9F,
+	0x78, 0xD5, 0x42, 0xEE, 0x9D, 0xB2, 0x09, 0x78, 0xF5, 0x17, 0x79, 0x1A, 0x2D, 0x67, 0x96, 0xDB,
+	0x6F, 0xDA, 0x2B, 0x72, 0x42, 0xD3, 0xDC, 0x02, 0xBB, 0xD3, 0x70, 0xC0, 0x3F, 0xB5, 0xF1, 0x70,
+	0xAD, 0xD5, 0x10, 0x01, 0x62, 0x11, 0xDF, 0x00, 0x18, 0x44, 0x82, 0x81, 0x98, 0x81, 0xA3, 0xC2,
+	0x0A, 0x7C, 0x6B, 0x2F, 0xD0, 0xC3, 0xB3, 0x8E, 0x6C, 0xFB, 0x68, 0xD6, 0x84, 0x2F, 0x2B, 0x8B,
+	0xD0, 0x52, 0xB8, 0xF1, 0x66, 0x99, 0x5B, 0x20, 0xF9, 0x80, 0xB7, 0x49, 0xE0, 0x61, 0xB6, 0x4A,
+	0xB3, 0xBB, 0x65, 0xD0, 0xA6, 0x20, 0x8B, 0x5C, 0xC7, 0x63, 0x86, 0xBB, 0xFB, 0xC5, 0x2D, 0x01,
+	0x19, 0x39, 0xA8, 0x91, 0x4C, 0x04, 0x4E, 0xD0, 0xBB, 0xC4, 0x34, 0x1B, 0xEE, 0xEF, 0xA7, 0x4D,
+	0x43, 0xD9, 0x7A, 0xD1, 0x62, 0x84, 0x0E, 0xA6, 0xAD, 0x29, 0x2E, 0xDC, 0x30, 0x1F, 0xBC, 0xE7,
+	0xE5, 0x1D, 0x9A, 0xA2, 0x8C, 0xEC, 0xD5, 0x01, 0xCE, 0x6F, 0x48, 0x25, 0x39, 0xC2, 0x04, 0x6F,
+	0x06, 0xCE, 0x2F, 0x25, 0xA9, 0x26, 0x09, 0x9E, 0x8B, 0x50, 0x07, 0xA8, 0xE5, 0x7C, 0xC8, 0xAF,
+	0x79, 0x7A, 0x07, 0x4E, 0x32, 0xE0, 0xE0, 0x78, 0xA7, 0x86, 0x72, 0x5F, 0x71, 0x25, 0x72, 0x09,
+	0x33, 0x24, 0x4C, 0xA3, 0xE6, 0xAC, 0xB8, 0xF0, 0x3F, 0x73, 0x72, 0xB9, 0xAD, 0x09, 0x5D, 0x7E,
+	0xB8, 0x04, 0x0E, 0xB4, 0xA8, 0x0B, 0x17, 0x73, 0x5F, 0x7C, 0x85, 0x87, 0x42, 0x6F, 0x9F, 0xC3,
+	0xA0, 0x1B, 0x2E, 0xAF, 0x12, 0x1C, 0xD9, 0x5D, 0x21, 0x37, 0xE7, 0xC0, 0xB3, 0xC2, 0x8E, 0x73,
+	0x1F, 0x43, 0x43, 0x0B, 0xE4, 0x07, 0x08, 0xCC, 0x9B, 0x22, 0xE7, 0x40, 0x79, 0x47, 0x94, 0x1F,
+	0x1A, 0x54, 0x94, 0xFE, 0x3A, 0xB1, 0x7A, 0xAE, 0x8C, 0x06, 0xD4, 0x45, 0x5D, 0x58, 0x4F, 0xAF,
+	0x80, 0x3F, 0x4F, 0x18, 0x04, 0x6F, 0xD0, 0x0C, 0x4A, 0xAC, 0xE7, 0x60, 0x9D, 0x22, 0xF0, 0xC6,
+	0xCB, 0xEF, 0x1E, 0xD4, 0xF0, 0x5E, 0xA1, 0x06, 0x83, 0xB7, 0x04, 0xFF, 0x21, 0x22, 0xF5, 0x8C,
+	0xB1, 0xDF, 0xB6, 0x59, 0xE1, 0x09, 0x74, 0xF1, 0xE9, 0x09, 0x71, 0xA0, 0x3A, 0x31, 0x3C, 0x2F,
+	0xD8, 0x40, 0x26, 0x90, 0x2C, 0x26, 0x74, 0x4F, 0xB2, 0x0E, 0x6A, 0xE9, 0x5E, 0x7F, 0xE6, 0x77,
+	0xD4, 0x69, 0x9C, 0x88, 0x40, 0x5A, 0x60, 0x52, 0xF2, 0x65, 0x64, 0x25, 0x38, 0x65, 0xCF, 0xFD,
+	0xCC, 0x82, 0x4A, 0x60, 0x51, 0x64, 0x01, 0x7A, 0x12, 0x50, 0xA0, 0xC0, 0x3C, 0x68, 0x07, 0x05,
+	0x47, 0x0C, 0xC2, 0x68, 0x99, 0xAC, 0xA5, 0xED, 0xBD, 0x46, 0xA6, 0x74, 0xB5, 0xCE, 0xE6, 0x84,
+	0x49, 0x28, 0x0F, 0x32, 0x57, 0xB4, 0xB1, 0xF1, 0x8D, 0x2C, 0x1E, 0x8B, 0x66, 0xC8, 0x42, 0xFC,
+	0xAE, 0xFB, 0xF5, 0xA0, 0xF5, 0x7E, 0x85, 0x30, 0x70, 0x81, 0xAC, 0xC5, 0x60, 0x4A, 0xBD, 0x6B,
+	0x9A, 0x99, 0x21, 0x90, 0xAF, 0x4D, 0xA3, 0x71, 0x47, 0xF9, 0x00, 0x90, 0x58, 0x3E, 0x8D, 0x96,
+	0x20, 0xDC, 0x3F, 0xB0, 0x1E, 0x3B, 0x66, 0x23, 0xCD, 0x80, 0xEB, 0xAA, 0x0D, 0x01, 0x28, 0x85,
+	0x0D, 0x81, 0x2F, 0x68, 0xEA, 0xC0, 0xA6, 0x01, 0x4A, 0xF0, 0x55, 0x0C, 0x83, 0xE1, 0x12, 0x05,
+	0x98, 0x86, 0x6E, 0x0A, 0x8E, 0xDD, 0xB1, 0x6F, 0x4C, 0x4C, 0x4D, 0x66, 0xD6, 0x06, 0xC7, 0xE3,
+	0x4E, 0xD7, 0xA6, 0x1E, 0x03, 0xE8, 0x26, 0x0D, 0xAF, 0xCC, 0x2D, 0x90, 0xCC, 0x63, 0xEF, 0xD0,
+	0x02, 0x40, 0xD5, 0x44, 0xF6, 0x8D, 0x72, 0x3F, 0x09, 0x3B, 0x25, 0xCB, 0xD0, 0xA4, 0xDB, 0x64,
+	0x2C, 0x88, 0x0B, 0x3C, 0xAC, 0x02, 0x42, 0x45, 0xA5, 0x63, 0x62, 0xAF, 0x85, 0x4A, 0x80, 0xEE,
+	0xA8, 0x4F, 0x3D, 0xD7, 0x70, 0xF0, 0x78, 0x7D, 0x81, 0x08, 0x17, 0xE5, 0x37, 0xD9, 0x34, 0x34,
+	0xBC, 0xA9, 0x0D, 0x96, 0x60, 0x93, 0x82, 0x27, 0xF4, 0x0D, 0xA5, 0xE0, 0x0A, 0x43, 0x0C, 0x72,
+	0x8A, 0xBA, 0x22, 0xF4, 0xA0, 0xBF, 0x78, 0xB9, 0x05, 0x9A, 0xD0, 0xB9, 0xD9, 0xFD, 0x61, 0xCB,
+	0x14, 0x54, 0xCD, 0x88, 0x52, 0x1D, 0xD7, 0x13, 0x6A, 0xBC, 0x51, 0x49, 0xE1, 0xD3, 0xCA, 0xEE,
+	0xF6, 0xCD, 0x62, 0xA9, 0xFA, 0x2D, 0xD6, 0x1D, 0x2A, 0xDE, 0xE2, 0xBB, 0xA6, 0x90, 0xC3, 0x38,
+	0xCA, 0x85, 0x18, 0x16, 0x2A, 0x5B, 0xA3, 0xD4, 0xC8, 0x64, 0x03, 0x37, 0x3B, 0x25, 0x25, 0x2A,
+	0x2B, 0x8F, 0xB0, 0x38, 0xE4, 0x84, 0xCC, 0x31, 0x2F, 0x61, 0x45, 0x4A, 0x07, 0x8D, 0x96, 0x85,
+	0xE6, 0x09, 0x65, 0x95, 0x4A, 0x03, 0xBE, 0x97, 0x55, 0x52, 0x32, 0x45, 0x1D, 0x5F, 0x16, 0x04,
+	0x60, 0x8B, 0x8A, 0x08, 0xDD, 0x2B, 0x5C, 0x58, 0x11, 0xEC, 0x0C, 0xFB, 0xF3, 0x9F, 0x09, 0xDB,
+	0x15, 0xE2, 0x86, 0xB2, 0x4F, 0x24, 0xDD, 0xC8, 0x98, 0x2B, 0x61, 0x13, 0xB0, 0xAC, 0x89, 0x7F,
+	0x9F, 0x3C, 0x51, 0x49, 0x1B, 0xC2, 0x71, 0x22, 0xAD, 0x02, 0xA9, 0x26, 0xA0, 0x84, 0xA9, 0x2E,
+	0x81, 0x0F, 0x68, 0xA4, 0xBB, 0x93, 0x81, 0x8C, 0x21, 0xB7, 0x00, 0x05, 0x8A, 0x9B, 0xA3, 0x71,
+	0x65, 0xE8, 0x6A, 0x99, 0x98, 0xE8, 0x3B, 0x8A, 0x62, 0xD6, 0x6E, 0x83, 0xD1, 0xC1, 0x3F, 0xE8,
+	0x70, 0x2D, 0x51, 0x71, 0xD1, 0x0D, 0xCB, 0x0C, 0x98, 0x44, 0x12, 0x90, 0x6E, 0x72, 0x97, 0x30,
+	0xA8, 0x17, 0x86, 0x5C, 0x18, 0x18, 0x37, 0x7A, 0x57, 0xED, 0x9B, 0xD0, 0x17, 0x2B, 0xC6, 0xFB,
+	0x7E, 0xC0, 0x70, 0x1C, 0x08, 0xAD, 0x00, 0xA5, 0x4C, 0x5A, 0x58, 0x05, 0x75, 0x12, 0xFA, 0x27,
+	0x46, 0x5F, 0x82, 0x13, 0x5C, 0xAE, 0x1F, 0xB5, 0xBA, 0xA1, 0x8E, 0x84, 0x4A, 0xE4, 0xD1, 0x12,
+	0x97, 0x9A, 0x1E, 0xCC, 0xD6, 0x5B, 0x86, 0x5C, 0x7A, 0x2D, 0x38, 0x3E, 0x9F, 0xF0, 0xC6, 0xF5,
+	0x89, 0xFE, 0x8A, 0xCD, 0xC0, 0x32, 0x92, 0x3F, 0xE5, 0x03, 0x8B, 0xB0, 0xEA, 0x13, 0xAC, 0xD1,
+	0xD4, 0xC6, 0x7E, 0x7C, 0x30, 0x11, 0xA6, 0xB8, 0x0D, 0x18, 0xBE, 0x97, 0x35, 0x7C, 0xF3, 0x3D,
+	0x90, 0x20, 0x87, 0xD5, 0xE8, 0xBC, 0x49, 0x89, 0x36, 0xB6, 0x94, 0x9B, 0xDA, 0x50, 0x72, 0xCA,
+	0xD3, 0x4A, 0xF1, 0xCF, 0x8D, 0xD9, 0x4C, 0x36, 0xC2, 0x04, 0x13, 0x99, 0xE4, 0x26, 0xD9, 0x66,
+	0x00, 0x41, 0xFA, 0xB5, 0xA2, 0xE9, 0x70, 0x8C, 0x4D, 0x60, 0x7C, 0x57, 0x85, 0x51, 0x2E, 0x12,
+	0x9C, 0x50, 0xB5, 0xE4, 0xC4, 0xE0, 0x61, 0x96, 0x37, 0xE8, 0x07, 0xBC, 0x98, 0x58, 0x15, 0x27,
+	0xE6, 0x3D, 0x58, 0xA5, 0x28, 0xE3, 0xE0, 0xE6, 0xF2, 0x2C, 0x89, 0xAF, 0xC1, 0x8E, 0xA7, 0xFC,
+	0x77, 0x70, 0x0C, 0x2A, 0x96, 0x1C, 0x57, 0xD9, 0x22, 0x95, 0x28, 0xB3, 0x11, 0x9E, 0xD5, 0x30,
+	0xF7, 0x4C, 0x34, 0xC0, 0x0A, 0x90, 0x7D, 0xFE, 0xC3, 0x4E, 0x96, 0xEB, 0x15, 0xDE, 0x45, 0xC5,
+	0x97, 0x9C, 0x8B, 0x18, 0x59, 0x2C, 0x45, 0xE0, 0x3B, 0x40, 0xB2, 0x8E, 0x73, 0x3B, 0x48, 0xB9,
+	0x9F, 0xF3, 0x77, 0x13, 0x44, 0x74, 0x91, 0x27, 0x29, 0xB7, 0x1A, 0x22, 0x5F, 0x07, 0x60, 0xEE,
+	0x71, 0x0E, 0x04, 0xCF, 0x62, 0x7E, 0xCC, 0x1A, 0x10, 0x7A, 0x37, 0xD8, 0x83, 0x86, 0xAB, 0xAE,
+	0xC3, 0x2C, 0x20, 0x12, 0xC9, 0x56, 0x01, 0x59, 0x57, 0x15, 0xB7, 0xAC, 0x15, 0x15, 0x11, 0x13,
+	0xD5, 0xA3, 0x17, 0x32, 0x6B, 0xF8, 0x70, 0xE0, 0xA3, 0x13, 0xC6, 0x8A, 0x50, 0x1F, 0x69, 0x09,
+	0x89, 0x53, 0x56, 0x66, 0x7A, 0x2F, 0x21, 0xF9, 0xDF, 0x37, 0x7E, 0x94, 0x97, 0x79, 0x39, 0xAE,
+	0x63, 0xA5, 0x24, 0x6B, 0x93, 0x81, 0x21, 0xB8, 0xA0, 0xB8, 0x44, 0x22, 0x8E, 0x04, 0xE9, 0x3E,
+	0x37, 0xED, 0xA4, 0x86, 0x13, 0x4D, 0x32, 0x52, 0x48, 0xC5, 0xE3, 0xBB, 0x0F, 0xB3, 0x69, 0x45,
+	0xC4, 0x0C, 0xA6, 0x8B, 0x04, 0xC6, 0x31, 0x5B, 0xAE, 0xE3, 0x78, 0x2B, 0x9F, 0x04, 0x44, 0x59,
+	0xA5, 0x96, 0x47, 0x9F, 0x39, 0x5F, 0x69, 0x0E, 0xB5, 0x58, 0x39, 0x2D, 0xB2, 0x9D, 0x4F, 0x32,
+	0xDC, 0xC4, 0x2E, 0x6E, 0xE7, 0x04, 0x78, 0xE2, 0x20, 0x19, 0xE1, 0x0D, 0xAD, 0x53, 0x6E, 0x61,
+	0xCB, 0xF8, 0x80, 0x80, 0x80, 0x9B, 0x92, 0x5B, 0xF7, 0x98, 0x9C, 0x39, 0x66, 0x44, 0x08, 0x9E,
+	0xE0, 0x3E, 0xC6, 0x39, 0x92, 0xDB, 0xCB, 0xE4, 0xC6, 0x6A, 0x0A, 0xD2, 0x8E, 0xE9, 0xAF, 0x9C,
+	0x2C, 0x49, 0x94, 0x44, 0x6B, 0xE0, 0xED, 0x33, 0xDC, 0x1A, 0x56, 0x62, 0x6B, 0x69, 0xC8, 0x92,
+	0x38, 0xA4, 0x85, 0x2D, 0x91, 0x8B, 0x57, 0x4C, 0xCC, 0x12, 0xD0, 0x73, 0x4B, 0xBB, 0x3A, 0x77,
+	0x36, 0xDD, 0x18, 0xD8, 0x66, 0xB7, 0xF4, 0xD0, 0xB4, 0xB3, 0x38, 0x0A, 0xB8, 0x65, 0xE4, 0x70,
+	0xD1, 0x14, 0xC6, 0xA1, 0x5E, 0xC9, 0x8B, 0x16, 0x33, 0x6C, 0x27, 0x88, 0x08, 0x39, 0xA8, 0x3E,
+	0xC7, 0x32, 0x1B, 0xC7, 0x59, 0xB8, 0x1F, 0x14, 0x1C, 0x3C, 0x93, 0x26, 0x43, 0xA5, 0x93, 0x8B,
+	0x64, 0x55, 0x23, 0x53, 0x7B, 0x47, 0x84, 0x67, 0x0F, 0x06, 0x36, 0xA5, 0x21, 0x15, 0xE9, 0x6A,
+	0x9F, 0xD1, 0x75, 0x57, 0xF2, 0x60, 0x20, 0xF8, 0xF0, 0xD8, 0x72, 0xC2, 0x73, 0xBC, 0xE0, 0x29,
+	0x98, 0x27, 0x98, 0xED, 0x02, 0x2F, 0xBE, 0x32, 0xA4, 0x84, 0xEB, 0x15, 0x44, 0xB3, 0xC2, 0xCE,
+	0x1A, 0xBE, 0x3B, 0x5D, 0xA5, 0xA8, 0xC6, 0x96, 0x5F, 0xEB, 0xC1, 0xB5, 0xC4, 0xC7, 0x94, 0x63,
+	0x00, 0xD0, 0x38, 0x22, 0x4A, 0x28, 0x84, 0xCA, 0xC4, 0x4A, 0x2B, 0x79, 0xAC, 0xD0, 0xC0, 0x4E,
+	0x3E, 0xB3, 0x7F, 0xFE, 0x13, 0x9B, 0xDA, 0x22, 0x8D, 0x46, 0x33, 0x88, 0x08, 0xDB, 0x14, 0x1A,
+	0xBD, 0x34, 0x84, 0xBD, 0xD0, 0x71, 0x01, 0xC6, 0x42, 0x0A, 0x9B, 0xA9, 0x96, 0x05, 0x28, 0x85,
+	0x06, 0xAB, 0xD6, 0xC2, 0x50, 0x56, 0xB7, 0x3E, 0x54, 0x51, 0x81, 0x9D, 0x01, 0xB0, 0xE8, 0xBA,
+	0xD6, 0x6B, 0x4B, 0xD8, 0x5D, 0x95, 0xEC, 0x2A, 0x4D, 0x9B, 0xDF, 0x33, 0xC7, 0x1E, 0x36, 0x41,
+	0xE7, 0x04, 0xA2, 0x63, 0x89, 0xFC, 0x81, 0x05, 0xF4, 0xDD, 0xE2, 0xA6, 0xA9, 0x15, 0xAF, 0x36,
+	0xD5, 0xA9, 0xBA, 0x9E, 0x01, 0x4D, 0x8A, 0xC5, 0x25, 0x7D, 0x19, 0xAC, 0xDA, 0x5F, 0x51, 0xBC,
+	0xA2, 0xBB, 0x15, 0x5E, 0x5F, 0x9E, 0xBF, 0xC5, 0x65, 0xB9, 0xF2, 0xDE, 0x3C, 0xBA, 0xE2, 0x69,
+	0xE3, 0xD4, 0xAF, 0xBC, 0x8D, 0xA1, 0x72, 0x42, 0x0C, 0xC2, 0x3D, 0xDB, 0xB6, 0xF5, 0x62, 0xDC,
+	0x52, 0x6C, 0x66, 0xAA, 0x18, 0x11, 0x39, 0xD8, 0xB8, 0x2A, 0x43, 0xAE, 0xEC, 0x73, 0xD2, 0x26,
+	0xAB, 0xD9, 0x34, 0x9B, 0x01, 0xDB, 0x70, 0x6A, 0x17, 0xC9, 0x52, 0x2C, 0xD8, 0x98, 0xFD, 0x04,
+	0x98, 0x2D, 0xC2, 0x26, 0x06, 0x53, 0x2E, 0x92, 0xE8, 0xFD, 0x07, 0x7C, 0x89, 0x14, 0x82, 0x54,
+	0xD7, 0x2C, 0x75, 0x9A, 0x23, 0x23, 0x56, 0xE9, 0x04, 0x22, 0x54, 0x18, 0xF4, 0xA9, 0x61, 0xF6,
+	0xAC, 0x69, 0x65, 0x4E, 0xCF, 0xA5, 0x7D, 0x0B, 0x10, 0xEC, 0x86, 0xEA, 0xB8, 0x1C, 0x0D, 0x85,
+	0x12, 0x14, 0xED, 0xCF, 0x0A, 0xE2, 0x4A, 0x13, 0xEB, 0x63, 0x1B, 0x69, 0x25, 0x42, 0x6A, 0xD0,
+	0x8F, 0x97, 0x4C, 0x7E, 0x25, 0xBF, 0x5A, 0xE5, 0xFE, 0xAB, 0x5A, 0x36, 0x1E, 0x93, 0x58, 0xE2,
+	0x26, 0x32, 0xB1, 0x57, 0x83, 0xDA, 0x3C, 0x8F, 0x93, 0x89, 0x75, 0x45, 0x25, 0x9F, 0x70, 0xE9,
+	0xDE, 0x5C, 0x13, 0xB6, 0x45, 0x45, 0xDC, 0x00, 0x81, 0x31, 0xFC, 0x06, 0x1C, 0xB5, 0xE2, 0xD7,
+	0x10, 0xED, 0x9A, 0xE3, 0xFF, 0x8C, 0xB0, 0x6D, 0x6C, 0xCA, 0x93, 0x8B, 0xCD, 0x72, 0x9B, 0x2B,
+	0xAD, 0x34, 0xA3, 0xA3, 0x6E, 0x54, 0xC5, 0xCD, 0x77, 0xB2, 0x96, 0xB8, 0xA1, 0x12, 0xEA, 0x38,
+	0xDF, 0x19, 0x15, 0x70, 0x7F, 0x5D, 0x65, 0xB9, 0x5C, 0x54, 0x10, 0x8C, 0xBF, 0x9D, 0xA7, 0x92,
+	0xE7, 0x7F, 0x3D, 0x7F, 0xFB, 0x3A, 0xCF, 0x57, 0x1F, 0xF8, 0x1F, 0x6B, 0x9E, 0xD1, 0x66, 0x11,
+	0x78, 0x27, 0x6F, 0xED, 0xAF, 0x59, 0xCE, 0x55, 0xF0, 0xCD, 0x15, 0x5D, 0xAE, 0x96, 0x74, 0x95,
+	0xA7, 0x7C, 0x96, 0x2C, 0x60, 0x3E, 0x42, 0xF6, 0x19, 0x4B, 0x04, 0x3C, 0x0D, 0xE8, 0xA6, 0x37,
+	0xDC, 0xA2, 0x95, 0x53, 0x8A, 0x0F, 0xAA, 0xE3, 0x0E, 0x9E, 0x90, 0x1D, 0xE1, 0xC4, 0x92, 0xE4,
+	0x7E, 0x8C, 0x29, 0x08, 0xD7, 0x71, 0x76, 0xF6, 0xB3, 0x0A, 0x08, 0xC6, 0x79, 0x4F, 0xC7, 0x29,
+	0xD5, 0x4F, 0x1B, 0x7A, 0xAD, 0x4A, 0xE3, 0xA6, 0x6A, 0xFD, 0x40, 0xB3, 0x3B, 0xF6, 0x7C, 0xB3,
+	0xCB, 0x48, 0x64, 0xDD, 0x02, 0xB6, 0xD0, 0x2F, 0x08, 0x0A, 0xB0, 0x59, 0x26, 0xF7, 0x7C, 0x82,
+	0x3D, 0xEF, 0x3A, 0x23, 0xAC, 0x02, 0xF3, 0xD6, 0xA5, 0x39, 0x4F, 0x89, 0xCC, 0x93, 0xD8, 0x41,
+	0x11, 0xB2, 0x2C, 0x5A, 0x06, 0x62, 0x3F, 0x1B, 0x2D, 0x94, 0xDE, 0xF8, 0x19, 0x18, 0xE6, 0x50,
+	0xCC, 0x5F, 0x58, 0x2A, 0x3D, 0x98, 0x30, 0x0A, 0xF1, 0x92, 0x6B, 0x91, 0xE7, 0x22, 0xA7, 0x1B,
+	0xE7, 0x2B, 0x69, 0x0F, 0x3E, 0xC8, 0xAB, 0x75, 0xC5, 0xF6, 0x0E, 0xA4, 0x42, 0x5D, 0xB6, 0x4B,
+	0xBB, 0x30, 0xA1, 0x6B, 0x2D, 0x52, 0x49, 0xB4, 0x19, 0x08, 0xF3, 0x66, 0x9E, 0x40, 0xD4, 0x23,
+	0x66, 0x27, 0xF2, 0x2D, 0x44, 0xE5, 0xC7, 0xA9, 0xBB, 0xF6, 0x93, 0xCA, 0x4B, 0xCF, 0x15, 0x55,
+	0x91, 0xFB, 0xDB, 0x1E, 0xA5, 0x2B, 0x5F, 0x78, 0x68, 0xB7, 0x21, 0x6C, 0x42, 0x85, 0xD9, 0x9E,
+	0xE3, 0xD4, 0x2F, 0xA5, 0xCB, 0xD6, 0xD2, 0x9D, 0x01, 0x37, 0xA0, 0x9E, 0x4B, 0x68, 0xF4, 0x44,
+	0x15, 0x64, 0x43, 0xE1, 0xCD, 0x95, 0x27, 0x65, 0xC1, 0x87, 0xA6, 0x4D, 0x53, 0x99, 0x25, 0xBC,
+	0xC3, 0x7B, 0xF2, 0x07, 0x45, 0x76, 0xB0, 0x86, 0x80, 0x8D, 0xE1, 0x80, 0x89, 0x5F, 0x53, 0x35,
+	0xF5, 0x81, 0xC5, 0x61, 0x41, 0x91, 0xE8, 0x10, 0x56, 0x6B, 0x9A, 0xEB, 0xFC, 0x18, 0xC3, 0xD0,
+	0xF9, 0x1E, 0x92, 0xC8, 0xCC, 0xA2, 0x81, 0xCA, 0xF1, 0x74, 0x06, 0x48, 0x82, 0x22, 0x83, 0x3D,
+	0xC2, 0x7C, 0xE0, 0x79, 0xA8, 0x06, 0xC4, 0x44, 0x78, 0xBD, 0xA7, 0xE3, 0x48, 0x5F, 0xB6, 0x5E,
+	0xDA, 0x05, 0xF2, 0x8A, 0xB8, 0xFF, 0x07, 0xC6, 0x7A, 0xEB, 0x88, 0x12, 0x81, 0xB6, 0xD8, 0x44,
+	0xA8, 0x36, 0xDD, 0x01, 0x9D, 0xE5, 0x1D, 0x12, 0x8F, 0xE6, 0x89, 0xE6, 0x84, 0x08, 0xE2, 0x70,
+	0x73, 0x42, 0x43, 0x4E, 0x53, 0xE0, 0xCA, 0x34, 0xC4, 0x3E, 0x85, 0x06, 0x78, 0x33, 0x0D, 0x79,
+	0x63, 0x41, 0x43, 0xD6, 0x47, 0x8D, 0xB1, 0xD4, 0x8C, 0x52, 0x99, 0x06, 0xAB, 0xA4, 0x2F, 0x80,
+	0x12, 0x72, 0x4E, 0xF1, 0x1A, 0x83, 0x82, 0x9F, 0xE2, 0x6D, 0xC5, 0x58, 0xC9, 0xBA, 0xE3, 0x72,
+	0x9D, 0xD2, 0x36, 0xA5, 0x03, 0x04, 0x43, 0xD2, 0xAF, 0x65, 0x17, 0x69, 0x55, 0x7B, 0x97, 0xD8,
+	0xB1, 0x51, 0x41, 0x70, 0x84, 0x31, 0xAA, 0x20, 0x6E, 0xD7, 0x2E, 0x57, 0xA0, 0x5D, 0x60, 0x4C,
+	0x56, 0x90, 0xFB, 0x5C, 0xB1, 0xBB, 0x78, 0x7D, 0x7A, 0x43, 0x26, 0x50, 0xE5, 0xAE, 0xE9, 0x1D,
+	0xBB, 0x7B, 0x84, 0x1B, 0x67, 0x15, 0x61, 0xB2, 0x6A, 0xB2, 0x31, 0x8D, 0x0A, 0x1F, 0xBA, 0x6E,
+	0x03, 0x90, 0xD1, 0xEA, 0x5F, 0x9E, 0x61, 0x25, 0xE0, 0x8A, 0x3F, 0x97, 0xD2, 0x56, 0xAA, 0xB2,
+	0xB3, 0x2E, 0xB1, 0x52, 0xA8, 0x2D, 0xAE, 0xAA, 0xC0, 0xBD, 0xAA, 0x28, 0x06, 0x14, 0x1F, 0x49,
+	0x67, 0x5F, 0xF8, 0x28, 0xA2, 0x25, 0x40, 0xA9, 0x78, 0xF6, 0xE8, 0x53, 0x24, 0x9F, 0xC1, 0x51,
+	0x8B, 0x31, 0xEF, 0xA1, 0xF7, 0x2D, 0x99, 0x5A, 0x2E, 0x56, 0x89, 0x45, 0x7C, 0x09, 0x96, 0xA0,
+	0xB1, 0x5E, 0x7E, 0x5E, 0xE2, 0xFA, 0x83, 0x94, 0x58, 0x00, 0xA5, 0x80, 0x93, 0xC2, 0x4B, 0xC1,
+	0x31, 0x2D, 0xCC, 0xBF, 0x93, 0x3D, 0x2F, 0xA2, 0x2C, 0x78, 0x34, 0x87, 0x42, 0x5D, 0x79, 0x1B,
+	0x93, 0xAA, 0x7C, 0xD9, 0xB4, 0x93, 0xDB, 0x3A, 0x67, 0x84, 0x07, 0x69, 0x8A, 0x42, 0x50, 0x66,
+	0xA1, 0x81, 0x5B, 0x70, 0x4A, 0x30, 0x13, 0x1E, 0x6D, 0xA9, 0x27, 0xC4, 0xA1, 0x29, 0xDE, 0xA7,
+	0x10, 0xDF, 0x6D, 0x95, 0x3C, 0x69, 0xA9, 0x36, 0x8C, 0xA9, 0x98, 0xF5, 0xF5, 0xEE, 0xFE, 0x47,
+	0xCB, 0x37, 0x8D, 0x3A, 0xA0, 0x42, 0xFF, 0xD1, 0x6A, 0x88, 0xFB, 0x82, 0x68, 0xD5, 0x48, 0x5E,
+	0x38, 0x82, 0xBB, 0xB7, 0xA3, 0xA5, 0x08, 0x57, 0x71, 0xB7, 0x05, 0xFE, 0xEA, 0x8C, 0xF0, 0x03,
+	0xB2, 0x1F, 0x1A, 0x3A, 0xC2, 0x33, 0x31, 0x6F, 0xA8, 0x89, 0x8C, 0xBA, 0xD3, 0x68, 0x86, 0x7D,
+	0xC3, 0x5C, 0xA1, 0xAE, 0xAB, 0x47, 0xDF, 0x04, 0xF0, 0x2F, 0x8B, 0x04, 0xF4, 0x62, 0x86, 0x8E,
+	0x02, 0x2E, 0x52, 0x92, 0x40, 0x98, 0xC1, 0x6E, 0x9D, 0x58, 0x08, 0xDC, 0x5F, 0x2F, 0x12, 0x95,
+	0x23, 0xA2, 0x36, 0x92, 0x86, 0xC4, 0x1F, 0x35, 0xC6, 0xDB, 0xA4, 0x42, 0x72, 0xDA, 0xD4, 0xAB,
+	0xB2, 0x28, 0xD4, 0x32, 0x54, 0x8E, 0x7E, 0x3D, 0xAF, 0x14, 0x87, 0x95, 0x30, 0x54, 0xE2, 0xD1,
+	0x8A, 0xC4, 0x56, 0x72, 0x00, 0x75, 0x6C, 0xC9, 0xF4, 0xA1, 0x1E, 0x92, 0x12, 0xE4, 0x00, 0x9A,
+	0x06, 0x35, 0xE4, 0x7B, 0xEC, 0x89, 0xD8, 0x07, 0xFB, 0x31, 0x82, 0x48, 0x48, 0xE2, 0x94, 0xDB,
+	0x62, 0x4A, 0x61, 0xF4, 0x83, 0x39, 0xDB, 0x6C, 0x36, 0x11, 0x24, 0x90, 0x9B, 0x5A, 0x3A, 0x7C,
+	0xF0, 0xCD, 0x37, 0xE2, 0x8D, 0xAD, 0x2F, 0x24, 0x13, 0x44, 0xCA, 0xD2, 0x79, 0x92, 0xE5, 0xCD,
+	0xD2, 0xD1, 0x94, 0xCA, 0xD4, 0x64, 0xD4, 0x93, 0xC9, 0xEA, 0xAF, 0x31, 0xE0, 0x1B, 0xAE, 0x80,
+	0xB8, 0xA9, 0xAF, 0xC6, 0x36, 0xC9, 0x5B, 0xC1, 0x84, 0x71, 0x52, 0x90, 0x37, 0x77, 0x6E, 0x1B,
+	0xB7, 0x3E, 0xC8, 0x93, 0x27, 0x9B, 0x75, 0x69, 0xB7, 0x79, 0x71, 0xC0, 0x1F, 0xEB, 0x95, 0x4F,
+	0xF0, 0xD4, 0x77, 0x35, 0xE4, 0x59, 0x40, 0xE6, 0x5A, 0x50, 0x52, 0xDC, 0xE4, 0xD6, 0x50, 0xF3,
+	0x33, 0x9E, 0x77, 0xD9, 0x1E, 0xAE, 0xC9, 0x03, 0x35, 0xDB, 0x2B, 0x94, 0xCE, 0xCD, 0x6C, 0xAF,
+	0xF6, 0x85, 0x93, 0xC0, 0x97, 0xDC, 0xB9, 0xF6, 0x18, 0xEE, 0x16, 0x4C, 0xDB, 0xCD, 0x5C, 0x63,
+	0x14, 0x76, 0x72, 0xB7, 0x51, 0xBA, 0x15, 0x6F, 0x0F, 0x2F, 0xA5, 0x9F, 0xB6, 0x95, 0x95, 0xF2,
+	0xFD, 0x1E, 0x4E, 0x2A, 0x6F, 0xAF, 0x24, 0xF0, 0x7E, 0x46, 0xDB, 0xE4, 0x21, 0x84, 0xAB, 0x2A,
+	0xC6, 0xFE, 0xCD, 0xE7, 0x8D, 0xE2, 0x16, 0x31, 0x34, 0xF1, 0x72, 0xEF, 0x9C, 0x45, 0xC7, 0x60,
+	0xC4, 0x06, 0x69, 0x01, 0x92, 0x56, 0x04, 0x7E, 0x7A, 0x4E, 0x19, 0x99, 0x9F, 0x9E, 0xB7, 0xB0,
+	0xE2, 0x9B, 0x17, 0xB8, 0x75, 0x12, 0xEA, 0x1C, 0x68, 0x31, 0xBB, 0x7E, 0x13, 0x96, 0xF6, 0x63,
+	0x7C, 0xF1, 0x76, 0x75, 0x29, 0x21, 0x9B, 0xBD, 0xFB, 0xEA, 0x9E, 0x04, 0xE5, 0xDD, 0xD7, 0x78,
+	0xBF, 0x5A, 0xC6, 0x1F, 0x43, 0x93, 0x74, 0x22, 0x4D, 0xA9, 0xDD, 0x8D, 0xFF, 0x67, 0x39, 0xC2,
+	0x7B, 0xE0, 0x76, 0xBB, 0x5D, 0x11, 0xA9, 0x1F, 0xE8, 0x33, 0x64, 0x7F, 0xAC, 0x79, 0x7A, 0x27,
+	0x6E, 0x85, 0x4B, 0x52, 0xCC, 0x60, 0x37, 0xBE, 0x55, 0xC7, 0xDC, 0xF0, 0xE7, 0xA3, 0x1A, 0x4D,
+	0x9D, 0x69, 0xC6, 0x0B, 0x3E, 0x8C, 0x74, 0x36, 0xFE, 0x82, 0xCD, 0x09, 0xDE, 0xF8, 0x41, 0xA9,
+	0xEF, 0x1C, 0xF8, 0x3E, 0x59, 0xE7, 0x78, 0x0A, 0x44, 0xDE, 0xFB, 0xA1, 0xED, 0x37, 0x3C, 0x17,
+	0xC6, 0x7B, 0xB2, 0xD3, 0x47, 0x10, 0x73, 0x1B, 0xC6, 0x05, 0x67, 0x8B, 0xD0, 0x82, 0x86, 0x2D,
+	0x44, 0xD0, 0x94, 0xD1, 0x56, 0x75, 0x6D, 0xA5, 0x54, 0x8D, 0xCE, 0x03, 0x6F, 0xDB, 0x18, 0xAF,
+	0xC2, 0x7D, 0x69, 0x83, 0x96, 0xA6, 0xEE, 0xD8, 0x5A, 0x9B, 0x6B, 0xF6, 0xAB, 0x57, 0xDC, 0xD1,
+	0xF2, 0x36, 0xFA, 0x9A, 0xFD, 0xEC, 0x6A, 0x2E, 0x94, 0x67, 0x38, 0x05, 0x55, 0xA6, 0xBB, 0x21,
+	0x4B, 0x36, 0x9C, 0x95, 0x6A, 0xCD, 0xAF, 0xF5, 0x41, 0xE4, 0xCD, 0x25, 0xDA, 0x27, 0x15, 0x73,
+	0x2D, 0x2E, 0x08, 0xC2, 0x30, 0x06, 0x98, 0x33, 0x6A, 0xC8, 0x2C, 0x00, 0x8D, 0x1F, 0x86, 0x2F,
+	0x17, 0x0D, 0xB4, 0xCF, 0xFA, 0xEB, 0x8B, 0x86, 0x4C, 0xBD, 0x88, 0xF0, 0x10, 0xB3, 0x1E, 0x72,
+	0xC7, 0x0F, 0x78, 0x67, 0x18, 0x97, 0x51, 0x11, 0xAD, 0x52, 0xF0, 0x2C, 0xC7, 0x5F, 0x0A, 0xC0,
+	0xF5, 0x80, 0x29, 0x2E, 0xC3, 0xF8, 0x4B, 0xB9, 0xDF, 0x27, 0xCA, 0x18, 0xDD, 0xF1, 0x14, 0x16,
+	0xBB, 0xD3, 0x57, 0xD3, 0x6D, 0xB9, 0x7E, 0xC0, 0xFC, 0x43, 0x70, 0xF2, 0x1E, 0xB3, 0xFD, 0x28,
+	0xD5, 0x38, 0x87, 0xD7, 0xA7, 0x67, 0x56, 0xD3, 0x4A, 0xCA, 0x85, 0x52, 0x48, 0x53, 0x9B, 0x7E,
+	0x51, 0x41, 0x1E, 0x0D, 0x28, 0x8E, 0xC8, 0xFD, 0xFC, 0xAE, 0xFD, 0xE3, 0x3B, 0x71, 0x4A, 0xA0,
+	0xE4, 0x6C, 0xAE, 0x70, 0x15, 0xBD, 0xF1, 0xB7, 0xE5, 0xDF, 0x96, 0xC2, 0xD0, 0xD0, 0x36, 0x7E,
+	0xD5, 0xC3, 0xBB, 0x1B, 0xFF, 0xAE, 0xE4, 0x5F, 0x6A, 0xAE, 0xFD, 0x79, 0x7A, 0xE2, 0x4A, 0xDD,
+	0xD1, 0x9E, 0x8B, 0xF8, 0x55, 0xA6, 0x8D, 0x70, 0x88, 0xFA, 0x43, 0x9E, 0xD5, 0x12, 0x77, 0x95,
+	0x7C, 0xFC, 0xF0, 0x06, 0x93, 0x65, 0xA0, 0xA1, 0xCB, 0xDC, 0x22, 0x65, 0x78, 0x22, 0x06, 0x43,
+	0xAE, 0xD4, 0xE6, 0x42, 0x56, 0xB4, 0x27, 0x43, 0x50, 0x35, 0x2B, 0x4A, 0x43, 0xF5, 0xB1, 0x81,
+	0x96, 0x96, 0xF6, 0x86, 0xED, 0xEC, 0x34, 0xD6, 0x52, 0xFD, 0xCD, 0x65, 0x22, 0x0B, 0x7B, 0xAC,
+	0x4E, 0x1F, 0xD6, 0xF7, 0xF9, 0x7E, 0x0B, 0xDF, 0x73, 0x91, 0xE4, 0x31, 0x39, 0x5F, 0xA2, 0xB9,
+	0x76, 0x3C, 0x3F, 0x12, 0xC3, 0x8C, 0x31, 0x7D, 0x78, 0x3C, 0xF4, 0x0D, 0xDF, 0x55, 0x36, 0x7C,
+	0x59, 0x1B, 0xBF, 0x94, 0xD2, 0x3D, 0x46, 0x20, 0xB3, 0xA9, 0x6A, 0xD2, 0x8D, 0xAD, 0xD1, 0x35,
+	0x53, 0x6F, 0x6B, 0xA2, 0x9C, 0xCD, 0x3B, 0x66, 0x84, 0x24, 0x80, 0x96, 0xBC, 0xA3, 0x5D, 0xE1,
+	0xE2, 0x54, 0xA9, 0x3F, 0xC5, 0x55, 0x31, 0x3A, 0x7B, 0x8A, 0x17, 0xDB, 0xE0, 0x91, 0x0E, 0x3A,
+	0x8F, 0x4A, 0x9B, 0xE5, 0x88, 0x3D, 0x3C, 0xA4, 0x83, 0x20, 0xB8, 0xB1, 0x6E, 0xB9, 0x5E, 0x4C,
+	0xA0, 0x76, 0x32, 0xA5, 0x85, 0x4D, 0xB1, 0x91, 0x1C, 0x7F, 0xFD, 0x07, 0x64, 0x03, 0x7F, 0x8E,
+	0x8F, 0xCE, 0x89, 0x88, 0xA3, 0xAD, 0x8D, 0x0C, 0x43, 0x97, 0xB1, 0x3C, 0x02, 0xB2, 0x82, 0xD7,
+	0xB8, 0x87, 0x8F, 0x07, 0x3E, 0x9A, 0x82, 0xDF, 0x93, 0x49, 0x26, 0x36, 0xA1, 0x10, 0x62, 0x79,
+	0x18, 0x56, 0x8C, 0x6A, 0xCD, 0xCA, 0x5C, 0xA5, 0x6B, 0x8F, 0xF0, 0xC6, 0x45, 0xDF, 0x7E, 0xA0,
+	0xBE, 0x91, 0x54, 0x9B, 0x47, 0x65, 0xBF, 0xD2, 0x47, 0xC7, 0x36, 0x62, 0xCF, 0x37, 0x38, 0xC2,
+	0x6A, 0x2B, 0x4A, 0xE9, 0x08, 0x2E, 0xEE, 0xFE, 0x56, 0xAB, 0x36, 0x45, 0x4D, 0xF4, 0x00, 0x24,
+	0xAF, 0x6F, 0x38, 0xF0, 0x74, 0x11, 0x65, 0x60, 0x64, 0xCA, 0xC7, 0x45, 0x0B, 0xD8, 0x38, 0x06,
+	0x4F, 0xCB, 0xE4, 0xD6, 0x9C, 0xF3, 0x85, 0x31, 0xA4, 0x02, 0x32, 0x69, 0x62, 0x9F, 0xE4, 0x22,
+	0x8A, 0xE3, 0x08, 0xB9, 0x23, 0x0E, 0xE4, 0xD0, 0xFD, 0x80, 0xF0, 0xE0, 0xD3, 0x59, 0x77, 0x4C,
+	0x3D, 0xE3, 0x29, 0x9D, 0x31, 0xE3, 0x7E, 0x1A, 0x47, 0xC0, 0x6C, 0x7C, 0x9D, 0xB1, 0xB9, 0x7F,
+	0xCD, 0x61, 0x66, 0x61, 0x37, 0x18, 0xAA, 0x92, 0x79, 0xD4, 0xB6, 0x0F, 0x2B, 0x3C, 0x43, 0x7D,
+	0x29, 0x16, 0x93, 0x59, 0x5B, 0xAC, 0x23, 0xC3, 0x97, 0xB1, 0x3E, 0x80, 0x8C, 0x27, 0x72, 0xA1,
+	0x56, 0xDB, 0x1D, 0x1F, 0x88, 0x5C, 0x07, 0x75, 0x55, 0x4F, 0xC0, 0xB8, 0x03, 0x39, 0x92, 0x19,
+	0x4B, 0xB1, 0x56, 0x80, 0x0B, 0xA8, 0x27, 0x74, 0x8A, 0x2E, 0xC9, 0x1B, 0x4D, 0x13, 0x46, 0x34,
+	0xA6, 0x18, 0x72, 0x0F, 0x18, 0x49, 0x1F, 0xAD, 0xC3, 0xA2, 0xA3, 0x0E, 0x73, 0x38, 0x27, 0x66,
+	0x58, 0xBC, 0xB0, 0xC2, 0xFC, 0xDA, 0x16, 0x3A, 0x8A, 0x0F, 0x77, 0x2B, 0x6C, 0x2D, 0xD9, 0x4A,
+	0xB8, 0x7E, 0x10, 0x8B, 0xC5, 0xC7, 0x6A, 0x47, 0x19, 0xB7, 0x64, 0x77, 0x41, 0x49, 0xED, 0x45,
+	0x86, 0x93, 0x77, 0x85, 0xE9, 0xDC, 0xCE, 0xF8, 0x1F, 0x72, 0x33, 0xC0, 0xD6, 0x98, 0xAC, 0x4A,
+	0x8E, 0x26, 0x16, 0xAF, 0x16, 0x3A, 0x29, 0xCE, 0x65, 0x5F, 0x71, 0x1B, 0x4A, 0x3E, 0xE1, 0x14,
+	0x46, 0x4F, 0xE3, 0x83, 0xEC, 0x26, 0x12, 0x20, 0xA1, 0xE3, 0xD4, 0x0C, 0x57, 0x7E, 0x05, 0x8B,
+	0x8E, 0xD5, 0xAA, 0x2E, 0xFD, 0x34, 0x11, 0x9E, 0xD0, 0x96, 0xB7, 0x80, 0x90, 0x35, 0x85, 0x81,
+	0xC5, 0xAD, 0x16, 0x1C, 0x65, 0xD5, 0x07, 0x49, 0x15, 0x86, 0xC6, 0x96, 0x5F, 0xC8, 0x9D, 0x14,
+	0xF9, 0xC7, 0x63, 0x2D, 0x6F, 0xB8, 0xE9, 0x8E, 0xC0, 0x53, 0xBA, 0x62, 0x13, 0xFE, 0x5B, 0xCA,
+	0x62, 0xD0, 0x71, 0x31, 0x01, 0x2C, 0x5A, 0xED, 0x06, 0xF1, 0x9B, 0x88, 0xCC, 0x37, 0x21, 0xBD,
+	0xA2, 0x72, 0x99, 0x16, 0xA9, 0x07, 0x28, 0xAC, 0xA0, 0x09, 0x0F, 0xB3, 0x0B, 0x75, 0x34, 0xA1,
+	0x0C, 0x8B, 0xCC, 0xC3, 0x16, 0x5A, 0x54, 0xB6, 0x6A, 0xA3, 0xB1, 0x76, 0xAB, 0x8E, 0xA5, 0x1B,
+	0x2E, 0xA8, 0x20, 0xF7, 0x5B, 0x2C, 0x97, 0x88, 0x82, 0xB2, 0xCF, 0xCE, 0xA6, 0xE2, 0x68, 0xBB,
+	0x42, 0xA7, 0x8D, 0x7D, 0x15, 0xE1, 0xD6, 0xEE, 0xD7, 0x26, 0x04, 0xF9, 0xF6, 0x6C, 0xE0, 0x36,
+	0xA6, 0x18, 0x99, 0xB8, 0x0D, 0x1C, 0xD2, 0x3B, 0x2C, 0xAA, 0x90, 0x69, 0xD9, 0xC2, 0x21, 0x99,
+	0xCA, 0xDE, 0x1C, 0x27, 0x75, 0x04, 0x52, 0x54, 0x40, 0x99, 0xAA, 0x59, 0x34, 0x86, 0x50, 0x41,
+	0x6C, 0x93, 0x2D, 0x4B, 0xD5, 0x26, 0x5F, 0x04, 0x94, 0xED, 0x52, 0x51, 0xC6, 0x26, 0xD9, 0xD3,
+	0xD8, 0xD6, 0x7B, 0x79, 0xFD, 0x75, 0x1D, 0x7B, 0xE9, 0x85, 0xE0, 0x2B, 0x68, 0x91, 0x06, 0x80,
+	0x8E, 0xBC, 0x6E, 0x0E, 0x2F, 0x7E, 0x4B, 0x3E, 0x6F, 0xB4, 0x46, 0x8D, 0xC4, 0x71, 0x7E, 0xF7,
+	0x93, 0x1C, 0x15, 0x71, 0x08, 0xF6, 0x87, 0x2D, 0x27, 0x8A, 0xCB, 0x7D, 0xC7, 0x44, 0xB9, 0x31,
+	0x5C, 0x9B, 0x1C, 0x40, 0xA4, 0x5B, 0xBA, 0xAF, 0x10, 0xCB, 0xD7, 0xA6, 0x48, 0x00, 0x72, 0xE9,
+	0x28, 0xC8, 0x82, 0x32, 0x9A, 0x0A, 0x5F, 0x56, 0xCA, 0x81, 0xFA, 0x0D, 0x1E, 0xD6, 0xD9, 0x0E,
+	0x54, 0xF2, 0x3D, 0xDD, 0x47, 0xA6, 0x1A, 0x29, 0x44, 0x82, 0x0C, 0xB9, 0xEB, 0x1F, 0x14, 0x61,
+	0x2B, 0xBA, 0x49, 0x1A, 0x85, 0x33, 0xFE, 0x1B, 0xCE, 0xFB, 0x9B, 0x43, 0x71, 0xC1, 0xD3, 0xC8,
+	0x8F, 0x99, 0xA8, 0x43, 0xBE, 0x01, 0xA0, 0x7B, 0x9C, 0x05, 0x91, 0x70, 0x03, 0x98, 0x2B, 0xEB,
+	0x84, 0xA5, 0x0C, 0x59, 0xD4, 0xDA, 0x32, 0x42, 0x79, 0x22, 0x94, 0x41, 0x6C, 0x83, 0xC0, 0x6D,
+	0xFB, 0x2D, 0x56, 0x5B, 0x11, 0x09, 0x33, 0xAB, 0xA6, 0x3C, 0xE0, 0xD1, 0x35, 0x44, 0x5D, 0x75,
+	0x9A, 0xA3, 0x37, 0x14, 0x4A, 0x8A, 0xD0, 0x42, 0xEB, 0x6A, 0xB4, 0x8A, 0xA2, 0xB6, 0x2B, 0xE1,
+	0xB2, 0x6F, 0x20, 0xAE, 0xA6, 0x43, 0x9F, 0x27, 0xE4, 0xE8, 0x48, 0x87, 0x18, 0x5B, 0xE3, 0x7C,
+	0x8C, 0xE9, 0x33, 0x06, 0x56, 0x7E, 0xCE, 0x00, 0x0C, 0xC4, 0x19, 0x47, 0x58, 0x70, 0x94, 0x27,
+	0x49, 0x9C, 0x1D, 0x89, 0x3D, 0x84, 0xE2, 0x97, 0xC9, 0x36, 0xDD, 0x9F, 0xD2, 0x55, 0x7E, 0xC5,
+	0xCE, 0xAC, 0xDD, 0xB7, 0xCF, 0x14, 0x77, 0xFD, 0x41, 0x34, 0x8C, 0x33, 0x2A, 0x4C, 0x11, 0x36,
+	0xB4, 0xC1, 0xAD, 0xBC, 0x0D, 0xF7, 0x11, 0x79, 0x5E, 0x71, 0x71, 0xDF, 0x66, 0x9A, 0x17, 0xC2,
+	0xD6, 0x24, 0xBC, 0x13, 0x33, 0xE7, 0xC7, 0x0F, 0x6F, 0x2F, 0xC0, 0xA1, 0x08, 0xE6, 0xEF, 0x7D,
+	0x20, 0x3E, 0xB3, 0xEE, 0x19, 0xFE, 0xFE, 0x1A, 0x60, 0xF9, 0x01, 0x71, 0xA0, 0xF8, 0x3A, 0x50,
+	0x9F, 0xEE, 0x38, 0xAB, 0x16, 0xC3, 0x4C, 0x6F, 0x2C, 0xB4, 0xE4, 0xDB, 0x57, 0x59, 0x72, 0xF2,
+	0xD1, 0xEE, 0xF5, 0x6E, 0x18, 0xE3, 0x32, 0x42, 0xE9, 0x8B, 0x0B, 0x65, 0x31, 0x3C, 0x6A, 0xE5,
+	0xD1, 0xB1, 0x07, 0x5A, 0x4E, 0x14, 0x9C, 0xCB, 0x77, 0xCE, 0xDC, 0x66, 0x3D, 0xCD, 0x96, 0x49,
+	0xFE, 0x78, 0x1E, 0x8B, 0x2C, 0x81, 0xC1, 0x68, 0x08, 0x92, 0xED, 0x72, 0x97, 0x45, 0x95, 0x2F,
+	0xC8, 0xDF, 0x6D, 0xBF, 0x85, 0x91, 0xCC, 0x86, 0x82, 0xFF, 0xEE, 0x67, 0x42, 0xF0, 0xEE, 0xD5,
+	0x2B, 0x45, 0x86, 0x48, 0xA1, 0x14, 0x17, 0x9A, 0x19, 0xC4, 0x14, 0xAB, 0x85, 0x14, 0x54, 0xEF,
+	0xEE, 0x9C, 0xBA, 0xAB, 0x11, 0x45, 0xC8, 0x08, 0xFE, 0x6D, 0x29, 0xAA, 0x74, 0xA7, 0x81, 0x14,
+	0xFE, 0xBF, 0x94, 0x5D, 0x7A, 0xF0, 0x51, 0x1A, 0xE8, 0xEF, 0x4E, 0xA4, 0x73, 0x4F, 0x11, 0x84,
+	0x8A, 0xC1, 0xF1, 0x17, 0x29, 0x50, 0x43, 0x64, 0x74, 0x81, 0xD7, 0xB2, 0x89, 0x3D, 0x11, 0x68,
+	0xB0, 0xE6, 0x7E, 0x26, 0xC7, 0x4F, 0x44, 0xE2, 0xF5, 0xB1, 0x80, 0x11, 0xD5, 0x3C, 0x22, 0x1C,
+	0xD0, 0x49, 0xC2, 0xAD, 0xF9, 0xF9, 0x30, 0xF5, 0x6F, 0x0A, 0x98, 0x55, 0x51, 0x2C, 0xE4, 0x34,
+	0x7D, 0xB4, 0x9E, 0x90, 0x74, 0xD3, 0x31, 0x89, 0x94, 0x30, 0x15, 0x12, 0x26, 0xDA, 0x43, 0xB1,
+	0x06, 0xBE, 0xC3, 0xA3, 0x2C, 0xD1, 0x95, 0xEB, 0x6B, 0x37, 0x6C, 0xF2, 0x28, 0x51, 0x97, 0xDB,
+	0x8D, 0x6A, 0x04, 0x93, 0xD1, 0x18, 0xC9, 0x4B, 0x91, 0x8C, 0x0C, 0xA9, 0xBC, 0x60, 0xC9, 0x94,
+	0xC0, 0x83, 0xBF, 0x8B, 0x5F, 0x0B, 0xC1, 0xEB, 0x4C, 0xFF, 0x74, 0x4F, 0x50, 0x1F, 0x8E, 0xE9,
+	0x29, 0x5D, 0x2F, 0xE9, 0xA7, 0xEC, 0x41, 0x64, 0xE4, 0x23, 0x8A, 0x8C, 0x95, 0x17, 0x7B, 0x6C,
+	0x1B, 0x38, 0x75, 0x42, 0x6F, 0xE5, 0x44, 0xD6, 0x7C, 0x90, 0x37, 0xC6, 0xFD, 0x9D, 0x3D, 0x51,
+	0x60, 0xFF, 0x74, 0x0F, 0x0D, 0x16, 0x78, 0xB5, 0x84, 0x8B, 0xFB, 0x0F, 0xF4, 0x85, 0x12, 0x6E,
+	0xF3, 0x81, 0x65, 0x75, 0xD5, 0x2B, 0xA6, 0x3A, 0x97, 0xB3, 0x6E, 0x0D, 0xE8, 0x0F, 0xD0, 0xA3,
+	0x08, 0x86, 0x9A, 0x68, 0x15, 0xCF, 0xAA, 0x96, 0xA8, 0xF0, 0xF3, 0xB3, 0xB3, 0x9F, 0xC4, 0xEB,
+	0x25, 0xE8, 0x41, 0x56, 0x03, 0x42, 0x6E, 0xA8, 0x10, 0x95, 0x72, 0xF9, 0xA5, 0x0C, 0xE4, 0xE3,
+	0xB3, 0x0F, 0x97, 0xC2, 0x3B, 0x13, 0xB5, 0xD6, 0xE0, 0x71, 0x53, 0x40, 0x5F, 0xC0, 0xA3, 0x60,
+	0xEC, 0x83, 0x48, 0x28, 0x89, 0xEB, 0xA7, 0x96, 0x78, 0x51, 0xC8, 0x24, 0x59, 0x63, 0x52, 0x57,
+	0xDD, 0x4D, 0xD5, 0x62, 0xE0, 0xEB, 0xE4, 0xE8, 0xAD, 0xFB, 0x62, 0x1F, 0x2B, 0x5F, 0xD2, 0xDE,
+	0x3C, 0xEE, 0xD3, 0x5E, 0x3D, 0x08, 0x53, 0xAF, 0x61, 0x96, 0xD3, 0xC1, 0x17, 0x5E, 0x0C, 0x2A,
+	0x8F, 0x2D, 0x95, 0x0F, 0xC2, 0x8A, 0x93, 0x5D, 0xC5, 0x19, 0xA4, 0xD2, 0xA9, 0x50, 0xBA, 0x84,
+	0x06, 0x2F, 0xE7, 0xC0, 0xD3, 0x41, 0x6D, 0x7C, 0xA2, 0x33, 0x11, 0x74, 0x2F, 0x05, 0x42, 0x14,
+	0x87, 0x9A, 0xAE, 0x64, 0x8D, 0x16, 0xD6, 0xC7, 0x30, 0xF6, 0x07, 0x66, 0x51, 0x91, 0x5B, 0x6A,
+	0x84, 0x67, 0x29, 0x8E, 0xB0, 0x0A, 0x6D, 0xCD, 0x72, 0x68, 0x0C, 0xBD, 0x2E, 0x0C, 0xB8, 0xD3,
+	0x12, 0x38, 0x3A, 0x9F, 0xE4, 0x43, 0xF7, 0x13, 0xDD, 0xEB, 0x42, 0x3A, 0xF4, 0x16, 0x54, 0xDB,
+	0x6A, 0xE8, 0x7B, 0x4D, 0x41, 0x2F, 0xF0, 0x19, 0x6F, 0xCD, 0x12, 0xBF, 0xD9, 0x8A, 0x33, 0x2C,
+	0x48, 0x84, 0x3E, 0x46, 0x53, 0xB4, 0xD1, 0xD7, 0x95, 0xE2, 0xEE, 0x25, 0x3A, 0x38, 0x78, 0x8B,
+	0xE1, 0xDE, 0xD5, 0x2D, 0x91, 0x7A, 0x8B, 0xA7, 0x38, 0x05, 0x09, 0xF8, 0x05, 0x71, 0x3B, 0xB8,
+	0xEF, 0xAF, 0x21, 0x7F, 0x9F, 0x56, 0xC3, 0x55, 0x17, 0xDA, 0xC8, 0x04, 0x9E, 0xB8, 0x09, 0x0C,
+	0xF5, 0x41, 0x3C, 0xE2, 0x4D, 0x1D, 0xC0, 0x6C, 0x6B, 0x85, 0xB0, 0x65, 0xE1, 0x79, 0x76, 0xB5,
+	0xFA, 0xC4, 0xC4, 0xD1, 0x6D, 0xA4, 0xE7, 0xB9, 0x9F, 0x66, 0x56, 0xA3, 0xB8, 0xE0, 0x14, 0x37,
+	0x86, 0x50, 0xE3, 0x16, 0xBB, 0x92, 0x50, 0x90, 0xBC, 0x0D, 0x10, 0xCD, 0x4F, 0xAD, 0x83, 0xEA,
+	0x7B, 0xF3, 0xA6, 0xB1, 0x2B, 0x4D, 0x04, 0x9D, 0x21, 0x78, 0x37, 0xB5, 0x56, 0x4D, 0x8A, 0x01,
+	0x1B, 0xF2, 0x17, 0xC2, 0x1B, 0x85, 0xA1, 0x01, 0x91, 0x25, 0xAA, 0xE1, 0x53, 0x91, 0xEC, 0x23,
+	0x3C, 0x08, 0xBE, 0x37, 0x28, 0x55, 0xD7, 0xA3, 0xE2, 0x7A, 0x35, 0x54, 0x47, 0xDC, 0xB2, 0x6E,
+	0xB2, 0x2A, 0xAE, 0xC8, 0xC1, 0x96, 0xE4, 0xBC, 0x36, 0x5B, 0x07, 0x57, 0x95, 0x7A, 0xE2, 0x36,
+	0x56, 0xD2, 0xD1, 0x0D, 0x18, 0xE2, 0x8E, 0xD6, 0x6D, 0xEF, 0x46, 0xEA, 0x1D, 0xF4, 0xFD, 0x4A,
+	0x4F, 0x2E, 0x74, 0x4B, 0x5A, 0x67, 0x14, 0xB8, 0xE2, 0x1A, 0x35, 0xB9, 0xFF, 0xE4, 0x53, 0x79,
+	0xBB, 0x0C, 0x5D, 0xAB, 0x4C, 0xCB, 0x01, 0xB7, 0xB9, 0x15, 0x85, 0x85, 0x18, 0x07, 0x3B, 0x26,
+	0xDD, 0x28, 0x2C, 0xCE, 0xB0, 0xE3, 0xB9, 0x18, 0xB1, 0x98, 0x2C, 0xD6, 0x2E, 0xDE, 0x83, 0x6D,
+	0x89, 0x3F, 0xE0, 0xAA, 0x32, 0x32, 0xD5, 0x85, 0x7A, 0x7A, 0xF3, 0x60, 0x60, 0x07, 0x31, 0xFE,
+	0x2A, 0xF8, 0xAF, 0xF4, 0xFD, 0x7B, 0x86, 0x97, 0x33, 0xD9, 0x73, 0x75, 0xA1, 0x8F, 0x7A, 0xFB,
+	0x5A, 0x14, 0x88, 0xD7, 0x84, 0x63, 0x46, 0x6F, 0x81, 0x06, 0x45, 0x67, 0xC3, 0xA3, 0x35, 0x82,
+	0x99, 0x9D, 0x05, 0x7E, 0xCC, 0x2D, 0x98, 0xD7, 0x52, 0xFA, 0x8A, 0x17, 0x04, 0xE1, 0x84, 0xEE,
+	0xBA, 0xAB, 0x5B, 0xD0, 0xF9, 0x65, 0xD6, 0xCE, 0xF0, 0x7E, 0xB4, 0x86, 0xDE, 0x42, 0x7D, 0x3F,
+	0x3B, 0xC6, 0x63, 0xDE, 0x37, 0xC7, 0x65, 0x5A, 0x5A, 0x6C, 0x7E, 0x5C, 0xC1, 0xFF, 0x50, 0xE2,
+	0xD2, 0x12, 0x3A, 0x76, 0xEE, 0xDF, 0x5A, 0xD7, 0x3A, 0x27, 0x6C, 0x5D, 0x93, 0x04, 0xE8, 0xCD,
+	0xDE, 0xAE, 0x16, 0x76, 0xB5, 0xE7, 0x11, 0xAF, 0xF0, 0x71, 0x9D, 0x56, 0xDD, 0xAD, 0x40, 0xAE,
+	0x03, 0x90, 0x8C, 0x6B, 0x80, 0xAE, 0xDC, 0x16, 0xF3, 0x5A, 0xAC, 0xD7, 0x82, 0x51, 0xFC, 0x44,
+	0x43, 0xBB, 0xC0, 0xA1, 0x5D, 0x00, 0x13, 0x56, 0x4D, 0x90, 0xBC, 0x65, 0xA8, 0x0A, 0x4E, 0x4F,
+	0xD8, 0x75, 0x79, 0x00, 0x51, 0x02, 0x9F, 0xDD, 0xF2, 0xCC, 0xC2, 0x7E, 0x41, 0x47, 0xF0, 0x30,
+	0xEE, 0x2D, 0x6E, 0xA2, 0xA2, 0xB1, 0x04, 0x16, 0xD1, 0x2F, 0xF6, 0x5E, 0xD0, 0xD9, 0x5E, 0x5C,
+	0xC8, 0x09, 0x43, 0x5C, 0xF3, 0x9B, 0xA1, 0x3C, 0xC7, 0x45, 0x69, 0xBF, 0xDF, 0xA7, 0x52, 0x64,
+	0xEF, 0x33, 0xFC, 0xE5, 0x60, 0x2C, 0xA5, 0x9F, 0xBC, 0x6E, 0xD4, 0x1E, 0x6B, 0x3D, 0x61, 0xD5,
+	0xC3, 0xF0, 0xB8, 0xD0, 0x07, 0x48, 0x6D, 0xCC, 0xDE, 0x58, 0x78, 0x3B, 0x83, 0xF8, 0x22, 0x3E,
+	0x27, 0xB8, 0xB7, 0xD4, 0x72, 0xF1, 0xA0, 0x2B, 0x88, 0x6A, 0x97, 0x06, 0x6B, 0xC2, 0x67, 0xD1,
+	0x12, 0x0F, 0xD7, 0x58, 0xF4, 0x15, 0x17, 0x3C, 0x2F, 0x13, 0xBC, 0xE3, 0xC1, 0x8E, 0xF1, 0x48,
+	0x03, 0x96, 0xA1, 0x8B, 0x02, 0x65, 0x37, 0x12, 0x4A, 0xAA, 0xCA, 0x45, 0x9F, 0x44, 0x3B, 0xEC,
+	0x07, 0xE6, 0x5E, 0xAD, 0x27, 0xF8, 0xBB, 0xCE, 0x78, 0x52, 0x9B, 0x30, 0x18, 0xD7, 0x26, 0x11,
+	0x33, 0xEC, 0x58, 0x5C, 0x18, 0x71, 0x87, 0xB7, 0x1B, 0x14, 0x39, 0xD8, 0x55, 0x2E, 0xF2, 0x76,
+	0x57, 0x68, 0xB5, 0xC0, 0xF8, 0xAF, 0xB9, 0x34, 0x33, 0x2D, 0x39, 0xE1, 0x7C, 0x1A, 0x2B, 0xF3,
+	0x95, 0xCD, 0x21, 0x26, 0x17, 0x49, 0x3D, 0xED, 0xD2, 0xA9, 0x5A, 0x04, 0x23, 0xC5, 0xF4, 0x5E,
+	0x84, 0x47, 0x88, 0xCD, 0xC3, 0xC9, 0xDA, 0xB6, 0x46, 0x50, 0x1B, 0xD0, 0xB5, 0xC4, 0x6D, 0xB6,
+	0x78, 0xFA, 0x32, 0xF7, 0xE3, 0xF3, 0x0C, 0xC7, 0x2B, 0xFD, 0x9C, 0x15, 0x8C, 0xBC, 0x97, 0x03,
+	0xF9, 0x80, 0x52, 0x5F, 0xD1, 0xCE, 0x62, 0x1B, 0x3B, 0xBA, 0x80, 0xF7, 0xF1, 0x31, 0xEB, 0x82,
+	0x84, 0x81, 0x5B, 0x3F, 0x04, 0x78, 0xF4, 0x77, 0x82, 0xBF, 0x8E, 0xAE, 0x0F, 0x74, 0x22, 0x47,
+	0x4E, 0xB4, 0xF4, 0x92, 0xF8, 0x41, 0x91, 0x05, 0x6D, 0x6C, 0xDB, 0x06, 0x62, 0x0A, 0x13, 0xB9,
+	0xC2, 0xA9, 0xA6, 0xB0, 0x7C, 0x99, 0xB8, 0x1B, 0x53, 0xB7, 0xD0, 0xC4, 0xBA, 0xBA, 0x0A, 0x42,
+	0x06, 0xAF, 0x82, 0x8E, 0x95, 0x23, 0x7B, 0x61, 0xD8, 0xD5, 0x40, 0xC5, 0x6A, 0xC0, 0x70, 0xD8,
+	0xC9, 0xF3, 0x40, 0x78, 0x63, 0x43, 0x52, 0xAE, 0x55, 0xBB, 0x3D, 0xE2, 0x72, 0x0D, 0x6D, 0x01,
+	0xFF, 0x96, 0x23, 0xFB, 0xD8, 0x83, 0xCA, 0x1C, 0x2C, 0x94, 0x13, 0x5E, 0xE0, 0x9C, 0x08, 0xB3,
+	0xD5, 0xD3, 0x92, 0xF1, 0x57, 0xBB, 0xED, 0x9B, 0xAC, 0x38, 0xBC, 0x27, 0x7B, 0x83, 0x77, 0x58,
+	0xDC, 0x5A, 0x11, 0x1E, 0xA1, 0xC8, 0x8D, 0x39, 0x1B, 0xA7, 0xDA, 0x66, 0x55, 0x5F, 0x4A, 0xF3,
+	0x89, 0xC6, 0x85, 0x57, 0x37, 0x34, 0x3C, 0x4F, 0x6B, 0xD7, 0x07, 0x3C, 0xE7, 0x75, 0xEB, 0x08,
+	0xF1, 0x83, 0x28, 0xF8, 0x56, 0x91, 0x05, 0x73, 0x26, 0x1E, 0xD3, 0x81, 0x37, 0x9B, 0x1D, 0x57,
+	0x53, 0xF8, 0x16, 0x95, 0xDE, 0xAA, 0xA3, 0x86, 0x22, 0x58, 0x34, 0x78, 0x9B, 0xDE, 0x9E, 0x08,
+	0xC8, 0x61, 0x2E, 0x30, 0xF4, 0x89, 0xAE, 0x51, 0x31, 0x74, 0x4A, 0xF5, 0x90, 0x64, 0x54, 0xA9,
+	0xE0, 0xAF, 0xD2, 0x7E, 0x7B, 0x1B, 0x6A, 0xBB, 0x32, 0x93, 0xC3, 0x2B, 0x95, 0x1C, 0x46, 0x26,
+	0x6A, 0xE5, 0x85, 0x5E, 0x5F, 0x91, 0x93, 0x70, 0x67, 0x09, 0x19, 0x03, 0x8E, 0x6A, 0x6D, 0xDF,
+	0x78, 0x59, 0x51, 0x6F, 0x1A, 0x4D, 0xA9, 0x1F, 0xCA, 0xBD, 0xDE, 0x34, 0x69, 0x72, 0x66, 0x93,
+	0xE4, 0x18, 0xAE, 0xC5, 0x0A, 0xAF, 0x9A, 0x40, 0x33, 0xAD, 0x89, 0x5C, 0x89, 0xE4, 0xF5, 0x36,
+	0xEB, 0xA3, 0xE9, 0x99, 0x1B, 0x03, 0xB2, 0xD9, 0x15, 0xFD, 0x16, 0x6F, 0xB3, 0xA9, 0x90, 0xFC,
+	0xA0, 0x2E, 0x55, 0x78, 0xB7, 0xA4, 0x6B, 0x0E, 0xD6, 0x2B, 0xBA, 0xCC, 0x3D, 0xF6, 0x27, 0x1C,
+	0xEC, 0x1A, 0x2E, 0xEC, 0x4C, 0xFC, 0x94, 0x8A, 0x70, 0x6E, 0xE2, 0x9B, 0xC6, 0x82, 0xDC, 0x09,
+	0x34, 0x16, 0xD4, 0x24, 0x6B, 0xC9, 0x7A, 0xD2, 0x6E, 0xFC, 0x27, 0x0C, 0x85, 0x20, 0x00, 0x13,
+	0xB3, 0xB9, 0x45, 0x43, 0xB4, 0x53, 0x40, 0x69, 0xCC, 0x04, 0xED, 0xFA, 0x44, 0x4C, 0x39, 0x34,
+	0x9A, 0xE1, 0xE5, 0x1C, 0x75, 0xC6, 0xE2, 0x88, 0x95, 0xDA, 0xE9, 0x03, 0x58, 0x58, 0x1F, 0x1A,
+	0xD1, 0x21, 0x27, 0x34, 0x26, 0x82, 0x1E, 0x55, 0xA9, 0xA2, 0x11, 0x81, 0xB8, 0x45, 0x13, 0xD7,
+	0x0E, 0x08, 0x96, 0x96, 0x4F, 0x39, 0x04, 0xE5, 0x05, 0x8C, 0xD9, 0xAD, 0x9C, 0xB7, 0xD0, 0x80,
+	0x11, 0x8E, 0x48, 0x3D, 0x38, 0xB6, 0x8B, 0x5B, 0xBE, 0x45, 0xDF, 0x15, 0x90, 0xEB, 0x16, 0xFB,
+	0xBD, 0x04, 0x60, 0x42, 0x57, 0x17, 0xD4, 0x5A, 0xB0, 0x6B, 0xBC, 0xCE, 0x85, 0xEC, 0x57, 0xD5,
+	0x80, 0x88, 0xA1, 0xBC, 0x2A, 0x75, 0x04, 0x04, 0xD5, 0x05, 0xC5, 0xF9, 0x1D, 0xF4, 0x03, 0x2F,
+	0xF6, 0x33, 0x6C, 0x08, 0xD0, 0xF8, 0x04, 0x99, 0xF0, 0x3D, 0xFB, 0xBD, 0x2C, 0x7B, 0x13, 0xE0,
+	0xFC, 0x04, 0xF9, 0x08, 0xFE, 0xC3, 0x64, 0x2E, 0x85, 0x6F, 0xDB, 0xD4, 0xAE, 0xED, 0x83, 0xE4,
+	0x43, 0xA9, 0xD3, 0x74, 0x78, 0xD9, 0xB1, 0x7B, 0xCD, 0xC2, 0x24, 0x3C, 0x94, 0xFD, 0x0C, 0x99,
+	0xF9, 0x29, 0xED, 0xA6, 0x66, 0x6A, 0x0B, 0x73, 0x4B, 0x9C, 0xF8, 0x3B, 0x29, 0x56, 0x72, 0x9A,
+	0xC6, 0x35, 0x39, 0x10, 0xD4, 0x89, 0xCD, 0x35, 0xE8, 0x2B, 0x62, 0xBD, 0x1F, 0xE8, 0x03, 0x4C,
+	0xD3, 0x5B, 0xBC, 0xD6, 0x9C, 0x5F, 0xEA, 0x0A, 0xD6, 0x15, 0x84, 0x14, 0xF7, 0x73, 0x88, 0xDA,
+	0x20, 0xA4, 0xF5, 0xDA, 0x61, 0x34, 0x8B, 0xD0, 0xA1, 0x5E, 0x80, 0xA5, 0xCE, 0xF9, 0xB1, 0x51,
+	0x92, 0x71, 0x80, 0x1D, 0x16, 0x25, 0x0F, 0x68, 0x56, 0x1A, 0xE6, 0xB2, 0x9A, 0xDE, 0x55, 0x8B,
+	0x84, 0x9E, 0x61, 0x72, 0x07, 0x5D, 0x79, 0xBD, 0xF3, 0x1A, 0xB3, 0xD3, 0x18, 0x3E, 0xD3, 0xBD,
+	0xF8, 0xF8, 0x6C, 0x6E, 0xCB, 0xD6, 0xA9, 0x64, 0x55, 0xA3, 0x28, 0xA8, 0xD9, 0xDE, 0x2D, 0xEB,
+	0xC8, 0x6F, 0x22, 0xA3, 0xA3, 0xEF, 0xB7, 0x7E, 0xB9, 0xCC, 0xCB, 0x37, 0x2F, 0x8B, 0xF3, 0xC6,
+	0xD2, 0x9B, 0xB6, 0x1A, 0x61, 0x74, 0xDD, 0x10, 0x7B, 0x27, 0xA9, 0xA6, 0xD8, 0xD8, 0x25, 0xAE,
+	0x57, 0x95, 0x60, 0xB1, 0xB8, 0x61, 0xD4, 0x30, 0x53, 0x57, 0x7F, 0x2F, 0xFF, 0xD4, 0x0B, 0x54,
+	0x47, 0x66, 0x1F, 0x9E, 0x5E, 0x41, 0x98, 0xAC, 0x99, 0xFA, 0xF0, 0x49, 0x46, 0xC9, 0xAC, 0x54,
+	0x1B, 0xAA, 0x28, 0xCE, 0x3C, 0x1C, 0x42, 0xD4, 0x2F, 0x47, 0xD6, 0x08, 0xA9, 0xC5, 0x45, 0xF1,
+	0x78, 0xA3, 0x2D, 0x9D, 0xD8, 0x52, 0x14, 0x48, 0x1D, 0x97, 0x6F, 0x83, 0x79, 0x14, 0x87, 0x29,
+	0x8C, 0xA6, 0x96, 0x62, 0x79, 0x2A, 0x44, 0xBE, 0x17, 0x5B, 0xD9, 0xCE, 0xB0, 0x96, 0x6A, 0x82,
+	0x8B, 0x7A, 0x54, 0xD0, 0x54, 0x7B, 0xC2, 0x8C, 0xEB, 0x9B, 0x71, 0x39, 0x57, 0x54, 0xA3, 0xBD,
+	0x32, 0xA2, 0x5E, 0x01, 0x4E, 0xFD, 0x72, 0xC2, 0x8A, 0xC9, 0xAC, 0x97, 0x19, 0xCB, 0xE8, 0x9F,
+	0x71, 0x28, 0xEA, 0x97, 0x12, 0x7D, 0x8D, 0x62, 0x7F, 0x08, 0xFC, 0x11, 0xF5, 0xAB, 0x8B, 0xC0,
+	0xA5, 0x2B, 0x7D, 0xAA, 0xBF, 0xDE, 0x80, 0x3B, 0x0A, 0xCC, 0x9B, 0xA6, 0xBF, 0x29, 0xBE, 0x69,
+	0x71, 0xA3, 0x46, 0x7B, 0xEE, 0x34, 0x37, 0x7F, 0xFF, 0x41, 0x65, 0xC3, 0x0A, 0x50, 0x94, 0x4C,
+	0x53, 0x60, 0xBE, 0x24, 0x55, 0xB9, 0xFF, 0xA7, 0x22, 0x30, 0xE5, 0xAC, 0x21, 0xD7, 0x24, 0x28,
+	0x37, 0x37, 0xB5, 0x7D, 0x25, 0x29, 0xE2, 0x47, 0xAC, 0xEB, 0xA9, 0x78, 0xF5, 0x6A, 0x3F, 0x19,
+	0x7A, 0x4E, 0x2F, 0x8D, 0xB0, 0xF1, 0x8B, 0x11, 0xDA, 0xBC, 0xC0, 0x40, 0x17, 0xDB, 0xD9, 0x8C,
+	0xFB, 0x96, 0x2A, 0xF2, 0xD9, 0x3C, 0x20, 0x67, 0x97, 0x0B, 0x7D, 0x3C, 0x65, 0xF4, 0x60, 0x6E,
+	0x86, 0x83, 0x0A, 0x78, 0x75, 0x73, 0x9A, 0x81, 0xF1, 0x3A, 0x90, 0x4B, 0x31, 0x7F, 0x33, 0x2E,
+	0x9D, 0x9F, 0xC4, 0xC9, 0x44, 0x5A, 0x38, 0x71, 0xEC, 0xB1, 0x40, 0x8C, 0x46, 0x4B, 0xAE, 0x45,
+	0x20, 0xC0, 0x23, 0xBA, 0xBD, 0xAF, 0x51, 0x24, 0xD6, 0xD7, 0x29, 0x0A, 0xCB, 0xC7, 0x0F, 0x6F,
+	0x4B, 0xB7, 0x0D, 0xC0, 0x77, 0x0B, 0x81, 0x16, 0xE9, 0x86, 0x1D, 0x76, 0x82, 0x7E, 0x73, 0xC0,
+	0x57, 0xFB, 0xB4, 0x01, 0x20, 0x7E, 0x53, 0xBF, 0x74, 0x81, 0x96, 0x60, 0x0A, 0x1E, 0x7A, 0x1B,
+	0x2D, 0xC0, 0x9F, 0xEE, 0x0B, 0x23, 0x0C, 0x26, 0xF6, 0xCD, 0xC5, 0x3B, 0x69, 0x5B, 0xD5, 0x89,
+	0x70, 0xA7, 0xE5, 0x3A, 0xCD, 0x07, 0x3B, 0xBF, 0xCD, 0xFF, 0x6E, 0xA4, 0x9E, 0x71, 0x3D, 0x41,
+	0x9E, 0xCD, 0x14, 0xCA, 0xEA, 0x13, 0x42, 0xDA, 0x5F, 0x87, 0x7E, 0x4D, 0xB9, 0xA2, 0xA9, 0xD5,
+	0x58, 0x11, 0xFB, 0x06, 0xDC, 0x03, 0x1F, 0xA8, 0xE8, 0x1B, 0x10, 0xD9, 0x2C, 0x2B, 0x9C, 0x18,
+	0xBE, 0x4D, 0x8D, 0xD3, 0xB0, 0x37, 0xF7, 0xF7, 0xBD, 0x78, 0x77, 0x2E, 0x99, 0xFC, 0x96, 0xD6,
+	0x44, 0xF5, 0x56, 0xBF, 0xFB, 0x83, 0x8D, 0x03, 0x0D, 0x75, 0x7B, 0x6D, 0xEA, 0xCE, 0x70, 0xBD,
+	0x91, 0x99, 0x3E, 0xAB, 0xF4, 0xB2, 0xC5, 0x3A, 0xC5, 0xF1, 0x2C, 0x10, 0x5B, 0xF9, 0x9B, 0x19,
+	0x4F, 0x8F, 0xB0, 0xC3, 0xF4, 0x0B, 0xBD, 0xF9, 0x22, 0x3E, 0xFD, 0x7F, 0xCF, 0x1F, 0x1D, 0x92,
+	0x9D, 0xA1, 0x00, 0x00,
+};
+
+static const char INDEX_PAGE_ETAG[] PROGMEM = "\"9b21091455510e06\"";
+static const char INDEX_PAGE_MIME[] PROGMEM = "text/html";
+
+const STM32WebAsset INDEX_PAGE = { INDEX_PAGE_GZ, sizeof(INDEX_PAGE_GZ), INDEX_PAGE_ETAG, INDEX_PAGE_MIME };
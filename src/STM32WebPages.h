@@ -11,11 +11,17 @@
 
 #include <Arduino.h>
 
-extern const char LOGIN_HTML_A[] PROGMEM;
-extern const char LOGIN_HTML_B[] PROGMEM;
+/* Pre-compressed page, see extras/web/embed_pages.py */
+struct STM32WebAsset
+{
+	const uint8_t* gz;
+	size_t gzLen;
+	const char* etag;
+	const char* mime;
+};
 
-extern const char INDEX_HTML_A[] PROGMEM;
-extern const char INDEX_HTML_B[] PROGMEM;
+extern const STM32WebAsset LOGIN_PAGE;
+extern const STM32WebAsset INDEX_PAGE;
 
 
 #endif	/* STM32_FOTA_WEB_PAGES_H */
\ No newline at end of file